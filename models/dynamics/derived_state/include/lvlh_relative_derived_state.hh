@@ -102,6 +102,13 @@ public:
      */
     bool use_theta_dot_correction{}; //!< trick_units(--)
 
+protected:
+    /**
+     * Rectilinear relative state computed for a batched curvilinear update,
+     * converted by complete_update().
+     */
+    RefFrameState rect_rel_state; //!< trick_io(**)
+
     // Methods
 
 public:
@@ -117,13 +124,50 @@ public:
     // update(): Compute the LVLH relative state
     void update() override;
 
+    // get_relative_state_request(): Describe the frame-to-frame relative
+    // state that update() computes
+    bool get_relative_state_request(RefFrame::RelativeStateRequest & request) override;
+
+    // complete_update(): Convert the frame-to-frame relative state
+    void complete_update() override;
+
     // Convert between types of LVLH coordinates
     void convert_rect_to_circ(const RefFrameState & rect_rel_state);
     void convert_circ_to_rect(const RefFrameState & circ_rel_state);
 
+    // Convert between types of LVLH coordinates for many subjects in the
+    // same target LVLH frame
+    static void convert_rect_to_circ_batch(const RefFrame & target_lvlh_frame,
+                                           bool theta_dot_correction,
+                                           unsigned int num_states,
+                                           const RefFrameState * rect_rel_states,
+                                           RefFrameState * circ_rel_states);
+    static void convert_circ_to_rect_batch(const RefFrame & target_lvlh_frame,
+                                           bool theta_dot_correction,
+                                           unsigned int num_states,
+                                           const RefFrameState * circ_rel_states,
+                                           RefFrameState * rect_rel_states);
+
 private:
+    // Reference radius of the target LVLH frame and its rate
+    static double get_reference_radius(const RefFrame & target_lvlh_frame, const char * state_name);
+    static double get_reference_radial_rate(const RefFrame & target_lvlh_frame, double reference_radius);
+
+    // Convert between types of LVLH coordinates given the reference radius
+    static void rect_to_circ(const RefFrameState & rect_rel_state,
+                             double reference_radius,
+                             double reference_rdot,
+                             bool theta_dot_correction,
+                             RefFrameState & circ_rel_state);
+    static void circ_to_rect(const RefFrameState & circ_rel_state,
+                             double reference_radius,
+                             double reference_rdot,
+                             bool theta_dot_correction,
+                             RefFrameState & rect_rel_state);
+
     // Method to correct omega for variable phase angle
-    void do_theta_dot_correction(double omega[3], const RefFrameState & state, const double r, bool c2r);
+    static void do_theta_dot_correction(
+        double omega[3], const RefFrameState & state, const double r, const double rdot, bool c2r);
 };
 
 } // namespace jeod
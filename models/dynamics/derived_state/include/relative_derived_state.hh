@@ -70,6 +70,7 @@ Library dependencies:
 #include "dynamics/dyn_body/include/class_declarations.hh"
 #include "dynamics/dyn_manager/include/class_declarations.hh"
 #include "utils/ref_frames/include/class_declarations.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
 #include "utils/ref_frames/include/ref_frame_state.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
@@ -205,10 +206,23 @@ public:
     // update(): Compute the relative state
     void update() override;
 
+    // get_relative_state_request(): Describe the frame-to-frame relative
+    // state that update() computes
+    virtual bool get_relative_state_request(RefFrame::RelativeStateRequest & request);
+
+    // complete_update(): Finish an update whose frame-to-frame relative state
+    // was computed as described by get_relative_state_request
+    virtual void complete_update();
+
     /* set_activation_flag(): Set the activation_flag to true or false
      * /param raf  RelativeDerivedState activation flag for RelKin manager
      */
     void set_activation_flag(bool raf);
+
+protected:
+    // get_frame_to_frame_request(): Describe the subject-target relative
+    // state per the direction sense
+    bool get_frame_to_frame_request(RefFrame::RelativeStateRequest & request);
 };
 
 } // namespace jeod
@@ -31,6 +31,7 @@ Library dependencies:
 
 // System includes
 #include <cstddef>
+#include <typeinfo>
 
 // JEOD includes
 #include "dynamics/dyn_body/include/dyn_body.hh"
@@ -108,22 +109,161 @@ void LvlhRelativeDerivedState::update()
     }
 }
 
+/**
+ * Describe the relative state that update() computes, the state of the
+ * subject frame in the target LVLH frame. As in the base class, only an
+ * object whose dynamic type is exactly LvlhRelativeDerivedState does so.
+ * \param[out] request The frames and the destination of their relative state
+ * @return False for the LVLH types update() does not support and for
+ *         derived classes
+ */
+bool LvlhRelativeDerivedState::get_relative_state_request(RefFrame::RelativeStateRequest & request)
+{
+    if(typeid(*this) != typeid(LvlhRelativeDerivedState))
+    {
+        return false;
+    }
+
+    if(lvlh_type == LvlhType::Rectilinear)
+    {
+        request.rel_state = &rel_state;
+    }
+    else if(lvlh_type == LvlhType::CircularCurvilinear)
+    {
+        request.rel_state = &rect_rel_state;
+    }
+    else
+    {
+        return false;
+    }
+
+    request.frame = subject_frame;
+    request.wrt_frame = target_frame;
+    return true;
+}
+
+/**
+ * Finish an update whose relative state was computed as described by
+ * get_relative_state_request, converting it to curvilinear coordinates
+ * if need be.
+ */
+void LvlhRelativeDerivedState::complete_update()
+{
+    if(lvlh_type == LvlhType::CircularCurvilinear)
+    {
+        convert_rect_to_circ(rect_rel_state);
+    }
+}
+
 /**
  * Convert from rectilinear LVLH coordinates to circular curvilinear.
  * \param[in] rect_rel_state Source state
  */
 void LvlhRelativeDerivedState::convert_rect_to_circ(const RefFrameState & rect_rel_state)
 {
-    // Locally store values to reduce lookups
-    double rect_position[3];
-    double rect_velocity[3];
-    Vector3::copy(rect_rel_state.trans.position, rect_position);
-    Vector3::copy(rect_rel_state.trans.velocity, rect_velocity);
+    double reference_radius = get_reference_radius(*target_frame, name.c_str());
+    if(reference_radius <= 0.0)
+    {
+        // Not reached
+        return;
+    }
+
+    rect_to_circ(rect_rel_state,
+                 reference_radius,
+                 get_reference_radial_rate(*target_frame, reference_radius),
+                 use_theta_dot_correction,
+                 rel_state);
+}
+
+/**
+ * Convert from circular curvilinear LVLH coordinates to rectilinear.
+ * \param[in] curvi_rel_state Source state
+ */
+void LvlhRelativeDerivedState::convert_circ_to_rect(const RefFrameState & curvi_rel_state)
+{
+    double reference_radius = get_reference_radius(*target_frame, name.c_str());
+    if(reference_radius <= 0.0)
+    {
+        // Not reached
+        return;
+    }
+
+    circ_to_rect(curvi_rel_state,
+                 reference_radius,
+                 get_reference_radial_rate(*target_frame, reference_radius),
+                 use_theta_dot_correction,
+                 rel_state);
+}
+
+/**
+ * Convert the rectilinear states of many subjects in the same target LVLH
+ * frame to circular curvilinear.
+ * \param[in] target_lvlh_frame Target LVLH frame, a child of the planet's inertial frame
+ * \param[in] theta_dot_correction Correct for the changing phase angles?
+ * \param[in] num_states Number of states
+ * \param[in] rect_rel_states Source states
+ * \param[out] circ_rel_states Converted states
+ */
+void LvlhRelativeDerivedState::convert_rect_to_circ_batch(const RefFrame & target_lvlh_frame,
+                                                          bool theta_dot_correction,
+                                                          unsigned int num_states,
+                                                          const RefFrameState * rect_rel_states,
+                                                          RefFrameState * circ_rel_states)
+{
+    double reference_radius = get_reference_radius(target_lvlh_frame, target_lvlh_frame.get_name().c_str());
+    if(reference_radius <= 0.0)
+    {
+        // Not reached
+        return;
+    }
+    double reference_rdot = get_reference_radial_rate(target_lvlh_frame, reference_radius);
+
+    for(unsigned int ii = 0; ii < num_states; ++ii)
+    {
+        rect_to_circ(rect_rel_states[ii], reference_radius, reference_rdot, theta_dot_correction, circ_rel_states[ii]);
+    }
+}
+
+/**
+ * Convert the circular curvilinear states of many subjects in the same
+ * target LVLH frame to rectilinear.
+ * \param[in] target_lvlh_frame Target LVLH frame, a child of the planet's inertial frame
+ * \param[in] theta_dot_correction Correct for the changing phase angles?
+ * \param[in] num_states Number of states
+ * \param[in] circ_rel_states Source states
+ * \param[out] rect_rel_states Converted states
+ */
+void LvlhRelativeDerivedState::convert_circ_to_rect_batch(const RefFrame & target_lvlh_frame,
+                                                          bool theta_dot_correction,
+                                                          unsigned int num_states,
+                                                          const RefFrameState * circ_rel_states,
+                                                          RefFrameState * rect_rel_states)
+{
+    double reference_radius = get_reference_radius(target_lvlh_frame, target_lvlh_frame.get_name().c_str());
+    if(reference_radius <= 0.0)
+    {
+        // Not reached
+        return;
+    }
+    double reference_rdot = get_reference_radial_rate(target_lvlh_frame, reference_radius);
+
+    for(unsigned int ii = 0; ii < num_states; ++ii)
+    {
+        circ_to_rect(circ_rel_states[ii], reference_radius, reference_rdot, theta_dot_correction, rect_rel_states[ii]);
+    }
+}
 
-    // Calculate the radial distance of the target LVLH frame from the origin
-    // of the planet used to define that LVLH frame. Note that <planet>.inertial
-    // is the direct parent of the target LVLH frame by assignation.
-    double reference_radius = Vector3::vmag(target_frame->state.trans.position);
+/**
+ * Calculate the radial distance of the target LVLH frame from the origin of
+ * the planet used to define that LVLH frame. Note that <planet>.inertial is
+ * the direct parent of the target LVLH frame by assignation.
+ * \param[in] target_lvlh_frame Target LVLH frame
+ * \param[in] state_name Name used in the error message
+ * \return Reference radius, or zero if it is invalid\n Units: M
+ */
+double LvlhRelativeDerivedState::get_reference_radius(const RefFrame & target_lvlh_frame, const char * state_name)
+{
+    double reference_radius = Vector3::vmag(target_lvlh_frame.state.trans.position);
 
     // Protect for invalid or zero value for reference radius
     if(reference_radius <= 1e-9)
@@ -133,27 +273,62 @@ void LvlhRelativeDerivedState::convert_rect_to_circ(const RefFrameState & rect_r
                              DerivedStateMessages::illegal_value,
                              "Derived state %s: Reference radius for curvilinear LVLH calculation"
                              " is negative or nearly zero.",
-                             name.c_str());
+                             state_name);
 
         // Not reached
-        return;
+        return 0.0;
     }
+    return reference_radius;
+}
+
+/**
+ * Calculate the rate of change of the reference radius.
+ * \param[in] target_lvlh_frame Target LVLH frame
+ * \param[in] reference_radius Reference radius\n Units: M
+ * \return Reference radial rate\n Units: M/s
+ */
+double LvlhRelativeDerivedState::get_reference_radial_rate(const RefFrame & target_lvlh_frame, double reference_radius)
+{
+    return Vector3::dot(target_lvlh_frame.state.trans.position, target_lvlh_frame.state.trans.velocity) /
+           reference_radius;
+}
+
+/**
+ * Convert from rectilinear LVLH coordinates to circular curvilinear, given
+ * the reference radius and its rate.
+ * \param[in] rect_rel_state Source state
+ * \param[in] reference_radius Reference radius\n Units: M
+ * \param[in] reference_rdot Reference radial rate\n Units: M/s
+ * \param[in] theta_dot_correction Correct for the changing phase angle?
+ * \param[out] circ_rel_state Converted state
+ */
+void LvlhRelativeDerivedState::rect_to_circ(const RefFrameState & rect_rel_state,
+                                            double reference_radius,
+                                            double reference_rdot,
+                                            bool theta_dot_correction,
+                                            RefFrameState & circ_rel_state)
+{
+    // Locally store values to reduce lookups
+    double rect_position[3];
+    double rect_velocity[3];
+    Vector3::copy(rect_rel_state.trans.position, rect_position);
+    Vector3::copy(rect_rel_state.trans.velocity, rect_velocity);
 
     // Calculate the orbital phase angle between the target and subject.
-    double theta = std::atan2(rect_position[0], reference_radius - rect_position[2]);
+    double radial_offset = reference_radius - rect_position[2];
+    double theta = std::atan2(rect_position[0], radial_offset);
 
     // Calculate the CLVLH x-position using the phase angle
-    rel_state.trans.position[0] = reference_radius * theta;
+    circ_rel_state.trans.position[0] = reference_radius * theta;
 
     // For this implementation, the y-axis for the RLVLH and CLVLH frames
     // are co-aligned, i.e., the CLVLH y-axis does not curve
-    rel_state.trans.position[1] = rect_position[1];
+    circ_rel_state.trans.position[1] = rect_position[1];
 
     // The CLVLH z-position is the difference between the radial
     // distances of the two vehicles.
-    double subject_radius = std::sqrt((reference_radius - rect_position[2]) * (reference_radius - rect_position[2]) +
-                                      rect_position[0] * rect_position[0]);
-    rel_state.trans.position[2] = reference_radius - subject_radius;
+    double subject_radius = std::sqrt(radial_offset * radial_offset + rect_position[0] * rect_position[0]);
+    circ_rel_state.trans.position[2] = reference_radius - subject_radius;
 
     // Construct the rotation matrix from RLVLH to CLVLH using phase angle
     double xform_rect2curvi[3][3];
@@ -169,25 +344,39 @@ void LvlhRelativeDerivedState::convert_rect_to_circ(const RefFrameState & rect_r
 
     // Transform subject_vehicle's RLVLH velocity by the phase angle to
     // obtain the CLVLH velocity
-    Vector3::transform(xform_rect2curvi, rect_velocity, rel_state.trans.velocity);
+    Vector3::transform(xform_rect2curvi, rect_velocity, circ_rel_state.trans.velocity);
 
     // Adjust subject_vehicle's RLVLH attitude by
     // the phase angle as well to get the corresponding CLVLH values
-    Matrix3x3::product_right_transpose(rect_rel_state.rot.T_parent_this, xform_rect2curvi, rel_state.rot.T_parent_this);
+    Matrix3x3::product_right_transpose(rect_rel_state.rot.T_parent_this,
+                                       xform_rect2curvi,
+                                       circ_rel_state.rot.T_parent_this);
 
     // Account for the rotation of the rectilinear LVLH frame
-    Vector3::copy(rect_rel_state.rot.ang_vel_this, rel_state.rot.ang_vel_this);
+    Vector3::copy(rect_rel_state.rot.ang_vel_this, circ_rel_state.rot.ang_vel_this);
     // Correct the angular velocity to account for theta dot
-    do_theta_dot_correction(rel_state.rot.ang_vel_this, rect_rel_state, reference_radius, false);
-    rel_state.rot.compute_quaternion();
-    rel_state.rot.compute_ang_vel_products();
+    if(theta_dot_correction)
+    {
+        do_theta_dot_correction(circ_rel_state.rot.ang_vel_this, rect_rel_state, reference_radius, reference_rdot, false);
+    }
+    circ_rel_state.rot.compute_quaternion();
+    circ_rel_state.rot.compute_ang_vel_products();
 }
 
 /**
- * Convert from circular curvilinear LVLH coordinates to rectilinear.
+ * Convert from circular curvilinear LVLH coordinates to rectilinear, given
+ * the reference radius and its rate.
  * \param[in] curvi_rel_state Source state
+ * \param[in] reference_radius Reference radius\n Units: M
+ * \param[in] reference_rdot Reference radial rate\n Units: M/s
+ * \param[in] theta_dot_correction Correct for the changing phase angle?
+ * \param[out] rect_rel_state Converted state
  */
-void LvlhRelativeDerivedState::convert_circ_to_rect(const RefFrameState & curvi_rel_state)
+void LvlhRelativeDerivedState::circ_to_rect(const RefFrameState & curvi_rel_state,
+                                            double reference_radius,
+                                            double reference_rdot,
+                                            bool theta_dot_correction,
+                                            RefFrameState & rect_rel_state)
 {
     // Locally store values to reduce lookups
     double curvi_position[3];
@@ -195,25 +384,6 @@ void LvlhRelativeDerivedState::convert_circ_to_rect(const RefFrameState & curvi_
     Vector3::copy(curvi_rel_state.trans.position, curvi_position);
     Vector3::copy(curvi_rel_state.trans.velocity, curvi_velocity);
 
-    // Calculate the radial distance of the target LVLH frame from the origin
-    // of the planet used to define that LVLH frame. Note that <planet>.inertial
-    // is the direct parent of the target LVLH frame by assignation.
-    double reference_radius = Vector3::vmag(target_frame->state.trans.position);
-
-    // Protect for invalid or zero value for reference radius
-    if(reference_radius <= 1e-9)
-    {
-        MessageHandler::fail(__FILE__,
-                             __LINE__,
-                             DerivedStateMessages::illegal_value,
-                             "Derived state %s: Reference radius for curvilinear LVLH calculation"
-                             " is negative or nearly zero.",
-                             name.c_str());
-
-        // Not reached
-        return;
-    }
-
     // Calculate the radius of subject vehicle; note that CLVLH z-pos is
     // the difference between the radial distances of the two vehicles.
     double subject_radius = reference_radius - curvi_position[2];
@@ -226,14 +396,14 @@ void LvlhRelativeDerivedState::convert_circ_to_rect(const RefFrameState & curvi_
     double sin_theta = std::sin(theta);
 
     // Project CLVLH z-position into RLVLH coordinates using phase angle.
-    rel_state.trans.position[2] = reference_radius - (subject_radius * cos_theta);
+    rect_rel_state.trans.position[2] = reference_radius - (subject_radius * cos_theta);
 
     // For this implementation, the y-axis for the RLVLH and CLVLH frames
     // are co-aligned, i.e., the CLVLH y-axis does not curve.
-    rel_state.trans.position[1] = curvi_position[1];
+    rect_rel_state.trans.position[1] = curvi_position[1];
 
     // Calculate the RLVLH x-position using the phase angle.
-    rel_state.trans.position[0] = subject_radius * sin_theta;
+    rect_rel_state.trans.position[0] = subject_radius * sin_theta;
 
     // Construct the rotation matrix from CLVLH to RLVLH using phase angle
     double xform_curvi2rect[3][3];
@@ -247,35 +417,30 @@ void LvlhRelativeDerivedState::convert_circ_to_rect(const RefFrameState & curvi_
 
     // Transform subject_vehicle's CLVLH velocity by the phase angle to
     // obtain the RLVLH velocity
-    Vector3::transform(xform_curvi2rect, curvi_velocity, rel_state.trans.velocity);
+    Vector3::transform(xform_curvi2rect, curvi_velocity, rect_rel_state.trans.velocity);
 
     // Adjust subject_vehicle's CLVLH attitude by
     // the phase angle as well to get the corresponding RLVLH value
     Matrix3x3::product_right_transpose(curvi_rel_state.rot.T_parent_this,
                                        xform_curvi2rect,
-                                       rel_state.rot.T_parent_this);
-    Vector3::copy(curvi_rel_state.rot.ang_vel_this, rel_state.rot.ang_vel_this);
-    do_theta_dot_correction(rel_state.rot.ang_vel_this, rel_state, reference_radius, true);
-    rel_state.rot.compute_quaternion();
-    rel_state.rot.compute_ang_vel_products();
+                                       rect_rel_state.rot.T_parent_this);
+    Vector3::copy(curvi_rel_state.rot.ang_vel_this, rect_rel_state.rot.ang_vel_this);
+    if(theta_dot_correction)
+    {
+        do_theta_dot_correction(rect_rel_state.rot.ang_vel_this, rect_rel_state, reference_radius, reference_rdot, true);
+    }
+    rect_rel_state.rot.compute_quaternion();
+    rect_rel_state.rot.compute_ang_vel_products();
 }
 
 /**
  * Compute thetadot correction to omega.
  */
-void LvlhRelativeDerivedState::do_theta_dot_correction(double omega[3],
-                                                       const RefFrameState & s,
-                                                       const double r,
-                                                       bool c2r)
+void LvlhRelativeDerivedState::do_theta_dot_correction(
+    double omega[3], const RefFrameState & s, const double r, const double rdot, bool c2r)
 {
-    if(!use_theta_dot_correction)
-    {
-        return;
-    }
-
     double x = r - s.trans.position[2];
     double y = s.trans.position[0];
-    double rdot = Vector3::dot(target_frame->state.trans.position, target_frame->state.trans.velocity) / r;
     double xdot = rdot - s.trans.velocity[2];
     double ydot = s.trans.velocity[0];
     double delta_omega[3] = {0, (x * ydot - y * xdot) / (x * x + y * y), 0};
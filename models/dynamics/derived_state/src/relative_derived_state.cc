@@ -30,6 +30,7 @@ Library dependencies:
 
 // System includes
 #include <cstddef>
+#include <typeinfo>
 
 // JEOD includes
 #include "dynamics/dyn_body/include/dyn_body.hh"
@@ -192,6 +193,65 @@ void RelativeDerivedState::update()
     }
 }
 
+/**
+ * Describe the relative state that update() computes, so that a caller
+ * such as RelativeKinematics can compute it together with others that
+ * share frames. The caller computes the state as requested and then calls
+ * complete_update().
+ * Batching is opt-in per class: a class derived from RelativeDerivedState
+ * may override update(), so only an object whose dynamic type is exactly
+ * RelativeDerivedState describes its update here. Derived classes that can
+ * be batched override this method.
+ * \param[out] request The frames and the destination of their relative state
+ * @return False if the update cannot be described this way,
+ *         in which case update() must be called instead
+ */
+bool RelativeDerivedState::get_relative_state_request(RefFrame::RelativeStateRequest & request)
+{
+    if(typeid(*this) != typeid(RelativeDerivedState))
+    {
+        return false;
+    }
+
+    return get_frame_to_frame_request(request);
+}
+
+/**
+ * Describe the frame-to-frame relative state of the subject and target
+ * frames per the direction sense, as update() computes it.
+ * \param[out] request The frames and the destination of their relative state
+ * @return False if the direction sense is not set
+ */
+bool RelativeDerivedState::get_frame_to_frame_request(RefFrame::RelativeStateRequest & request)
+{
+    if(direction_sense == ComputeSubjectStateinTarget)
+    {
+        request.frame = subject_frame;
+        request.wrt_frame = target_frame;
+    }
+
+    else if(direction_sense == ComputeTargetStateinSubject)
+    {
+        request.frame = target_frame;
+        request.wrt_frame = subject_frame;
+    }
+
+    else
+    {
+        return false;
+    }
+
+    request.rel_state = &rel_state;
+    return true;
+}
+
+/**
+ * Finish an update whose relative state was computed as described by
+ * get_relative_state_request. The relative state is the final product
+ * here, so there is nothing left to do.
+ */
+void RelativeDerivedState::complete_update() {}
+
 /**
  * Setter for the activation flag to on or off and
  * If off, unsubscribes subject and target frames
@@ -1,6 +1,7 @@
-#include "utils/trick_csv/include/read_trk_csv.hh"
+#include "utils/trick_csv/include/trk_csv_reader.hh"
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 double dot(const double * v1, const double * v2)
 {
@@ -105,18 +106,36 @@ void compare(const int numRows, const int numCols, double ** p1, double ** p2, c
     std::cout << "Error found at element [" << maxErrRow << "][" << maxErrCol << "]\n";
 }
 
+// Read every column of a log, row after row; rows[ii] points to row ii.
+int readLog(const char * fileName, std::vector<double> & table, std::vector<double *> & rows)
+{
+    TrkCsvReader log(fileName);
+    unsigned long numRows = log.readRows(table);
+    unsigned int numCols = log.getNumCols();
+
+    rows.resize(numRows);
+    for(unsigned long ii = 0; ii < numRows; ++ii)
+    {
+        rows[ii] = table.data() + ii * numCols;
+    }
+    return numCols;
+}
+
 int main(int arg_c, char ** arg_v)
 {
     (void)arg_c;
     (void)arg_v;
 
-    ReadTrkCsv vehState("log_VehState.csv");
-    ReadTrkCsv relState("log_RelState.csv");
+    std::vector<double> vehTable;
+    std::vector<double *> vehRows;
+    std::vector<double> relTable;
+    std::vector<double *> relRows;
+    readLog("log_VehState.csv", vehTable, vehRows);
+    int numCols = readLog("log_RelState.csv", relTable, relRows);
 
     // First check for internal consistency
-    double ** relValues = relState.getValues();
-    int numCols = relState.getNumCols();
-    int numRows = relState.getNumRows();
+    double ** relValues = relRows.data();
+    int numRows = relRows.size();
 
     std::cout << "Checking for consistency with existing code\n";
     compare(numRows, 36, relValues, relValues, 1, 37);
@@ -145,7 +164,7 @@ int main(int arg_c, char ** arg_v)
     auto ** computedCurviPosBinA = new double *[numRows];
     auto ** computedCurviVelBinA = new double *[numRows];
     auto ** computedCurviAngVelBinA = new double *[numRows];
-    double ** stateValues = vehState.getValues();
+    double ** stateValues = vehRows.data();
 
     for(int ii = 0; ii < numRows; ++ii)
     {
@@ -0,0 +1,278 @@
+// Time the LVLH frame of one target as maintained by many LvlhFrame objects,
+// each computing it as before and with the computation shared, and the
+// conversion of many chasers' states in that frame between rectilinear and
+// curvilinear LVLH, one at a time and batched. Check the shared frames
+// against the computed one and the conversions against the original
+// trigonometric formulation and against each other.
+// System includes
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// JEOD includes
+#include "dynamics/derived_state/include/lvlh_relative_derived_state.hh"
+#include "dynamics/dyn_manager/include/dyn_manager.hh"
+#include "environment/planet/include/base_planet.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/lvlh_frame/include/lvlh_frame.hh"
+#include "utils/math/include/matrix3x3.hh"
+#include "utils/math/include/vector3.hh"
+
+using namespace std;
+using namespace jeod;
+
+static unsigned long seed = 12345;
+
+static double uniform()
+{
+    seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+    return static_cast<double>(seed) / 2147483648.0;
+}
+
+/**
+ * Place the target on a 400 km circular orbit at the given time.
+ */
+static void move_target(RefFrame & target, double time)
+{
+    double radius = 6778.0e3;
+    double rate = 1.1e-3;
+    double angle = rate * time;
+    target.state.trans.position[0] = radius * cos(angle);
+    target.state.trans.position[1] = radius * sin(angle) * 0.8;
+    target.state.trans.position[2] = radius * sin(angle) * 0.6;
+    target.state.trans.velocity[0] = -radius * rate * sin(angle);
+    target.state.trans.velocity[1] = radius * rate * cos(angle) * 0.8;
+    target.state.trans.velocity[2] = radius * rate * cos(angle) * 0.6;
+    target.set_timestamp(time);
+}
+
+/**
+ * Curvilinear position, velocity and attitude of a rectilinear state,
+ * computed as convert_rect_to_circ computed them before the conversions
+ * were shared with the batched versions.
+ */
+static void trig_rect_to_circ(const RefFrameState & rect, double reference_radius, RefFrameState & circ)
+{
+    double theta = atan2(rect.trans.position[0], reference_radius - rect.trans.position[2]);
+    double subject_radius = sqrt((reference_radius - rect.trans.position[2]) *
+                                     (reference_radius - rect.trans.position[2]) +
+                                 rect.trans.position[0] * rect.trans.position[0]);
+    circ.trans.position[0] = reference_radius * theta;
+    circ.trans.position[1] = rect.trans.position[1];
+    circ.trans.position[2] = reference_radius - subject_radius;
+
+    double xform[3][3];
+    Matrix3x3::initialize(xform);
+    xform[0][0] = cos(theta);
+    xform[0][2] = sin(theta);
+    xform[1][1] = 1.0;
+    xform[2][0] = -sin(theta);
+    xform[2][2] = cos(theta);
+    Vector3::transform(xform, rect.trans.velocity, circ.trans.velocity);
+    Matrix3x3::product_right_transpose(rect.rot.T_parent_this, xform, circ.rot.T_parent_this);
+}
+
+static double max_abs_diff(const double * a, const double * b, unsigned int num)
+{
+    double max_diff = 0.0;
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        double diff = fabs(a[ii] - b[ii]);
+        max_diff = diff > max_diff ? diff : max_diff;
+    }
+    return max_diff;
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_chasers;
+    int num_steps;
+    double tolerance;
+
+    cmdline_parser.add_int("NumChasers", 16, &num_chasers);
+    cmdline_parser.add_int("NumSteps", 10000, &num_steps);
+    cmdline_parser.add_double("Tolerance", 1.0e-12, &tolerance);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_chasers <= 0 || num_steps <= 0)
+    {
+        cerr << "NumChasers and NumSteps must be positive." << endl;
+        return 1;
+    }
+
+    DynManager dyn_manager;
+    BasePlanet earth;
+    RefFrame target;
+    earth.set_name("Earth");
+    earth.inertial.set_name("Earth", "inertial");
+    earth.inertial.set_ephem_manager(&dyn_manager);
+    earth.inertial.make_root();
+    target.set_name("target");
+    earth.inertial.add_child(target);
+    move_target(target, 0.0);
+
+    // One LVLH frame of the target per chaser; all but the first copy the
+    // state computed by the first.
+    auto num = static_cast<unsigned int>(num_chasers);
+    vector<unique_ptr<LvlhFrame>> lvlh_frames;
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        lvlh_frames.emplace_back(new LvlhFrame);
+        lvlh_frames.back()->set_subject_frame(target);
+        lvlh_frames.back()->set_planet(earth);
+        lvlh_frames.back()->initialize(dyn_manager);
+    }
+    LvlhFrame & primary = *lvlh_frames[0];
+
+    // As before, every frame computed the state.
+    auto start = chrono::steady_clock::now();
+    for(int step = 1; step <= num_steps; ++step)
+    {
+        move_target(target, step);
+        for(unsigned int ii = 0; ii < num; ++ii)
+        {
+            primary.update();
+        }
+    }
+    auto stop = chrono::steady_clock::now();
+    double unshared_ns = chrono::duration<double, nano>(stop - start).count() / num_steps;
+
+    // Shared: the frames after the first copy its state.
+    double max_frame_diff = 0.0;
+    start = chrono::steady_clock::now();
+    for(int step = 1; step <= num_steps; ++step)
+    {
+        move_target(target, num_steps + step);
+        for(unsigned int ii = 1; ii < num; ++ii)
+        {
+            lvlh_frames[ii]->update();
+        }
+        primary.update();
+    }
+    stop = chrono::steady_clock::now();
+    double shared_ns = chrono::duration<double, nano>(stop - start).count() / num_steps;
+    for(unsigned int ii = 1; ii < num; ++ii)
+    {
+        if(!lvlh_frames[ii]->is_shared())
+        {
+            cout << "LVLH frame " << ii << " is not shared" << endl;
+            return 1;
+        }
+        double diff = max_abs_diff(lvlh_frames[ii]->frame.state.rot.T_parent_this[0],
+                                   primary.frame.state.rot.T_parent_this[0],
+                                   9);
+        max_frame_diff = diff > max_frame_diff ? diff : max_frame_diff;
+    }
+
+    cout << "Chasers: " << num << ", steps: " << num_steps << endl;
+    cout << fixed << setprecision(1) << "LVLH frames, each computed: " << unshared_ns << " ns/step" << endl;
+    cout << "LVLH frames, shared:        " << shared_ns << " ns/step" << endl;
+    cout.unsetf(ios::floatfield);
+
+    // Chasers within 50 km of the target, in any attitude.
+    const RefFrame & target_lvlh = primary.frame;
+    double reference_radius = Vector3::vmag(target_lvlh.state.trans.position);
+    vector<RefFrameState> rect(num), circ(num), batch_circ(num), batch_rect(num), trig_circ(num);
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        for(unsigned int jj = 0; jj < 3; ++jj)
+        {
+            rect[ii].trans.position[jj] = 50.0e3 * (2.0 * uniform() - 1.0);
+            rect[ii].trans.velocity[jj] = 10.0 * (2.0 * uniform() - 1.0);
+            rect[ii].rot.ang_vel_this[jj] = 1.0e-3 * (2.0 * uniform() - 1.0);
+        }
+        double quat[4] = {uniform() - 0.5, uniform() - 0.5, uniform() - 0.5, uniform() - 0.5};
+        double qmag = sqrt(quat[0] * quat[0] + quat[1] * quat[1] + quat[2] * quat[2] + quat[3] * quat[3]);
+        for(double & qq : quat)
+        {
+            qq /= qmag;
+        }
+        rect[ii].rot.Q_parent_this.scalar = quat[0];
+        Vector3::copy(&quat[1], rect[ii].rot.Q_parent_this.vector);
+        rect[ii].rot.compute_transformation();
+    }
+
+    LvlhRelativeDerivedState one_at_a_time;
+    one_at_a_time.set_target_frame(const_cast<RefFrame &>(target_lvlh));
+    one_at_a_time.use_theta_dot_correction = true;
+
+    int num_reps = num_steps;
+    start = chrono::steady_clock::now();
+    for(int rep = 0; rep < num_reps; ++rep)
+    {
+        for(unsigned int ii = 0; ii < num; ++ii)
+        {
+            one_at_a_time.convert_rect_to_circ(rect[ii]);
+            circ[ii] = one_at_a_time.rel_state;
+        }
+    }
+    stop = chrono::steady_clock::now();
+    double single_ns = chrono::duration<double, nano>(stop - start).count() / (num_reps * num);
+
+    start = chrono::steady_clock::now();
+    for(int rep = 0; rep < num_reps; ++rep)
+    {
+        LvlhRelativeDerivedState::convert_rect_to_circ_batch(target_lvlh, true, num, rect.data(), batch_circ.data());
+    }
+    stop = chrono::steady_clock::now();
+    double batch_ns = chrono::duration<double, nano>(stop - start).count() / (num_reps * num);
+
+    LvlhRelativeDerivedState::convert_circ_to_rect_batch(target_lvlh, true, num, batch_circ.data(), batch_rect.data());
+
+    double max_batch_diff = 0.0;
+    double max_trig_pos_diff = 0.0;
+    double max_trig_rot_diff = 0.0;
+    double max_round_trip_diff = 0.0;
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        double diffs[3] = {max_abs_diff(circ[ii].trans.position, batch_circ[ii].trans.position, 3),
+                           max_abs_diff(circ[ii].trans.velocity, batch_circ[ii].trans.velocity, 3),
+                           max_abs_diff(circ[ii].rot.ang_vel_this, batch_circ[ii].rot.ang_vel_this, 3)};
+        for(double diff : diffs)
+        {
+            max_batch_diff = diff > max_batch_diff ? diff : max_batch_diff;
+        }
+
+        trig_rect_to_circ(rect[ii], reference_radius, trig_circ[ii]);
+        double pos_diff = max_abs_diff(trig_circ[ii].trans.position, batch_circ[ii].trans.position, 3);
+        pos_diff = fmax(pos_diff, max_abs_diff(trig_circ[ii].trans.velocity, batch_circ[ii].trans.velocity, 3));
+        max_trig_pos_diff = fmax(max_trig_pos_diff, pos_diff);
+        max_trig_rot_diff = fmax(max_trig_rot_diff,
+                                 max_abs_diff(trig_circ[ii].rot.T_parent_this[0],
+                                              batch_circ[ii].rot.T_parent_this[0],
+                                              9));
+
+        double round_trip = max_abs_diff(rect[ii].trans.position, batch_rect[ii].trans.position, 3) / 50.0e3;
+        round_trip = fmax(round_trip, max_abs_diff(rect[ii].trans.velocity, batch_rect[ii].trans.velocity, 3) / 10.0);
+        round_trip = fmax(round_trip, max_abs_diff(rect[ii].rot.T_parent_this[0], batch_rect[ii].rot.T_parent_this[0], 9));
+        round_trip = fmax(
+            round_trip,
+            max_abs_diff(rect[ii].rot.ang_vel_this, batch_rect[ii].rot.ang_vel_this, 3) / 1.0e-3);
+        max_round_trip_diff = fmax(max_round_trip_diff, round_trip);
+    }
+
+    cout << fixed << setprecision(1) << "Rect to curvilinear, one at a time: " << single_ns << " ns/chaser" << endl;
+    cout << "Rect to curvilinear, batched:      " << batch_ns << " ns/chaser" << endl;
+    cout.unsetf(ios::floatfield);
+    cout << scientific << setprecision(2);
+    cout << "Max shared frame difference:               " << max_frame_diff << endl;
+    cout << "Max batched vs one at a time difference:   " << max_batch_diff << endl;
+    cout << "Max difference from trig, position m, m/s: " << max_trig_pos_diff << endl;
+    cout << "Max difference from trig, attitude:        " << max_trig_rot_diff << endl;
+    cout << "Max relative round trip difference:        " << max_round_trip_diff << endl;
+    cout.unsetf(ios::floatfield);
+
+    if((max_frame_diff != 0.0) || (max_batch_diff != 0.0) || (max_trig_rot_diff != 0.0) ||
+       (max_trig_pos_diff != 0.0) || (max_round_trip_diff > tolerance))
+    {
+        cout << "Failed tolerance " << tolerance << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -396,3 +396,7 @@ TEST(LvlhRelativeDerivedState, do_theta_dot_correction)
     }
     EXPECT_CALL(mockMessageHandler, process_message(_, _, _, _, _, _, _)).Times(AnyNumber());
 }
+
+TEST(LvlhRelativeDerivedState, convert_rect_to_circ_batch) {}
+
+TEST(LvlhRelativeDerivedState, convert_circ_to_rect_batch) {}
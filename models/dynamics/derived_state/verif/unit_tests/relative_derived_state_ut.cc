@@ -288,6 +288,38 @@ TEST(RelativeDerivedState, update)
     EXPECT_CALL(mockMessageHandler, process_message(_, _, _, _, _, _, _)).Times(AnyNumber());
 }
 
+TEST(RelativeDerivedState, get_relative_state_request)
+{
+    BodyRefFrame bodyRefFrame;
+    RefFrame refFrame;
+    RelativeDerivedState staticInst;
+    RefFrame::RelativeStateRequest request{};
+    staticInst.set_subject_frame(bodyRefFrame);
+    staticInst.set_target_frame(refFrame);
+
+    // No direction_sense set. Not describable as a request.
+    EXPECT_FALSE(staticInst.get_relative_state_request(request));
+
+    staticInst.direction_sense = RelativeDerivedState::ComputeSubjectStateinTarget;
+    EXPECT_TRUE(staticInst.get_relative_state_request(request));
+    EXPECT_EQ(&bodyRefFrame, request.frame);
+    EXPECT_EQ(&refFrame, request.wrt_frame);
+    EXPECT_EQ(&staticInst.rel_state, request.rel_state);
+
+    staticInst.direction_sense = RelativeDerivedState::ComputeTargetStateinSubject;
+    EXPECT_TRUE(staticInst.get_relative_state_request(request));
+    EXPECT_EQ(&refFrame, request.frame);
+    EXPECT_EQ(&bodyRefFrame, request.wrt_frame);
+    EXPECT_EQ(&staticInst.rel_state, request.rel_state);
+
+    // Derived classes do not describe their updates unless they opt in.
+    RelativeDerivedStateTest derivedInst;
+    derivedInst.set_subject_frame(bodyRefFrame);
+    derivedInst.set_target_frame(refFrame);
+    derivedInst.direction_sense = RelativeDerivedState::ComputeSubjectStateinTarget;
+    EXPECT_FALSE(derivedInst.get_relative_state_request(request));
+}
+
 TEST(RelativeDerivedState, set_activation_flag)
 {
     {
@@ -454,6 +454,16 @@ public:
      */
     bool is_root_body();
 
+    /**
+     * Indicates whether this DynBody is attached to a reference frame
+     * rather than having its state integrated.
+     * @return Is the body's state slaved to a reference frame?
+     */
+    bool is_attached_to_frame() const
+    {
+        return frame_attach.isAttached();
+    }
+
     // Find this body's parent and root bodies.
     // Note that the const methods are public. The modifiable methods are not.
 
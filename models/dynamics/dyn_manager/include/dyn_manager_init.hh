@@ -128,6 +128,14 @@ public:
      */
     DynamicsIntegrationGroup * integ_group_constructor{}; //!< trick_units(--)
 
+    /**
+     * Number of threads used by the default integration group to compute
+     * gravitation, collect forces and torques, and integrate its root
+     * bodies. The default, zero, leaves the group's num_threads setting
+     * as is (one unless set in the integ_group_constructor).
+     */
+    unsigned int num_threads{}; //!< trick_units(--)
+
     /**
      * The simulation's dynamics manager uses an integrator constructor to
      * generate the dynamic manager's time integrator and to generate a state
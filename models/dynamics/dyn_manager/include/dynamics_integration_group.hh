@@ -63,10 +63,12 @@ Library dependencies:
 #define JEOD_DYNAMICS_INTEGRATION_GROUP_HH
 
 // System includes
+#include <vector>
 
 // JEOD includes
 #include "utils/container/include/pointer_vector.hh"
 #include "utils/integration/include/jeod_integration_group.hh"
+#include "utils/integration/include/jeod_thread_pool.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 //! Namespace jeod
@@ -197,9 +199,28 @@ public:
      */
     bool deriv_ephem_update{}; //!< trick_units(--)
 
+    /**
+     * Number of threads used to process the group's root bodies in
+     * gravitation(), collect_derivatives(), and integrate_bodies().
+     * gravitation() spreads the individual gravity controls of the root
+     * bodies over the threads, so even a single body benefits.
+     * The default, one, processes the bodies serially on the calling thread.
+     * Larger values are an opt-in: they are safe only when the per-body
+     * force, torque, and gravity computations do not modify state shared
+     * with other bodies in the group. Results are bit-for-bit identical
+     * to serial processing.
+     */
+    unsigned int num_threads{1}; //!< trick_units(--)
+
 protected:
     // Member functions
 
+    // Prepare for processing the root bodies on multiple threads.
+    bool prepare_parallel_pass(bool check_frame_attachments, unsigned int min_root_bodies = 2);
+
+    // Prepare for evaluating the root bodies' gravity controls on multiple threads.
+    bool prepare_gravitation_tasks();
+
     // Reset the group's state integrators.
     // Resets can occur when time changes behavior (call is internal to the
     // integration process) or when some external event would render an
@@ -225,6 +246,47 @@ protected:
      */
     bool bodies_integrated_separately{true}; //!< trick_units(--)
 
+    /**
+     * The root bodies in dyn_bodies, in dyn_bodies order. Rebuilt at the
+     * start of each multithreaded pass.
+     */
+    std::vector<DynBody *> root_bodies; //!< trick_io(**)
+
+    /**
+     * Per root body integration results from a multithreaded
+     * integrate_bodies() pass, merged in root_bodies order.
+     */
+    std::vector<er7_utils::IntegratorResult> root_body_results; //!< trick_io(**)
+
+    /**
+     * A gravity control of a root body, evaluated as one task of a
+     * multithreaded gravitation() pass.
+     */
+    struct GravityTask
+    {
+        /**
+         * The root body.
+         */
+        DynBody * body;
+
+        /**
+         * Index of the control in the body's gravity interaction.
+         */
+        unsigned int control_index;
+    };
+
+    /**
+     * The active gravity controls of the root bodies, in root_bodies and
+     * then control order. Rebuilt at the start of each multithreaded
+     * gravitation() pass.
+     */
+    std::vector<GravityTask> gravity_tasks; //!< trick_io(**)
+
+    /**
+     * Worker threads used when num_threads is greater than one.
+     */
+    JeodThreadPool thread_pool; //!< trick_io(**)
+
 private:
     // Register items in the base class with the memory manager
     void register_base_contents();
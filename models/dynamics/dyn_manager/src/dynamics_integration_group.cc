@@ -22,6 +22,7 @@ Library dependencies:
    (environment/gravity/src/gravity_manager.cc)
    (environment/time/src/time_manager.cc)
    (utils/integration/src/jeod_integration_group.cc)
+   (utils/integration/src/jeod_thread_pool.cc)
    (utils/message/src/message_handler.cc)
    (utils/named_item/src/named_item.cc))
 
@@ -33,6 +34,7 @@ Library dependencies:
 
 // JEOD includes
 #include "dynamics/dyn_body/include/dyn_body.hh"
+#include "environment/gravity/include/gravity_controls.hh"
 #include "environment/gravity/include/gravity_manager.hh"
 #include "utils/integration/include/jeod_integration_time.hh"
 #include "utils/memory/include/jeod_alloc.hh"
@@ -95,6 +97,7 @@ DynamicsIntegrationGroup::~DynamicsIntegrationGroup()
 /**
  * Create an integration group object that can be used as the
  * dynamic manager's default integration group.
+ * The created group inherits this object's num_threads setting.
  * @param[in] owner        The new group's owner
  * @param[in] integ_cotr   Integrator constructor
  * @param[in] integ_inter  Simulation engine integration interface
@@ -106,7 +109,10 @@ DynamicsIntegrationGroup * DynamicsIntegrationGroup::create_group(JeodIntegratio
                                                                   JeodIntegratorInterface & integ_inter,
                                                                   JeodIntegrationTime & time_mngr) const
 {
-    return JEOD_ALLOC_CLASS_OBJECT(DynamicsIntegrationGroup, (owner, integ_cotr, integ_inter, time_mngr));
+    DynamicsIntegrationGroup * group =
+        JEOD_ALLOC_CLASS_OBJECT(DynamicsIntegrationGroup, (owner, integ_cotr, integ_inter, time_mngr));
+    group->num_threads = num_threads;
+    return group;
 }
 
 /**
@@ -263,6 +269,82 @@ void DynamicsIntegrationGroup::prepare_for_integ_loop(double sim_endtime)
     jeod_time_manager->update_time(sim_endtime - integ_interface->get_dt());
 }
 
+/**
+ * Determine whether a pass over the root bodies is to be made on multiple
+ * threads. If so, collect the root bodies and size the thread pool.
+ * @param[in] check_frame_attachments  Make the pass serially if any root body
+ *                                     is attached to a reference frame.
+ *                                     Integrating such a body reads the state
+ *                                     of its parent frame, which may belong to
+ *                                     another body in the group.
+ * @param[in] min_root_bodies  Make the pass serially if there are fewer
+ *                             root bodies than this.
+ * @return True if the pass is to be made on multiple threads.
+ */
+bool DynamicsIntegrationGroup::prepare_parallel_pass(bool check_frame_attachments, unsigned int min_root_bodies)
+{
+    if(num_threads <= 1)
+    {
+        return false;
+    }
+
+    // The set of root bodies changes with attach and detach; rebuild it.
+    root_bodies.clear();
+    for(std::vector<DynBody *>::const_iterator it = dyn_bodies.begin(); it != dyn_bodies.end(); ++it)
+    {
+        DynBody * body = *it;
+        if(body->is_root_body())
+        {
+            if(check_frame_attachments && body->is_attached_to_frame())
+            {
+                return false;
+            }
+            root_bodies.push_back(body);
+        }
+    }
+
+    if(root_bodies.size() < min_root_bodies)
+    {
+        return false;
+    }
+
+    if(thread_pool.get_num_threads() != num_threads)
+    {
+        thread_pool.set_num_threads(num_threads);
+    }
+
+    return true;
+}
+
+/**
+ * Determine whether the gravity controls of the root bodies are to be
+ * evaluated on multiple threads. If so, list them as tasks.
+ * @return True if there are at least two tasks to share out.
+ */
+bool DynamicsIntegrationGroup::prepare_gravitation_tasks()
+{
+    if(!prepare_parallel_pass(false, 1))
+    {
+        return false;
+    }
+
+    gravity_tasks.clear();
+    for(std::vector<DynBody *>::const_iterator it = root_bodies.begin(); it != root_bodies.end(); ++it)
+    {
+        DynBody * body = *it;
+        unsigned int n_controls = body->grav_interaction.grav_controls.size();
+        for(unsigned int ii = 0; ii < n_controls; ++ii)
+        {
+            if(body->grav_interaction.grav_controls[ii]->active)
+            {
+                gravity_tasks.push_back({body, ii});
+            }
+        }
+    }
+
+    return gravity_tasks.size() >= 2;
+}
+
 /**
  * Compute the gravitational acceleration of each root dynamic body.
  * @param dyn_manager    Dynamics manager.
@@ -277,6 +359,27 @@ void DynamicsIntegrationGroup::gravitation(DynManager & dyn_manager, GravityMana
         dyn_manager.update_ephemerides();
     }
 
+    // Compute gravitational effects on the root bodies in parallel if so configured.
+    // Each task evaluates one gravity control of one body. The contributions
+    // are then summed per body in control order, as in the serial pass.
+    if(prepare_gravitation_tasks())
+    {
+        auto control_gravitation = [this, &gravity_manager](unsigned int index)
+        {
+            const GravityTask & task = gravity_tasks[index];
+            gravity_manager.control_gravitation(task.body->composite_body,
+                                                task.body->grav_interaction,
+                                                task.control_index);
+        };
+        thread_pool.run(static_cast<unsigned int>(gravity_tasks.size()), control_gravitation);
+
+        for(std::vector<DynBody *>::const_iterator it = root_bodies.begin(); it != root_bodies.end(); ++it)
+        {
+            gravity_manager.sum_gravitation((*it)->grav_interaction);
+        }
+        return;
+    }
+
     // Compute gravitational effects on each root body.
     for(std::vector<DynBody *>::const_iterator it = dyn_bodies.begin(); it != dyn_bodies.end(); ++it)
     {
@@ -297,6 +400,17 @@ void DynamicsIntegrationGroup::gravitation(DynManager & dyn_manager, GravityMana
  */
 void DynamicsIntegrationGroup::collect_derivatives()
 {
+    // Collect forces and torques on the root bodies in parallel if so configured.
+    if(prepare_parallel_pass(false))
+    {
+        auto body_collect = [this](unsigned int index)
+        {
+            root_bodies[index]->collect_forces_and_torques();
+        };
+        thread_pool.run(static_cast<unsigned int>(root_bodies.size()), body_collect);
+        return;
+    }
+
     // Collect forces and torques on each root body.
     for(std::vector<DynBody *>::const_iterator it = dyn_bodies.begin(); it != dyn_bodies.end(); ++it)
     {
@@ -357,6 +471,29 @@ er7_utils::IntegratorResult DynamicsIntegrationGroup::integrate_bodies(double cy
         status = integrate_container(cycle_dyndt, target_stage, integrable_objects);
     }
 
+    // Propagate the root bodies in parallel if so configured.
+    // Each body's result is saved and the results are merged afterwards,
+    // in the same order as the serial loop below, so the merged status
+    // does not depend on the order in which the threads finish.
+    if(prepare_parallel_pass(true))
+    {
+        root_body_results.resize(root_bodies.size(), er7_utils::IntegratorResult(false));
+        auto body_integrate = [this, cycle_dyndt, target_stage](unsigned int index)
+        {
+            root_body_results[index] = root_bodies[index]->integrate(cycle_dyndt, target_stage);
+        };
+        thread_pool.run(static_cast<unsigned int>(root_bodies.size()), body_integrate);
+
+        for(std::vector<er7_utils::IntegratorResult>::const_iterator it = root_body_results.begin();
+            it != root_body_results.end();
+            ++it)
+        {
+            integ_merger.merge_integrator_result(*it, status);
+        }
+
+        return status;
+    }
+
     // Propagate state of each body to the end of the intermediate step.
     for(std::vector<DynBody *>::const_iterator it = dyn_bodies.begin(); it != dyn_bodies.end(); ++it)
     {
@@ -184,6 +184,11 @@ void DynManager::initialize_model_internal(DynManagerInit & init, TimeManager &
                                                            *integ_interface,
                                                            time_mngr.get_jeod_integration_time()));
         }
+
+        if(init.num_threads > 0)
+        {
+            default_integ_group->num_threads = init.num_threads;
+        }
     }
 }
 
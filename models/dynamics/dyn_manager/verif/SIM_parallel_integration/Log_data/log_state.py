@@ -0,0 +1,26 @@
+################TRICK HEADER#######################################
+#PURPOSE:
+#  (Log the integrated state of every vehicle. The binary recording
+#   preserves every bit of each value, so the recordings from the serial
+#   and parallel runs can be compared byte for byte.)
+####################################################################
+
+def log_state ( log_cycle ) :
+  recording_group_name = "state"
+  dr_group = trick.sim_services.DRBinary(recording_group_name)
+  dr_group.thisown = 0
+  dr_group.set_cycle(log_cycle)
+  dr_group.freq = trick.sim_services.DR_Always
+
+  for veh in ["veh1", "veh2", "veh3", "veh4", "veh5", "veh6", "veh7", "veh8"] :
+    body = veh + ".dyn_body.composite_body.state"
+    for ii in range(0,3) :
+      dr_group.add_variable( body + ".trans.position[" + str(ii) + "]" )
+      dr_group.add_variable( body + ".trans.velocity[" + str(ii) + "]" )
+      dr_group.add_variable( body + ".rot.ang_vel_this[" + str(ii) + "]" )
+      dr_group.add_variable( body + ".rot.Q_parent_this.vector[" + str(ii) + "]" )
+      dr_group.add_variable( veh + ".dyn_body.grav_interaction.grav_accel[" + str(ii) + "]" )
+    dr_group.add_variable( body + ".rot.Q_parent_this.scalar" )
+
+  trick.add_data_record_group(dr_group)
+  return
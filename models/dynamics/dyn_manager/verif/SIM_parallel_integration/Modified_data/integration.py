@@ -0,0 +1,5 @@
+dynamics.dyn_manager_init.sim_integ_opt = trick.sim_services.Runge_Kutta_4
+
+# Create the default integration group from the prototype so that the
+# number of threads used by the group can be set from the run input file.
+dynamics.dyn_manager_init.integ_group_constructor = dynamics.group_prototype
@@ -0,0 +1,58 @@
+################TRICK HEADER#######################################
+#PURPOSE:
+#  (Configure the vehicles. Each vehicle gets a distinct orbit and spin
+#   so that no two vehicles follow the same trajectory.)
+####################################################################
+
+def set_vehicle( vehicle, veh_name, position, velocity, ang_velocity ) :
+  vehicle.dyn_body.set_name( veh_name )
+  vehicle.dyn_body.integ_frame_name = "Earth.inertial"
+  vehicle.dyn_body.translational_dynamics = True
+  vehicle.dyn_body.rotational_dynamics = True
+
+  vehicle.mass_init.set_subject_body( vehicle.dyn_body.mass )
+  vehicle.mass_init.properties.pt_orientation.data_source = trick.Orientation.InputEigenRotation
+  vehicle.mass_init.properties.pt_orientation.eigen_angle = 0.0
+  vehicle.mass_init.properties.pt_orientation.eigen_axis  = [ 0, 1, 0]
+  vehicle.mass_init.properties.mass       = 1000.0
+  vehicle.mass_init.properties.position   = [ 0.0, 0.0, 0.0]
+  vehicle.mass_init.properties.inertia[0] = [ 100.0,   0.0,   0.0]
+  vehicle.mass_init.properties.inertia[1] = [   0.0, 200.0,   0.0]
+  vehicle.mass_init.properties.inertia[2] = [   0.0,   0.0, 300.0]
+  dynamics.dyn_manager.add_body_action( vehicle.mass_init )
+
+  vehicle.trans_init.set_subject_body( vehicle.dyn_body )
+  vehicle.trans_init.reference_ref_frame_name = "Earth.inertial"
+  vehicle.trans_init.body_frame_id = "composite_body"
+  vehicle.trans_init.position = position
+  vehicle.trans_init.velocity = velocity
+  dynamics.dyn_manager.add_body_action( vehicle.trans_init )
+
+  vehicle.rot_init.set_subject_body( vehicle.dyn_body )
+  vehicle.rot_init.reference_ref_frame_name = "Earth.inertial"
+  vehicle.rot_init.body_frame_id = "composite_body"
+  vehicle.rot_init.orientation.data_source = trick.Orientation.InputEigenRotation
+  vehicle.rot_init.orientation.eigen_angle = 0.0
+  vehicle.rot_init.orientation.eigen_axis  = [ 0.0, 0.0, 1.0]
+  vehicle.rot_init.ang_velocity = ang_velocity
+  dynamics.dyn_manager.add_body_action( vehicle.rot_init )
+
+  vehicle.grav_control.source_name = "Earth"
+  vehicle.grav_control.active      = True
+  vehicle.grav_control.spherical   = False
+  vehicle.grav_control.degree      = 36
+  vehicle.grav_control.order       = 36
+  vehicle.grav_control.gradient    = True
+  vehicle.grav_control.gradient_degree = 36
+  vehicle.grav_control.gradient_order  = 36
+  vehicle.dyn_body.grav_interaction.add_control( vehicle.grav_control )
+
+
+set_vehicle( veh1, "veh1", [ 6778137.0,       0.0,       0.0], [    0.0, 7668.6,    0.0], [0.0, 0.0, 0.01] )
+set_vehicle( veh2, "veh2", [       0.0, 6878137.0,       0.0], [-5372.4,    0.0, 5372.4], [0.0, 0.02, 0.0] )
+set_vehicle( veh3, "veh3", [       0.0,       0.0, 7078137.0], [ 7504.3,    0.0,    0.0], [0.03, 0.0, 0.0] )
+set_vehicle( veh4, "veh4", [-7378137.0,       0.0,       0.0], [    0.0, -6332.5, 3655.9], [0.01, 0.01, 0.0] )
+set_vehicle( veh5, "veh5", [ 5000000.0, 5000000.0,       0.0], [-5200.0, 5200.0, 1200.0], [0.0, 0.01, 0.01] )
+set_vehicle( veh6, "veh6", [       0.0, -4800000.0, 5200000.0], [ 7400.0, -1200.0, -1100.0], [0.01, 0.0, 0.01] )
+set_vehicle( veh7, "veh7", [ 26560000.0,      0.0,       0.0], [    0.0, 1936.7, 3354.6], [0.0, 0.0, -0.02] )
+set_vehicle( veh8, "veh8", [ 42164000.0,      0.0,       0.0], [    0.0, 3074.7,    0.0], [0.0, -0.01, 0.0] )
@@ -0,0 +1,18 @@
+#/*****************************************************************************
+#                      Run init threads: Thread count from DynManagerInit
+#******************************************************************************
+#
+#Description:
+#Propagate the same eight vehicles as RUN_serial with the thread count given
+#by DynManagerInit::num_threads rather than by the prototype group. The
+#initialization setting overrides the prototype's single thread. The
+#recorded data must match RUN_serial bit for bit:
+#
+#   cmp RUN_serial/log_state.trk RUN_init_threads/log_state.trk
+#
+#*****************************************************************************/
+
+exec(compile(open( "SET_test/common_input.py", "rb").read(), "SET_test/common_input.py", 'exec'))
+
+dynamics.group_prototype.num_threads = 1
+dynamics.dyn_manager_init.num_threads = 4
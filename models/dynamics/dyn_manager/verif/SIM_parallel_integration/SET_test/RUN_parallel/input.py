@@ -0,0 +1,16 @@
+#/*****************************************************************************
+#                      Run parallel: Multithreaded integration group
+#******************************************************************************
+#
+#Description:
+#Propagate the same eight vehicles as RUN_serial with the default integration
+#group spreading gravitation, derivative collection, and state integration
+#over four threads. The recorded data must match RUN_serial bit for bit:
+#
+#   cmp RUN_serial/log_state.trk RUN_parallel/log_state.trk
+#
+#*****************************************************************************/
+
+exec(compile(open( "SET_test/common_input.py", "rb").read(), "SET_test/common_input.py", 'exec'))
+
+dynamics.group_prototype.num_threads = 4
@@ -0,0 +1,13 @@
+#/*****************************************************************************
+#                      Run serial: Single-threaded reference
+#******************************************************************************
+#
+#Description:
+#Propagate eight vehicles with the default integration group processing the
+#bodies serially. This run provides the reference for RUN_parallel.
+#
+#*****************************************************************************/
+
+exec(compile(open( "SET_test/common_input.py", "rb").read(), "SET_test/common_input.py", 'exec'))
+
+dynamics.group_prototype.num_threads = 1
@@ -0,0 +1,23 @@
+# This file defines the common input aspects shared between the runs in the
+# SIM_parallel_integration suite. The runs differ only in the number of
+# threads used by the default integration group.
+
+trick.sim_services.exec_set_trap_sigfpe(1)
+
+# Set up data recording.
+exec(compile(open( "Log_data/log_state.py", "rb").read(), "Log_data/log_state.py", 'exec'))
+log_state(10.0)
+
+# Setup integration parameters.
+exec(compile(open( "Modified_data/integration.py", "rb").read(), "Modified_data/integration.py", 'exec'))
+
+# Set up simulation date and time.
+exec(compile(open( "Modified_data/time.py", "rb").read(), "Modified_data/time.py", 'exec'))
+
+# Turn off polar motion.
+earth.rnp.enable_polar = False
+
+# Configure the vehicles.
+exec(compile(open( "Modified_data/vehicles.py", "rb").read(), "Modified_data/vehicles.py", 'exec'))
+
+trick.stop(10800)
@@ -0,0 +1,5 @@
+JEOD_HOME ?= $(realpath $(CURDIR)/../../../../../)
+
+# Generalized S_override.mk file
+# Sets trick compilation flags and builds ephemeris binary files
+include $(JEOD_HOME)/bin/jeod/generic_S_overrides.mk
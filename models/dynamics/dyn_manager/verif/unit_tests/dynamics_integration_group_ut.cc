@@ -37,6 +37,8 @@ TEST(DynamicsIntegrationGroup, delete_dyn_body) {}
 
 TEST(DynamicsIntegrationGroup, prepare_for_integ_loop) {}
 
+TEST(DynamicsIntegrationGroup, prepare_parallel_pass) {}
+
 TEST(DynamicsIntegrationGroup, gravitation) {}
 
 TEST(DynamicsIntegrationGroup, collect_derivatives) {}
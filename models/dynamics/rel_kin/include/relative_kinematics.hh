@@ -69,10 +69,12 @@ Library dependencies:
 #define JEOD_RELATIVE_KINEMATICS_HH
 
 // System includes
+#include <vector>
 
 // JEOD includes
 #include "dynamics/derived_state/include/class_declarations.hh"
 #include "utils/container/include/pointer_vector.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 //! Namespace jeod
@@ -100,6 +102,47 @@ public:
      */
     JeodPointerVector<RelativeDerivedState>::type relative_states; //!< trick_io(**)
 
+    /**
+     * Update the relative states together in update_all, computing the
+     * state of a frame shared by several of them with respect to a common
+     * ancestor frame only once. Only RelativeDerivedState and
+     * LvlhRelativeDerivedState objects, not objects of derived classes, are
+     * batched; the others are updated in turn. The batch computes relative
+     * states with the RefFrame algorithm, so it is not used while the
+     * relative state cache is enabled, and it bypasses any user override of
+     * RefFrame::compute_relative_state. Off by default.
+     */
+    bool batch_updates{}; //!< trick_units(--)
+
+protected:
+    /**
+     * The relative states updated by the last batched update_all,
+     * in list order.
+     */
+    std::vector<RelativeDerivedState *> batch_relstates; //!< trick_io(**)
+
+    /**
+     * The relative state requests of batch_relstates.
+     */
+    std::vector<RefFrame::RelativeStateRequest> batch_requests; //!< trick_io(**)
+
+    /**
+     * The frames of batch_requests for which batch_order was built.
+     */
+    std::vector<const RefFrame *> batch_frames; //!< trick_io(**)
+
+    /**
+     * Indices into batch_requests, ordered so that requests for the same
+     * frame are adjacent.
+     */
+    std::vector<unsigned int> batch_order; //!< trick_io(**)
+
+    /**
+     * batch_requests in batch_order.
+     */
+    std::vector<RefFrame::RelativeStateRequest> batch_ordered_requests; //!< trick_io(**)
+
+public:
     // Member functions
     RelativeKinematics();
     ~RelativeKinematics();
@@ -123,6 +166,10 @@ public:
 
     // Update all of the RelativeDerivedStates maintained by this model
     void update_all();
+
+protected:
+    // Order the batched requests so that requests for the same frame are adjacent
+    void order_batch_requests();
 };
 
 } // namespace jeod
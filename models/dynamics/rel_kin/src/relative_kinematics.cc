@@ -25,6 +25,7 @@ Library dependencies:
   ((relative_kinematics.cc)
    (rel_kin_messages.cc)
    (dynamics/derived_state/src/relative_derived_state.cc)
+   (utils/ref_frames/src/ref_frame_compute_relative_state.cc)
    (utils/message/src/message_handler.cc)
    (utils/named_item/src/named_item.cc))
 
@@ -32,8 +33,9 @@ Library dependencies:
 *******************************************************************************/
 
 // System includes
-#include <algorithm> // std::find
+#include <algorithm> // std::find, std::stable_sort
 #include <cstddef>
+#include <functional> // std::less
 
 // JEOD includes
 #include "dynamics/derived_state/include/relative_derived_state.hh"
@@ -199,13 +201,90 @@ void RelativeKinematics::update_all()
 {
     unsigned int n_relstates = num_rel_states;
 
+    // The relative state cache shares work between relative states in its
+    // own way; leave the updates to it.
+    if(!batch_updates || RefFrame::relative_state_cache_enabled())
+    {
+        for(unsigned int ii = 0; ii < n_relstates; ++ii)
+        {
+            if(relative_states[ii]->active == true)
+            {
+                relative_states[ii]->update();
+            }
+        }
+        return;
+    }
+
+    // Collect the requests of the active relative states. Those that
+    // cannot describe their update as a request are updated directly.
+    batch_relstates.clear();
+    batch_requests.clear();
     for(unsigned int ii = 0; ii < n_relstates; ++ii)
     {
-        if(relative_states[ii]->active == true)
+        RelativeDerivedState * relstate = relative_states[ii];
+        if(relstate->active != true)
+        {
+            continue;
+        }
+
+        RefFrame::RelativeStateRequest request{};
+        if(relstate->get_relative_state_request(request))
+        {
+            batch_relstates.push_back(relstate);
+            batch_requests.push_back(request);
+        }
+        else
         {
-            relative_states[ii]->update();
+            relstate->update();
         }
     }
+
+    // Compute the relative states, sharing the work common to requests
+    // for the same frame, and let each relative state finish its update.
+    order_batch_requests();
+    RefFrame::compute_relative_states(batch_ordered_requests.data(), batch_ordered_requests.size());
+
+    for(auto * relstate : batch_relstates)
+    {
+        relstate->complete_update();
+    }
+}
+
+/**
+ * Order the batched requests so that requests for the same frame are
+ * adjacent. The order is rebuilt only when the frames of the requests
+ * differ from those of the previous update.
+ */
+void RelativeKinematics::order_batch_requests()
+{
+    unsigned int n_requests = batch_requests.size();
+    bool frames_changed = (batch_frames.size() != n_requests);
+    for(unsigned int ii = 0; (ii < n_requests) && !frames_changed; ++ii)
+    {
+        frames_changed = (batch_frames[ii] != batch_requests[ii].frame);
+    }
+
+    if(frames_changed)
+    {
+        batch_frames.resize(n_requests);
+        batch_order.resize(n_requests);
+        for(unsigned int ii = 0; ii < n_requests; ++ii)
+        {
+            batch_frames[ii] = batch_requests[ii].frame;
+            batch_order[ii] = ii;
+        }
+        auto frame_less = [this](unsigned int left, unsigned int right)
+        {
+            return std::less<const RefFrame *>()(batch_frames[left], batch_frames[right]);
+        };
+        std::stable_sort(batch_order.begin(), batch_order.end(), frame_less);
+    }
+
+    batch_ordered_requests.resize(n_requests);
+    for(unsigned int ii = 0; ii < n_requests; ++ii)
+    {
+        batch_ordered_requests[ii] = batch_requests[batch_order[ii]];
+    }
 }
 
 } // namespace jeod
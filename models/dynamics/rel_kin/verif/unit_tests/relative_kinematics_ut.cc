@@ -2,17 +2,72 @@
  * relative_kinematics_ut.cc
  */
 
+#include "dynamics/derived_state/include/relative_derived_state.hh"
+#include "dynamics/dyn_body/include/body_ref_frame.hh"
 #include "dynamics/rel_kin/include/relative_kinematics.hh"
 #include "message_handler_mock.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+
+#include <cmath>
+#include <string>
 using testing::_;
 using testing::AnyNumber;
 using testing::Mock;
 
 using namespace jeod;
 
+namespace
+{
+/**
+ * A relative state whose update() differs from that of its base class.
+ */
+class OffsetRelativeDerivedState : public RelativeDerivedState
+{
+public:
+    unsigned int num_updates{};
+
+    void update() override
+    {
+        RelativeDerivedState::update();
+        rel_state.trans.position[0] += 1.0;
+        ++num_updates;
+    }
+};
+
+void set_frame_state(RefFrame & frame, double offset)
+{
+    for(unsigned int ii = 0; ii < 3; ++ii)
+    {
+        frame.state.trans.position[ii] = offset * (ii + 1.0);
+        frame.state.trans.velocity[ii] = 0.1 * offset * (3.0 - ii);
+        frame.state.rot.ang_vel_this[ii] = 0.01 * offset * (ii - 1.0);
+    }
+    double angle = 0.2 * offset;
+    frame.state.rot.Q_parent_this.scalar = std::cos(angle);
+    frame.state.rot.Q_parent_this.vector[0] = std::sin(angle) * 0.6;
+    frame.state.rot.Q_parent_this.vector[1] = 0.0;
+    frame.state.rot.Q_parent_this.vector[2] = std::sin(angle) * 0.8;
+    frame.state.rot.compute_transformation();
+}
+
+void expect_same_state(const RefFrameState & a, const RefFrameState & b)
+{
+    for(unsigned int ii = 0; ii < 3; ++ii)
+    {
+        EXPECT_EQ(a.trans.position[ii], b.trans.position[ii]);
+        EXPECT_EQ(a.trans.velocity[ii], b.trans.velocity[ii]);
+        EXPECT_EQ(a.rot.ang_vel_this[ii], b.rot.ang_vel_this[ii]);
+        for(unsigned int jj = 0; jj < 3; ++jj)
+        {
+            EXPECT_EQ(a.rot.T_parent_this[ii][jj], b.rot.T_parent_this[ii][jj]);
+        }
+    }
+}
+} // namespace
+
 TEST(RelativeKinematics, create)
 {
     MockMessageHandler mockMessageHandler;
@@ -33,4 +88,77 @@ TEST(RelativeKinematics, activate_relstate) {}
 
 TEST(RelativeKinematics, update_single) {}
 
-TEST(RelativeKinematics, update_all) {}
+TEST(RelativeKinematics, update_all)
+{
+    MockMessageHandler mockMessageHandler;
+    EXPECT_CALL(mockMessageHandler, process_message(_, _, _, _, _, _, _)).Times(AnyNumber());
+
+    // Two vehicles with a port each under a common root, and a target
+    // frame on the first vehicle.
+    RefFrame root;
+    BodyRefFrame vehicle_a;
+    BodyRefFrame vehicle_b;
+    BodyRefFrame port_a;
+    BodyRefFrame port_b;
+    RefFrame target_a;
+    root.set_name("root");
+    vehicle_a.set_name("vehicle_a");
+    vehicle_b.set_name("vehicle_b");
+    port_a.set_name("port_a");
+    port_b.set_name("port_b");
+    target_a.set_name("target_a");
+    root.make_root();
+    root.add_child(vehicle_a);
+    root.add_child(vehicle_b);
+    vehicle_a.add_child(port_a);
+    vehicle_a.add_child(target_a);
+    vehicle_b.add_child(port_b);
+    set_frame_state(vehicle_a, 1.0);
+    set_frame_state(vehicle_b, 2.0);
+    set_frame_state(port_a, 0.3);
+    set_frame_state(port_b, 0.7);
+    set_frame_state(target_a, 0.5);
+
+    // Relative states of both directions, one of which overrides update().
+    BodyRefFrame * subjects[4] = {&port_b, &port_b, &vehicle_b, &port_a};
+    RefFrame * targets[4] = {&port_a, &target_a, &target_a, &vehicle_b};
+    RelativeDerivedState relstates[4];
+    OffsetRelativeDerivedState offset_relstate;
+    RelativeKinematics rel_kin;
+    for(unsigned int ii = 0; ii < 5; ++ii)
+    {
+        RelativeDerivedState & relstate = (ii < 4) ? relstates[ii] : offset_relstate;
+        relstate.set_name("relstate_" + std::to_string(ii));
+        relstate.set_subject_frame(*subjects[ii % 4]);
+        relstate.set_target_frame(*targets[ii % 4]);
+        relstate.direction_sense = (ii % 2 == 0) ? RelativeDerivedState::ComputeSubjectStateinTarget
+                                                 : RelativeDerivedState::ComputeTargetStateinSubject;
+        relstate.active = true;
+        rel_kin.add_relstate(relstate);
+    }
+
+    EXPECT_FALSE(rel_kin.batch_updates);
+    rel_kin.update_all();
+    RefFrameState unbatched[5];
+    for(unsigned int ii = 0; ii < 4; ++ii)
+    {
+        unbatched[ii] = relstates[ii].rel_state;
+    }
+    unbatched[4] = offset_relstate.rel_state;
+    EXPECT_EQ(offset_relstate.num_updates, 1u);
+
+    for(unsigned int ii = 0; ii < 4; ++ii)
+    {
+        relstates[ii].rel_state.initialize();
+    }
+    offset_relstate.rel_state.initialize();
+
+    rel_kin.batch_updates = true;
+    rel_kin.update_all();
+    for(unsigned int ii = 0; ii < 4; ++ii)
+    {
+        expect_same_state(relstates[ii].rel_state, unbatched[ii]);
+    }
+    expect_same_state(offset_relstate.rel_state, unbatched[4]);
+    EXPECT_EQ(offset_relstate.num_updates, 2u);
+}
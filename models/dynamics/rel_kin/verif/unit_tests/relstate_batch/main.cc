@@ -0,0 +1,189 @@
+// Time RelativeKinematics::update_all for a proximity operations scenario:
+// vehicles below the Earth inertial frame, each with a docking port frame
+// below its structure frame, and relative states between the ports and
+// structures of pairs of vehicles. The batched and unbatched updates must
+// produce the same relative states bit for bit.
+
+// System includes
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// JEOD includes
+#include "dynamics/derived_state/include/relative_derived_state.hh"
+#include "dynamics/dyn_body/include/body_ref_frame.hh"
+#include "dynamics/rel_kin/include/relative_kinematics.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
+
+using namespace std;
+using namespace jeod;
+
+/**
+ * A vehicle, with the frames involved in its relative states.
+ */
+struct Vehicle
+{
+    BodyRefFrame composite_body;
+    BodyRefFrame structure;
+    BodyRefFrame docking_port;
+};
+
+/**
+ * Set a frame's state to a smooth function of time and stamp the frame.
+ */
+static void update_frame(RefFrame & frame, double time, double seed)
+{
+    RefFrameState & state = frame.state;
+    for(unsigned int ii = 0; ii < 3; ++ii)
+    {
+        state.trans.position[ii] = 1.0e4 * seed * sin(seed * (ii + 1) + 1.0e-3 * time);
+        state.trans.velocity[ii] = 1.0e1 * seed * cos(seed * (ii + 1) + 1.0e-3 * time);
+        state.rot.ang_vel_this[ii] = 1.0e-4 * seed * (ii + 1);
+    }
+    double half_angle = 0.5 * (seed + 1.0e-4 * time);
+    double axis[3] = {1.0 / sqrt(3.0), 1.0 / sqrt(3.0), 1.0 / sqrt(3.0)};
+    state.rot.Q_parent_this.scalar = cos(half_angle);
+    for(unsigned int ii = 0; ii < 3; ++ii)
+    {
+        state.rot.Q_parent_this.vector[ii] = -sin(half_angle) * axis[ii];
+    }
+    state.rot.compute_transformation();
+    state.rot.compute_ang_vel_products();
+    frame.set_timestamp(time);
+}
+
+/**
+ * Compare two states bit for bit.
+ */
+static bool same_state(const RefFrameState & a, const RefFrameState & b)
+{
+    return (memcmp(a.trans.position, b.trans.position, sizeof(a.trans.position)) == 0) &&
+           (memcmp(a.trans.velocity, b.trans.velocity, sizeof(a.trans.velocity)) == 0) &&
+           (memcmp(a.rot.T_parent_this, b.rot.T_parent_this, sizeof(a.rot.T_parent_this)) == 0) &&
+           (memcmp(a.rot.ang_vel_this, b.rot.ang_vel_this, sizeof(a.rot.ang_vel_this)) == 0) &&
+           (a.rot.Q_parent_this.scalar == b.rot.Q_parent_this.scalar) &&
+           (memcmp(a.rot.Q_parent_this.vector, b.rot.Q_parent_this.vector, sizeof(a.rot.Q_parent_this.vector)) == 0);
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_vehicles;
+    int num_relstates;
+    int num_steps;
+
+    cmdline_parser.add_int("NumVehicles", 40, &num_vehicles);
+    cmdline_parser.add_int("NumRelstates", 1000, &num_relstates);
+    cmdline_parser.add_int("NumSteps", 2000, &num_steps);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_vehicles < 2 || num_relstates <= 0 || num_steps <= 0)
+    {
+        cerr << "NumVehicles must be at least two; NumRelstates and NumSteps must be positive." << endl;
+        return 1;
+    }
+
+    // Build the tree.
+    RefFrame ssb;
+    RefFrame em_bary;
+    RefFrame earth_inertial;
+    RefFrame earth_pfix;
+    vector<Vehicle> vehicles(static_cast<unsigned int>(num_vehicles));
+
+    ssb.set_name("SSB.inertial");
+    ssb.make_root();
+    em_bary.set_name("EMBary.inertial");
+    ssb.add_child(em_bary);
+    earth_inertial.set_name("Earth.inertial");
+    em_bary.add_child(earth_inertial);
+    earth_pfix.set_name("Earth.pfix");
+    earth_inertial.add_child(earth_pfix);
+    for(unsigned int iv = 0; iv < vehicles.size(); ++iv)
+    {
+        string veh_name = "veh" + to_string(iv);
+        vehicles[iv].composite_body.set_name(veh_name, "composite_body");
+        vehicles[iv].structure.set_name(veh_name, "structure");
+        vehicles[iv].docking_port.set_name(veh_name, "docking_port");
+        earth_inertial.add_child(vehicles[iv].composite_body);
+        vehicles[iv].composite_body.add_child(vehicles[iv].structure);
+        vehicles[iv].structure.add_child(vehicles[iv].docking_port);
+    }
+
+    // Relative states from each vehicle's docking port to the other
+    // vehicles' docking ports and structures, with a few in the reverse
+    // sense, until the requested number has been registered.
+    RelativeKinematics rel_kin;
+    vector<unique_ptr<RelativeDerivedState>> relstates;
+    unsigned int nveh = vehicles.size();
+    auto nrel = static_cast<unsigned int>(num_relstates);
+    for(unsigned int offset = 1; (offset < nveh) && (relstates.size() < nrel); ++offset)
+    {
+        for(unsigned int iv = 0; (iv < nveh) && (relstates.size() < nrel); ++iv)
+        {
+            Vehicle & other = vehicles[(iv + offset) % nveh];
+            relstates.emplace_back(new RelativeDerivedState);
+            RelativeDerivedState & relstate = *relstates.back();
+            relstate.set_name("relstate" + to_string(relstates.size()));
+            relstate.set_subject_frame(vehicles[iv].docking_port);
+            relstate.set_target_frame((offset % 2 == 1) ? other.docking_port : other.structure);
+            relstate.direction_sense = (relstates.size() % 8 == 0) ? RelativeDerivedState::ComputeTargetStateinSubject
+                                                                   : RelativeDerivedState::ComputeSubjectStateinTarget;
+            rel_kin.add_relstate(relstate);
+        }
+    }
+
+    vector<RefFrameState> results[2];
+    double elapsed_ms[2] = {0.0, 0.0};
+
+    for(unsigned int pass = 0; pass < 2; ++pass)
+    {
+        rel_kin.batch_updates = (pass == 1);
+
+        for(int step = 0; step < num_steps; ++step)
+        {
+            double time = step;
+            update_frame(em_bary, time, 0.05);
+            update_frame(earth_inertial, time, 0.1);
+            update_frame(earth_pfix, time, 0.2);
+            for(unsigned int iv = 0; iv < nveh; ++iv)
+            {
+                update_frame(vehicles[iv].composite_body, time, 0.3 + 0.01 * iv);
+                update_frame(vehicles[iv].structure, time, 0.4 + 0.01 * iv);
+                update_frame(vehicles[iv].docking_port, time, 0.6 + 0.01 * iv);
+            }
+
+            auto start = chrono::steady_clock::now();
+            rel_kin.update_all();
+            auto stop = chrono::steady_clock::now();
+            elapsed_ms[pass] += chrono::duration<double, milli>(stop - start).count();
+        }
+
+        for(const auto & relstate : relstates)
+        {
+            results[pass].push_back(relstate->rel_state);
+        }
+    }
+
+    unsigned int num_diff = 0;
+    for(unsigned int ii = 0; ii < relstates.size(); ++ii)
+    {
+        num_diff += same_state(results[0][ii], results[1][ii]) ? 0 : 1;
+    }
+
+    cout << nveh << " vehicles, " << relstates.size() << " relative states, " << num_steps << " steps" << endl;
+    cout << fixed << setprecision(1);
+    cout << "  unbatched: " << setw(8) << 1.0e3 * elapsed_ms[0] / num_steps << " us/update_all" << endl;
+    cout << "  batched:   " << setw(8) << 1.0e3 * elapsed_ms[1] / num_steps << " us/update_all" << endl;
+    cout << "  " << num_diff << " differences" << endl;
+
+    return (num_diff == 0) ? 0 : 1;
+}
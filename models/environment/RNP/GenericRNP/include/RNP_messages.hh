@@ -115,6 +115,12 @@ public:
      */
     static const char * polar_motion_table_warning; //!< trick_units(--)
 
+    /**
+     * Indicates a cache file that could not be read or written, or whose
+     * contents do not match the model configuration.
+     */
+    static const char * cache_file_warning; //!< trick_units(--)
+
     // Class is not instantiable, operator = and copy constructor are
     // hidden from use.
     RNPMessages() = delete;
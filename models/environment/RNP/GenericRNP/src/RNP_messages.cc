@@ -51,6 +51,7 @@ MAKE_RNP_MESSAGE_CODE(setup_error);
 
 // Warnings
 MAKE_RNP_MESSAGE_CODE(polar_motion_table_warning);
+MAKE_RNP_MESSAGE_CODE(cache_file_warning);
 
 #undef MAKE_RNP_MESSAGE_CODE
 
@@ -74,6 +74,7 @@ Library dependencies:
 #define NUTATION_J2000_HH
 
 // System includes
+#include <string>
 
 // JEOD includes
 #include "environment/RNP/GenericRNP/include/planet_rotation.hh"
@@ -197,6 +198,44 @@ public: // public data members
      */
     double equa_of_equi{}; //!< trick_units(--)
 
+    /**
+     * When set, update_rotation obtains the nutation series sums from
+     * piecewise Chebyshev fits instead of summing the series term by term.
+     * Each segment spans fit_span days, aligned to whole multiples of
+     * fit_span from J2000, and fit_num_segments consecutive segments are
+     * fitted whenever the current time leaves the fitted range.
+     * With the default one day span and degree 10, the fitted nutation in
+     * longitude and in obliquity differ from the full series by less than
+     * 1e-15 radians, and the equation of the equinoxes by less than
+     * 1e-12 seconds.
+     */
+    bool use_chebyshev_fit{}; //!< trick_units(--)
+
+    /**
+     * Length of the time span covered by each fitted segment.
+     */
+    double fit_span{1.0}; //!< trick_units(day)
+
+    /**
+     * Degree of the Chebyshev polynomials fitted to each segment.
+     */
+    unsigned int fit_degree{10}; //!< trick_units(count)
+
+    /**
+     * Number of consecutive segments fitted at a time.
+     */
+    unsigned int fit_num_segments{32}; //!< trick_units(count)
+
+    /**
+     * Name of a file in which the fits are cached across runs.
+     * The file is read the first time fits are needed; if it is missing,
+     * unreadable, or was generated with a different configuration or
+     * different series coefficients, the fits are generated and the file
+     * is rewritten. Refits later in the run do not write the file;
+     * write_fit_cache saves the current fits on request.
+     */
+    std::string fit_cache_file; //!< trick_units(--)
+
 private: // private data members
 public:  // public member functions
     NutationJ2000() = default;
@@ -214,6 +253,52 @@ public:  // public member functions
     // nutation. init must be of type NutationJ2000Init or an exec_terminate
     // will occur
     void initialize(PlanetRotationInit * init) override;
+
+    // Sum the nutation series term by term at the given time.
+    void evaluate_series(double time, double & long_sum, double & obliq_sum) const;
+
+    // Obtain the nutation series sums at the given time from the fits.
+    void evaluate_fit(double time, double & long_sum, double & obliq_sum);
+
+    // Write the current fits to the cache file.
+    void write_fit_cache() const;
+
+protected: // protected member functions
+    // Compute the fundamental arguments at the given time.
+    static void compute_fundamental_arguments(
+        double time, double & L_out, double & M_out, double & F_out, double & D_out, double & omega_out);
+
+    // Fit fit_num_segments segments starting with the given segment.
+    void generate_fit(long first_segment);
+
+    // Fingerprint of the series coefficients, used to validate cache files.
+    double series_checksum() const;
+
+    // Read the fits from the cache file.
+    bool read_fit_cache(long needed_segment);
+
+protected: // protected data members
+    /**
+     * Chebyshev coefficients of the fitted segments. Each segment holds
+     * fit_degree+1 coefficients for the longitude sum followed by
+     * fit_degree+1 coefficients for the obliquity sum.
+     */
+    double * fit_coeffs{}; //!< trick_units(--)
+
+    /**
+     * Index of the first fitted segment, counted in fit_span days from J2000.
+     */
+    long fit_first_segment{}; //!< trick_units(count)
+
+    /**
+     * Number of valid segments in fit_coeffs; zero until first use.
+     */
+    unsigned int fit_count{}; //!< trick_units(count)
+
+    /**
+     * Set once the cache file has been consulted.
+     */
+    bool fit_cache_checked{}; //!< trick_units(--)
 };
 
 } // namespace jeod
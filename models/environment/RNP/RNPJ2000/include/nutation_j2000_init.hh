@@ -76,6 +76,7 @@ Library dependencies:
 #define NUTATION_J2000_INIT_HH
 
 // System includes
+#include <string>
 
 // JEOD includes
 #include "environment/RNP/GenericRNP/include/planet_rotation_init.hh"
@@ -151,6 +152,33 @@ public: // public data members
      */
     double * obliq_t_coeffs{}; //!< trick_units(--)
 
+    /**
+     * Evaluate the nutation series from piecewise Chebyshev fits rather
+     * than term by term. See NutationJ2000::use_chebyshev_fit.
+     */
+    bool use_chebyshev_fit{}; //!< trick_units(--)
+
+    /**
+     * Length of the time span covered by each fitted segment.
+     */
+    double fit_span{1.0}; //!< trick_units(day)
+
+    /**
+     * Degree of the Chebyshev polynomials fitted to each segment.
+     */
+    unsigned int fit_degree{10}; //!< trick_units(count)
+
+    /**
+     * Number of consecutive segments fitted at a time.
+     */
+    unsigned int fit_num_segments{32}; //!< trick_units(count)
+
+    /**
+     * Name of a file in which the fits are cached across runs.
+     * Leave empty to fit at run time only.
+     */
+    std::string fit_cache_file; //!< trick_units(--)
+
 public: // public member functions
     NutationJ2000Init() = default;
     ~NutationJ2000Init() override;
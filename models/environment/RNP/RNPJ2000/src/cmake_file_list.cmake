@@ -5,6 +5,7 @@ rnp_j2000.cc
 polar_motion_j2000_init.cc
 polar_motion_j2000.cc
 nutation_j2000.cc
+nutation_j2000_fit.cc
 precession_j2000.cc
 nutation_j2000_init.cc
 rotation_j2000.cc
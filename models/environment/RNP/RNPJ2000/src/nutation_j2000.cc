@@ -31,6 +31,7 @@ Class:
 
 Library dependencies:
   ((nutation_j2000.cc)
+   (nutation_j2000_fit.cc)
    (nutation_j2000_init.cc)
    (environment/RNP/GenericRNP/src/RNP_messages.cc)
    (environment/RNP/GenericRNP/src/planet_rotation.cc)
@@ -72,50 +73,98 @@ NutationJ2000::~NutationJ2000()
     JEOD_DELETE_ARRAY(long_t_coeffs);
     JEOD_DELETE_ARRAY(obliq_coeffs);
     JEOD_DELETE_ARRAY(obliq_t_coeffs);
+    JEOD_DELETE_ARRAY(fit_coeffs);
 }
 
 /**
- * Specific implementation of update_rotation, from the polymorphic
- * pure virtual base class PlanetRotation
+ * Compute the fundamental arguments of the nutation series.
+ * \param[in] time Julian centuries since J2000, TT
+ * \param[out] L_out Mean anomaly of the moon, degrees
+ * \param[out] M_out Mean anomaly of the sun, degrees
+ * \param[out] F_out Mean argument of latitude of the moon, degrees
+ * \param[out] D_out Mean elongation from the sun, degrees
+ * \param[out] omega_out Right ascension of the ascending node of the mean lunar orbit, degrees
  */
-void NutationJ2000::update_rotation()
+void NutationJ2000::compute_fundamental_arguments(
+    double time, double & L_out, double & M_out, double & F_out, double & D_out, double & omega_out)
 {
-    // This implements the Bond / Vallado implementation of J2000 nutation,
-    // as referenced in the documentation
-    // compute the fundamental arguments
     // time2 is the square of the time, time3 is the cube
-    double time = current_time;
-    double time2 = 0.0;
-    double time3 = 0.0;
-
-    time2 = time * time;
-    time3 = time2 * time;
+    double time2 = time * time;
+    double time3 = time2 * time;
 
     // the fundamental arguments are in degrees
 
-    L = 134.9629813888889 + 477198.8673980555 * time + 0.008697222222222223 * time2 + 0.00001777777777777778 * time3;
+    L_out = 134.9629813888889 + 477198.8673980555 * time + 0.008697222222222223 * time2 +
+            0.00001777777777777778 * time3;
 
-    M = 357.5277233333333 + 35999.05034 * time - 0.00016027777777777778 * time2 - 0.000003333333333333333 * time3;
+    M_out = 357.5277233333333 + 35999.05034 * time - 0.00016027777777777778 * time2 - 0.000003333333333333333 * time3;
 
-    F = 93.27191027777778 + 483202.0175380555 * time - 0.0036825 * time2 + 0.000003055555555555555 * time3;
+    F_out = 93.27191027777778 + 483202.0175380555 * time - 0.0036825 * time2 + 0.000003055555555555555 * time3;
 
-    D = 297.8503630555556 + 445267.11148 * time - 0.001914166666666667 * time2 + 0.0000052777777777777778 * time3;
+    D_out = 297.8503630555556 + 445267.11148 * time - 0.001914166666666667 * time2 + 0.0000052777777777777778 * time3;
 
-    omega = 125.0445222222222 - 1934.136260833333 * time + 0.00207083333333333 * time2 +
-            0.000002222222222222222 * time3;
+    omega_out = 125.0445222222222 - 1934.136260833333 * time + 0.00207083333333333 * time2 +
+                0.000002222222222222222 * time3;
+}
 
-    nutation_in_longitude = 0.0;
-    nutation_in_obliquity = 0.0;
+/**
+ * Sum the nutation series term by term.
+ * \param[in] time Julian centuries since J2000, TT
+ * \param[out] long_sum Nutation in longitude, 1e-4 arcseconds
+ * \param[out] obliq_sum Nutation in obliquity, 1e-4 arcseconds
+ */
+void NutationJ2000::evaluate_series(double time, double & long_sum, double & obliq_sum) const
+{
+    double L_t;
+    double M_t;
+    double F_t;
+    double D_t;
+    double omega_t;
+    compute_fundamental_arguments(time, L_t, M_t, F_t, D_t, omega_t);
+
+    long_sum = 0.0;
+    obliq_sum = 0.0;
     for(unsigned int i = 0; i < num_coeffs; ++i)
     {
-        double api = L_coeffs[i] * L + M_coeffs[i] * M + F_coeffs[i] * F + D_coeffs[i] * D + omega_coeffs[i] * omega;
+        double api = L_coeffs[i] * L_t + M_coeffs[i] * M_t + F_coeffs[i] * F_t + D_coeffs[i] * D_t +
+                     omega_coeffs[i] * omega_t;
         api *= DEGTORAD;
 
-        nutation_in_longitude += ((long_coeffs[i] + long_t_coeffs[i] * time)) * sin(api);
+        long_sum += ((long_coeffs[i] + long_t_coeffs[i] * time)) * sin(api);
 
-        nutation_in_obliquity += ((obliq_coeffs[i] + obliq_t_coeffs[i] * time)) * cos(api);
+        obliq_sum += ((obliq_coeffs[i] + obliq_t_coeffs[i] * time)) * cos(api);
 
     } // for(unsigned int i = 0)
+}
+
+/**
+ * Specific implementation of update_rotation, from the polymorphic
+ * pure virtual base class PlanetRotation
+ */
+void NutationJ2000::update_rotation()
+{
+    // This implements the Bond / Vallado implementation of J2000 nutation,
+    // as referenced in the documentation
+    // compute the fundamental arguments
+    // time2 is the square of the time, time3 is the cube
+    double time = current_time;
+    double time2 = 0.0;
+    double time3 = 0.0;
+
+    time2 = time * time;
+    time3 = time2 * time;
+
+    compute_fundamental_arguments(time, L, M, F, D, omega);
+
+    // Sum the series, or look the sums up in the fits if so configured.
+    if(use_chebyshev_fit)
+    {
+        evaluate_fit(time, nutation_in_longitude, nutation_in_obliquity);
+    }
+    else
+    {
+        evaluate_series(time, nutation_in_longitude, nutation_in_obliquity);
+    }
 
     // note that the numbers here have been converted from arcseconds to degrees
 
@@ -212,6 +261,27 @@ void NutationJ2000::initialize(PlanetRotationInit * init)
         obliq_coeffs[ii] = nut_init->obliq_coeffs[ii];
         obliq_t_coeffs[ii] = nut_init->obliq_t_coeffs[ii];
     }
+
+    use_chebyshev_fit = nut_init->use_chebyshev_fit;
+    fit_span = nut_init->fit_span;
+    fit_degree = nut_init->fit_degree;
+    fit_num_segments = nut_init->fit_num_segments;
+    fit_cache_file = nut_init->fit_cache_file;
+
+    if(use_chebyshev_fit && ((fit_span <= 0.0) || (fit_num_segments == 0)))
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             RNPMessages::initialization_error,
+                             "NutationJ2000 Chebyshev fit requires a positive "
+                             "fit_span and fit_num_segments");
+        return;
+    }
+
+    // Discard any fits made with a previous configuration.
+    JEOD_DELETE_ARRAY(fit_coeffs);
+    fit_count = 0;
+    fit_cache_checked = false;
 }
 
 } // namespace jeod
@@ -0,0 +1,318 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup RNP
+ * @{
+ * @addtogroup RNPJ2000
+ * @{
+ *
+ * @file models/environment/RNP/RNPJ2000/src/nutation_j2000_fit.cc
+ * Implementation of the Chebyshev fits of the NutationJ2000 series
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+      (((Press, William H. et al.)
+        (Numerical Recipes in C, Second Edition)
+        (Cambridge University Press) (1992) (Section 5.8: Chebyshev
+         Approximation)))
+
+Assumptions and limitations:
+  ((Earth specific) (Must be initialized))
+
+Class:
+  (NutationJ2000)
+
+Library dependencies:
+  ((nutation_j2000_fit.cc)
+   (nutation_j2000.cc)
+   (environment/RNP/GenericRNP/src/RNP_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+// System includes
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <string>
+
+// JEOD includes
+#include "environment/RNP/GenericRNP/include/RNP_messages.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/nutation_j2000.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+/**
+ * First line of a NutationJ2000 fit cache file.
+ */
+static const char * const fit_cache_header = "JEOD NutationJ2000 Chebyshev fit, version 1";
+
+/**
+ * Obtain the nutation series sums at the given time from the Chebyshev
+ * fits, fitting a new range of segments if the time is outside the
+ * currently fitted range.
+ * \param[in] time Julian centuries since J2000, TT
+ * \param[out] long_sum Nutation in longitude, 1e-4 arcseconds
+ * \param[out] obliq_sum Nutation in obliquity, 1e-4 arcseconds
+ */
+void NutationJ2000::evaluate_fit(double time, double & long_sum, double & obliq_sum)
+{
+    double days = time * JULIANCENTTODAY;
+    double segment_start = std::floor(days / fit_span);
+    auto segment = static_cast<long>(segment_start);
+
+    if((fit_count == 0) || (segment < fit_first_segment) ||
+       (segment >= fit_first_segment + static_cast<long>(fit_count)))
+    {
+        // The cache file is consulted once, when the fits are first needed,
+        // and written then if it did not hold them. Later refits are kept
+        // in memory only, so that no file is written during the run.
+        if(!fit_cache_checked && !fit_cache_file.empty())
+        {
+            fit_cache_checked = true;
+            if(!read_fit_cache(segment))
+            {
+                generate_fit(segment);
+                write_fit_cache();
+            }
+        }
+        else
+        {
+            generate_fit(segment);
+        }
+    }
+
+    unsigned int stride = fit_degree + 1;
+    const double * long_fit = fit_coeffs + 2 * stride * static_cast<unsigned int>(segment - fit_first_segment);
+    const double * obliq_fit = long_fit + stride;
+
+    // Map the time to [-1, 1] over the segment and evaluate with
+    // Clenshaw's recurrence.
+    double x = 2.0 * (days - segment_start * fit_span) / fit_span - 1.0;
+    double two_x = 2.0 * x;
+    double long_b1 = 0.0;
+    double long_b2 = 0.0;
+    double obliq_b1 = 0.0;
+    double obliq_b2 = 0.0;
+    for(unsigned int kk = fit_degree; kk > 0; --kk)
+    {
+        double long_b0 = two_x * long_b1 - long_b2 + long_fit[kk];
+        long_b2 = long_b1;
+        long_b1 = long_b0;
+
+        double obliq_b0 = two_x * obliq_b1 - obliq_b2 + obliq_fit[kk];
+        obliq_b2 = obliq_b1;
+        obliq_b1 = obliq_b0;
+    }
+
+    long_sum = x * long_b1 - long_b2 + long_fit[0];
+    obliq_sum = x * obliq_b1 - obliq_b2 + obliq_fit[0];
+}
+
+/**
+ * Fit Chebyshev polynomials to the nutation series sums over
+ * fit_num_segments consecutive segments. The fits interpolate the series
+ * at the Chebyshev nodes of each segment.
+ * \param[in] first_segment Index of the first segment, counted in
+ *                          fit_span days from J2000
+ */
+void NutationJ2000::generate_fit(long first_segment)
+{
+    unsigned int num_nodes = fit_degree + 1;
+
+    JEOD_DELETE_ARRAY(fit_coeffs);
+    fit_coeffs = JEOD_ALLOC_PRIM_ARRAY(2 * num_nodes * fit_num_segments, double);
+
+    double * long_values = JEOD_ALLOC_PRIM_ARRAY(num_nodes, double);
+    double * obliq_values = JEOD_ALLOC_PRIM_ARRAY(num_nodes, double);
+
+    for(unsigned int seg = 0; seg < fit_num_segments; ++seg)
+    {
+        double segment_start = static_cast<double>(first_segment + static_cast<long>(seg)) * fit_span;
+        double half_span = 0.5 * fit_span;
+
+        for(unsigned int jj = 0; jj < num_nodes; ++jj)
+        {
+            double node = std::cos(M_PI * (jj + 0.5) / num_nodes);
+            double days = segment_start + half_span * (node + 1.0);
+            evaluate_series(days * DAYTOJULIANCENT, long_values[jj], obliq_values[jj]);
+        }
+
+        double * long_fit = fit_coeffs + 2 * num_nodes * seg;
+        double * obliq_fit = long_fit + num_nodes;
+        for(unsigned int kk = 0; kk < num_nodes; ++kk)
+        {
+            double long_acc = 0.0;
+            double obliq_acc = 0.0;
+            for(unsigned int jj = 0; jj < num_nodes; ++jj)
+            {
+                double weight = std::cos(M_PI * kk * (jj + 0.5) / num_nodes);
+                long_acc += long_values[jj] * weight;
+                obliq_acc += obliq_values[jj] * weight;
+            }
+            double scale = (kk == 0) ? 1.0 / num_nodes : 2.0 / num_nodes;
+            long_fit[kk] = long_acc * scale;
+            obliq_fit[kk] = obliq_acc * scale;
+        }
+    }
+
+    JEOD_DELETE_ARRAY(long_values);
+    JEOD_DELETE_ARRAY(obliq_values);
+
+    fit_first_segment = first_segment;
+    fit_count = fit_num_segments;
+}
+
+/**
+ * Compute a fingerprint of the series coefficients. A cache file written
+ * with different coefficients is rejected.
+ * @return Weighted sum of the series coefficients
+ */
+double NutationJ2000::series_checksum() const
+{
+    double sum = 0.0;
+    for(unsigned int ii = 0; ii < num_coeffs; ++ii)
+    {
+        double term = L_coeffs[ii] + 2.0 * M_coeffs[ii] + 3.0 * F_coeffs[ii] + 4.0 * D_coeffs[ii] +
+                      5.0 * omega_coeffs[ii] + 6.0 * long_coeffs[ii] + 7.0 * long_t_coeffs[ii] +
+                      8.0 * obliq_coeffs[ii] + 9.0 * obliq_t_coeffs[ii];
+        sum += term * (ii + 1);
+    }
+    return sum;
+}
+
+/**
+ * Read the fits from the cache file. The file is accepted only if it was
+ * generated with the current configuration and series coefficients and
+ * contains the needed segment.
+ * \param[in] needed_segment Index of the segment that must be present
+ * @return True if the fits were read
+ */
+bool NutationJ2000::read_fit_cache(long needed_segment)
+{
+    std::ifstream cache(fit_cache_file.c_str());
+    if(!cache)
+    {
+        // A missing file is expected on the first run.
+        return false;
+    }
+
+    std::string header;
+    std::getline(cache, header);
+
+    unsigned int file_num_coeffs = 0;
+    unsigned int file_degree = 0;
+    unsigned int file_num_segments = 0;
+    double file_span = 0.0;
+    double file_checksum = 0.0;
+    long file_first_segment = 0;
+    cache >> file_num_coeffs >> file_degree >> file_span >> file_checksum >> file_first_segment >> file_num_segments;
+
+    if(!cache || (header != fit_cache_header) || (file_num_coeffs != num_coeffs) || (file_degree != fit_degree) ||
+       (file_span != fit_span) || (file_checksum != series_checksum()) || (file_num_segments != fit_num_segments))
+    {
+        MessageHandler::warn(__FILE__,
+                             __LINE__,
+                             RNPMessages::cache_file_warning,
+                             "NutationJ2000 cache file '%s' does not match the model configuration; "
+                             "the fits will be regenerated.",
+                             fit_cache_file.c_str());
+        return false;
+    }
+
+    if((needed_segment < file_first_segment) ||
+       (needed_segment >= file_first_segment + static_cast<long>(file_num_segments)))
+    {
+        return false;
+    }
+
+    unsigned int total = 2 * (fit_degree + 1) * fit_num_segments;
+    double * values = JEOD_ALLOC_PRIM_ARRAY(total, double);
+    for(unsigned int ii = 0; ii < total; ++ii)
+    {
+        cache >> values[ii];
+    }
+
+    if(!cache)
+    {
+        JEOD_DELETE_ARRAY(values);
+        MessageHandler::warn(__FILE__,
+                             __LINE__,
+                             RNPMessages::cache_file_warning,
+                             "NutationJ2000 cache file '%s' is truncated; the fits will be regenerated.",
+                             fit_cache_file.c_str());
+        return false;
+    }
+
+    JEOD_DELETE_ARRAY(fit_coeffs);
+    fit_coeffs = values;
+    fit_first_segment = file_first_segment;
+    fit_count = file_num_segments;
+
+    return true;
+}
+
+/**
+ * Write the fits to the cache file. The coefficients are written with
+ * enough digits to be read back exactly. This is done automatically only
+ * for the first fits of a run; call it, e.g. from a shutdown job, to save
+ * the fits current at that time instead. Nothing is written if there is no
+ * cache file or no fit.
+ */
+void NutationJ2000::write_fit_cache() const
+{
+    if(fit_cache_file.empty() || (fit_count == 0))
+    {
+        return;
+    }
+
+    std::ofstream cache(fit_cache_file.c_str());
+    if(!cache)
+    {
+        MessageHandler::warn(__FILE__,
+                             __LINE__,
+                             RNPMessages::cache_file_warning,
+                             "Unable to write NutationJ2000 cache file '%s'.",
+                             fit_cache_file.c_str());
+        return;
+    }
+
+    unsigned int stride = fit_degree + 1;
+
+    cache << fit_cache_header << '\n';
+    cache << std::setprecision(17);
+    cache << num_coeffs << ' ' << fit_degree << ' ' << fit_span << ' ' << series_checksum() << ' '
+          << fit_first_segment << ' ' << fit_count << '\n';
+    for(unsigned int seg = 0; seg < fit_count; ++seg)
+    {
+        const double * segment_fit = fit_coeffs + 2 * stride * seg;
+        for(unsigned int kk = 0; kk < 2 * stride; ++kk)
+        {
+            cache << segment_fit[kk] << ((kk + 1 < 2 * stride) ? ' ' : '\n');
+        }
+    }
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ * @}
+ */
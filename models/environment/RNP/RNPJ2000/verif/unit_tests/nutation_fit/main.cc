@@ -0,0 +1,248 @@
+// Compare the Chebyshev-fit evaluation of the NutationJ2000 series against
+// the term-by-term evaluation, for accuracy and for speed.
+
+// System includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+// JEOD includes
+#include "environment/RNP/RNPJ2000/data/include/nutation_j2000.hh"
+#include "environment/RNP/RNPJ2000/include/nutation_j2000.hh"
+#include "environment/RNP/RNPJ2000/include/nutation_j2000_init.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+
+using namespace std;
+using namespace jeod;
+
+/**
+ * Results of comparing a fitted nutation model against the full series.
+ */
+struct FitErrors
+{
+    double longitude{};
+    double obliquity{};
+    double equinox{};
+    double rotation{};
+};
+
+/**
+ * Generate reproducible times, in Julian centuries TT, from 1990 to 2050,
+ * in increasing order.
+ */
+static void make_random_times(unsigned int num_times, vector<double> & times)
+{
+    unsigned long seed = 24680;
+    times.resize(num_times);
+    for(unsigned int ii = 0; ii < num_times; ++ii)
+    {
+        seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+        double frac = static_cast<double>(seed) / 2147483648.0;
+        times[ii] = -0.1 + 0.5 * frac;
+    }
+    std::sort(times.begin(), times.end());
+}
+
+/**
+ * Generate equally spaced times, in Julian centuries TT, starting in 2025,
+ * as a simulation calling the model at a fixed rate would.
+ */
+static void make_stepped_times(unsigned int num_times, double step, vector<double> & times)
+{
+    times.resize(num_times);
+    for(unsigned int ii = 0; ii < num_times; ++ii)
+    {
+        times[ii] = (9131.0 + ii * step / 86400.0) / 36525.0;
+    }
+}
+
+/**
+ * Read a whole file.
+ */
+static string read_file(const char * name)
+{
+    ifstream file(name);
+    return string(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+}
+
+/**
+ * Update the model at each time and save the outputs.
+ */
+static void run_model(NutationJ2000 & nutation, const vector<double> & times, vector<double> & outputs)
+{
+    outputs.resize(13 * times.size());
+    for(unsigned int ii = 0; ii < times.size(); ++ii)
+    {
+        nutation.current_time = times[ii];
+        nutation.update_rotation();
+        double * out = &outputs[13 * ii];
+        out[0] = nutation.nutation_in_longitude;
+        out[1] = nutation.nutation_in_obliquity;
+        out[2] = nutation.equa_of_equi;
+        for(unsigned int jj = 0; jj < 9; ++jj)
+        {
+            out[3 + jj] = nutation.rotation[jj / 3][jj % 3];
+        }
+    }
+}
+
+/**
+ * Time the updates of the model at the given times.
+ * @return Time per update, in nanoseconds
+ */
+static double time_model(NutationJ2000 & nutation, const vector<double> & times, vector<double> & outputs)
+{
+    auto start = chrono::steady_clock::now();
+    run_model(nutation, times, outputs);
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(stop - start).count() / times.size();
+}
+
+static FitErrors compare(const vector<double> & ref, const vector<double> & fit)
+{
+    FitErrors errors;
+    for(unsigned int ii = 0; ii < ref.size(); ii += 13)
+    {
+        errors.longitude = fmax(errors.longitude, fabs(ref[ii] - fit[ii]));
+        errors.obliquity = fmax(errors.obliquity, fabs(ref[ii + 1] - fit[ii + 1]));
+        errors.equinox = fmax(errors.equinox, fabs(ref[ii + 2] - fit[ii + 2]));
+        for(unsigned int jj = 3; jj < 12; ++jj)
+        {
+            errors.rotation = fmax(errors.rotation, fabs(ref[ii + jj] - fit[ii + jj]));
+        }
+    }
+    return errors;
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    NutationJ2000Init_nutation_j2000_default_data nutation_default_data;
+    NutationJ2000Init nut_init;
+    NutationJ2000 reference;
+    int num_times;
+    int num_steps;
+    double step;
+    double span;
+    double tolerance;
+    std::string cache_file;
+
+    cmdline_parser.add_int("NumTimes", 200000, &num_times);
+    cmdline_parser.add_int("NumSteps", 864000, &num_steps);
+    cmdline_parser.add_double("Step", 1.0, &step);
+    cmdline_parser.add_double("Span", 1.0, &span);
+    cmdline_parser.add_double("Tolerance", 1.0e-15, &tolerance);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_times <= 0 || num_steps <= 0 || step <= 0.0 || span <= 0.0)
+    {
+        cerr << "NumTimes, NumSteps, Step, and Span must be positive." << endl;
+        return 1;
+    }
+
+    nutation_default_data.initialize(&nut_init);
+    reference.initialize(&nut_init);
+
+    // Accuracy is assessed at random times over six decades;
+    // speed at a fixed rate over NumSteps steps.
+    vector<double> times;
+    vector<double> steps;
+    make_random_times(static_cast<unsigned int>(num_times), times);
+    make_stepped_times(static_cast<unsigned int>(num_steps), step, steps);
+
+    vector<double> ref_out;
+    vector<double> ref_steps_out;
+    run_model(reference, times, ref_out);
+    double series_ns = time_model(reference, steps, ref_steps_out);
+
+    int rv = 0;
+
+    cout << "Accuracy times: " << times.size() << ", timing steps: " << steps.size() << " of " << step
+         << " s, span: " << span << " day" << endl;
+    cout << "Full series: " << fixed << setprecision(1) << series_ns << " ns/update" << endl;
+    cout.unsetf(ios::floatfield);
+    cout << setw(8) << "degree" << setw(12) << "ns/update" << setw(14) << "dpsi (rad)" << setw(14) << "deps (rad)"
+         << setw(14) << "EoE (s)" << setw(14) << "matrix" << endl;
+
+    for(unsigned int degree = 6; degree <= 16; degree += 2)
+    {
+        nut_init.use_chebyshev_fit = true;
+        nut_init.fit_span = span;
+        nut_init.fit_degree = degree;
+        NutationJ2000 fitted;
+        fitted.initialize(&nut_init);
+
+        vector<double> fit_out;
+        run_model(fitted, times, fit_out);
+        FitErrors errors = compare(ref_out, fit_out);
+
+        NutationJ2000 fitted_steps;
+        fitted_steps.initialize(&nut_init);
+        double fit_ns = time_model(fitted_steps, steps, fit_out);
+        cout << setw(8) << degree << setw(12) << fixed << setprecision(1) << fit_ns << scientific
+             << setprecision(2) << setw(14) << errors.longitude << setw(14) << errors.obliquity << setw(14)
+             << errors.equinox << setw(14) << errors.rotation << endl;
+        cout.unsetf(ios::floatfield);
+
+        // The documented bound applies to the default configuration.
+        if(degree == 10 && span == 1.0 &&
+           (errors.longitude > tolerance || errors.obliquity > tolerance || errors.equinox > 1.0e3 * tolerance))
+        {
+            cout << "Failed tolerance " << tolerance << " at degree " << degree << endl;
+            rv = 1;
+        }
+    }
+
+    // Round trip through a cache file: the reloaded fit must reproduce
+    // the freshly generated fit exactly.
+    char cache_name[] = "/tmp/nutation_fit_XXXXXX";
+    int fd = mkstemp(cache_name);
+    if(fd >= 0)
+    {
+        close(fd);
+        remove(cache_name);
+        nut_init.fit_degree = 10;
+        nut_init.fit_cache_file = cache_name;
+
+        NutationJ2000 writer;
+        writer.initialize(&nut_init);
+        vector<double> write_out;
+        run_model(writer, vector<double>(1, times[0]), write_out);
+
+        NutationJ2000 reader;
+        reader.initialize(&nut_init);
+        vector<double> read_out;
+        run_model(reader, vector<double>(1, times[0]), read_out);
+
+        bool same = (write_out == read_out);
+        cout << "Cache file round trip: " << (same ? "identical" : "DIFFERENT") << endl;
+        if(!same)
+        {
+            rv = 1;
+        }
+
+        // A refit later in the run must leave the file alone.
+        string before = read_file(cache_name);
+        vector<double> refit_out;
+        run_model(writer, vector<double>(1, times[0] + 0.1), refit_out);
+        bool untouched = (read_file(cache_name) == before);
+        cout << "Cache file after a refit: " << (untouched ? "unchanged" : "REWRITTEN") << endl;
+        if(!untouched)
+        {
+            rv = 1;
+        }
+        remove(cache_name);
+    }
+
+    return rv;
+}
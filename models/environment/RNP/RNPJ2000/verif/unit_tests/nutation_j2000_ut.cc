@@ -19,3 +19,7 @@ TEST(NutationJ2000, create)
 TEST(NutationJ2000, update_rotation) {}
 
 TEST(NutationJ2000, initialize) {}
+
+TEST(NutationJ2000, evaluate_series) {}
+
+TEST(NutationJ2000, evaluate_fit) {}
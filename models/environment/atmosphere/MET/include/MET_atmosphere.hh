@@ -55,7 +55,8 @@ ASSUMPTIONS AND LIMITATIONS:
      object for the update_state call. Otherwise there can be unexpected
      behavior))
 LIBRARY DEPENDENCIES:
-   (../src/MET_atmosphere.cc)
+   ((../src/MET_atmosphere.cc)
+    (../src/MET_atmosphere_batch.cc))
 
 *******************************************************************************/
 
@@ -63,6 +64,7 @@ LIBRARY DEPENDENCIES:
 #define JEOD_MET_ATMOSPHERE_HH
 
 // System includes
+#include <vector>
 
 // JEOD includes
 #include "environment/time/include/time_utc.hh"
@@ -138,6 +140,8 @@ public:
                      The computed tempeerature at the current altitude.*/
     void update();
     double compute_temperature(double altitude_km);
+    double compute_temperature(double altitude_km, double T_exo, double T_125_in) const;
+    static double compute_T_125(double T_exo);
     METAtmosphereThermal(const double & T_exosphere, const double & altitude_km);
     virtual ~METAtmosphereThermal() = default;
     METAtmosphereThermal & operator=(const METAtmosphereThermal &) = delete;
@@ -233,6 +237,25 @@ private:                  // private member variables
 
     double solar_hour_angle{}; /*!< trick_units(rad) solar hour angle */
 
+    double solar_right_ascension{}; /*!< trick_units(rad) right ascension of the Sun */
+
+    double greenwich_mean_angle{}; /*!< trick_units(rad) Greenwich mean position */
+
+    double solar_activity_variation{}; /*!< trick_units(K)
+        solar-activity term of the exospheric temperature */
+
+    double geomagnetic_variation{}; /*!< trick_units(K)
+        geomagnetic term of the exospheric temperature */
+
+    double semiannual_variation{}; /*!< trick_units(K)
+        semiannual term of the exospheric temperature */
+
+    std::vector<double> batch_work; /*!< trick_io(**)
+        Per-position work arrays used by update_atmosphere_batch. */
+
+    std::vector<unsigned int> batch_order; /*!< trick_io(**)
+        Positions in the order in which update_atmosphere_batch evaluates them. */
+
     METAtmosphereStateVars state; /*!< trick_units(--)
        A scratch set of state variables, used for populating state
        variables internally before being copied onto the real state. */
@@ -307,12 +330,27 @@ public: // public member functions
     void update_atmosphere(const PlanetFixedPosition * pfix_pos, AtmosphereState * state) override;
     void update_atmosphere(const PlanetFixedPosition * pfix_pos, METAtmosphereStateVars * state);
 
+    // Evaluate the atmosphere at many positions at the current time.
+    void update_atmosphere_batch(unsigned int num_points,
+                                 const double * altitude,
+                                 const double * latitude,
+                                 const double * longitude,
+                                 METAtmosphereStateVars * states);
+
 private: // private member functions
     void update_atmosphere(const PlanetFixedPosition * pfix_pos);
+    void evaluate_position();
+    void complete_state();
     void modify_densities();
     void compute_solar_angles();
+    void compute_solar_hour_angle();
+    void compute_exospheric_time_terms();
     void compute_exospheric_temperature();
     void jacchia();
+    void compute_densities(double temperature_ceiling_A,
+                           double integral_Mg_RT,
+                           double integral_g_RT,
+                           double integral_g_RT_500);
     void compute_seasonal_latitude_variation();
     void compute_seasonal_lat_variation_He();
     void atmos_MET_FAIR5();
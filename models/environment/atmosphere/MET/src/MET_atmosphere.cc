@@ -96,17 +96,26 @@ Notes: (The temperature at 125 km is a function of the exospheric
         temperature and is empirically derived)
 *****************************************************************************/
 void METAtmosphereThermal::update()
+{
+    T_125 = compute_T_125(T_exosphere);
+    T_out = compute_temperature(altitude_km);
+}
+
+/*****************************************************************************
+compute_T_125
+Purpose:(Returns the temperature at the 125 km inflection point for a given
+         exospheric temperature.)
+*****************************************************************************/
+double METAtmosphereThermal::compute_T_125(double T_exo)
 {
     // T_125 represents T_x in the Jacchia papers.
     // See eq(9) in either Jacchia paper.
     //  TODO 1970/71 inconsistency
     //       1970:
-    T_125 = 444.3807 + (0.02385 * T_exosphere) - (392.8292 * exp(-0.0021357 * T_exosphere));
+    return 444.3807 + (0.02385 * T_exo) - (392.8292 * exp(-0.0021357 * T_exo));
     //       1971:
-    // T_125    = 371.6678 + (0.0518806 * T_exosphere) -
-    //             (294.3505 * exp (-0.00216222 * T_exosphere));
-
-    T_out = compute_temperature(altitude_km);
+    // return 371.6678 + (0.0518806 * T_exo) -
+    //        (294.3505 * exp (-0.00216222 * T_exo));
 }
 
 /*****************************************************************************
@@ -144,6 +153,17 @@ Assumptions:(( All temperature profiles:
 
 *****************************************************************************/
 double METAtmosphereThermal::compute_temperature(double altitude_km_in)
+{
+    return compute_temperature(altitude_km_in, T_exosphere, T_125);
+}
+
+/*****************************************************************************
+compute_temperature
+Purpose:(Returns the temperature at a specified altitude for the given
+         exospheric temperature and temperature at 125 km, so that profiles
+         for several positions can be evaluated without updating the model.)
+*****************************************************************************/
+double METAtmosphereThermal::compute_temperature(double altitude_km_in, double T_exo, double T_125_in) const
 {
     // temperature-offset is the difference between temperatures at the 125km and
     // 90km altitude reference points:
@@ -176,20 +196,20 @@ double METAtmosphereThermal::compute_temperature(double altitude_km_in)
     // base-altitude is delta-altitude above 125 km.
     double dz = altitude_km_in - 125.0;
     double dz_2 = dz * dz;
-    double dT = T_125 - T_90;
+    double dT = T_125_in - T_90;
 
     if(dz <= 0.0)
     {
         // obtain the temperature as a polynomial in z:
         double dz_3 = dz * dz_2;
         double dz_4 = dz_2 * dz_2;
-        return T_125 + dT * ((k_1 * dz) + (k_3 * dz_3) + (k_4 * dz_4));
+        return T_125_in + dT * ((k_1 * dz) + (k_3 * dz_3) + (k_4 * dz_4));
     }
     // else use equation 13, which is identical both Jacchia papers:
     double dz_2_5 = dz_2 * sqrt(dz);
-    double coeff_A = 2 * (T_exosphere - T_125) / M_PI;
+    double coeff_A = 2 * (T_exo - T_125_in) / M_PI;
     //   magic number 4.5E-6 is empirical, identified as "B" in eq(13).
-    return T_125 + coeff_A * std::atan2(k_1 * dT * dz * (1.0 + (4.5E-6 * dz_2_5)), coeff_A);
+    return T_125_in + coeff_A * std::atan2(k_1 * dT * dz * (1.0 + (4.5E-6 * dz_2_5)), coeff_A);
 }
 
 /****************************************************************************
@@ -273,15 +293,36 @@ void METAtmosphere::update_atmosphere(const PlanetFixedPosition * pfix_pos)
     latitude = pfix_pos->ellip_coords.latitude;
     longitude = pfix_pos->ellip_coords.longitude;
 
-    // Compute the solar data.
+    // Compute the terms that depend on time only.
     compute_solar_angles();
-    // Compute exospheric temperature.
+    compute_exospheric_time_terms();
+
+    evaluate_position();
+}
+
+/*****************************************************************************
+evaluate_position
+Purpose:(Computes the scratch state at the current altitude, latitude, and
+         longitude, given the time-dependent terms.)
+*****************************************************************************/
+void METAtmosphere::evaluate_position()
+{
+    // Compute the solar hour angle and exospheric temperature here.
+    compute_solar_hour_angle();
     compute_exospheric_temperature();
     // Call the main Jacchia atmosphere routine.
     jacchia();
     // Apply density modifications:
     modify_densities();
+    complete_state();
+}
 
+/*****************************************************************************
+complete_state
+Purpose:(Completes the scratch state from the computed densities.)
+*****************************************************************************/
+void METAtmosphere::complete_state()
+{
     /* Finish computations of density. */
     state.log10_dens = log10(state.density);
     state.N2 = species.num_density[0];
@@ -345,6 +386,9 @@ ASSUMPTIONS AND LIMITATIONS:
 ******************************************************************************/
 void METAtmosphere::compute_solar_angles()
 {
+    // The solar hour angle, which also depends on longitude, is computed
+    // separately by compute_solar_hour_angle.
+
     //****************************************************************************
     // PART A - compute the necessary time representations
     //****************************************************************************
@@ -461,7 +505,7 @@ void METAtmosphere::compute_solar_angles()
     // If the ratio is out-of-bounds, assign to pi/2.
     // The RA has to be put into the same quadrant as the celestial longitude,
     // so for now generate RA in the first quadrant.
-    double solar_right_ascension = M_PI_2;
+    solar_right_ascension = M_PI_2;
     if(std::abs(scratch1) < std::abs(scratch2))
     {
         solar_right_ascension = std::abs(asin(scratch1 / scratch2));
@@ -498,11 +542,20 @@ void METAtmosphere::compute_solar_angles()
     double greenwich_mean_position = std::fmod((A1 + (A2 * century_frac) + (A3 * century_frac * century_frac) +
                                                 (A4 * minutes_of_day)),
                                                360.0);
+    greenwich_mean_angle = greenwich_mean_position * deg_to_rad;
+}
 
+/*****************************************************************************
+compute_solar_hour_angle
+Purpose:(Computes the solar hour angle at the current longitude from the
+         time-dependent terms computed by compute_solar_angles.)
+*****************************************************************************/
+void METAtmosphere::compute_solar_hour_angle()
+{
     // previous algorithm's application of constraints on right ascension
     // point (RAP) was unnecessary because it is local, and constraint gets
     // applied in the computation of solar-hour-angle anyway.
-    double right_ascension_point = greenwich_mean_position * deg_to_rad + longitude;
+    double right_ascension_point = greenwich_mean_angle + longitude;
     solar_hour_angle = right_ascension_point - solar_right_ascension;
     while(solar_hour_angle > M_PI)
     {
@@ -553,23 +606,6 @@ void METAtmosphere::compute_exospheric_temperature()
                              "errors in the results of this function.\n");
     }
 
-    //****************************************************************************
-    // PART A - compute the solar-activity variation
-    //****************************************************************************
-    // Ci are solar activity variables
-    //  TODO 1970/71 inconsistency
-    //       1970:
-    const double C1 = 383.0;
-    const double C2 = 3.32;
-    const double C3 = 1.80;
-    //       1971:
-    // const double C1 = 379.0;
-    // const double C2 = 3.24;
-    // const double C3 = 1.30;
-
-    //       See equation 14.
-    double solar_activity_variation = C1 + C2 * F10B + C3 * (F10 - F10B);
-
     //****************************************************************************
     // PART B - compute the diurnal variation see Jacchia(1971) p 28
     //****************************************************************************a
@@ -609,6 +645,34 @@ void METAtmosphere::compute_exospheric_temperature()
 
     // A simpler way of writing equation 17:
     double diurnal_variation = 1.0 + RE * (A1 + A3 * (A2 - A1));
+    // Exospheric temperature (method output)
+    state.exo_temp = solar_activity_variation * diurnal_variation + geomagnetic_variation + semiannual_variation;
+}
+
+/*****************************************************************************
+compute_exospheric_time_terms
+Purpose:(Computes the solar-activity, geomagnetic, and semiannual variations
+         of the exospheric temperature, which depend on time only.)
+*****************************************************************************/
+void METAtmosphere::compute_exospheric_time_terms()
+{
+    //****************************************************************************
+    // PART A - compute the solar-activity variation
+    //****************************************************************************
+    // Ci are solar activity variables
+    //  TODO 1970/71 inconsistency
+    //       1970:
+    const double C1 = 383.0;
+    const double C2 = 3.32;
+    const double C3 = 1.80;
+    //       1971:
+    // const double C1 = 379.0;
+    // const double C2 = 3.24;
+    // const double C3 = 1.30;
+
+    //       See equation 14.
+    solar_activity_variation = C1 + C2 * F10B + C3 * (F10 - F10B);
+
     //****************************************************************************
     // PART C - compute the geomagnetic variation
     //****************************************************************************
@@ -617,7 +681,7 @@ void METAtmosphere::compute_exospheric_temperature()
     const double D3 = 1.0;
     const double D4 = 100.0;
     const double D5 = -0.08;
-    double geomagnetic_variation = 0.0;
+    geomagnetic_variation = 0.0;
     //  TODO 1970/71 inconsistency
     //       1970: as implemented here
     //       1971: completely new formulations.  Not implemented at all.
@@ -660,10 +724,7 @@ void METAtmosphere::compute_exospheric_temperature()
     double sav_a = E2 + E3 * (std::sin(2 * M_PI * tau1 + E4));
     double sav_b = std::sin(4 * M_PI * tau1 + E5);
     // equation 23:
-    double semiannual_variation = E1 + F10B * sav_a * sav_b;
-
-    // Exospheric temperature (method output)
-    state.exo_temp = solar_activity_variation * diurnal_variation + geomagnetic_variation + semiannual_variation;
+    semiannual_variation = E1 + F10B * sav_a * sav_b;
 }
 
 /*****************************************************************************
@@ -743,6 +804,34 @@ void METAtmosphere::jacchia()
     // if the integration ceiling is 105km, it still has to be integrated.
     double integral_Mg_RT = apply_gauss_quadrature(0, integration_ceiling_A) / R_gas_constant;
 
+    // Integrals of (g/RT) from the barometric ceiling and from 500 km to the
+    // current altitude, for the diffusion equation.
+    double integral_g_RT = 0.0;
+    double integral_g_RT_500 = 0.0;
+    if(altitude_km > barometric_equation_ceiling)
+    {
+        integral_g_RT = apply_gauss_quadrature(1, altitude_km) / R_gas_constant;
+    }
+    if(altitude_km > 500.0)
+    {
+        integral_g_RT_500 = apply_gauss_quadrature(6, altitude_km) / R_gas_constant;
+    }
+
+    compute_densities(temperature_ceiling_A, integral_Mg_RT, integral_g_RT, integral_g_RT_500);
+}
+
+/*****************************************************************************
+compute_densities
+Purpose:(Completes the Jacchia computation of the total density, the mean
+         molecular weight, and the species number densities, given the
+         temperature at the integration ceiling and the integrals over
+         altitude computed by jacchia.)
+*****************************************************************************/
+void METAtmosphere::compute_densities(double temperature_ceiling_A,
+                                      double integral_Mg_RT,
+                                      double integral_g_RT,
+                                      double integral_g_RT_500)
+{
     // Now put it all together:
 
     // Magic number:
@@ -798,8 +887,8 @@ void METAtmosphere::jacchia()
     //****************************************************************************
     if(altitude_km > barometric_equation_ceiling)
     {
-        /* Integrate (g/T) from barometric_ceiling (index 1) to alt km :- */
-        double integral_g_RT = apply_gauss_quadrature(1, altitude_km) / R_gas_constant;
+        // integral_g_RT is the integral of (g/RT) from the barometric ceiling
+        // (index 1) to the current altitude.
         // compute the ratio between the temperature at the barometric-ceiling
         // (already computed) and the current temperature.
         double temp_ratio = temperature_ceiling_A / state.temperature;
@@ -827,7 +916,6 @@ void METAtmosphere::jacchia()
         double temperature_500 = thermal.compute_temperature(500.0);
         double log_temperature_500 = log10(temperature_500);
 
-        double integral_g_RT = apply_gauss_quadrature(6, altitude_km) / R_gas_constant;
 
         // Magic numbers:
         // 79.13 = documented 73.13 + 6 to go from cm^-3 to m^-3
@@ -838,7 +926,7 @@ void METAtmosphere::jacchia()
                                           (79.13 - (39.4 * log_temperature_500) +
                                            (5.5 * log_temperature_500 * log_temperature_500))) *
                                  (temperature_500 / state.temperature) *
-                                 std::exp(-species.mol_weight[5] * integral_g_RT);
+                                 std::exp(-species.mol_weight[5] * integral_g_RT_500);
     }
 
     auto less_than_one = [](const double & num_density)
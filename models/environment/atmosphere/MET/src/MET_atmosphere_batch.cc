@@ -0,0 +1,273 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Atmosphere
+ * @{
+ *
+ * @file models/environment/atmosphere/MET/src/MET_atmosphere_batch.cc
+ * Evaluation of the MET atmosphere at many positions at once
+ */
+
+/********************************* TRICK HEADER *******************************
+PURPOSE:
+   (Evaluates the MET atmosphere at many positions at the same time,
+    computing the time-dependent terms once.)
+REFERENCE:
+   (((Jacchia, L.G.) (New Static Models of the Thermosphere and
+       Exosphere with Empirical Temperature Profiles) (Smithsonian
+       Astrophysical Observatory Special Report No. 313) (--) (1970) (--)))
+
+ASSUMPTIONS AND LIMITATIONS:
+   ((Positions below the barometric ceiling are evaluated one at a time.))
+
+LIBRARY DEPENDENCY:
+  ((MET_atmosphere_batch.cc)
+   (MET_atmosphere.cc)
+   (environment/atmosphere/base_atmos/src/atmosphere_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+*****************************************************************************/
+
+// System includes
+#include <algorithm>
+#include <cstddef>
+
+// JEOD includes
+#include "utils/math/include/gauss_quadrature.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/MET_atmosphere.hh"
+#include "environment/atmosphere/base_atmos/include/atmosphere_messages.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+//****************************************************************************
+// update_atmosphere_batch:
+/**
+ * Calculates the METAtmosphere at the current time at many positions.
+ * The solar angles and the time-dependent parts of the exospheric
+ * temperature are computed once. The altitude integrals are then evaluated
+ * one quadrature node at a time across all positions that reach that node's
+ * cell, and the integral from 500 km is taken from the same cell values as
+ * the integral from the barometric ceiling rather than being recomputed.
+ * The results are those of update_atmosphere called for each position.
+ * \param[in] num_points Number of positions
+ * \param[in] altitude Geodetic altitudes\n Units: m
+ * \param[in] latitude_in Geodetic latitudes\n Units: rad
+ * \param[in] longitude_in Longitudes\n Units: rad
+ * \param[out] states Where the state results will be stored, one per position
+ */
+//****************************************************************************
+void METAtmosphere::update_atmosphere_batch(unsigned int num_points,
+                                            const double * altitude,
+                                            const double * latitude_in,
+                                            const double * longitude_in,
+                                            METAtmosphereStateVars * states)
+{
+    if(num_points == 0)
+    {
+        return;
+    }
+    if((altitude == nullptr) || (latitude_in == nullptr) || (longitude_in == nullptr) || (states == nullptr))
+    {
+        MessageHandler::error(__FILE__,
+                              __LINE__,
+                              AtmosphereMessages::framework_error,
+                              "A position or state array is NULL.\n"
+                              "Cannot update atmosphere at unknown locations.\n");
+        return;
+    }
+
+    // Compute the terms that depend on time only.
+    compute_solar_angles();
+    compute_exospheric_time_terms();
+
+    // Positions below the barometric ceiling are evaluated one at a time.
+    // The rest are ordered by the highest quadrature cell they reach, so that
+    // the positions integrated over each cell form a contiguous range.
+    unsigned int cell_start[num_integ_divisions + 1] = {};
+    for(unsigned int ii = 0; ii < num_points; ++ii)
+    {
+        double alt_km = altitude[ii] / 1000.0;
+        if(alt_km < barometric_equation_ceiling)
+        {
+            altitude_km = alt_km;
+            latitude = latitude_in[ii];
+            longitude = longitude_in[ii];
+            evaluate_position();
+            states[ii] = state;
+            continue;
+        }
+        unsigned int top_cell = 0;
+        while((top_cell + 1 < num_integ_divisions) && (alt_km > gauss_altitudes[top_cell + 1]))
+        {
+            ++top_cell;
+        }
+        ++cell_start[top_cell + 1];
+    }
+    for(unsigned int cell = 1; cell <= num_integ_divisions; ++cell)
+    {
+        cell_start[cell] += cell_start[cell - 1];
+    }
+    unsigned int num_batch = cell_start[num_integ_divisions];
+    if(num_batch == 0)
+    {
+        return;
+    }
+
+    batch_order.resize(num_batch);
+    {
+        unsigned int next[num_integ_divisions];
+        std::copy(cell_start, cell_start + num_integ_divisions, next);
+        for(unsigned int ii = 0; ii < num_points; ++ii)
+        {
+            double alt_km = altitude[ii] / 1000.0;
+            if(alt_km < barometric_equation_ceiling)
+            {
+                continue;
+            }
+            unsigned int top_cell = 0;
+            while((top_cell + 1 < num_integ_divisions) && (alt_km > gauss_altitudes[top_cell + 1]))
+            {
+                ++top_cell;
+            }
+            batch_order[next[top_cell]++] = ii;
+        }
+    }
+
+    // Per-position work arrays, in batch order.
+    batch_work.assign(11 * static_cast<std::size_t>(num_batch), 0.0);
+    double * alt = batch_work.data();
+    double * lat = alt + num_batch;
+    double * lon = lat + num_batch;
+    double * T_exo = lon + num_batch;
+    double * T_125 = T_exo + num_batch;
+    double * T_ceiling = T_125 + num_batch;
+    double * integral_Mg = T_ceiling + num_batch;
+    double * integral_g = integral_Mg + num_batch;
+    double * integral_g_500 = integral_g + num_batch;
+    double * cell_sum = integral_g_500 + num_batch;
+    double * half_cell_height = cell_sum + num_batch;
+
+    // Exospheric temperature and the temperature profile parameters.
+    for(unsigned int jj = 0; jj < num_batch; ++jj)
+    {
+        unsigned int ii = batch_order[jj];
+        alt[jj] = altitude[ii] / 1000.0;
+        lat[jj] = latitude_in[ii];
+        lon[jj] = longitude_in[ii];
+
+        latitude = lat[jj];
+        longitude = lon[jj];
+        compute_solar_hour_angle();
+        compute_exospheric_temperature();
+        T_exo[jj] = state.exo_temp;
+        T_125[jj] = METAtmosphereThermal::compute_T_125(T_exo[jj]);
+        T_ceiling[jj] = thermal.compute_temperature(barometric_equation_ceiling, T_exo[jj], T_125[jj]);
+    }
+
+    // Barometric integral of (mu g / T) over the whole first cell, which
+    // every position in the batch spans. The gravity and molecular weight at
+    // the quadrature nodes are the same for all positions.
+    {
+        unsigned int gauss_order = gauss_n[0];
+        double alt_lo = gauss_altitudes[0];
+        double alt_hi = std::min(barometric_equation_ceiling, gauss_altitudes[1]);
+        double half_height = 0.5 * (alt_hi - alt_lo);
+        for(unsigned int kk = 0; kk < gauss_order; ++kk)
+        {
+            double alt_eval_point = alt_lo + half_height * (1.0 + GaussQuadrature::gauss_xvalues[gauss_order][kk]);
+            double rad_eval_point = 1.0 + (alt_eval_point / 6.356766E3);
+            double grav = 9.80665 / (rad_eval_point * rad_eval_point);
+            double mol_wt = compute_mol_wt(alt_eval_point);
+            double weight = GaussQuadrature::gauss_weights[gauss_order][kk];
+            for(unsigned int jj = 0; jj < num_batch; ++jj)
+            {
+                double value_eval_point = grav / thermal.compute_temperature(alt_eval_point, T_exo[jj], T_125[jj]);
+                value_eval_point *= mol_wt;
+                cell_sum[jj] += weight * value_eval_point;
+            }
+        }
+        for(unsigned int jj = 0; jj < num_batch; ++jj)
+        {
+            integral_Mg[jj] = cell_sum[jj] * half_height;
+        }
+    }
+
+    // Diffusion integrals of (g / T) over the higher cells, accumulated from
+    // the barometric ceiling and, for cells from 500 km up
+    // (gauss_altitudes[6]), from 500 km.
+    for(unsigned int cell = 1; cell < num_integ_divisions; ++cell)
+    {
+        unsigned int first = cell_start[cell];
+        if(first == num_batch)
+        {
+            break;
+        }
+        unsigned int gauss_order = gauss_n[cell];
+        double alt_lo = gauss_altitudes[cell];
+        double alt_top = gauss_altitudes[cell + 1];
+
+        for(unsigned int jj = first; jj < num_batch; ++jj)
+        {
+            half_cell_height[jj] = 0.5 * (std::min(alt[jj], alt_top) - alt_lo);
+            cell_sum[jj] = 0.0;
+        }
+        for(unsigned int kk = 0; kk < gauss_order; ++kk)
+        {
+            double node = 1.0 + GaussQuadrature::gauss_xvalues[gauss_order][kk];
+            double weight = GaussQuadrature::gauss_weights[gauss_order][kk];
+            for(unsigned int jj = first; jj < num_batch; ++jj)
+            {
+                double alt_eval_point = alt_lo + half_cell_height[jj] * node;
+                double rad_eval_point = 1.0 + (alt_eval_point / 6.356766E3);
+                double grav = 9.80665 / (rad_eval_point * rad_eval_point);
+                double value_eval_point = grav / thermal.compute_temperature(alt_eval_point, T_exo[jj], T_125[jj]);
+                cell_sum[jj] += weight * value_eval_point;
+            }
+        }
+        for(unsigned int jj = first; jj < num_batch; ++jj)
+        {
+            double cell_integral = cell_sum[jj] * half_cell_height[jj];
+            integral_g[jj] += cell_integral;
+            if(cell >= 6)
+            {
+                integral_g_500[jj] += cell_integral;
+            }
+        }
+    }
+
+    // Complete each position.
+    for(unsigned int jj = 0; jj < num_batch; ++jj)
+    {
+        altitude_km = alt[jj];
+        latitude = lat[jj];
+        longitude = lon[jj];
+        state.exo_temp = T_exo[jj];
+        thermal.update();
+        state.temperature = thermal.T_out;
+        state.mol_weight = mol_weight_barometric_ceiling;
+
+        compute_densities(T_ceiling[jj],
+                          integral_Mg[jj] / R_gas_constant,
+                          integral_g[jj] / R_gas_constant,
+                          integral_g_500[jj] / R_gas_constant);
+        modify_densities();
+        complete_state();
+        states[batch_order[jj]] = state;
+    }
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ */
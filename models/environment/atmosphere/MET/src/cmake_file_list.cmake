@@ -3,6 +3,7 @@ set(SUBDIR ${CMAKE_CURRENT_LIST_DIR})
 set(SRCS
 MET_atmosphere_state_vars.cc
 MET_atmosphere.cc
+MET_atmosphere_batch.cc
 MET_atmosphere_state.cc
 )
 
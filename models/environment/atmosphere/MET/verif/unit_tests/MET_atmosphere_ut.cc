@@ -36,3 +36,5 @@ TEST(METAtmosphere, atmos_MET_FAIR5) {}
 TEST(METAtmosphere, compute_mol_wt) {}
 
 TEST(METAtmosphere, apply_gauss_quadrature) {}
+
+TEST(METAtmosphere, update_atmosphere_batch) {}
@@ -0,0 +1,148 @@
+// Compare METAtmosphere::update_atmosphere_batch with update_atmosphere called
+// for each position, and report the cost per position for batches of 1, 100,
+// and NumPoints positions spread over low Earth orbit altitudes.
+// System includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "environment/atmosphere/MET/include/MET_atmosphere.hh"
+#include "environment/atmosphere/MET/include/MET_atmosphere_state_vars.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/planet_fixed/planet_fixed_posn/include/planet_fixed_posn.hh"
+
+using namespace std;
+using namespace jeod;
+
+/**
+ * Largest relative difference between two sets of state variables.
+ */
+static double state_difference(const METAtmosphereStateVars & a, const METAtmosphereStateVars & b)
+{
+    const double av[] = {a.temperature, a.density, a.pressure, a.exo_temp, a.log10_dens, a.mol_weight,
+                         a.N2,          a.Ox2,     a.Ox,       a.A,        a.He,         a.Hyd};
+    const double bv[] = {b.temperature, b.density, b.pressure, b.exo_temp, b.log10_dens, b.mol_weight,
+                         b.N2,          b.Ox2,     b.Ox,       b.A,        b.He,         b.Hyd};
+    double max_diff = 0.0;
+    for(unsigned int ii = 0; ii < sizeof(av) / sizeof(av[0]); ++ii)
+    {
+        double scale = max(fabs(av[ii]), fabs(bv[ii]));
+        double diff = (scale > 0.0) ? fabs(av[ii] - bv[ii]) / scale : 0.0;
+        max_diff = max(max_diff, diff);
+    }
+    return max_diff;
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_points;
+    int num_reps;
+    double tolerance;
+
+    cmdline_parser.add_int("NumPoints", 10000, &num_points);
+    cmdline_parser.add_int("NumReps", 20, &num_reps);
+    cmdline_parser.add_double("Tolerance", 1.0e-15, &tolerance);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_points <= 0 || num_reps <= 0)
+    {
+        cerr << "NumPoints and NumReps must be positive." << endl;
+        return 1;
+    }
+
+    double tjt = 18500.25;
+    METAtmosphere atmos(tjt);
+    atmos.F10 = 150.0;
+    atmos.F10B = 140.0;
+    atmos.geo_index = 15.0;
+
+    // Positions: mostly 200 to 1200 km, plus the region boundaries and a few
+    // positions below the barometric ceiling and above the top cell.
+    unsigned int count = static_cast<unsigned int>(num_points);
+    vector<PlanetFixedPosition> positions(count);
+    vector<double> altitude(count);
+    vector<double> latitude(count);
+    vector<double> longitude(count);
+    const double special_km[] = {95.0, 104.9, 105.0, 125.0, 170.0, 440.0, 470.0, 500.0, 1500.0, 3000.0};
+    unsigned long seed = 12345;
+    for(unsigned int ii = 0; ii < count; ++ii)
+    {
+        double uniform[3];
+        for(double & value : uniform)
+        {
+            seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+            value = static_cast<double>(seed) / 2147483648.0;
+        }
+        altitude[ii] = (ii < sizeof(special_km) / sizeof(special_km[0])) ? special_km[ii] * 1000.0
+                                                                           : (200.0 + 1000.0 * uniform[0]) * 1000.0;
+        latitude[ii] = asin(2.0 * uniform[1] - 1.0);
+        longitude[ii] = M_PI * (2.0 * uniform[2] - 1.0);
+        positions[ii].ellip_coords.altitude = altitude[ii];
+        positions[ii].ellip_coords.latitude = latitude[ii];
+        positions[ii].ellip_coords.longitude = longitude[ii];
+    }
+
+    // Accuracy over a day of hourly epochs.
+    vector<METAtmosphereStateVars> scalar_states(count);
+    vector<METAtmosphereStateVars> batch_states(count);
+    double max_diff = 0.0;
+    for(unsigned int hour = 0; hour < 24; ++hour)
+    {
+        tjt = 18500.0 + hour / 24.0;
+        for(unsigned int ii = 0; ii < count; ++ii)
+        {
+            atmos.update_atmosphere(&positions[ii], &scalar_states[ii]);
+        }
+        atmos.update_atmosphere_batch(count, altitude.data(), latitude.data(), longitude.data(), batch_states.data());
+        for(unsigned int ii = 0; ii < count; ++ii)
+        {
+            max_diff = max(max_diff, state_difference(scalar_states[ii], batch_states[ii]));
+        }
+    }
+    cout << count << " positions, 24 epochs: max relative difference " << scientific << setprecision(2) << max_diff
+         << endl;
+
+    // Cost per position. Each repetition advances the time by one minute.
+    unsigned int batch_sizes[] = {1, 100, count};
+    cout << fixed << setprecision(3);
+    for(unsigned int batch_size : batch_sizes)
+    {
+        batch_size = min(batch_size, count);
+        double scalar_us = 0.0;
+        double batch_us = 0.0;
+        for(int rep = 0; rep < num_reps; ++rep)
+        {
+            tjt = 18600.0 + rep / 1440.0;
+            auto start = chrono::steady_clock::now();
+            for(unsigned int ii = 0; ii < batch_size; ++ii)
+            {
+                atmos.update_atmosphere(&positions[count - batch_size + ii], &scalar_states[ii]);
+            }
+            auto middle = chrono::steady_clock::now();
+            atmos.update_atmosphere_batch(batch_size,
+                                          &altitude[count - batch_size],
+                                          &latitude[count - batch_size],
+                                          &longitude[count - batch_size],
+                                          batch_states.data());
+            auto stop = chrono::steady_clock::now();
+            scalar_us += chrono::duration<double, micro>(middle - start).count();
+            batch_us += chrono::duration<double, micro>(stop - middle).count();
+        }
+        double per_point = 1.0 / (static_cast<double>(batch_size) * num_reps);
+        cout << setw(6) << batch_size << " positions: " << setw(8) << scalar_us * per_point << " us/position scalar, "
+             << setw(8) << batch_us * per_point << " us/position batched" << endl;
+    }
+
+    if(max_diff > tolerance)
+    {
+        cout << "Failed tolerance " << scientific << tolerance << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -262,6 +262,24 @@ public:
         file.file_spec.set_model_directory(dirIn);
     }
 
+    /**
+     * Use a native JPL binary ephemeris file in place of the compiled
+     * coefficient library. See De4xxFileSpec::set_binary_file.
+     */
+    void set_binary_file(const std::string & file_name)
+    {
+        file.file_spec.set_binary_file(file_name);
+    }
+
+    /**
+     * Enable or disable paging in the next record of a memory mapped
+     * JPL binary file ahead of need.
+     */
+    void set_prefetch_next_record(bool prefetch)
+    {
+        file.file_spec.set_prefetch_next_record(prefetch);
+    }
+
     /**
      * Get Ephemeris data model directory.
      * This number is used to specify the de file to use
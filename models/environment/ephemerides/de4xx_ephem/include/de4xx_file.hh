@@ -62,7 +62,9 @@ Assumptions and limitations:
    (Assumption 2.
     32-bit integers occupy 4 chars and doubles, 8 chars)
    (Assumption 3.
-    IEEE-standard doubles))
+    IEEE-standard doubles)
+   (Assumption 4.
+    A JPL binary ephemeris file has the same byte order as the host.))
 
 Library dependencies:
   ((../src/de4xx_file.cc))
@@ -189,6 +191,15 @@ class De4xxFileSpec
     friend class De4xxFile;
 
 public:
+    /**
+     * Identifies the representation of the ephemeris data.
+     */
+    enum FileFormat
+    {
+        SharedLibrary = 0, ///< Coefficients compiled into libde\<denum\>.so
+        JplBinary = 1      ///< Native JPL binary file, memory mapped
+    };
+
     // Member functions
     De4xxFileSpec();
     De4xxFileSpec(const De4xxFileSpec &) = delete;
@@ -231,6 +242,30 @@ public:
         return ephem_file_dir;
     }
 
+    /**
+     * Use a native JPL binary ephemeris file (e.g., linux_p1550p2650.440)
+     * in place of the compiled coefficient library.
+     * A relative file name is resolved against the model directory.
+     */
+    void set_binary_file(const std::string & file_name);
+
+    /**
+     * Get the ephemeris data representation.
+     */
+    FileFormat get_file_format()
+    {
+        return file_format;
+    }
+
+    /**
+     * Enable or disable paging in the next record of a memory mapped
+     * JPL binary file ahead of need.
+     */
+    void set_prefetch_next_record(bool prefetch)
+    {
+        prefetch_next_record = prefetch;
+    }
+
 protected:
     // Member data
 
@@ -251,11 +286,25 @@ protected:
      */
     std::string ephem_file_name; //!< trick_units(--)
 
+    /**
+     * Ephemeris data representation
+     */
+    FileFormat file_format{SharedLibrary}; //!< trick_units(--)
+
+    /**
+     * Advise the kernel to page in the adjacent record of a memory mapped
+     * JPL binary file whenever a new record is selected.
+     */
+    bool prefetch_next_record{true}; //!< trick_units(--)
+
     // Internally-computed items (visible for logging and checkpoint)
     /**
      * Ephemeris file path name
      */
     std::string pathname; //!< trick_io(*o) trick_units(--)
+
+    // Member functions
+    void update_pathname();
 };
 
 /**
@@ -323,10 +372,36 @@ public:
 
 protected:
     /**
-     * The dl handle for the ephemeris shared object.
+     * The dl handle for the ephemeris shared object, or the start of the
+     * mapping of a JPL binary file.
      */
     void * file{}; //!< trick_units(--) trick_io(**)
 
+    /**
+     * Size of the mapping of a JPL binary file.
+     */
+    std::size_t map_size{}; //!< trick_units(--) trick_io(**)
+
+    /**
+     * Size of one record of a JPL binary file.
+     */
+    std::size_t record_size{}; //!< trick_units(--) trick_io(**)
+
+    /**
+     * Data set metadata decoded from a JPL binary file header.
+     */
+    EphemerisDataSetMeta binary_meta{}; //!< trick_units(--) trick_io(**)
+
+    /**
+     * Item metadata decoded from a JPL binary file header.
+     */
+    EphemerisDataItemMeta binary_items[De4xxBase::De4xx_File_MaxEntries]{}; //!< trick_units(--) trick_io(**)
+
+    /**
+     * The single segment spanned by a JPL binary file.
+     */
+    EphemerisDataSegmentMeta binary_segment{}; //!< trick_units(--) trick_io(**)
+
     // Member functions
 public:
     De4xxFileIO() = default;
@@ -640,15 +715,19 @@ public:
      */
     bool logMemoryStats{true}; //!< trick_units(--)
 
-private:
+protected:
     // Member functions
 
     void open();
 
+    void open_binary();
+
     void reopen();
 
     void close();
 
+    const double * prefetch_record(uint32_t segment_recno);
+
     void interpolate(double time, double fblk);
 
     void capture_mem_stats();
@@ -13,6 +13,7 @@
  * ephemeris file. The functions are
  *
  *   open        - Open an ephemeris file for input
+ *   open_binary - Memory map a native JPL binary ephemeris file
  *   close       - Close a previously open ephemeris file
  *   read_record - Read a record from the ephemeris file
  *   get_string  - Get a string from the current data record
@@ -34,6 +35,7 @@ Reference:
 Assumptions and limitations:
    ((User correctly specified byteswapping in the EphemeridesIn structure)
     (Local machine is either big-endian or little-endian)
+    (JPL binary files have the same byte order as the local machine)
     (Errors are fatal))
 
 Library dependency:
@@ -49,11 +51,14 @@ Library dependency:
 #define __STDC_LIMIT_MACROS
 // System includes
 #include <cerrno>
+#include <cmath>
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -76,6 +81,45 @@ Library dependency:
 namespace jeod
 {
 
+/**
+ * Layout of the header record of a native JPL binary ephemeris file,
+ * as written by the JPL asc2eph utility.
+ */
+namespace JplBinaryLayout
+{
+static constexpr std::size_t cnam_offset = 252;   //!< First 400 constant names
+static constexpr std::size_t name_length = 6;     //!< Characters per constant name
+static constexpr std::size_t max_names = 400;     //!< Names stored ahead of SS
+static constexpr std::size_t ss_offset = 2652;    //!< Start, stop, step Julian dates
+static constexpr std::size_t ncon_offset = 2676;  //!< Number of constants
+static constexpr std::size_t au_offset = 2680;    //!< Astronomical unit, km
+static constexpr std::size_t emrat_offset = 2688; //!< Earth-Moon mass ratio
+static constexpr std::size_t ipt_offset = 2696;   //!< Item pointers, 12 triplets
+static constexpr std::size_t numde_offset = 2840; //!< Ephemeris number
+static constexpr std::size_t lpt_offset = 2844;   //!< Libration pointers
+static constexpr std::size_t ext_offset = 2856;   //!< Names beyond 400, then RPT, TPT
+static constexpr uint32_t num_ipt_items = 12;     //!< Items described by IPT
+} // namespace JplBinaryLayout
+
+/**
+ * Copy a value of type T out of a possibly unaligned file location.
+ * @return Value at the location
+ * \param[in] base Start of file contents
+ * \param[in] offset Byte offset of the value
+ */
+template<typename T> static T read_binary_value(const char * base, std::size_t offset)
+{
+    T value;
+    std::memcpy(&value, base + offset, sizeof(T));
+    return value;
+}
+
+/**
+ * Names of the DE constants required by JEOD, in De4xxEphemConsts order.
+ */
+static const char * const de_constant_names[De4xxBase::De4xx_Const_MaxConsts] =
+    {"DENUM", "LENUM", "AU", "EMRAT", "CLIGHT", "GM1", "GM2", "GMB", "GM4", "GM5", "GM6", "GM7", "GM8", "GM9", "GMS"};
+
 /**
  * Construct a De4xxFileSpec object.
  */
@@ -87,14 +131,40 @@ De4xxFileSpec::De4xxFileSpec()
 void De4xxFileSpec::set_model_number(int denum_in)
 {
     denum = denum_in;
-    ephem_file_name = "libde" + std::to_string(denum) + ".so";
-    pathname = ephem_file_dir + "/" + ephem_file_name;
+    if(file_format == SharedLibrary)
+    {
+        ephem_file_name = "libde" + std::to_string(denum) + ".so";
+    }
+    update_pathname();
 }
 
 void De4xxFileSpec::set_model_directory(const std::string & dirIn)
 {
     ephem_file_dir = dirIn;
-    pathname = ephem_file_dir + "/" + ephem_file_name;
+    update_pathname();
+}
+
+void De4xxFileSpec::set_binary_file(const std::string & file_name)
+{
+    file_format = JplBinary;
+    ephem_file_name = file_name;
+    update_pathname();
+}
+
+/**
+ * Form the path name from the directory and file name.
+ * An absolute file name is used as is.
+ */
+void De4xxFileSpec::update_pathname()
+{
+    if((!ephem_file_name.empty()) && (ephem_file_name[0] == '/'))
+    {
+        pathname = ephem_file_name;
+    }
+    else
+    {
+        pathname = ephem_file_dir + "/" + ephem_file_name;
+    }
 }
 
 /**
@@ -213,6 +283,12 @@ void De4xxFile::shutdown()
  */
 void De4xxFile::open() // flawfinder: ignore
 {
+    if(file_spec.file_format == De4xxFileSpec::JplBinary)
+    {
+        open_binary();
+        return;
+    }
+
     // Clear dlerror
     char * dlError;
     dlerror();
@@ -307,6 +383,285 @@ void De4xxFile::open() // flawfinder: ignore
     //   capture_mem_stats();
 }
 
+/**
+ * Memory map a native JPL binary ephemeris file and decode its header.
+ * The file is treated as a single segment; records are located by index
+ * arithmetic directly in the mapping.
+ *
+ * \par Assumptions and Limitations
+ *  - The file has the byte order of the host
+ *  - Errors are fatal
+ */
+void De4xxFile::open_binary()
+{
+    using namespace JplBinaryLayout;
+
+    int fd = ::open(file_spec.pathname.c_str(), O_RDONLY); // flawfinder: ignore
+    if(fd < 0)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             EphemeridesMessages::file_error,
+                             "Error opening ephemeris file '%s' for input: %s",
+                             file_spec.pathname.c_str(),
+                             std::strerror(errno));
+
+        // Not reached
+        return;
+    }
+
+    struct stat file_stat;
+    if(fstat(fd, &file_stat) != 0)
+    {
+        ::close(fd);
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             EphemeridesMessages::file_error,
+                             "Error querying ephemeris file '%s': %s",
+                             file_spec.pathname.c_str(),
+                             std::strerror(errno));
+
+        // Not reached
+        return;
+    }
+
+    std::size_t file_size = static_cast<std::size_t>(file_stat.st_size);
+    if(file_size < ext_offset + 6 * sizeof(int32_t))
+    {
+        ::close(fd);
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             EphemeridesMessages::garbage_file,
+                             "Ephemeris file '%s' is too short to be a JPL binary ephemeris",
+                             file_spec.pathname.c_str());
+
+        // Not reached
+        return;
+    }
+
+    void * addr = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(addr == MAP_FAILED)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             EphemeridesMessages::file_error,
+                             "Error mapping ephemeris file '%s': %s",
+                             file_spec.pathname.c_str(),
+                             std::strerror(errno));
+
+        // Not reached
+        return;
+    }
+
+    io.file = addr;
+    io.map_size = file_size;
+    const char * base = static_cast<const char *>(addr);
+
+    // The ephemeris number and constant count are small positive integers;
+    // anything else indicates a byte-swapped or non-ephemeris file.
+    int32_t numde = read_binary_value<int32_t>(base, numde_offset);
+    int32_t ncon = read_binary_value<int32_t>(base, ncon_offset);
+    if((numde <= 0) || (numde > 9999) || (ncon <= 0) || (ncon > 10000))
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             EphemeridesMessages::unsupported_architecture,
+                             "Ephemeris file '%s' is not a JPL binary ephemeris with host byte order",
+                             file_spec.pathname.c_str());
+
+        // Not reached
+        return;
+    }
+
+    // Decode the item pointers. The lunar mantle angular velocity and
+    // TT-TDB pointers follow any constant names beyond the first 400.
+    std::size_t ext_names = (static_cast<std::size_t>(ncon) > max_names) ? (ncon - max_names) : 0;
+    std::size_t rpt_offset = ext_offset + ext_names * name_length;
+    uint32_t pointers[De4xxBase::De4xx_File_MaxEntries][3];
+    for(uint32_t ii = 0; ii < num_ipt_items; ++ii)
+    {
+        for(uint32_t jj = 0; jj < 3; ++jj)
+        {
+            pointers[ii][jj] = read_binary_value<int32_t>(base, ipt_offset + (3 * ii + jj) * sizeof(int32_t));
+        }
+    }
+    for(uint32_t jj = 0; jj < 3; ++jj)
+    {
+        pointers[De4xxBase::De4xx_File_LLibration][jj] =
+            read_binary_value<int32_t>(base, lpt_offset + jj * sizeof(int32_t));
+        pointers[De4xxBase::De4xx_File_LAngVel][jj] = 0;
+        pointers[De4xxBase::De4xx_File_tt_tdb][jj] = 0;
+    }
+    if((numde >= 430) && (rpt_offset + 6 * sizeof(int32_t) <= file_size))
+    {
+        for(uint32_t jj = 0; jj < 3; ++jj)
+        {
+            pointers[De4xxBase::De4xx_File_LAngVel][jj] =
+                read_binary_value<int32_t>(base, rpt_offset + jj * sizeof(int32_t));
+            pointers[De4xxBase::De4xx_File_tt_tdb][jj] =
+                read_binary_value<int32_t>(base, rpt_offset + (3 + jj) * sizeof(int32_t));
+        }
+    }
+
+    // The record length is implied by the extent of the last item.
+    uint32_t ncoeff = 0;
+    for(uint32_t ii = 0; ii < De4xxBase::De4xx_File_MaxEntries; ++ii)
+    {
+        EphemerisDataItemMeta & itemData = io.binary_items[ii];
+        itemData.offset = pointers[ii][0];
+        itemData.nterms = pointers[ii][1];
+        itemData.npoly = pointers[ii][2];
+        if(itemData.offset > 0)
+        {
+            uint32_t extent = itemData.offset - 1 + item[ii].nitems * itemData.nterms * itemData.npoly;
+            ncoeff = (extent > ncoeff) ? extent : ncoeff;
+        }
+    }
+    bool has_extended_items = (io.binary_items[De4xxBase::De4xx_File_LAngVel].offset > 0) ||
+                              (io.binary_items[De4xxBase::De4xx_File_tt_tdb].offset > 0);
+
+    io.record_size = ncoeff * sizeof(double);
+    if((ncoeff < 2) || (io.record_size < ext_offset) || (file_size < 3 * io.record_size) ||
+       (ncon * sizeof(double) > io.record_size))
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             EphemeridesMessages::garbage_file,
+                             "Ephemeris file '%s' has inconsistent record sizing",
+                             file_spec.pathname.c_str());
+
+        // Not reached
+        return;
+    }
+
+    // The file is a sequence of whole records; anything else was cut short.
+    if((file_size % io.record_size) != 0)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             EphemeridesMessages::garbage_file,
+                             "Ephemeris file '%s' is truncated: %zu bytes is not a whole number of %zu byte records",
+                             file_spec.pathname.c_str(),
+                             file_size,
+                             io.record_size);
+
+        // Not reached
+        return;
+    }
+
+    EphemerisDataSetMeta & meta = io.binary_meta;
+    meta.number_file_items = has_extended_items ? De4xxBase::De4xx_File_MaxEntries
+                                                : (De4xxBase::De4xx_File_LLibration + 1);
+    meta.start_epoch = read_binary_value<double>(base, ss_offset);
+    meta.stop_epoch = read_binary_value<double>(base, ss_offset + sizeof(double));
+    meta.delta_epoch = read_binary_value<double>(base, ss_offset + 2 * sizeof(double));
+    meta.number_segments = 1;
+    meta.ncoeff = ncoeff;
+
+    // Pick the constants JEOD needs out of the name/value lists.
+    // DENUM, LENUM, AU, and EMRAT are also available from the header proper.
+    bool found[De4xxBase::De4xx_Const_MaxConsts] = {};
+    meta.de_constants[De4xxBase::De4xx_Const_DENUM] = numde;
+    meta.de_constants[De4xxBase::De4xx_Const_LENUM] = numde;
+    meta.de_constants[De4xxBase::De4xx_Const_AU] = read_binary_value<double>(base, au_offset);
+    meta.de_constants[De4xxBase::De4xx_Const_EMRAT] = read_binary_value<double>(base, emrat_offset);
+    found[De4xxBase::De4xx_Const_DENUM] = true;
+    found[De4xxBase::De4xx_Const_LENUM] = true;
+    found[De4xxBase::De4xx_Const_AU] = true;
+    found[De4xxBase::De4xx_Const_EMRAT] = true;
+
+    for(uint32_t ii = 0; ii < static_cast<uint32_t>(ncon); ++ii)
+    {
+        std::size_t name_offset = (ii < max_names) ? (cnam_offset + ii * name_length)
+                                                   : (ext_offset + (ii - max_names) * name_length);
+        std::string name(base + name_offset, name_length);
+        name.erase(name.find_last_not_of(' ') + 1);
+
+        for(uint32_t jj = 0; jj < De4xxBase::De4xx_Const_MaxConsts; ++jj)
+        {
+            if(name == de_constant_names[jj])
+            {
+                meta.de_constants[jj] = read_binary_value<double>(base, io.record_size + ii * sizeof(double));
+                found[jj] = true;
+                break;
+            }
+        }
+    }
+
+    for(uint32_t jj = 0; jj < De4xxBase::De4xx_Const_MaxConsts; ++jj)
+    {
+        if(!found[jj])
+        {
+            MessageHandler::fail(__FILE__,
+                                 __LINE__,
+                                 EphemeridesMessages::garbage_file,
+                                 "Ephemeris file '%s' does not define constant '%s'",
+                                 file_spec.pathname.c_str(),
+                                 de_constant_names[jj]);
+
+            // Not reached
+            return;
+        }
+    }
+
+    // Data records start with the third record. Each begins with the
+    // Julian dates that bound it.
+    const double * records = reinterpret_cast<const double *>(base + 2 * io.record_size);
+    io.binary_segment.num_recs = static_cast<uint32_t>(file_size / io.record_size - 2);
+    io.binary_segment.start_epoch = records[0];
+    io.binary_segment.stop_epoch = records[(io.binary_segment.num_recs - 1) * ncoeff + 1];
+
+    if(std::fabs((records[1] - records[0]) - meta.delta_epoch) > 1.0e-6)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             EphemeridesMessages::garbage_file,
+                             "Ephemeris file '%s' record span %g does not match header span %g",
+                             file_spec.pathname.c_str(),
+                             records[1] - records[0],
+                             meta.delta_epoch);
+
+        // Not reached
+        return;
+    }
+
+    io.metaData = &io.binary_meta;
+    io.itemData = io.binary_items;
+    io.segmentData = &io.binary_segment;
+
+    MessageHandler::debug(__FILE__,
+                          __LINE__,
+                          EphemeridesMessages::debug,
+                          "Mapped JPL binary ephemeris DE%d '%s', %u records",
+                          numde,
+                          file_spec.pathname.c_str(),
+                          io.binary_segment.num_recs);
+}
+
+/**
+ * Advise the kernel that a record of a memory mapped JPL binary file will
+ * soon be needed so that the page-in is overlapped with computation.
+ * @return Start of the advised record, or null if nothing was advised
+ *         (not a JPL binary file, or no such record)
+ * \param[in] segment_recno Record number within the mapped segment
+ */
+const double * De4xxFile::prefetch_record(uint32_t segment_recno)
+{
+    if((file_spec.file_format != De4xxFileSpec::JplBinary) || (io.file == nullptr) ||
+       (segment_recno >= io.binary_segment.num_recs))
+    {
+        return nullptr;
+    }
+
+    static const std::size_t page_size = static_cast<std::size_t>(sysconf(_SC_PAGE_SIZE));
+    std::size_t start = (2 + static_cast<std::size_t>(segment_recno)) * io.record_size;
+    std::size_t aligned_start = start - (start % page_size);
+    char * base = static_cast<char *>(io.file);
+    madvise(base + aligned_start, start + io.record_size - aligned_start, MADV_WILLNEED);
+    return reinterpret_cast<const double *>(base + start);
+}
+
 /**
  * Open the JPL ephemeris file on restart.
  *
@@ -320,7 +675,14 @@ void De4xxFile::reopen()
     // Close the file if it is already open.
     if(io.file != nullptr)
     {
-        dlclose(io.file);
+        if(file_spec.file_format == De4xxFileSpec::JplBinary)
+        {
+            munmap(io.file, io.map_size);
+        }
+        else
+        {
+            dlclose(io.file);
+        }
         io.file = nullptr;
     }
 
@@ -346,7 +708,15 @@ void De4xxFile::close()
     }
 
     // Close the file.
-    rc = dlclose(io.file);
+    if(file_spec.file_format == De4xxFileSpec::JplBinary)
+    {
+        rc = munmap(io.file, io.map_size);
+        io.map_size = 0;
+    }
+    else
+    {
+        rc = dlclose(io.file);
+    }
 
     // Check for success.
     // NOTE: Failure is a warning here as the close may be the result of an
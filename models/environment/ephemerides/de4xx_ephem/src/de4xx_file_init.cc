@@ -77,14 +77,22 @@ void De4xxFile::pre_initialize()
     // Open the ephemeris file.
     open(); // flawfinder: ignore
 
-    // Clear dlerror
-    dlerror();
-
-    // Grab the first segment data segment symbol as a starting point
+    // Grab the first segment data segment as a starting point.
+    // The records of a mapped JPL binary file follow the two header records.
     io.recno = 0;
     io.segment_index = 0;
     io.segment_recno = 0;
-    io.coeffs_segment_starting_addr = (double *)dlsym(io.file, "segment_coeffs_0");
+    if(file_spec.file_format == De4xxFileSpec::JplBinary)
+    {
+        io.coeffs_segment_starting_addr = reinterpret_cast<double *>(static_cast<char *>(io.file) +
+                                                                     2 * io.record_size);
+    }
+    else
+    {
+        // Clear dlerror
+        dlerror();
+        io.coeffs_segment_starting_addr = (double *)dlsym(io.file, "segment_coeffs_0");
+    }
     if(io.coeffs_segment_starting_addr == nullptr)
     {
         char * dlError = dlerror();
@@ -244,6 +244,22 @@ void De4xxFile::update(double time)
         }
         io.current_record_starting_addr = &(
             io.coeffs_segment_starting_addr[(recno - io.segment_recno) * io.metaData->ncoeff]);
+        // Records are usually consumed in order; have the next one in the
+        // direction of travel paged in ahead of time.
+        if(file_spec.prefetch_next_record && (file_spec.file_format == De4xxFileSpec::JplBinary))
+        {
+            uint32_t segment_recno = recno - io.segment_recno;
+            bool backward = (recno < io.recno) && (io.recno != static_cast<uint32_t>(std::numeric_limits<int>::max()));
+            if(!backward)
+            {
+                prefetch_record(segment_recno + 1);
+            }
+            else if(segment_recno > 0)
+            {
+                prefetch_record(segment_recno - 1);
+            }
+        }
+
         io.recno = recno;
         coef.coef = &(io.coeffs_segment_starting_addr[(recno - io.segment_recno) * io.metaData->ncoeff]);
     }
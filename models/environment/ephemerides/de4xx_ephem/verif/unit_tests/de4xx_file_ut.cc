@@ -3,16 +3,148 @@
  */
 
 #include "environment/ephemerides/de4xx_ephem/include/de4xx_file.hh"
+#include "memory_interface_mock.hh"
 #include "message_handler_mock.hh"
+#include "simulation_interface_mock.hh"
+#include "utils/memory/include/memory_manager.hh"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <dlfcn.h>
+#include <fstream>
+#include <string>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 using testing::_;
 using testing::AnyNumber;
 using testing::Mock;
+using testing::Return;
 
 using namespace jeod;
 
+// Directory holding libde405.so, the compiled coefficient library that the
+// JPL binary file written below is checked against.
+#ifndef DE4XX_LIB_DIR
+#define DE4XX_LIB_DIR "build/de4xx_lib"
+#endif
+
+namespace
+{
+
+// Exposes the protected members of De4xxFile to the tests.
+class TestDe4xxFile : public De4xxFile
+{
+public:
+    using De4xxFile::open;
+    using De4xxFile::prefetch_record;
+};
+
+// The coefficient library, opened directly rather than through De4xxFile.
+struct De405Library
+{
+    De405Library()
+    {
+        handle = dlopen(DE4XX_LIB_DIR "/libde405.so", RTLD_LAZY | RTLD_LOCAL);
+        if(handle != nullptr)
+        {
+            meta = static_cast<const EphemerisDataSetMeta *>(dlsym(handle, "metaData"));
+            items = static_cast<const EphemerisDataItemMeta *>(dlsym(handle, "itemData"));
+            coeffs = static_cast<const double *>(dlsym(handle, "segment_coeffs_0"));
+        }
+    }
+
+    ~De405Library()
+    {
+        if(handle != nullptr)
+        {
+            dlclose(handle);
+        }
+    }
+
+    bool valid() const
+    {
+        return (meta != nullptr) && (items != nullptr) && (coeffs != nullptr);
+    }
+
+    void * handle{};
+    const EphemerisDataSetMeta * meta{};
+    const EphemerisDataItemMeta * items{};
+    const double * coeffs{};
+};
+
+template<typename T> void put(std::vector<char> & buffer, std::size_t offset, T value)
+{
+    std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+// Write the first num_recs records of the DE405 library as a JPL binary
+// file, laid out as by the JPL asc2eph utility, less the last cut_bytes.
+// A bad header has an invalid ephemeris number.
+void write_binary_file(const De405Library & lib,
+                       const std::string & path,
+                       uint32_t num_recs,
+                       std::size_t cut_bytes = 0,
+                       bool bad_header = false)
+{
+    static const char * const names[De4xxBase::De4xx_Const_MaxConsts] =
+        {"DENUM", "LENUM", "AU", "EMRAT", "CLIGHT", "GM1", "GM2", "GMB", "GM4", "GM5", "GM6", "GM7", "GM8", "GM9", "GMS"};
+    const uint32_t ncoeff = lib.meta->ncoeff;
+    const std::size_t record_size = ncoeff * sizeof(double);
+    std::vector<char> buffer((2 + num_recs) * record_size, ' ');
+
+    for(uint32_t ii = 0; ii < De4xxBase::De4xx_Const_MaxConsts; ++ii)
+    {
+        std::memcpy(buffer.data() + 252 + 6 * ii, names[ii], std::strlen(names[ii]));
+        put<double>(buffer, record_size + ii * sizeof(double), lib.meta->de_constants[ii]);
+    }
+    put<double>(buffer, 2652, lib.coeffs[0]);
+    put<double>(buffer, 2660, lib.coeffs[(num_recs - 1) * ncoeff + 1]);
+    put<double>(buffer, 2668, lib.meta->delta_epoch);
+    put<int32_t>(buffer, 2676, De4xxBase::De4xx_Const_MaxConsts);
+    put<double>(buffer, 2680, lib.meta->de_constants[De4xxBase::De4xx_Const_AU]);
+    put<double>(buffer, 2688, lib.meta->de_constants[De4xxBase::De4xx_Const_EMRAT]);
+    for(uint32_t ii = 0; ii < 12; ++ii)
+    {
+        put<int32_t>(buffer, 2696 + 12 * ii, lib.items[ii].offset);
+        put<int32_t>(buffer, 2700 + 12 * ii, lib.items[ii].nterms);
+        put<int32_t>(buffer, 2704 + 12 * ii, lib.items[ii].npoly);
+    }
+    put<int32_t>(buffer, 2840, bad_header ? -405 : 405);
+    put<int32_t>(buffer, 2844, lib.items[De4xxBase::De4xx_File_LLibration].offset);
+    put<int32_t>(buffer, 2848, lib.items[De4xxBase::De4xx_File_LLibration].nterms);
+    put<int32_t>(buffer, 2852, lib.items[De4xxBase::De4xx_File_LLibration].npoly);
+    std::memcpy(buffer.data() + 2 * record_size, lib.coeffs, num_recs * record_size);
+
+    std::ofstream out(path, std::ios::binary);
+    out.write(buffer.data(), buffer.size() - cut_bytes);
+}
+
+// Mocks needed to construct and initialize a De4xxFile.
+struct De4xxFileTestEnv
+{
+    De4xxFileTestEnv()
+        : mockSimInterface(mockMemoryInterface),
+          memoryManager(mockMemoryInterface)
+    {
+        EXPECT_CALL(mockMessageHandler, process_message(_, _, _, _, _, _, _)).Times(AnyNumber());
+        ON_CALL(mockMemoryInterface, register_allocation(_, _, _, _, _)).WillByDefault(Return(true));
+        EXPECT_CALL(mockMemoryInterface, register_allocation(_, _, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(mockMemoryInterface, deregister_allocation(_, _, _, _, _)).Times(AnyNumber());
+    }
+
+    MockMessageHandler mockMessageHandler;
+    MockJeodMemoryInterface mockMemoryInterface;
+    MockJeodSimulationInterface mockSimInterface;
+    JeodMemoryManager memoryManager;
+};
+
+const char * const binary_file = "de4xx_file_ut.405";
+
+} // namespace
+
 TEST(De4xxFileSpec, create)
 {
     De4xxFileSpec staticInst;
@@ -24,6 +156,17 @@ TEST(De4xxFileSpec, set_model_number) {}
 
 TEST(De4xxFileSpec, set_model_directory) {}
 
+TEST(De4xxFileSpec, set_binary_file)
+{
+    De4xxFileSpec spec;
+    spec.set_model_directory("ephem");
+    spec.set_binary_file("linux_p1550p2650.440");
+    spec.set_model_number(440);
+    EXPECT_EQ(De4xxFileSpec::JplBinary, spec.get_file_format());
+    EXPECT_EQ(440u, spec.get_model_number());
+    EXPECT_EQ("ephem", spec.get_model_directory());
+}
+
 TEST(De4xxFileHeader, create) {}
 
 TEST(De4xxFileItem, create)
@@ -43,10 +186,143 @@ TEST(De4xxFile, shutdown) {}
 
 TEST(De4xxFile, open) {}
 
+TEST(De4xxFile, open_binary)
+{
+    De4xxFileTestEnv env;
+    De405Library lib;
+    ASSERT_TRUE(lib.valid()) << "Cannot load " DE4XX_LIB_DIR "/libde405.so";
+    const uint32_t num_recs = 4;
+    write_binary_file(lib, binary_file, num_recs);
+
+    {
+        EXPECT_CALL(env.mockMessageHandler, process_message(MessageHandler::Failure, _, _, _, _, _, _)).Times(0);
+
+        De4xxFile lib_file;
+        De4xxFile bin_file;
+        lib_file.logMemoryStats = false;
+        bin_file.logMemoryStats = false;
+        lib_file.file_spec.set_model_directory(DE4XX_LIB_DIR);
+        lib_file.file_spec.set_model_number(405);
+        bin_file.file_spec.set_model_directory(".");
+        bin_file.file_spec.set_binary_file(binary_file);
+        bin_file.file_spec.set_model_number(405);
+
+        double epoch = lib.coeffs[0];
+        lib_file.initialize(epoch, 0.0, 0.0, 0.0);
+        bin_file.initialize(epoch, 0.0, 0.0, 0.0);
+
+        EXPECT_EQ(num_recs, bin_file.io.total_num_recs);
+        EXPECT_EQ(lib.meta->ncoeff, bin_file.io.metaData->ncoeff);
+        EXPECT_EQ(lib_file.header.au, bin_file.header.au);
+        EXPECT_EQ(lib_file.header.vlight, bin_file.header.vlight);
+        for(uint32_t ii = 0; ii < De4xxBase::number_grav_models(405); ++ii)
+        {
+            EXPECT_EQ(lib_file.header.gmbody[ii], bin_file.header.gmbody[ii]);
+        }
+
+        for(uint32_t ii = 0; ii < lib_file.io.metaData->number_file_items; ++ii)
+        {
+            EXPECT_EQ(lib_file.item[ii].avail, bin_file.item[ii].avail);
+            lib_file.item[ii].active = lib_file.item[ii].avail;
+            bin_file.item[ii].active = bin_file.item[ii].avail;
+        }
+
+        // Step through the records forward and then back; the binary file
+        // and the library must interpolate the same coefficients.
+        double span = num_recs * lib.meta->delta_epoch * 86400.0;
+        for(int kk = 0; kk <= 40; ++kk)
+        {
+            double time = span * ((kk <= 20) ? kk : (40 - kk)) / 20.5;
+            lib_file.update(time);
+            bin_file.update(time);
+            EXPECT_EQ(lib_file.io.recno, bin_file.io.recno);
+            for(uint32_t ii = 0; ii < lib_file.io.metaData->number_file_items; ++ii)
+            {
+                for(int jj = 0; jj < lib_file.item[ii].nitems; ++jj)
+                {
+                    EXPECT_EQ(lib_file.item[ii].state[0][jj], bin_file.item[ii].state[0][jj]);
+                    EXPECT_EQ(lib_file.item[ii].state[1][jj], bin_file.item[ii].state[1][jj]);
+                }
+            }
+        }
+        EXPECT_FALSE(bin_file.time_is_in_range(span + 86400.0));
+        Mock::VerifyAndClear(&env.mockMessageHandler);
+    }
+
+    EXPECT_CALL(env.mockMessageHandler, process_message(_, _, _, _, _, _, _)).Times(AnyNumber());
+    std::remove(binary_file);
+}
+
+TEST(De4xxFile, open_binary_rejects_bad_files)
+{
+    De4xxFileTestEnv env;
+    De405Library lib;
+    ASSERT_TRUE(lib.valid()) << "Cannot load " DE4XX_LIB_DIR "/libde405.so";
+    const std::size_t record_size = lib.meta->ncoeff * sizeof(double);
+
+    // Cut short within the header, cut short within the last record,
+    // and a header that is not that of a host byte order DE file.
+    std::size_t cut_bytes[3] = {5 * record_size, record_size / 2, 0};
+    bool bad_header[3] = {false, false, true};
+    for(int ii = 0; ii < 3; ++ii)
+    {
+        write_binary_file(lib, binary_file, 4, cut_bytes[ii], bad_header[ii]);
+
+        EXPECT_CALL(env.mockMessageHandler, process_message(MessageHandler::Failure, _, _, _, _, _, _)).Times(1);
+        TestDe4xxFile bin_file;
+        bin_file.file_spec.set_model_directory(".");
+        bin_file.file_spec.set_binary_file(binary_file);
+        bin_file.open();
+        EXPECT_EQ(nullptr, bin_file.io.metaData);
+        Mock::VerifyAndClear(&env.mockMessageHandler);
+        EXPECT_CALL(env.mockMessageHandler, process_message(_, _, _, _, _, _, _)).Times(AnyNumber());
+    }
+
+    std::remove(binary_file);
+}
+
 TEST(De4xxFile, reopen) {}
 
 TEST(De4xxFile, close) {}
 
+TEST(De4xxFile, prefetch_record)
+{
+    De4xxFileTestEnv env;
+    De405Library lib;
+    ASSERT_TRUE(lib.valid()) << "Cannot load " DE4XX_LIB_DIR "/libde405.so";
+    const uint32_t num_recs = 4;
+    write_binary_file(lib, binary_file, num_recs);
+
+    {
+        TestDe4xxFile lib_file;
+        TestDe4xxFile bin_file;
+        lib_file.file_spec.set_model_directory(DE4XX_LIB_DIR);
+        lib_file.file_spec.set_model_number(405);
+        bin_file.file_spec.set_model_directory(".");
+        bin_file.file_spec.set_binary_file(binary_file);
+        bin_file.file_spec.set_model_number(405);
+        lib_file.pre_initialize();
+        bin_file.pre_initialize();
+
+        // Each prefetched record holds the coefficients of the same record
+        // in the library.
+        const double * lib_coeffs = lib_file.io.coeffs_segment_starting_addr;
+        const std::size_t ncoeff = lib.meta->ncoeff;
+        for(uint32_t ii = 0; ii < num_recs; ++ii)
+        {
+            const double * record = bin_file.prefetch_record(ii);
+            ASSERT_NE(nullptr, record);
+            EXPECT_EQ(0, std::memcmp(lib_coeffs + ii * ncoeff, record, ncoeff * sizeof(double)));
+        }
+
+        // Nothing is advised beyond the end of the file or for the library.
+        EXPECT_EQ(nullptr, bin_file.prefetch_record(num_recs));
+        EXPECT_EQ(nullptr, lib_file.prefetch_record(0));
+    }
+
+    std::remove(binary_file);
+}
+
 TEST(De4xxFile, time_is_in_range) {}
 
 TEST(De4xxFile, capture_mem_stats) {}
@@ -143,6 +143,25 @@ public:
      */
     void gravitation(const RefFrame & point, GravityInteraction & grav);
 
+    /**
+     * Compute the contribution of one of the provided dynamic body's gravity
+     * controls, leaving it in the control's grav_accel, grav_grad and
+     * grav_pot. This and sum_gravitation split gravitation(point, grav)
+     * so that the controls can be evaluated concurrently, for one body or
+     * for many.
+     * \param[in] point  Point of interest, as a reference frame.
+     * \param[in] grav Gravity interaction
+     * \param[in] control_index Index of the control in grav.grav_controls
+     */
+    void control_gravitation(const RefFrame & point, const GravityInteraction & grav, unsigned int control_index);
+
+    /**
+     * Sum the contributions left by control_gravitation in the active
+     * controls, in control order, into the gravity interaction.
+     * \param[in,out] grav Gravity interaction
+     */
+    void sum_gravitation(GravityInteraction & grav);
+
     /**
      * Get the vector of gravitational bodies.
      * \warning Do not modify the vector, or elements of it.
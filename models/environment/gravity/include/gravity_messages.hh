@@ -121,6 +121,11 @@ public:
      */
     static const char * null_pointer; //!< trick_units(--)
 
+    /**
+     * Error issued when a gravity coefficient file cannot be read.
+     */
+    static const char * file_error; //!< trick_units(--)
+
     // Member functions
     // This class is not instantiable.
     // The constructors and assignment operator for this class are deleted.
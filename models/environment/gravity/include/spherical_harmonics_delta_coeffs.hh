@@ -129,6 +129,8 @@ public:
     virtual void initialize(SphericalHarmonicsDeltaCoeffsInit & var_init, BaseDynManager & dyn_manager);
 
     virtual void update(SphericalHarmonicsGravityControls & controls);
+
+    virtual bool inputs_changed();
 };
 
 } // namespace jeod
@@ -0,0 +1,229 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2025 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/include/spherical_harmonics_gravity_batch.hh
+ * Define a spherical harmonics gravity evaluator that processes many
+ * points of interest in a single call.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((Gottlieb, R. G.)
+    (Fast Gravity, Gravity Partials, Normalized Gravity, Gravity Gradient
+     Torque and Magnetic Field: Derivation, Code and Data)
+    (NASA Contractor Report 188243) (February 1993)))
+
+Assumptions and limitations:
+  ((The variational (tidal) effects attached to the per-vehicle controls
+    are not applied; the coefficients are those of the source at the time
+    initialize() was called.)
+   (Third body and relativistic contributions are not computed.))
+
+Library dependencies:
+  ((../src/spherical_harmonics_gravity_batch.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_SPHERICAL_HARMONICS_GRAVITY_BATCH_HH
+#define JEOD_SPHERICAL_HARMONICS_GRAVITY_BATCH_HH
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+#include "spherical_harmonics_packed_coeffs.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+/**
+ * Evaluates the spherical harmonics gravity field of one source at many
+ * points of interest per call. The points are processed in blocks of
+ * block_size; within a block every step of the Gottlieb recursion is
+ * carried out for all points in a short, dependency-free loop over
+ * contiguous lane data so that the compiler can map it onto the SIMD
+ * registers of the target (e.g., AVX2 or AVX-512 when so configured).
+ *
+ * The SphericalHarmonicsGravityControls::calc_nonspherical per-body
+ * evaluation remains the reference implementation. For the same inputs
+ * the batch evaluator performs the same arithmetic in the same order.
+ */
+class SphericalHarmonicsGravityBatch
+{
+    JEOD_MAKE_SIM_INTERFACES(jeod, SphericalHarmonicsGravityBatch)
+
+public:
+    /**
+     * Number of points evaluated together in the innermost loops.
+     */
+    static constexpr unsigned int block_size = 8;
+
+    // Member data
+
+    /**
+     * The source whose field is evaluated.
+     * @note Users should not set this data member in the input file.
+     */
+    SphericalHarmonicsGravitySource * harmonics_source{}; //!< trick_units(--)
+
+    /**
+     * Non-spherical degree to be used.
+     */
+    unsigned int degree{}; //!< trick_units(--)
+
+    /**
+     * Non-spherical order to be used.
+     */
+    unsigned int order{}; //!< trick_units(--)
+
+    /**
+     * Non-spherical degree to be used for computing gradient.
+     */
+    unsigned int gradient_degree{}; //!< trick_units(--)
+
+    /**
+     * Non-spherical order to be used for computing gradient.
+     */
+    unsigned int gradient_order{}; //!< trick_units(--)
+
+    /**
+     * Compute gravity gradient matrices?
+     */
+    bool gradient{}; //!< trick_units(--)
+
+    /**
+     * Compute only the perturbing (non-spherical) gravity?
+     */
+    bool perturbing_only{true}; //!< trick_units(--)
+
+protected:
+    /**
+     * Indicates that the minimum radius warning has been issued.
+     */
+    bool min_radius_warn{}; //!< trick_units(--)
+
+    /**
+     * Coefficients packed for sequential access.
+     */
+    SphericalHarmonicsPackedCoeffs coeffs; //!< trick_io(**)
+
+    /**
+     * Three rolling rows of Legendre functions, each degree+3 entries of
+     * block_size lanes.
+     */
+    double * P_rows{}; //!< trick_io(**)
+
+    /**
+     * Per-lane C_tilde terms, degree+1 entries of block_size lanes.
+     */
+    double * C_tilde{}; //!< trick_io(**)
+
+    /**
+     * Per-lane S_tilde terms, degree+1 entries of block_size lanes.
+     */
+    double * S_tilde{}; //!< trick_io(**)
+
+public:
+    SphericalHarmonicsGravityBatch() = default;
+    virtual ~SphericalHarmonicsGravityBatch();
+    SphericalHarmonicsGravityBatch(const SphericalHarmonicsGravityBatch &) = delete;
+    SphericalHarmonicsGravityBatch & operator=(const SphericalHarmonicsGravityBatch &) = delete;
+
+    // Configure the evaluator to match an initialized per-body control
+    virtual void initialize(                           // Return: -- Void
+        SphericalHarmonicsGravityControls & controls); // In:     -- Initialized control
+
+    // Compute gravitation at a set of points
+    virtual void evaluate(       // Return: --    Void
+        unsigned int num_points, // In:     --    Number of points
+        const double * pos_x,    // In:     m     Inertial x relative to source
+        const double * pos_y,    // In:     m     Inertial y relative to source
+        const double * pos_z,    // In:     m     Inertial z relative to source
+        double * accel_x,        // Out:    m/s2  Inertial x acceleration
+        double * accel_y,        // Out:    m/s2  Inertial y acceleration
+        double * accel_z,        // Out:    m/s2  Inertial z acceleration
+        double * pot,            // Out:    m2/s2 Potential, may be null
+        double (*dgdx)[3][3]);   // Out:    1/s2  Gradients, may be null
+
+protected:
+    // Compute gravitation at up to block_size points
+    void evaluate_block(unsigned int first,
+                        unsigned int count,
+                        const double * pos_x,
+                        const double * pos_y,
+                        const double * pos_z,
+                        double * accel_x,
+                        double * accel_y,
+                        double * accel_z,
+                        double * pot,
+                        double (*dgdx)[3][3]);
+
+    // Release the workspace
+    void free_workspace();
+};
+
+} // namespace jeod
+
+#ifdef TRICK_VER
+#include "spherical_harmonics_gravity_controls.hh"
+#include "spherical_harmonics_gravity_source.hh"
+#endif
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
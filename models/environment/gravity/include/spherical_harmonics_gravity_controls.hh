@@ -108,9 +108,36 @@ public:
     SphericalHarmonicsGravitySource * harmonics_source{}; //!< trick_units(--)
 
     /**
-     * LeGendre polynomials used to calculate non-spherical attraction
+     * Workspace of the Gottlieb recursion, one 64-byte aligned allocation
+     * sized to the degree of the source. The arrays below point into it.
      */
-    double ** Pnm{}; //!< trick_units(--)
+    double * gottlieb_workspace{}; //!< trick_io(**)
+
+    /**
+     * LeGendre polynomials used to calculate non-spherical attraction,
+     * packed by degree; see legendre_row.
+     */
+    double * Pnm{}; //!< trick_io(**)
+
+    /**
+     * cos(m*lambda), indexed by order.
+     */
+    double * cos_mlambda{}; //!< trick_io(**)
+
+    /**
+     * sin(m*lambda), indexed by order.
+     */
+    double * sin_mlambda{}; //!< trick_io(**)
+
+    /**
+     * Gottlieb C_tilde terms, indexed by order.
+     */
+    double * C_tilde{}; //!< trick_io(**)
+
+    /**
+     * Gottlieb S_tilde terms, indexed by order.
+     */
+    double * S_tilde{}; //!< trick_io(**)
 
     /**
      * Coefficient degree to be used for totaling up all active delta_coeffs.
@@ -168,6 +195,44 @@ public:
      */
     unsigned int gradient_order{}; //!< trick_units(--)
 
+    /**
+     * Choose the degree evaluated by each call from the distance to the
+     * source, up to the degree above, dropping the highest degrees while a
+     * bound on their summed contribution stays below adaptive_tolerance.
+     */
+    bool adaptive_degree{}; //!< trick_units(--)
+
+    /**
+     * Bound on the acceleration dropped in adaptive mode, relative to the
+     * central (point mass) acceleration.
+     */
+    double adaptive_tolerance{1.0e-12}; //!< trick_units(--)
+
+    /**
+     * Factor, in (0,1], applied to adaptive_tolerance before the evaluated
+     * degree is lowered. The band between the two keeps the degree from
+     * chattering back and forth.
+     */
+    double adaptive_hysteresis{0.1}; //!< trick_units(--)
+
+    /**
+     * Degree evaluated by the last call.
+     * @note This is an output; users should not set it in the input file.
+     */
+    unsigned int effective_degree{}; //!< trick_units(--)
+
+    /**
+     * Order evaluated by the last call.
+     * @note This is an output; users should not set it in the input file.
+     */
+    unsigned int effective_order{}; //!< trick_units(--)
+
+    /**
+     * Number of times adaptive mode has changed the evaluated degree.
+     * @note This is an output; users should not set it in the input file.
+     */
+    unsigned int num_degree_changes{}; //!< trick_units(--)
+
     /**
      * List of controls for variational gravity effects like solid-body tides
      */
@@ -249,6 +314,28 @@ protected:
 
     // Add up (via superposition) all active variational gravity effects
     virtual void sum_deltacoeffs(); // Return: --  Void
+
+    // Choose the degree and order to be evaluated at a distance
+    void update_effective_degree( // Return: --  Void
+        double r_mag);            // In:     M   Distance to the source
+
+    // Allocate and initialize the Gottlieb recursion workspace
+    void allocate_workspace(      // Return: --  Void
+        unsigned int max_degree); // In:     --  Degree of the source
+
+    // Release the Gottlieb recursion workspace
+    void release_workspace(); // Return: --  Void
+
+    /**
+     * Locate the Legendre polynomials of a given degree in Pnm.
+     * Row n holds P(n,0) to P(n,n+2).
+     * @return Pointer to P(n,0)
+     * \param[in] n Degree
+     */
+    double * legendre_row(unsigned int n)
+    {
+        return Pnm + n * (n + 5) / 2;
+    }
 };
 
 } // namespace jeod
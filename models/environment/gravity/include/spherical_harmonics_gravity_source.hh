@@ -58,7 +58,8 @@ Assumptions and limitations:
   ((TBS))
 
 Library dependencies:
-  ((../src/spherical_harmonics_gravity_source.cc))
+  ((../src/spherical_harmonics_gravity_source.cc)
+   (../src/spherical_harmonics_gravity_source_file.cc))
 
 
 *******************************************************************************/
@@ -67,6 +68,8 @@ Library dependencies:
 #define JEOD_SPHERICAL_HARMONICS_GRAVITY_BODY_HH
 
 // System includes
+#include <pthread.h>
+#include <string>
 #include <vector>
 
 // JEOD includes
@@ -76,6 +79,7 @@ Library dependencies:
 // Model includes
 #include "class_declarations.hh"
 #include "gravity_source.hh"
+#include "spherical_harmonics_packed_coeffs.hh"
 
 //! Namespace jeod
 namespace jeod
@@ -111,11 +115,15 @@ public:
 
     /**
      * Normalized real (cosine) spherical harmonic coefficients.
+     * The controls read a copy made by initialize_body; call
+     * update_packed_coeffs after changing these during a run.
      */
     double ** Cnm{}; //!< trick_units(--)
 
     /**
      * Normalized imaginary (sine) spherical harmonic coefficients.
+     * The controls read a copy made by initialize_body; call
+     * update_packed_coeffs after changing these during a run.
      */
     double ** Snm{}; //!< trick_units(--)
 
@@ -180,6 +188,33 @@ public:
      */
     JeodPointerVector<SphericalHarmonicsDeltaCoeffs>::type delta_coeffs; //!< trick_io(**)
 
+    /**
+     * Number of times one of the delta_coeffs has been recomputed. The
+     * effects are shared by all controls on this source and are recomputed
+     * only when their inputs change, so controls that read the effects at
+     * the same version read the same coefficients.
+     */
+    unsigned int deltacoeffs_version{}; //!< trick_units(--)
+
+    /**
+     * The coefficients read by the controls, interleaved per degree and order.
+     * This is a snapshot taken by initialize_body and refreshed by
+     * update_packed_coeffs.
+     */
+    SphericalHarmonicsPackedCoeffs packed_coeffs; //!< trick_io(**)
+
+protected:
+    /**
+     * Degree for which the Gottlieb coefficients were last computed.
+     */
+    unsigned int gottlieb_degree{}; //!< trick_units(--)
+
+    /**
+     * Guards the delta-coefficients of the effects, which controls evaluated
+     * on different threads update and read at the same time.
+     */
+    pthread_mutex_t deltacoeff_mutex{}; //!< trick_io(**)
+
 public:
     SphericalHarmonicsGravitySource();
     ~SphericalHarmonicsGravitySource() override;
@@ -198,6 +233,44 @@ public:
     void add_deltacoeff(SphericalHarmonicsDeltaCoeffsInit & var_init,
                         BaseDynManager & dyn_manager,
                         SphericalHarmonicsDeltaCoeffs & var_effect);
+
+    // Copy changed Cnm and Snm values into the table read by the controls.
+    void update_packed_coeffs();
+
+    // Lock the delta-coeffs effects against concurrent updates and reads.
+    void begin_deltacoeff_block();
+
+    // Unlock the delta-coeffs effects.
+    void end_deltacoeff_block();
+
+    // Bring a delta-coeffs effect up to date, recomputing it only if its
+    // inputs have changed since it was last computed.
+    void update_deltacoeff(SphericalHarmonicsDeltaCoeffs & delta_coeff, SphericalHarmonicsGravityControls & controls);
+
+    // Load the coefficients from a JEOD binary or ICGEM (.gfc) file,
+    // truncated to the given degree and order (0 = as in the file).
+    void load_coefficient_file(const std::string & file_name,
+                               unsigned int max_degree = 0,
+                               unsigned int max_order = 0);
+
+    // Write the coefficients to a JEOD binary coefficient file.
+    void write_coefficient_file(const std::string & file_name) const;
+
+protected:
+    // Read the coefficients from a memory-mapped JEOD binary file.
+    bool read_binary_coefficients(const std::string & file_name, unsigned int max_degree, unsigned int max_order);
+
+    // Read the coefficients from an ICGEM gravity field (.gfc) file.
+    void read_icgem_coefficients(const std::string & file_name, unsigned int max_degree, unsigned int max_order);
+
+    // Replace the coefficient arrays with zeroed arrays of the given size.
+    void allocate_coefficients(unsigned int new_degree, unsigned int new_order);
+
+    // Compute the Gottlieb coefficient arrays for the current degree.
+    void compute_gottlieb_coefficients();
+
+    // Release the Gottlieb coefficient arrays.
+    void release_gottlieb_arrays();
 };
 
 } // namespace jeod
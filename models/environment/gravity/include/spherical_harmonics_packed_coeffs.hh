@@ -0,0 +1,234 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2025 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/include/spherical_harmonics_packed_coeffs.hh
+ * Define a contiguous, triangular packing of the spherical harmonics
+ * coefficients and the Gottlieb recursion coefficients.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((Gottlieb, R. G.)
+    (Fast Gravity, Gravity Partials, Normalized Gravity, Gravity Gradient
+     Torque and Magnetic Field: Derivation, Code and Data)
+    (NASA Contractor Report 188243) (February 1993)))
+
+Assumptions and limitations:
+  ((The packed table is a snapshot of the source coefficients taken when
+    build() is called. Changes made to the source afterwards are not seen
+    until update_coefficients() or build() is called.))
+
+Library dependencies:
+  ((../src/spherical_harmonics_packed_coeffs.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_SPHERICAL_HARMONICS_PACKED_COEFFS_HH
+#define JEOD_SPHERICAL_HARMONICS_PACKED_COEFFS_HH
+
+// System includes
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+#include "class_declarations.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+/**
+ * Stores the coefficients needed by the Gottlieb recursion in a single
+ * contiguous, lower-triangular array. The terms for a given degree n and
+ * order m are interleaved so that a sweep over m for a fixed n reads memory
+ * strictly in order.
+ */
+class SphericalHarmonicsPackedCoeffs
+{
+    JEOD_MAKE_SIM_INTERFACES(jeod, SphericalHarmonicsPackedCoeffs)
+
+public:
+    /**
+     * The coefficients associated with one (degree, order) pair.
+     */
+    struct Term
+    {
+        /**
+         * Normalized real (cosine) spherical harmonic coefficient.
+         */
+        double C; //!< trick_units(--)
+
+        /**
+         * Normalized imaginary (sine) spherical harmonic coefficient.
+         */
+        double S; //!< trick_units(--)
+
+        /**
+         * Gottlieb coefficient xi.
+         */
+        double xi; //!< trick_units(--)
+
+        /**
+         * Gottlieb coefficient eta.
+         */
+        double eta; //!< trick_units(--)
+
+        /**
+         * Gottlieb coefficient zeta.
+         */
+        double zeta; //!< trick_units(--)
+
+        /**
+         * Gottlieb coefficient upsilon.
+         */
+        double upsilon; //!< trick_units(--)
+    };
+
+    // Member data
+
+    /**
+     * Maximum degree represented in the table.
+     */
+    unsigned int degree{}; //!< trick_units(--)
+
+    /**
+     * Maximum order represented in the table.
+     */
+    unsigned int order{}; //!< trick_units(--)
+
+    /**
+     * Packed terms, (degree+1)*(degree+2)/2 entries indexed by index(n,m).
+     */
+    Term * terms{}; //!< trick_io(**)
+
+    /**
+     * Gottlieb coefficient alpha, indexed by degree.
+     */
+    double * alpha{}; //!< trick_io(**)
+
+    /**
+     * Gottlieb coefficient beta, indexed by degree.
+     */
+    double * beta{}; //!< trick_io(**)
+
+    /**
+     * Gottlieb coefficient nrdiag, indexed by degree.
+     */
+    double * nrdiag{}; //!< trick_io(**)
+
+    /**
+     * Sectoral Legendre function values P(n,n), indexed by degree.
+     */
+    double * Pnn{}; //!< trick_io(**)
+
+    /**
+     * 0 to degree+2 cast as doubles.
+     */
+    double * int_to_double{}; //!< trick_io(**)
+
+    /**
+     * Root sum square of the C and S coefficients of each degree.
+     */
+    double * degree_rss{}; //!< trick_io(**)
+
+    // Member functions
+
+    SphericalHarmonicsPackedCoeffs() = default;
+    ~SphericalHarmonicsPackedCoeffs();
+    SphericalHarmonicsPackedCoeffs(const SphericalHarmonicsPackedCoeffs &) = delete;
+    SphericalHarmonicsPackedCoeffs & operator=(const SphericalHarmonicsPackedCoeffs &) = delete;
+
+    // Pack the coefficients of the source up to the given degree and order
+    void build(const SphericalHarmonicsGravitySource & source, // In: -- Source to be packed
+               unsigned int max_degree,                        // In: -- Degree to be packed
+               unsigned int max_order);                        // In: -- Order to be packed
+
+    // Copy the source's C and S coefficients into the table built from it
+    void update_coefficients(const SphericalHarmonicsGravitySource & source); // In: -- Source the table was built from
+
+    // Release the packed arrays
+    void clear();
+
+    /**
+     * Compute the location of the (n,m) term in the packed array.
+     * @return Index of the term
+     * \param[in] n Degree
+     * \param[in] m Order, no larger than n
+     */
+    static unsigned int index(unsigned int n, unsigned int m)
+    {
+        return n * (n + 1) / 2 + m;
+    }
+
+    /**
+     * Access the packed terms of a given degree.
+     * @return Pointer to the (n,0) term
+     * \param[in] n Degree
+     */
+    const Term * row(unsigned int n) const
+    {
+        return terms + index(n, 0);
+    }
+};
+
+} // namespace jeod
+
+#ifdef TRICK_VER
+#include "spherical_harmonics_gravity_source.hh"
+#endif
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
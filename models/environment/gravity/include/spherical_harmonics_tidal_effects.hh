@@ -137,6 +137,14 @@ protected:
      */
     RefFrame * pfix{}; //!< trick_units(--)
 
+    /**
+     * Time stamps of the frames the effect depends on when the effect was
+     * last updated: the subject body's planet-fixed and inertial frames
+     * followed by the tidal bodies' inertial frames.
+     * Length after init is num_tidal_bodies + 2.
+     */
+    double * input_times{}; //!< trick_units(s)
+
     // Member functions
 public:
     SphericalHarmonicsTidalEffects() = default;
@@ -145,6 +153,8 @@ public:
     void initialize(SphericalHarmonicsDeltaCoeffsInit & var_init, BaseDynManager & dyn_manager) override;
 
     void update(SphericalHarmonicsGravityControls & controls) override;
+
+    bool inputs_changed() override;
 };
 
 } // namespace jeod
@@ -10,6 +10,9 @@ spherical_harmonics_delta_coeffs.cc
 spherical_harmonics_gravity_controls.cc
 spherical_harmonics_calc_nonspherical.cc
 spherical_harmonics_gravity_source.cc
+spherical_harmonics_gravity_source_file.cc
+spherical_harmonics_packed_coeffs.cc
+spherical_harmonics_gravity_batch.cc
 gravity_messages.cc
 spherical_harmonics_tidal_effects.cc
 )
@@ -281,10 +281,13 @@ void GravityControls::gravitation(const RefFrame & point_of_interest,
     if(!perturbing_only && !skip_spherical)
     {
         // Compute state of integ. frame origin wrt the planet center.
-        Vector3::negate(grav_source_state.trans.position, grav_source_frame.pos);
+        // This is done in a local copy of the shared source frame so that
+        // bodies can be processed concurrently.
+        GravityIntegFrame local_source_frame(grav_source_frame);
+        Vector3::negate(grav_source_state.trans.position, local_source_frame.pos);
 
         // Calculate spherical gravity, in the integration frame.
-        calc_spherical(point_of_interest.state.trans.position, rel_pos, grav_source_frame, body_grav_accel, dgdx, pot);
+        calc_spherical(point_of_interest.state.trans.position, rel_pos, local_source_frame, body_grav_accel, dgdx, pot);
     }
 }
 
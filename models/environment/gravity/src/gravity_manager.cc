@@ -220,6 +220,33 @@ void GravityManager::gravitation(const double integ_pos[3], GravityInteraction &
 // Note: This overload of GravityManager::gravitation provides the ability
 // to compute gravitation with a relativistic correction.
 void GravityManager::gravitation(const RefFrame & point, GravityInteraction & grav)
+{
+    unsigned int n_controls = grav.grav_controls.size(); // --   Number of controls for the dyn body
+
+    /* Compute the gravitational acceleration from each gravitational body
+       for which the vehicle has a control on the body and accumulate the
+       total gravitational acceleration, gradient, and potential. */
+    for(unsigned int ii = 0; ii < n_controls; ++ii)
+    {
+        control_gravitation(point, grav, ii);
+    }
+    sum_gravitation(grav);
+}
+
+// Compute the contribution of one gravity control.
+void GravityManager::control_gravitation(const RefFrame & point,
+                                         const GravityInteraction & grav,
+                                         unsigned int control_index)
+{
+    GravityControls & control = *(grav.grav_controls[control_index]);
+    if(control.active)
+    {
+        control.gravitation(point, grav.integ_frame_index, control.grav_accel, control.grav_grad, control.grav_pot);
+    }
+}
+
+// Sum the contributions of the active gravity controls.
+void GravityManager::sum_gravitation(GravityInteraction & grav)
 {
     double total_grav_accel[3] = {0.0, 0.0, 0.0}; // M/s2 Total accel
     double total_grav_grad[3][3] = {
@@ -230,17 +257,12 @@ void GravityManager::gravitation(const RefFrame & point, GravityInteraction & gr
 
     double total_grav_pot = 0.0;                         // -- Total gravitational potential
     unsigned int n_controls = grav.grav_controls.size(); // --   Number of controls for the dyn body
-    unsigned int integ_idx = grav.integ_frame_index;     // --   Vehicle integration frame index
 
-    /* Compute the gravitational acceleration from each gravitational body
-       for which the vehicle has a control on the body and accumulate the
-       total gravitational acceleration, gradient, and potential. */
     for(unsigned int ii = 0; ii < n_controls; ++ii)
     {
-        GravityControls & control_ii = *(grav.grav_controls[ii]);
+        const GravityControls & control_ii = *(grav.grav_controls[ii]);
         if(control_ii.active)
         {
-            control_ii.gravitation(point, integ_idx, control_ii.grav_accel, control_ii.grav_grad, control_ii.grav_pot);
             Vector3::incr(control_ii.grav_accel, total_grav_accel);
             Matrix3x3::incr(control_ii.grav_grad, total_grav_grad);
             total_grav_pot += control_ii.grav_pot;
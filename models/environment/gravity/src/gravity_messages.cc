@@ -51,6 +51,7 @@ MAKE_GRAVITY_MESSAGE_CODE(invalid_object);
 MAKE_GRAVITY_MESSAGE_CODE(invalid_limit);
 MAKE_GRAVITY_MESSAGE_CODE(domain_error);
 MAKE_GRAVITY_MESSAGE_CODE(null_pointer);
+MAKE_GRAVITY_MESSAGE_CODE(file_error);
 
 #undef MAKE_GRAVITY_MESSAGE_CODE
 
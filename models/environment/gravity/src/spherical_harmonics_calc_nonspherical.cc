@@ -20,6 +20,7 @@ Purpose:
 Library dependencies:
   ((spherical_harmonics_calc_nonspherical.cc)
    (spherical_harmonics_gravity_source.cc)
+   (spherical_harmonics_packed_coeffs.cc)
    (environment/planet/src/planet.cc))
 
 
@@ -75,32 +76,38 @@ void SphericalHarmonicsGravityControls::calc_nonspherical(const double integ_pos
                              harmonics_source->name.c_str());
     }
 
-    // Store Cnm[2][...] array locally to avoid data writes to gravity body
-    double local_Cnm[3];
-    local_Cnm[0] = harmonics_source->Cnm[2][0];
-    local_Cnm[1] = harmonics_source->Cnm[2][1];
-    local_Cnm[2] = harmonics_source->Cnm[2][2];
+    // Choose the degree and order to be evaluated at this distance
+    update_effective_degree(r_mag);
+    unsigned int eval_grad_degree = (gradient_degree < effective_degree) ? gradient_degree : effective_degree;
+    unsigned int eval_grad_order = (gradient_order < eval_grad_degree) ? gradient_order : eval_grad_degree;
+
+    // The source coefficients, interleaved for the recursion
+    const SphericalHarmonicsPackedCoeffs & coeffs = harmonics_source->packed_coeffs;
+
+    // Store C20 locally to avoid data writes to gravity body
+    double local_C20 = coeffs.row(2)[0].C;
 
     // Compute acceleration due to non-spherical gravity
     // (from code on pages 43-46 of Gottlieb's 1993 paper)
 
     // Compute gravity coefficients changes from variational effects
-    double temp_C20;
     unsigned int n_deltacoeffs = var_effects.size();
 
     if(n_deltacoeffs > 0)
     {
-        // Sum up the gravity coefficients changes in this body's "delta-bin"
+        // Sum up the gravity coefficients changes in this body's "delta-bin".
+        // Other threads may be updating the shared effects.
+        harmonics_source->begin_deltacoeff_block();
         update_deltacoeffs();
         sum_deltacoeffs();
+        harmonics_source->end_deltacoeff_block();
 
-        temp_C20 = local_Cnm[0];
-        local_Cnm[0] += total_dC20;
+        local_C20 += total_dC20;
 
         // Correct permanent tide if already included in C20 coefficient
         if(!harmonics_source->tide_free)
         {
-            local_Cnm[0] += harmonics_source->tide_free_delta;
+            local_C20 += harmonics_source->tide_free_delta;
         }
     }
 
@@ -139,8 +146,6 @@ void SphericalHarmonicsGravityControls::calc_nonspherical(const double integ_pos
 
     // Set up first values to enable recursive calculation of normalized
     // coefficients with modification for underflow near poles
-    double cos_mlambda[degree + 1];
-    double sin_mlambda[degree + 1];
     cos_mlambda[0] = 1.0;
     sin_mlambda[0] = 0.0;
     if(rho_sq > 0.0)
@@ -189,16 +194,11 @@ void SphericalHarmonicsGravityControls::calc_nonspherical(const double integ_pos
     double Sumh_grad_N = 0.0;
     double Sumgam_grad_N = 0.0;
 
-    double C_tilde[degree + 1];
-    double S_tilde[degree + 1];
-
     double Lambda = 0.0;
 
+    const SphericalHarmonicsPackedCoeffs::Term * terms_ii;
     double * P_ii;
-    double * C_ii;
-    double * S_ii;
-    double * zeta_ii;
-    double * xi_ii;
+    double C_ii0;
 
     double C_iijj;
     double S_iijj;
@@ -224,11 +224,11 @@ void SphericalHarmonicsGravityControls::calc_nonspherical(const double integ_pos
     S_tilde[0] = 0.0;
     S_tilde[1] = Y_div_r; // equation (3-18)
 
-    Pnm[1][0] = sqrt(3.0) * Epilson;
+    legendre_row(1)[0] = sqrt(3.0) * Epilson;
 
-    for(unsigned int ii = 2; ii <= degree; ++ii)
+    for(unsigned int ii = 2; ii <= effective_degree; ++ii)
     {
-        if(ii <= gradient_degree && gradient_degree > 0)
+        if(ii <= eval_grad_degree && eval_grad_degree > 0)
         {
             ii_grad_deg_nonzero = true;
         }
@@ -237,67 +237,55 @@ void SphericalHarmonicsGravityControls::calc_nonspherical(const double integ_pos
             ii_grad_deg_nonzero = false;
         }
 
-        // Protect against writes into harmonics body Cnm array
-        if(ii == 2)
-        {
-            C_ii = &(local_Cnm[0]);
-        }
-        else
-        {
-            C_ii = &(harmonics_source->Cnm[ii][0]);
-        }
-
-        P_ii = &(Pnm[ii][0]);
-        S_ii = &(harmonics_source->Snm[ii][0]);
-        xi_ii = &(harmonics_source->xi[ii][0]);
-        double * eta_ii = &(harmonics_source->eta[ii][0]);
-        zeta_ii = &(harmonics_source->zeta[ii][0]);
-        double * upsilon_ii = &(harmonics_source->upsilon[ii][0]);
+        // The C20 term may carry the variational effects
+        terms_ii = coeffs.row(ii);
+        C_ii0 = (ii == 2) ? local_C20 : terms_ii[0].C;
 
-        double * P_iim1 = &(Pnm[ii - 1][0]);
-        double * P_iim2 = &(Pnm[ii - 2][0]);
+        P_ii = legendre_row(ii);
+        double * P_iim1 = legendre_row(ii - 1);
+        double * P_iim2 = legendre_row(ii - 2);
 
         rad_div_r_nth = rad_div_r_nth * rad_div_r;
 
-        // Protect for underflow
+        // Protect for underflow: this and all higher degrees contribute nothing
         if(rad_div_r_nth < 1.0E-299)
         {
-            rad_div_r_nth = 0.0;
+            break;
         }
 
         // P(n,0) term, equation (7-14)
-        P_ii[0] = harmonics_source->alpha[ii] * Epilson * P_iim1[0] - harmonics_source->beta[ii] * P_iim2[0];
+        P_ii[0] = coeffs.alpha[ii] * Epilson * P_iim1[0] - coeffs.beta[ii] * P_iim2[0];
 
         // P(n,n-1) term, equation (7-16)
-        P_ii[ii - 1] = Epilson * harmonics_source->nrdiag[ii];
+        P_ii[ii - 1] = Epilson * coeffs.nrdiag[ii];
 
         // P(n,1) term, equation (7-12)
-        P_ii[1] = xi_ii[1] * Epilson * P_iim1[1] - eta_ii[1] * P_iim2[1];
+        P_ii[1] = terms_ii[1].xi * Epilson * P_iim1[1] - terms_ii[1].eta * P_iim2[1];
 
-        double dbl_iip1 = harmonics_source->int_to_double[ii + 1];
+        double dbl_iip1 = coeffs.int_to_double[ii + 1];
 
-        double Sumv_N = P_ii[0] * C_ii[0];
-        double Sumh_N = P_ii[1] * C_ii[0] * zeta_ii[0];
+        double Sumv_N = P_ii[0] * C_ii0;
+        double Sumh_N = P_ii[1] * C_ii0 * terms_ii[0].zeta;
         double Sumgam_N = Sumv_N * dbl_iip1;
 
         for(unsigned int jj = 2; jj <= (ii - 2); ++jj)
         {
             // Equation (7-12)
-            P_ii[jj] = xi_ii[jj] * Epilson * P_iim1[jj] - eta_ii[jj] * P_iim2[jj];
+            P_ii[jj] = terms_ii[jj].xi * Epilson * P_iim1[jj] - terms_ii[jj].eta * P_iim2[jj];
         }
 
         if(ii_grad_deg_nonzero)
         {
-            Sumh_grad_N = P_ii[1] * C_ii[0] * zeta_ii[0];
+            Sumh_grad_N = P_ii[1] * C_ii0 * terms_ii[0].zeta;
             Sumgam_grad_N = Sumv_N * dbl_iip1;
-            Summ_N = P_ii[2] * C_ii[0] * upsilon_ii[0];
+            Summ_N = P_ii[2] * C_ii0 * terms_ii[0].upsilon;
             Sump_N = Sumh_grad_N * dbl_iip1;
             Suml_N = Sumgam_grad_N * (dbl_iip1 + 1.0);
         }
 
-        if(order > 0)
+        if(effective_order > 0)
         {
-            if(gradient_order > 0)
+            if(eval_grad_order > 0)
             {
                 grad_order_nonzero = true;
             }
@@ -334,9 +322,9 @@ void SphericalHarmonicsGravityControls::calc_nonspherical(const double integ_pos
             C_tilde[ii] = cos_phi_nth * cos_mlambda[ii];
             S_tilde[ii] = cos_phi_nth * sin_mlambda[ii];
 
-            for(unsigned int jj = 1; (jj <= order) && (jj <= ii); ++jj)
+            for(unsigned int jj = 1; (jj <= effective_order) && (jj <= ii); ++jj)
             {
-                if(jj <= gradient_order)
+                if(jj <= eval_grad_order)
                 {
                     jj_lt_grad_order = true;
                 }
@@ -345,12 +333,14 @@ void SphericalHarmonicsGravityControls::calc_nonspherical(const double integ_pos
                     jj_lt_grad_order = false;
                 }
 
-                dbl_jj = harmonics_source->int_to_double[jj];
-                dbl_jjp1 = harmonics_source->int_to_double[jj + 1];
-                dbl_jjm1 = harmonics_source->int_to_double[jj - 1];
+                const SphericalHarmonicsPackedCoeffs::Term & term = terms_ii[jj];
 
-                C_iijj = C_ii[jj];
-                S_iijj = S_ii[jj];
+                dbl_jj = coeffs.int_to_double[jj];
+                dbl_jjp1 = coeffs.int_to_double[jj + 1];
+                dbl_jjm1 = coeffs.int_to_double[jj - 1];
+
+                C_iijj = term.C;
+                S_iijj = term.S;
 
                 jj_x_Piijj = dbl_jj * P_ii[jj];
                 B_tilde = C_iijj * C_tilde[jj] + S_iijj * S_tilde[jj];
@@ -363,7 +353,7 @@ void SphericalHarmonicsGravityControls::calc_nonspherical(const double integ_pos
 
                 if(jj < ii)
                 {
-                    zetaiijj_x_Piijjp1 = zeta_ii[jj] * P_ii[jj + 1];
+                    zetaiijj_x_Piijjp1 = term.zeta * P_ii[jj + 1];
                     Sumh_N = Sumh_N + zetaiijj_x_Piijjp1 * B_tilde;
                     if(ii_grad_deg_nonzero && grad_order_nonzero && jj_lt_grad_order)
                     {
@@ -382,7 +372,7 @@ void SphericalHarmonicsGravityControls::calc_nonspherical(const double integ_pos
                 {
                     Sumgam_grad_N = Sumgam_grad_N + (dbl_jj + dbl_iip1) * Piijj_x_Btilde;
                     Suml_N = Suml_N + (dbl_jj + dbl_iip1) * (dbl_jjp1 + dbl_iip1) * Piijj_x_Btilde;
-                    Summ_N = Summ_N + P_ii[jj + 2] * B_tilde * upsilon_ii[jj];
+                    Summ_N = Summ_N + P_ii[jj + 2] * B_tilde * term.upsilon;
                     Sums_N = Sums_N + (dbl_jj + dbl_iip1) * jj_x_Piijj * B_tilde_m1;
                     Sumt_N = Sumt_N - (dbl_jj + dbl_iip1) * jj_x_Piijj * A_tilde_m1;
                 }
@@ -439,14 +429,8 @@ void SphericalHarmonicsGravityControls::calc_nonspherical(const double integ_pos
     // Convert back to inertial (overwrites position vector)
     Vector3::transform_transpose(harmonics_source->pfix->state.rot.T_parent_this, body_grav_accel);
 
-    // Remove delta coefficient for tide effect
-    if(n_deltacoeffs > 0)
-    {
-        local_Cnm[0] = temp_C20;
-    }
-
     // Compute gravity gradient
-    if(gradient && (gradient_degree > 0))
+    if(gradient && (eval_grad_degree > 0))
     {
         double dgdx_pf[3][3]; // Gravity gradient in planet-fixed coords
 
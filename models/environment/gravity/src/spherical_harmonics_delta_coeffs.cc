@@ -98,6 +98,17 @@ void SphericalHarmonicsDeltaCoeffs::update(SphericalHarmonicsGravityControls & c
     return; // Pure virtual; no unique behavior of its own
 }
 
+/**
+ * Have the inputs to update changed since they were last checked?
+ * The gravity source only updates an effect when this returns true.
+ * Effects that cannot tell always report a change.
+ * @return True if the delta-coefficients need to be updated
+ */
+bool SphericalHarmonicsDeltaCoeffs::inputs_changed()
+{
+    return true;
+}
+
 } // namespace jeod
 
 /**
@@ -0,0 +1,642 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/spherical_harmonics_gravity_batch.cc
+ * Define member functions for the SphericalHarmonicsGravityBatch class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((spherical_harmonics_gravity_batch.cc)
+   (spherical_harmonics_packed_coeffs.cc)
+   (spherical_harmonics_gravity_controls.cc)
+   (spherical_harmonics_gravity_source.cc)
+   (gravity_messages.cc)
+   (environment/ephemerides/ephem_interface/src/ephem_ref_frame.cc)
+   (utils/message/src/message_handler.cc))
+
+
+*******************************************************************************/
+
+// System includes
+#include <cmath>
+
+// JEOD includes
+#include "environment/ephemerides/ephem_interface/include/ephem_ref_frame.hh"
+#include "utils/math/include/matrix3x3.hh"
+#include "utils/math/include/numerical.hh"
+#include "utils/math/include/vector3.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/gravity_messages.hh"
+#include "../include/spherical_harmonics_gravity_batch.hh"
+#include "../include/spherical_harmonics_gravity_controls.hh"
+#include "../include/spherical_harmonics_gravity_source.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+/**
+ * SphericalHarmonicsGravityBatch destructor.
+ */
+SphericalHarmonicsGravityBatch::~SphericalHarmonicsGravityBatch()
+{
+    free_workspace();
+}
+
+/**
+ * Release the workspace.
+ */
+void SphericalHarmonicsGravityBatch::free_workspace()
+{
+    JEOD_DELETE_ARRAY(P_rows);
+    JEOD_DELETE_ARRAY(C_tilde);
+    JEOD_DELETE_ARRAY(S_tilde);
+}
+
+/**
+ * Take the source and the degree, order, and gradient settings from an
+ * initialized per-body control, pack the coefficients, and size the
+ * workspace.
+ * \param[in] controls Initialized spherical harmonics gravity control
+ */
+void SphericalHarmonicsGravityBatch::initialize(SphericalHarmonicsGravityControls & controls)
+{
+    if(controls.harmonics_source == nullptr)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             GravityMessages::invalid_object,
+                             "Gravity controls for '%s' have not been initialized.",
+                             controls.source_name.c_str());
+        return;
+    }
+
+    harmonics_source = controls.harmonics_source;
+    controls.get_degree_order(degree, order);
+    controls.get_grad_degree_order(gradient_degree, gradient_order);
+    gradient = controls.gradient;
+    perturbing_only = controls.perturbing_only;
+
+    coeffs.build(*harmonics_source, degree, order);
+
+    // The seed rows for degrees 0 and 1 are always present.
+    unsigned int ws_degree = (degree > 1) ? degree : 1;
+
+    free_workspace();
+    P_rows = JEOD_ALLOC_PRIM_ARRAY(3 * (ws_degree + 3) * block_size, double);
+    C_tilde = JEOD_ALLOC_PRIM_ARRAY((ws_degree + 1) * block_size, double);
+    S_tilde = JEOD_ALLOC_PRIM_ARRAY((ws_degree + 1) * block_size, double);
+}
+
+/**
+ * Compute the gravitational acceleration, potential, and optionally the
+ * gravity gradient at each of a set of points.
+ * \param[in] num_points Number of points
+ * \param[in] pos_x Inertial x positions relative to the source\n Units: M
+ * \param[in] pos_y Inertial y positions relative to the source\n Units: M
+ * \param[in] pos_z Inertial z positions relative to the source\n Units: M
+ * \param[out] accel_x Inertial x accelerations\n Units: M/s2
+ * \param[out] accel_y Inertial y accelerations\n Units: M/s2
+ * \param[out] accel_z Inertial z accelerations\n Units: M/s2
+ * \param[out] pot Potentials, or null\n Units: M2/s2
+ * \param[out] dgdx Gravity gradients, or null\n Units: 1/s2
+ */
+void SphericalHarmonicsGravityBatch::evaluate(unsigned int num_points,
+                                              const double * pos_x,
+                                              const double * pos_y,
+                                              const double * pos_z,
+                                              double * accel_x,
+                                              double * accel_y,
+                                              double * accel_z,
+                                              double * pot,
+                                              double (*dgdx)[3][3])
+{
+    if(harmonics_source == nullptr)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             GravityMessages::null_pointer,
+                             "SphericalHarmonicsGravityBatch::evaluate called before initialize.");
+        return;
+    }
+
+    for(unsigned int first = 0; first < num_points; first += block_size)
+    {
+        unsigned int count = num_points - first;
+        if(count > block_size)
+        {
+            count = block_size;
+        }
+        evaluate_block(first, count, pos_x, pos_y, pos_z, accel_x, accel_y, accel_z, pot, dgdx);
+    }
+}
+
+/**
+ * Compute gravitation at up to block_size points, starting at index first.
+ * Lanes beyond count repeat the last point and their results are discarded.
+ * The arithmetic follows SphericalHarmonicsGravityControls::calc_nonspherical
+ * (pages 43-46 of Gottlieb's 1993 paper) term for term.
+ * \param[in] first Index of the first point in the block
+ * \param[in] count Number of points in the block
+ * \param[in] pos_x Inertial x positions relative to the source\n Units: M
+ * \param[in] pos_y Inertial y positions relative to the source\n Units: M
+ * \param[in] pos_z Inertial z positions relative to the source\n Units: M
+ * \param[out] accel_x Inertial x accelerations\n Units: M/s2
+ * \param[out] accel_y Inertial y accelerations\n Units: M/s2
+ * \param[out] accel_z Inertial z accelerations\n Units: M/s2
+ * \param[out] pot Potentials, or null\n Units: M2/s2
+ * \param[out] dgdx Gravity gradients, or null\n Units: 1/s2
+ */
+void SphericalHarmonicsGravityBatch::evaluate_block(unsigned int first,
+                                                    unsigned int count,
+                                                    const double * pos_x,
+                                                    const double * pos_y,
+                                                    const double * pos_z,
+                                                    double * accel_x,
+                                                    double * accel_y,
+                                                    double * accel_z,
+                                                    double * pot,
+                                                    double (*dgdx)[3][3])
+{
+    constexpr unsigned int W = block_size;
+    double T_parent_this[3][3];
+    Matrix3x3::copy(harmonics_source->pfix->state.rot.T_parent_this, T_parent_this);
+    const double radius = harmonics_source->radius;
+    const double mu = harmonics_source->mu;
+    const unsigned int row_len = (((degree > 1) ? degree : 1) + 3) * W;
+
+    // Per-lane geometry (page 33 of Gottlieb 1993)
+    double posn[W][3];
+    double r_mag[W];
+    double r_mag_inv[W];
+    double X_div_r[W];
+    double Y_div_r[W];
+    double Epilson[W];
+    double rad_div_r[W];
+    double rad_div_r_nth[W];
+    double cos_phi[W];
+    double cos_phi_nth[W];
+    double cos_lambda[W];
+    double sin_lambda[W];
+    double cos_mlambda[W];
+    double sin_mlambda[W];
+
+    for(unsigned int ll = 0; ll < W; ++ll)
+    {
+        unsigned int idx = first + ((ll < count) ? ll : (count - 1));
+        posn[ll][0] = pos_x[idx];
+        posn[ll][1] = pos_y[idx];
+        posn[ll][2] = pos_z[idx];
+
+        r_mag[ll] = Vector3::vmag(posn[ll]);
+
+        if((ll < count) && (r_mag[ll] < radius) && !min_radius_warn)
+        {
+            min_radius_warn = true;
+            MessageHandler::warn(__FILE__,
+                                 __LINE__,
+                                 GravityMessages::domain_error,
+                                 "Radial distance %g is less than the equatorial radius %g of %s.",
+                                 r_mag[ll],
+                                 radius,
+                                 harmonics_source->name.c_str());
+        }
+
+        double posn_pf[3];
+        Vector3::transform(T_parent_this, posn[ll], posn_pf);
+
+        r_mag_inv[ll] = 1.0 / r_mag[ll];
+        X_div_r[ll] = posn_pf[0] * r_mag_inv[ll];
+        Y_div_r[ll] = posn_pf[1] * r_mag_inv[ll];
+        Epilson[ll] = posn_pf[2] * r_mag_inv[ll];
+        rad_div_r[ll] = radius * r_mag_inv[ll];
+        rad_div_r_nth[ll] = rad_div_r[ll];
+
+        double rho_sq = 0.0;
+        if((posn_pf[0] < -SQRT_DBL_MIN) || (posn_pf[0] > SQRT_DBL_MIN))
+        {
+            rho_sq += posn_pf[0] * posn_pf[0];
+        }
+        if((posn_pf[1] < -SQRT_DBL_MIN) || (posn_pf[1] > SQRT_DBL_MIN))
+        {
+            rho_sq += posn_pf[1] * posn_pf[1];
+        }
+
+        double rho = std::sqrt(rho_sq);
+        cos_phi[ll] = rho * r_mag_inv[ll];
+        cos_phi_nth[ll] = cos_phi[ll];
+        if(rho_sq > 0.0)
+        {
+            cos_lambda[ll] = posn_pf[0] / rho;
+            sin_lambda[ll] = posn_pf[1] / rho;
+        }
+        else
+        {
+            cos_lambda[ll] = 1.0;
+            sin_lambda[ll] = 0.0;
+        }
+        cos_mlambda[ll] = cos_lambda[ll];
+        sin_mlambda[ll] = sin_lambda[ll];
+    }
+
+    // Seed the recursions: C_tilde, S_tilde (bottom p 33) and P(0,*), P(1,*).
+    for(unsigned int ll = 0; ll < W; ++ll)
+    {
+        C_tilde[ll] = 1.0;
+        C_tilde[W + ll] = X_div_r[ll];
+        S_tilde[ll] = 0.0;
+        S_tilde[W + ll] = Y_div_r[ll];
+    }
+
+    double * P_row0 = P_rows;
+    double * P_row1 = P_rows + row_len;
+    for(unsigned int ll = 0; ll < W; ++ll)
+    {
+        P_row0[ll] = 1.0;
+        P_row0[W + ll] = 0.0;
+        P_row0[2 * W + ll] = 0.0;
+        P_row1[ll] = std::sqrt(3.0) * Epilson[ll];
+        P_row1[W + ll] = std::sqrt(3.0);
+        P_row1[2 * W + ll] = 0.0;
+        P_row1[3 * W + ll] = 0.0;
+    }
+
+    // Per-lane sums, perturbing gravity only.
+    double Sumv[W] = {};
+    double Sumgam[W] = {};
+    double Sumgam_grad[W] = {};
+    double Suml[W] = {};
+    double Sumh[W] = {};
+    double Sumh_grad[W] = {};
+    double Sumj[W] = {};
+    double Sumk[W] = {};
+    double Summ[W] = {};
+    double Sumn[W] = {};
+    double Sumo[W] = {};
+    double Sump[W] = {};
+    double Sumq[W] = {};
+    double Sumr[W] = {};
+    double Sums[W] = {};
+    double Sumt[W] = {};
+
+    double Sumv_N[W];
+    double Sumh_N[W];
+    double Sumgam_N[W];
+    double Sumj_N[W];
+    double Sumk_N[W];
+    double Suml_N[W] = {};
+    double Summ_N[W] = {};
+    double Sumn_N[W] = {};
+    double Sumo_N[W] = {};
+    double Sump_N[W] = {};
+    double Sumq_N[W] = {};
+    double Sumr_N[W] = {};
+    double Sums_N[W] = {};
+    double Sumt_N[W] = {};
+    double Sumh_grad_N[W] = {};
+    double Sumgam_grad_N[W] = {};
+
+    const double * int_to_double = coeffs.int_to_double;
+    const bool grad_order_nonzero = (gradient_order > 0);
+
+    for(unsigned int ii = 2; ii <= degree; ++ii)
+    {
+        const bool ii_grad_deg_nonzero = (ii <= gradient_degree) && (gradient_degree > 0);
+        const bool ii_grad_full = ii_grad_deg_nonzero && grad_order_nonzero;
+
+        const SphericalHarmonicsPackedCoeffs::Term * row_ii = coeffs.row(ii);
+        double * P_ii = P_rows + (ii % 3) * row_len;
+        const double * P_iim1 = P_rows + ((ii - 1) % 3) * row_len;
+        const double * P_iim2 = P_rows + ((ii - 2) % 3) * row_len;
+
+        const double alpha_ii = coeffs.alpha[ii];
+        const double beta_ii = coeffs.beta[ii];
+        const double nrdiag_ii = coeffs.nrdiag[ii];
+        const double Pnn_ii = coeffs.Pnn[ii];
+        const double C_ii0 = row_ii[0].C;
+        const double zeta_ii0 = row_ii[0].zeta;
+        const double upsilon_ii0 = row_ii[0].upsilon;
+        const double xi_ii1 = row_ii[1].xi;
+        const double eta_ii1 = row_ii[1].eta;
+        const double dbl_iip1 = int_to_double[ii + 1];
+
+        for(unsigned int ll = 0; ll < W; ++ll)
+        {
+            double rdrn = rad_div_r_nth[ll] * rad_div_r[ll];
+            rad_div_r_nth[ll] = (rdrn < 1.0E-299) ? 0.0 : rdrn;
+
+            // P(n,n), P(n,n+1), and P(n,n+2) terms, table 1 (p. 14)
+            P_ii[ii * W + ll] = Pnn_ii;
+            P_ii[(ii + 1) * W + ll] = 0.0;
+            P_ii[(ii + 2) * W + ll] = 0.0;
+
+            // P(n,0) term, equation (7-14)
+            P_ii[ll] = alpha_ii * Epilson[ll] * P_iim1[ll] - beta_ii * P_iim2[ll];
+
+            // P(n,n-1) term, equation (7-16)
+            P_ii[(ii - 1) * W + ll] = Epilson[ll] * nrdiag_ii;
+
+            // P(n,1) term, equation (7-12)
+            P_ii[W + ll] = xi_ii1 * Epilson[ll] * P_iim1[W + ll] - eta_ii1 * P_iim2[W + ll];
+
+            Sumv_N[ll] = P_ii[ll] * C_ii0;
+            Sumh_N[ll] = P_ii[W + ll] * C_ii0 * zeta_ii0;
+            Sumgam_N[ll] = Sumv_N[ll] * dbl_iip1;
+        }
+
+        for(unsigned int jj = 2; jj <= (ii - 2); ++jj)
+        {
+            // Equation (7-12)
+            const double xi_iijj = row_ii[jj].xi;
+            const double eta_iijj = row_ii[jj].eta;
+            double * P_iijj = P_ii + jj * W;
+            const double * P_iim1jj = P_iim1 + jj * W;
+            const double * P_iim2jj = P_iim2 + jj * W;
+            for(unsigned int ll = 0; ll < W; ++ll)
+            {
+                P_iijj[ll] = xi_iijj * Epilson[ll] * P_iim1jj[ll] - eta_iijj * P_iim2jj[ll];
+            }
+        }
+
+        if(ii_grad_deg_nonzero)
+        {
+            for(unsigned int ll = 0; ll < W; ++ll)
+            {
+                Sumh_grad_N[ll] = P_ii[W + ll] * C_ii0 * zeta_ii0;
+                Sumgam_grad_N[ll] = Sumv_N[ll] * dbl_iip1;
+                Summ_N[ll] = P_ii[2 * W + ll] * C_ii0 * upsilon_ii0;
+                Sump_N[ll] = Sumh_grad_N[ll] * dbl_iip1;
+                Suml_N[ll] = Sumgam_grad_N[ll] * (dbl_iip1 + 1.0);
+            }
+        }
+
+        if(order > 0)
+        {
+            double * C_tilde_ii = C_tilde + ii * W;
+            double * S_tilde_ii = S_tilde + ii * W;
+
+            for(unsigned int ll = 0; ll < W; ++ll)
+            {
+                Sumj_N[ll] = 0.0;
+                Sumk_N[ll] = 0.0;
+
+                cos_phi_nth[ll] = (cos_phi_nth[ll] > SQRT_DBL_MIN) ? cos_phi_nth[ll] * cos_phi[ll] : 0.0;
+
+                double cml = cos_lambda[ll] * cos_mlambda[ll] - sin_lambda[ll] * sin_mlambda[ll];
+                double sml = sin_lambda[ll] * cos_mlambda[ll] + cos_lambda[ll] * sin_mlambda[ll];
+                cos_mlambda[ll] = cml;
+                sin_mlambda[ll] = sml;
+
+                // Equation (3-18), modified for underflow
+                C_tilde_ii[ll] = cos_phi_nth[ll] * cml;
+                S_tilde_ii[ll] = cos_phi_nth[ll] * sml;
+            }
+
+            if(ii_grad_full)
+            {
+                for(unsigned int ll = 0; ll < W; ++ll)
+                {
+                    Sumn_N[ll] = 0.0;
+                    Sumo_N[ll] = 0.0;
+                    Sumq_N[ll] = 0.0;
+                    Sumr_N[ll] = 0.0;
+                    Sums_N[ll] = 0.0;
+                    Sumt_N[ll] = 0.0;
+                }
+            }
+
+            for(unsigned int jj = 1; (jj <= order) && (jj <= ii); ++jj)
+            {
+                const bool jj_grad = ii_grad_full && (jj <= gradient_order);
+                const double dbl_jj = int_to_double[jj];
+                const double dbl_jjp1 = int_to_double[jj + 1];
+                const double dbl_jjm1 = int_to_double[jj - 1];
+                const double C_iijj = row_ii[jj].C;
+                const double S_iijj = row_ii[jj].S;
+                const double zeta_iijj = row_ii[jj].zeta;
+                const double upsilon_iijj = row_ii[jj].upsilon;
+
+                const double * P_iijj = P_ii + jj * W;
+                const double * P_iijjp1 = P_ii + (jj + 1) * W;
+                const double * P_iijjp2 = P_ii + (jj + 2) * W;
+                const double * C_tilde_jj = C_tilde + jj * W;
+                const double * S_tilde_jj = S_tilde + jj * W;
+                const double * C_tilde_jjm1 = C_tilde + (jj - 1) * W;
+                const double * S_tilde_jjm1 = S_tilde + (jj - 1) * W;
+
+                // The branches on jj and jj_grad are hoisted out of the lane
+                // loops so that each loop body is straight-line code.
+                double B_tilde[W];
+                double B_tilde_m1[W];
+                double A_tilde_m1[W];
+                for(unsigned int ll = 0; ll < W; ++ll)
+                {
+                    double jj_x_Piijj = dbl_jj * P_iijj[ll];
+                    B_tilde[ll] = C_iijj * C_tilde_jj[ll] + S_iijj * S_tilde_jj[ll];
+
+                    // equation (3-9)
+                    B_tilde_m1[ll] = C_iijj * C_tilde_jjm1[ll] + S_iijj * S_tilde_jjm1[ll];
+                    A_tilde_m1[ll] = C_iijj * S_tilde_jjm1[ll] - S_iijj * C_tilde_jjm1[ll];
+                    double Piijj_x_Btilde = P_iijj[ll] * B_tilde[ll];
+                    Sumv_N[ll] = Sumv_N[ll] + Piijj_x_Btilde;
+                    Sumj_N[ll] = Sumj_N[ll] + jj_x_Piijj * B_tilde_m1[ll];
+                    Sumk_N[ll] = Sumk_N[ll] - jj_x_Piijj * A_tilde_m1[ll];
+                    Sumgam_N[ll] = Sumgam_N[ll] + (dbl_jj + dbl_iip1) * Piijj_x_Btilde;
+                }
+
+                if(jj < ii)
+                {
+                    for(unsigned int ll = 0; ll < W; ++ll)
+                    {
+                        Sumh_N[ll] = Sumh_N[ll] + zeta_iijj * P_iijjp1[ll] * B_tilde[ll];
+                    }
+                }
+
+                if(jj_grad)
+                {
+                    if(jj < ii)
+                    {
+                        for(unsigned int ll = 0; ll < W; ++ll)
+                        {
+                            double zetaiijj_x_Piijjp1 = zeta_iijj * P_iijjp1[ll];
+                            Sumh_grad_N[ll] = Sumh_grad_N[ll] + zetaiijj_x_Piijjp1 * B_tilde[ll];
+                            Sump_N[ll] = Sump_N[ll] + (dbl_jj + dbl_iip1) * zetaiijj_x_Piijjp1 * B_tilde[ll];
+                            Sumq_N[ll] = Sumq_N[ll] + dbl_jj * zetaiijj_x_Piijjp1 * B_tilde_m1[ll];
+                            Sumr_N[ll] = Sumr_N[ll] - dbl_jj * zetaiijj_x_Piijjp1 * A_tilde_m1[ll];
+                        }
+                    }
+
+                    for(unsigned int ll = 0; ll < W; ++ll)
+                    {
+                        double jj_x_Piijj = dbl_jj * P_iijj[ll];
+                        double Piijj_x_Btilde = P_iijj[ll] * B_tilde[ll];
+                        Sumgam_grad_N[ll] = Sumgam_grad_N[ll] + (dbl_jj + dbl_iip1) * Piijj_x_Btilde;
+                        Suml_N[ll] = Suml_N[ll] + (dbl_jj + dbl_iip1) * (dbl_jjp1 + dbl_iip1) * Piijj_x_Btilde;
+                        Summ_N[ll] = Summ_N[ll] + P_iijjp2[ll] * B_tilde[ll] * upsilon_iijj;
+                        Sums_N[ll] = Sums_N[ll] + (dbl_jj + dbl_iip1) * jj_x_Piijj * B_tilde_m1[ll];
+                        Sumt_N[ll] = Sumt_N[ll] - (dbl_jj + dbl_iip1) * jj_x_Piijj * A_tilde_m1[ll];
+                    }
+                }
+
+                if(jj_grad && (jj >= 2))
+                {
+                    const double * C_tilde_jjm2 = C_tilde + (jj - 2) * W;
+                    const double * S_tilde_jjm2 = S_tilde + (jj - 2) * W;
+                    for(unsigned int ll = 0; ll < W; ++ll)
+                    {
+                        double jj_x_Piijj = dbl_jj * P_iijj[ll];
+                        Sumn_N[ll] = Sumn_N[ll] +
+                                     dbl_jjm1 * jj_x_Piijj * (C_iijj * C_tilde_jjm2[ll] + S_iijj * S_tilde_jjm2[ll]);
+                        Sumo_N[ll] = Sumo_N[ll] +
+                                     dbl_jjm1 * jj_x_Piijj * (C_iijj * S_tilde_jjm2[ll] - S_iijj * C_tilde_jjm2[ll]);
+                    }
+                }
+            } // next m
+
+            for(unsigned int ll = 0; ll < W; ++ll)
+            {
+                Sumj[ll] += rad_div_r_nth[ll] * Sumj_N[ll];
+                Sumk[ll] += rad_div_r_nth[ll] * Sumk_N[ll];
+            }
+
+            if(ii_grad_full)
+            {
+                for(unsigned int ll = 0; ll < W; ++ll)
+                {
+                    Sumn[ll] += rad_div_r_nth[ll] * Sumn_N[ll];
+                    Sumo[ll] += rad_div_r_nth[ll] * Sumo_N[ll];
+                    Sumq[ll] += rad_div_r_nth[ll] * Sumq_N[ll];
+                    Sumr[ll] += rad_div_r_nth[ll] * Sumr_N[ll];
+                    Sums[ll] += rad_div_r_nth[ll] * Sums_N[ll];
+                    Sumt[ll] += rad_div_r_nth[ll] * Sumt_N[ll];
+                }
+            }
+        } // end if order>0
+
+        for(unsigned int ll = 0; ll < W; ++ll)
+        {
+            Sumv[ll] += rad_div_r_nth[ll] * Sumv_N[ll];
+            Sumh[ll] += rad_div_r_nth[ll] * Sumh_N[ll];
+            Sumgam[ll] += rad_div_r_nth[ll] * Sumgam_N[ll];
+        }
+
+        if(ii_grad_deg_nonzero)
+        {
+            for(unsigned int ll = 0; ll < W; ++ll)
+            {
+                Sumh_grad[ll] += rad_div_r_nth[ll] * Sumh_grad_N[ll];
+                Sumgam_grad[ll] += rad_div_r_nth[ll] * Sumgam_grad_N[ll];
+                Suml[ll] += rad_div_r_nth[ll] * Suml_N[ll];
+                Summ[ll] += rad_div_r_nth[ll] * Summ_N[ll];
+                Sump[ll] += rad_div_r_nth[ll] * Sump_N[ll];
+            }
+        }
+    } // next n
+
+    // Assemble the outputs of the valid lanes.
+    const bool compute_gradient = gradient && (gradient_degree > 0);
+    for(unsigned int ll = 0; ll < count; ++ll)
+    {
+        unsigned int idx = first + ll;
+        double mu_div_r = mu * r_mag_inv[ll];
+        double mu_div_rsq = mu_div_r * r_mag_inv[ll];
+        double Z_div_r = Epilson[ll];
+        double Lambda = Sumgam[ll] + Epilson[ll] * Sumh[ll];
+        double pot_ll = mu_div_r * Sumv[ll];
+
+        // Equation (4-13)
+        double accel[3];
+        accel[0] = -mu_div_rsq * (Lambda * X_div_r[ll] - Sumj[ll]);
+        accel[1] = -mu_div_rsq * (Lambda * Y_div_r[ll] - Sumk[ll]);
+        accel[2] = -mu_div_rsq * (Lambda * Z_div_r - Sumh[ll]);
+        Vector3::transform_transpose(T_parent_this, accel);
+
+        double grad[3][3];
+        if(compute_gradient)
+        {
+            double dgdx_pf[3][3];
+
+            Lambda = Sumgam_grad[ll] + Epilson[ll] * Sumh_grad[ll];
+            double Gg = -(Summ[ll] * Epilson[ll] + Sump[ll] + Sumh_grad[ll]);
+            double Ff = Suml[ll] + Lambda + Epilson[ll] * (Sump[ll] + Sumh_grad[ll] - Gg);
+            double D1 = Epilson[ll] * Sumq[ll] + Sums[ll];
+            double D2 = Epilson[ll] * Sumr[ll] + Sumt[ll];
+
+            double mu_div_r3 = mu_div_rsq * r_mag_inv[ll];
+            dgdx_pf[0][0] = mu_div_r3 * ((Ff * X_div_r[ll] - 2.0 * D1) * X_div_r[ll] - Lambda + Sumn[ll]);
+            dgdx_pf[1][1] = mu_div_r3 * ((Ff * Y_div_r[ll] - 2.0 * D2) * Y_div_r[ll] - Lambda - Sumn[ll]);
+            dgdx_pf[2][2] = mu_div_r3 * ((Ff * Z_div_r + 2.0 * Gg) * Z_div_r - Lambda + Summ[ll]);
+            dgdx_pf[0][1] = mu_div_r3 * ((Ff * Y_div_r[ll] - D2) * X_div_r[ll] - D1 * Y_div_r[ll] - Sumo[ll]);
+            dgdx_pf[1][0] = dgdx_pf[0][1];
+            dgdx_pf[0][2] = mu_div_r3 * ((Ff * X_div_r[ll] - D1) * Z_div_r + Gg * X_div_r[ll] + Sumq[ll]);
+            dgdx_pf[2][0] = dgdx_pf[0][2];
+            dgdx_pf[1][2] = mu_div_r3 * ((Ff * Y_div_r[ll] - D2) * Z_div_r + Gg * Y_div_r[ll] + Sumr[ll]);
+            dgdx_pf[2][1] = dgdx_pf[1][2];
+
+            Matrix3x3::transpose_transform_matrix(T_parent_this, dgdx_pf, grad);
+        }
+        else
+        {
+            Matrix3x3::initialize(grad);
+        }
+
+        // Add the spherical contribution (see GravityControls::calc_spherical).
+        if(!perturbing_only)
+        {
+            double r_sq = r_mag[ll] * r_mag[ll];
+            double r_3rd = r_sq * r_mag[ll];
+            double acc_local[3];
+            Vector3::scale(posn[ll], -mu / r_3rd, acc_local);
+            Vector3::incr(acc_local, accel);
+            pot_ll += mu / r_mag[ll];
+
+            if(gradient)
+            {
+                const double * pp = posn[ll];
+                double mu_div_r5th = mu / (r_3rd * r_sq);
+                grad[0][0] += mu_div_r5th * (3.0 * pp[0] * pp[0] - r_sq);
+                grad[0][1] += mu_div_r5th * 3.0 * pp[0] * pp[1];
+                grad[0][2] += mu_div_r5th * 3.0 * pp[0] * pp[2];
+                grad[1][1] += mu_div_r5th * (3.0 * pp[1] * pp[1] - r_sq);
+                grad[1][2] += mu_div_r5th * 3.0 * pp[1] * pp[2];
+                grad[2][2] += mu_div_r5th * (3.0 * pp[2] * pp[2] - r_sq);
+                grad[1][0] = grad[0][1];
+                grad[2][0] = grad[0][2];
+                grad[2][1] = grad[1][2];
+            }
+        }
+
+        accel_x[idx] = accel[0];
+        accel_y[idx] = accel[1];
+        accel_z[idx] = accel[2];
+        if(pot != nullptr)
+        {
+            pot[idx] = pot_ll;
+        }
+        if(dgdx != nullptr)
+        {
+            Matrix3x3::copy(grad, dgdx[idx]);
+        }
+    }
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -32,6 +32,7 @@ Library dependencies:
 // System includes
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 
 // JEOD includes
 #include "utils/memory/include/jeod_alloc.hh"
@@ -71,10 +72,7 @@ SphericalHarmonicsGravityControls::~SphericalHarmonicsGravityControls()
     var_effects.clear();
     JEOD_DEREGISTER_CHECKPOINTABLE(this, var_effects);
 
-    // Array Pnm was allocated to degree/order specified in harmonics body,
-    // which is the size of the entire spherical harmonics model, not to the
-    // to-be-used degree/order specified in this control.
-    JEOD_DELETE_2D(Pnm, harmonics_source->degree + 1, true);
+    release_workspace();
     JEOD_DELETE_2D(delta_Cnm, delta_degree + 1, true);
     JEOD_DELETE_2D(delta_Snm, delta_degree + 1, true);
 }
@@ -96,48 +94,78 @@ void SphericalHarmonicsGravityControls::initialize_control(GravityManager & grav
 
     // If degree > 0 in the gravity body then create and fill Gottlieb
     // LeGendre polynomial array.  Otherwise only spherical gravity available.
-    unsigned int alloc_degree = harmonics_source->degree;
-
-    if(alloc_degree > 0)
+    release_workspace();
+    if(harmonics_source->degree > 0)
     {
-        Pnm = JEOD_ALLOC_PRIM_ARRAY(alloc_degree + 1, double *);
-        double * int_to_double = JEOD_ALLOC_PRIM_ARRAY(alloc_degree + 2, double);
-
-        for(unsigned int ii = 0; ii <= alloc_degree; ++ii)
-        {
-            int_to_double[ii] = static_cast<double>(ii);
-            Pnm[ii] = JEOD_ALLOC_PRIM_ARRAY(ii + 3, double);
-        }
-
-        int_to_double[alloc_degree + 1] = static_cast<double>(alloc_degree + 1);
+        allocate_workspace(harmonics_source->degree);
+    }
+}
 
-        // In the code below, the equation numbers and page numbers refer to
-        // the Gottlieb 1993 paper.
+/**
+ * Allocate the Gottlieb recursion workspace as a single block and fill in the
+ * Legendre polynomials that do not depend on position.
+ * The polynomials are sized to the degree/order of the entire spherical
+ * harmonics model, not to the to-be-used degree/order of this control, so
+ * that the latter can be changed at run time.
+ * \param[in] max_degree Degree of the source
+ */
+void SphericalHarmonicsGravityControls::allocate_workspace(unsigned int max_degree)
+{
+    // Each array starts on a 64 byte boundary, eight doubles apart.
+    const unsigned int align = 8;
+    unsigned int pnm_size = (max_degree + 1) * (max_degree + 6) / 2;
+    unsigned int pnm_stride = (pnm_size + align - 1) / align * align;
+    unsigned int order_stride = (max_degree + 1 + align - 1) / align * align;
+
+    gottlieb_workspace = JEOD_ALLOC_PRIM_ARRAY(pnm_stride + 4 * order_stride + align, double);
+    auto address = reinterpret_cast<std::uintptr_t>(gottlieb_workspace);
+    unsigned int offset = ((64 - address % 64) % 64) / sizeof(double);
+
+    Pnm = gottlieb_workspace + offset;
+    cos_mlambda = Pnm + pnm_stride;
+    sin_mlambda = cos_mlambda + order_stride;
+    C_tilde = sin_mlambda + order_stride;
+    S_tilde = C_tilde + order_stride;
+
+    for(unsigned int ii = 0; ii < pnm_size; ++ii)
+    {
+        Pnm[ii] = 0.0;
+    }
 
-        // Bottom of page 47 and page 48, and see equation (7-8)
-        Pnm[0][0] = 1.0;
-        Pnm[0][1] = 0.0;
-        Pnm[0][2] = 0.0;
-        Pnm[1][1] = sqrt(3.0);
-        Pnm[1][2] = 0.0;
-        Pnm[1][3] = 0.0;
+    // In the code below, the equation numbers and page numbers refer to
+    // the Gottlieb 1993 paper.
 
-        // Pages 46-47
-        for(unsigned int ii = 2; ii <= alloc_degree; ++ii)
-        {
-            // P(n,n) term, equation (7-8)
-            Pnm[ii][ii] = sqrt((2.0 * int_to_double[ii] + 1.0) / (2.0 * int_to_double[ii])) * Pnm[ii - 1][ii - 1];
+    // Bottom of page 47 and page 48, and see equation (7-8).
+    // P(n,n+1) and P(n,n+2) terms are zero, table 1 (p. 14).
+    legendre_row(0)[0] = 1.0;
+    if(max_degree >= 1)
+    {
+        legendre_row(1)[1] = sqrt(3.0);
+    }
 
-            // P(n,n+1) and P(n,n+2) terms, table 1 (p. 14)
-            Pnm[ii][ii + 1] = 0.0;
-            Pnm[ii][ii + 2] = 0.0;
-        }
+    // Pages 46-47
+    for(unsigned int ii = 2; ii <= max_degree; ++ii)
+    {
+        double dbl_ii = static_cast<double>(ii);
 
-        // Clean up local variable int_to_double (needed to init Pnm above)
-        JEOD_DELETE_ARRAY(int_to_double);
+        // P(n,n) term, equation (7-8)
+        legendre_row(ii)[ii] = sqrt((2.0 * dbl_ii + 1.0) / (2.0 * dbl_ii)) * legendre_row(ii - 1)[ii - 1];
     }
 }
 
+/**
+ * Release the Gottlieb recursion workspace.
+ */
+void SphericalHarmonicsGravityControls::release_workspace()
+{
+    JEOD_DELETE_ARRAY(gottlieb_workspace);
+    Pnm = nullptr;
+    cos_mlambda = nullptr;
+    sin_mlambda = nullptr;
+    C_tilde = nullptr;
+    S_tilde = nullptr;
+}
+
 /**
  * Add a new GravityDeltaControls to the var_effects list.
  * \param[in] delta_control Control to be added
@@ -378,6 +406,35 @@ void SphericalHarmonicsGravityControls::check_validity()
             return;
         }
 
+        // ADAPTIVE DEGREE ERRORS
+        // These are recoverable.
+        if(adaptive_degree)
+        {
+            if(!(adaptive_tolerance > 0.0))
+            {
+                MessageHandler::error(__FILE__,
+                                      __LINE__,
+                                      GravityMessages::invalid_limit,
+                                      "Adaptive degree tolerance (%g) for %s must be positive.\n"
+                                      "Resetting to 1e-12.",
+                                      adaptive_tolerance,
+                                      harmonics_source->name.c_str());
+                adaptive_tolerance = 1.0e-12;
+            }
+
+            if(!(adaptive_hysteresis > 0.0) || (adaptive_hysteresis > 1.0))
+            {
+                MessageHandler::error(__FILE__,
+                                      __LINE__,
+                                      GravityMessages::invalid_limit,
+                                      "Adaptive degree hysteresis (%g) for %s must be in (0,1].\n"
+                                      "Resetting to 0.1.",
+                                      adaptive_hysteresis,
+                                      harmonics_source->name.c_str());
+                adaptive_hysteresis = 0.1;
+            }
+        }
+
         // GRADIENT ERRORS
         // These are all recoverable.
         if(gradient)
@@ -444,19 +501,102 @@ void SphericalHarmonicsGravityControls::check_validity()
 }
 
 /**
- * Command all of the gravitational variation effects to update
- * themselves.
+ * Choose the degree and order to be evaluated at a given distance.
+ * Without adaptive_degree these are the configured degree and order.
+ * In adaptive mode, the acceleration of degree n relative to the central
+ * acceleration is bounded by (2n+1) sqrt(n+1) (R/r)^n times the root sum
+ * square of the fully normalized degree n coefficients. (The sum over the
+ * orders of the squared normalized harmonics is 2n+1, and that of their
+ * squared surface gradients is n(n+1)(2n+1).) The error of evaluating to
+ * degree N is bounded by the sum of these bounds over the degrees above N.
+ * The evaluated degree is raised to the lowest degree whose tail sum is
+ * below adaptive_tolerance, and lowered only to the lowest degree whose tail
+ * sum is below adaptive_tolerance * adaptive_hysteresis.
+ * \param[in] r_mag Distance to the source\n Units: M
+ */
+void SphericalHarmonicsGravityControls::update_effective_degree(double r_mag)
+{
+    unsigned int new_degree = degree;
+
+    if(adaptive_degree)
+    {
+        const double * degree_rss = harmonics_source->packed_coeffs.degree_rss;
+        double lower_tolerance = adaptive_tolerance * adaptive_hysteresis;
+        double rad_div_r = harmonics_source->radius / r_mag;
+        double rad_div_r_nth = rad_div_r;
+        double total = 0.0;
+        unsigned int raise_degree = 2;
+        unsigned int lower_degree = 2;
+        auto degree_bound = [degree_rss](unsigned int nn, double rad_div_r_nn)
+        {
+            double dn = static_cast<double>(nn);
+            return (2.0 * dn + 1.0) * std::sqrt(dn + 1.0) * rad_div_r_nn * degree_rss[nn];
+        };
+
+        // Sum the bounds of all degrees, then remove them one degree at a
+        // time to obtain the error bound of each truncation.
+        for(unsigned int ii = 2; ii <= degree; ++ii)
+        {
+            rad_div_r_nth *= rad_div_r;
+            total += degree_bound(ii, rad_div_r_nth);
+        }
+
+        double tail = total;
+        rad_div_r_nth = rad_div_r;
+        for(unsigned int ii = 2; ii <= degree; ++ii)
+        {
+            // tail bounds the error of evaluating to degree ii - 1.
+            if(tail >= adaptive_tolerance)
+            {
+                raise_degree = ii;
+            }
+            if(tail >= lower_tolerance)
+            {
+                lower_degree = ii;
+            }
+            rad_div_r_nth *= rad_div_r;
+            tail -= degree_bound(ii, rad_div_r_nth);
+        }
+
+        new_degree = effective_degree;
+        if(raise_degree > effective_degree)
+        {
+            new_degree = raise_degree;
+        }
+        else if(lower_degree < effective_degree)
+        {
+            new_degree = lower_degree;
+        }
+        if(new_degree > degree)
+        {
+            new_degree = degree;
+        }
+        if((new_degree != effective_degree) && (effective_degree != 0))
+        {
+            ++num_degree_changes;
+        }
+    }
+
+    effective_degree = new_degree;
+    effective_order = (order < effective_degree) ? order : effective_degree;
+}
+
+/**
+ * Bring all of the active gravitational variation effects up to date.
+ * The effects are shared by all controls on the gravity source, which
+ * recomputes an effect only when its inputs have changed. The caller holds
+ * the source's delta-coeffs lock through this call and sum_deltacoeffs.
  */
 void SphericalHarmonicsGravityControls::update_deltacoeffs()
 {
-    // Iterate over the list of delta-controls, telling each to update itself
-    unsigned int n_deltacoeffs = harmonics_source->delta_coeffs.size();
+    // Iterate over the list of delta-controls, updating each active effect
+    unsigned int n_deltacoeffs = var_effects.size();
 
     for(unsigned int ii = 0; ii < n_deltacoeffs; ++ii)
     {
         if(var_effects[ii]->active)
         {
-            harmonics_source->delta_coeffs[ii]->update(*this);
+            harmonics_source->update_deltacoeff(*(var_effects[ii]->grav_effect), *this);
         }
     }
 }
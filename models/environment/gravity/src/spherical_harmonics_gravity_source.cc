@@ -18,6 +18,7 @@ Purpose:
 Library dependencies:
   ((spherical_harmonics_gravity_source.cc)
    (gravity_source.cc)
+   (spherical_harmonics_gravity_source_file.cc)
    (spherical_harmonics_delta_coeffs.cc)
    (gravity_manager.cc)
    (gravity_messages.cc)
@@ -59,6 +60,7 @@ SphericalHarmonicsGravitySource::SphericalHarmonicsGravitySource()
     JEOD_REGISTER_CLASS(SphericalHarmonicsGravitySource);
     JEOD_REGISTER_CLASS(SphericalHarmonicsDeltaCoeffs);
     JEOD_REGISTER_CHECKPOINTABLE(this, delta_coeffs);
+    pthread_mutex_init(&deltacoeff_mutex, nullptr);
 }
 
 /**
@@ -67,28 +69,88 @@ SphericalHarmonicsGravitySource::SphericalHarmonicsGravitySource()
 SphericalHarmonicsGravitySource::~SphericalHarmonicsGravitySource()
 {
     JEOD_DEREGISTER_CHECKPOINTABLE(this, delta_coeffs);
+    pthread_mutex_destroy(&deltacoeff_mutex);
+    release_gottlieb_arrays();
+    JEOD_DELETE_2D(Cnm, degree + 1, true);
+    JEOD_DELETE_2D(Snm, degree + 1, true);
+}
+
+/**
+ * Release the Gottlieb coefficient arrays.
+ */
+void SphericalHarmonicsGravitySource::release_gottlieb_arrays()
+{
     JEOD_DELETE_ARRAY(a_by_rad);
     JEOD_DELETE_ARRAY(alpha);
     JEOD_DELETE_ARRAY(beta);
     JEOD_DELETE_ARRAY(nrdiag);
     JEOD_DELETE_ARRAY(int_to_double);
-    JEOD_DELETE_2D(xi, degree + 1, true);
-    JEOD_DELETE_2D(eta, degree + 1, true);
-    JEOD_DELETE_2D(zeta, degree + 1, true);
-    JEOD_DELETE_2D(upsilon, degree + 1, true);
-    JEOD_DELETE_2D(Cnm, degree + 1, true);
-    JEOD_DELETE_2D(Snm, degree + 1, true);
+    JEOD_DELETE_2D(xi, gottlieb_degree + 1, true);
+    JEOD_DELETE_2D(eta, gottlieb_degree + 1, true);
+    JEOD_DELETE_2D(zeta, gottlieb_degree + 1, true);
+    JEOD_DELETE_2D(upsilon, gottlieb_degree + 1, true);
+    gottlieb_degree = 0;
 }
 
 /**
- * Initialize Gottlieb gravity coefficients.
+ * Initialize Gottlieb gravity coefficients and pack them, with the spherical
+ * harmonic coefficients, into the table read by the controls.
+ * The Gottlieb coefficients are not recomputed if they are already available
+ * for the current degree, e.g. after load_coefficient_file. The table is
+ * always rebuilt, as the coefficients may have been changed since.
  */
 void SphericalHarmonicsGravitySource::initialize_body()
 {
+    if((alpha == nullptr) || (gottlieb_degree != degree))
+    {
+        compute_gottlieb_coefficients();
+    }
+
+    packed_coeffs.clear();
+    if(degree > 0)
+    {
+        packed_coeffs.build(*this, degree, order);
+    }
+}
+
+/**
+ * Copy the spherical harmonic coefficients into the table read by the
+ * controls. The table is built by initialize_body, so a change made to Cnm
+ * or Snm afterwards, e.g. by an input file event, is not seen until this is
+ * called. The degree and order must not have changed; call initialize_body
+ * again if they have. This must not be called while the controls are being
+ * evaluated on other threads.
+ */
+void SphericalHarmonicsGravitySource::update_packed_coeffs()
+{
+    if((packed_coeffs.degree != degree) || (packed_coeffs.order != order))
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             GravityMessages::invalid_limit,
+                             "The degree or order of %s has changed since it was initialized; "
+                             "call initialize_body rather than update_packed_coeffs.",
+                             name.c_str());
+        return;
+    }
+    if(degree > 0)
+    {
+        packed_coeffs.update_coefficients(*this);
+    }
+}
+
+/**
+ * Compute the Gottlieb coefficients for the current degree.
+ */
+void SphericalHarmonicsGravitySource::compute_gottlieb_coefficients()
+{
+    release_gottlieb_arrays();
+
     // If degree > 0 then create and fill Gottlieb coefficient arrays.
     // Otherwise, only spherical gravity can be used.
     if(degree > 0)
     {
+        gottlieb_degree = degree;
         double num1;
         double den1;
         double num2;
@@ -262,6 +324,43 @@ void SphericalHarmonicsGravitySource::add_deltacoeff(SphericalHarmonicsDeltaCoef
     var_effect.initialize(var_init, dyn_manager);
 }
 
+/**
+ * Lock the gravitational variation effects. Controls evaluated on different
+ * threads share the effects, so a control holds the lock from the time it
+ * brings the effects up to date until it has read their delta-coefficients.
+ */
+void SphericalHarmonicsGravitySource::begin_deltacoeff_block()
+{
+    pthread_mutex_lock(&deltacoeff_mutex);
+}
+
+/**
+ * Unlock the gravitational variation effects.
+ */
+void SphericalHarmonicsGravitySource::end_deltacoeff_block()
+{
+    pthread_mutex_unlock(&deltacoeff_mutex);
+}
+
+/**
+ * Bring a gravitational variation effect up to date. The effect's
+ * delta-coefficients depend on the planet and time only, so the first
+ * control to need them at a new time stamp computes them and every other
+ * control on this source reuses them. The caller must hold the lock taken
+ * by begin_deltacoeff_block.
+ * \param[in,out] delta_coeff Effect to be updated
+ * \param[in] controls Gravity controls requesting the update
+ */
+void SphericalHarmonicsGravitySource::update_deltacoeff(SphericalHarmonicsDeltaCoeffs & delta_coeff,
+                                                        SphericalHarmonicsGravityControls & controls)
+{
+    if(delta_coeff.inputs_changed())
+    {
+        delta_coeff.update(controls);
+        ++deltacoeffs_version;
+    }
+}
+
 } // namespace jeod
 
 /**
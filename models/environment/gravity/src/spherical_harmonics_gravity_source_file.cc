@@ -0,0 +1,514 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/spherical_harmonics_gravity_source_file.cc
+ * Define the SphericalHarmonicsGravitySource methods that read and write
+ * gravity coefficient files.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+  (((Barthelmes, F. and Foerste, C.)
+    (The ICGEM-format)
+    (GFZ Potsdam, Department 1 "Geodesy and Remote Sensing") (2011)))
+
+Assumptions and limitations:
+  ((Binary coefficient files are read in the byte order of the machine that
+    wrote them; a file with the other byte order is rejected.)
+   (Only the static (gfc, gfct) terms of an ICGEM file are used.))
+
+Library dependencies:
+  ((spherical_harmonics_gravity_source_file.cc)
+   (spherical_harmonics_gravity_source.cc)
+   (gravity_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+*******************************************************************************/
+
+// System includes
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// JEOD includes
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/gravity_messages.hh"
+#include "../include/spherical_harmonics_gravity_source.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+namespace
+{
+
+/**
+ * Version of the binary coefficient file format written by
+ * SphericalHarmonicsGravitySource::write_coefficient_file.
+ */
+const std::uint32_t binary_coefficient_version = 1;
+
+/**
+ * Identifies a JEOD binary coefficient file.
+ */
+const char binary_coefficient_magic[8] = {'J', 'E', 'O', 'D', 'S', 'H', 'G', '\0'};
+
+/**
+ * Binary coefficient file header. The header is followed by the cosine
+ * coefficients and then by the sine coefficients, each ordered by degree
+ * and then by order, with order limited to min(degree, header order).
+ */
+struct BinaryCoefficientHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t degree;
+    std::uint32_t order;
+    std::uint32_t flags;
+    double mu;
+    double radius;
+};
+
+static_assert(sizeof(BinaryCoefficientHeader) == 40, "Unexpected padding in BinaryCoefficientHeader");
+
+/**
+ * Header flag bit indicating a tide-free C20 coefficient.
+ */
+const std::uint32_t binary_flag_tide_free = 0x1;
+
+/**
+ * Number of coefficients of each kind up to and including the given degree.
+ * \param[in] degree Degree
+ * \param[in] order Maximum order
+ * @return Number of (n,m) pairs with n <= degree and m <= min(n, order)
+ */
+std::size_t num_coefficients(unsigned int degree, unsigned int order)
+{
+    std::size_t count = 0;
+    for(unsigned int nn = 0; nn <= degree; ++nn)
+    {
+        count += std::min(nn, order) + 1;
+    }
+    return count;
+}
+
+/**
+ * Convert an ICGEM number, which may use a Fortran 'D' exponent.
+ * \param[in] text Text of the number
+ * \param[out] value Converted value
+ * @return True if the whole text is a number
+ */
+bool parse_icgem_number(std::string text, double & value)
+{
+    std::replace(text.begin(), text.end(), 'D', 'E');
+    std::replace(text.begin(), text.end(), 'd', 'e');
+    char * end = nullptr;
+    value = std::strtod(text.c_str(), &end);
+    return (!text.empty()) && (*end == '\0');
+}
+
+} // namespace
+
+/**
+ * Load the gravity coefficients from a file, replacing any coefficients
+ * already set (e.g. by default data), and compute the Gottlieb coefficients
+ * for the loaded degree. The file may be a JEOD binary coefficient file, as
+ * written by write_coefficient_file, or an ICGEM gravity field (.gfc) file.
+ * The gravitational parameter, radius, and tide system are taken from the
+ * file; the name and tide_free_delta are left as set by the user.
+ * \param[in] file_name Name of the coefficient file
+ * \param[in] max_degree Degree to which the model is truncated; 0 loads the
+ *                       full degree of the file
+ * \param[in] max_order Order to which the model is truncated; 0 loads up to
+ *                      the loaded degree
+ */
+void SphericalHarmonicsGravitySource::load_coefficient_file(const std::string & file_name,
+                                                            unsigned int max_degree,
+                                                            unsigned int max_order)
+{
+    if(!read_binary_coefficients(file_name, max_degree, max_order))
+    {
+        read_icgem_coefficients(file_name, max_degree, max_order);
+    }
+
+    initialize_body();
+}
+
+/**
+ * Replace the coefficient arrays with zero-filled arrays for the given
+ * degree and order. Each row n holds orders 0 to n, as in the default data.
+ * \param[in] new_degree Degree of the new arrays
+ * \param[in] new_order Order of the new arrays
+ */
+void SphericalHarmonicsGravitySource::allocate_coefficients(unsigned int new_degree, unsigned int new_order)
+{
+    JEOD_DELETE_2D(Cnm, degree + 1, true);
+    JEOD_DELETE_2D(Snm, degree + 1, true);
+
+    degree = new_degree;
+    order = new_order;
+    Cnm = JEOD_ALLOC_PRIM_ARRAY(degree + 1, double *);
+    Snm = JEOD_ALLOC_PRIM_ARRAY(degree + 1, double *);
+    for(unsigned int nn = 0; nn <= degree; ++nn)
+    {
+        Cnm[nn] = JEOD_ALLOC_PRIM_ARRAY(nn + 1, double);
+        Snm[nn] = JEOD_ALLOC_PRIM_ARRAY(nn + 1, double);
+    }
+}
+
+/**
+ * Read the coefficients from a JEOD binary coefficient file. The file is
+ * memory-mapped and only the coefficients up to the requested degree and
+ * order are copied.
+ * \param[in] file_name Name of the coefficient file
+ * \param[in] max_degree Requested degree (0 = file degree)
+ * \param[in] max_order Requested order (0 = loaded degree)
+ * @return False if the file is not a JEOD binary coefficient file
+ */
+bool SphericalHarmonicsGravitySource::read_binary_coefficients(const std::string & file_name,
+                                                               unsigned int max_degree,
+                                                               unsigned int max_order)
+{
+    int fd = ::open(file_name.c_str(), O_RDONLY); // flawfinder: ignore
+    if(fd < 0)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             GravityMessages::file_error,
+                             "Unable to open gravity coefficient file '%s'.",
+                             file_name.c_str());
+        return true;
+    }
+
+    struct stat file_stat;
+    if((fstat(fd, &file_stat) != 0) ||
+       (static_cast<std::size_t>(file_stat.st_size) < sizeof(BinaryCoefficientHeader)))
+    {
+        close(fd);
+        return false;
+    }
+
+    auto file_size = static_cast<std::size_t>(file_stat.st_size);
+    void * addr = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(addr == MAP_FAILED)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             GravityMessages::file_error,
+                             "Unable to map gravity coefficient file '%s'.",
+                             file_name.c_str());
+        return true;
+    }
+
+    BinaryCoefficientHeader header;
+    std::memcpy(&header, addr, sizeof(header));
+    if(std::memcmp(header.magic, binary_coefficient_magic, sizeof(header.magic)) != 0)
+    {
+        munmap(addr, file_size);
+        return false;
+    }
+
+    const char * error = nullptr;
+    if(header.version != binary_coefficient_version)
+    {
+        error = "has an unsupported version or byte order";
+    }
+    else if(file_size != sizeof(header) + 2 * num_coefficients(header.degree, header.order) * sizeof(double))
+    {
+        error = "is truncated or has extra data";
+    }
+    else if((max_degree > header.degree) || (max_order > header.order))
+    {
+        error = "does not extend to the requested degree and order";
+    }
+
+    if(error != nullptr)
+    {
+        munmap(addr, file_size);
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             GravityMessages::file_error,
+                             "Gravity coefficient file '%s' %s.",
+                             file_name.c_str(),
+                             error);
+        return true;
+    }
+
+    unsigned int new_degree = (max_degree > 0) ? max_degree : header.degree;
+    unsigned int new_order = std::min((max_order > 0) ? max_order : header.order, new_degree);
+    allocate_coefficients(new_degree, new_order);
+    mu = header.mu;
+    radius = header.radius;
+    tide_free = (header.flags & binary_flag_tide_free) != 0;
+
+    const auto * file_cnm = reinterpret_cast<const double *>(static_cast<const char *>(addr) + sizeof(header));
+    const double * file_snm = file_cnm + num_coefficients(header.degree, header.order);
+    std::size_t row_start = 0;
+    for(unsigned int nn = 0; nn <= degree; ++nn)
+    {
+        unsigned int row_order = std::min(nn, order);
+        std::memcpy(Cnm[nn], file_cnm + row_start, (row_order + 1) * sizeof(double));
+        std::memcpy(Snm[nn], file_snm + row_start, (row_order + 1) * sizeof(double));
+        row_start += std::min(nn, header.order) + 1;
+    }
+
+    munmap(addr, file_size);
+    return true;
+}
+
+/**
+ * Read the coefficients from an ICGEM gravity field (.gfc) file. The
+ * coefficients must be fully normalized. Time-variable terms (trnd, acos,
+ * asin) are ignored with a warning.
+ * \param[in] file_name Name of the coefficient file
+ * \param[in] max_degree Requested degree (0 = file degree)
+ * \param[in] max_order Requested order (0 = loaded degree)
+ */
+void SphericalHarmonicsGravitySource::read_icgem_coefficients(const std::string & file_name,
+                                                              unsigned int max_degree,
+                                                              unsigned int max_order)
+{
+    std::ifstream gfc_file(file_name.c_str());
+    if(!gfc_file)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             GravityMessages::file_error,
+                             "Unable to open gravity coefficient file '%s'.",
+                             file_name.c_str());
+        return;
+    }
+
+    // Read the header.
+    double file_mu = 0.0;
+    double file_radius = 0.0;
+    double file_degree = -1.0;
+    std::string norm = "fully_normalized";
+    std::string tide_system;
+    bool end_of_head = false;
+    std::string line;
+    unsigned int line_number = 0;
+
+    while(!end_of_head && std::getline(gfc_file, line))
+    {
+        ++line_number;
+        std::istringstream fields(line);
+        std::string keyword;
+        std::string value;
+        fields >> keyword >> value;
+
+        if(keyword == "end_of_head")
+        {
+            end_of_head = true;
+        }
+        else if((keyword == "earth_gravity_constant") || (keyword == "gravity_constant"))
+        {
+            parse_icgem_number(value, file_mu);
+        }
+        else if(keyword == "radius")
+        {
+            parse_icgem_number(value, file_radius);
+        }
+        else if(keyword == "max_degree")
+        {
+            parse_icgem_number(value, file_degree);
+        }
+        else if(keyword == "norm")
+        {
+            norm = value;
+        }
+        else if(keyword == "tide_system")
+        {
+            tide_system = value;
+        }
+    }
+
+    const char * error = nullptr;
+    if(!end_of_head)
+    {
+        error = "is not an ICGEM file (no end_of_head)";
+    }
+    else if((file_mu <= 0.0) || (file_radius <= 0.0) || (file_degree < 0.0))
+    {
+        error = "does not specify the gravity constant, radius, and maximum degree";
+    }
+    else if(norm != "fully_normalized")
+    {
+        error = "does not contain fully normalized coefficients";
+    }
+    else if(max_degree > static_cast<unsigned int>(file_degree))
+    {
+        error = "does not extend to the requested degree";
+    }
+
+    if(error != nullptr)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             GravityMessages::file_error,
+                             "Gravity coefficient file '%s' %s.",
+                             file_name.c_str(),
+                             error);
+        return;
+    }
+
+    unsigned int new_degree = (max_degree > 0) ? max_degree : static_cast<unsigned int>(file_degree);
+    unsigned int new_order = std::min((max_order > 0) ? max_order : new_degree, new_degree);
+    allocate_coefficients(new_degree, new_order);
+    mu = file_mu;
+    radius = file_radius;
+
+    if(tide_system == "tide_free")
+    {
+        tide_free = true;
+    }
+    else
+    {
+        tide_free = false;
+        if((tide_system != "zero_tide") && !tide_system.empty())
+        {
+            MessageHandler::warn(__FILE__,
+                                 __LINE__,
+                                 GravityMessages::file_error,
+                                 "Gravity coefficient file '%s' uses the '%s' tide system; "
+                                 "C20 is treated as zero-tide.",
+                                 file_name.c_str(),
+                                 tide_system.c_str());
+        }
+    }
+
+    // Read the coefficients.
+    unsigned int num_ignored = 0;
+    while(std::getline(gfc_file, line))
+    {
+        ++line_number;
+        std::istringstream fields(line);
+        std::string key;
+        if(!(fields >> key))
+        {
+            continue;
+        }
+
+        if((key == "trnd") || (key == "acos") || (key == "asin"))
+        {
+            ++num_ignored;
+            continue;
+        }
+
+        unsigned int nn = 0;
+        unsigned int mm = 0;
+        std::string c_text;
+        std::string s_text;
+        double c_value = 0.0;
+        double s_value = 0.0;
+        if(((key != "gfc") && (key != "gfct")) || !(fields >> nn >> mm >> c_text >> s_text) ||
+           !parse_icgem_number(c_text, c_value) || !parse_icgem_number(s_text, s_value) || (mm > nn))
+        {
+            MessageHandler::fail(__FILE__,
+                                 __LINE__,
+                                 GravityMessages::file_error,
+                                 "Gravity coefficient file '%s' has an invalid entry at line %u.",
+                                 file_name.c_str(),
+                                 line_number);
+            return;
+        }
+
+        if((nn <= degree) && (mm <= order))
+        {
+            Cnm[nn][mm] = c_value;
+            Snm[nn][mm] = s_value;
+        }
+    }
+
+    if(num_ignored > 0)
+    {
+        MessageHandler::warn(__FILE__,
+                             __LINE__,
+                             GravityMessages::file_error,
+                             "Ignored %u time-variable terms in gravity coefficient file '%s'.",
+                             num_ignored,
+                             file_name.c_str());
+    }
+}
+
+/**
+ * Write the coefficients to a JEOD binary coefficient file, which
+ * load_coefficient_file can read without parsing.
+ * \param[in] file_name Name of the coefficient file
+ */
+void SphericalHarmonicsGravitySource::write_coefficient_file(const std::string & file_name) const
+{
+    std::ofstream out_file(file_name.c_str(), std::ios::binary | std::ios::trunc);
+    if(!out_file)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             GravityMessages::file_error,
+                             "Unable to create gravity coefficient file '%s'.",
+                             file_name.c_str());
+        return;
+    }
+
+    BinaryCoefficientHeader header;
+    std::memcpy(header.magic, binary_coefficient_magic, sizeof(header.magic));
+    header.version = binary_coefficient_version;
+    header.degree = degree;
+    header.order = order;
+    header.flags = tide_free ? binary_flag_tide_free : 0;
+    header.mu = mu;
+    header.radius = radius;
+    out_file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    // Rows below degree 2 are not used by the model and may not be allocated.
+    for(double ** coeffs : {Cnm, Snm})
+    {
+        for(unsigned int nn = 0; nn <= degree; ++nn)
+        {
+            for(unsigned int mm = 0; mm <= std::min(nn, order); ++mm)
+            {
+                double value = ((coeffs != nullptr) && (coeffs[nn] != nullptr)) ? coeffs[nn][mm] : 0.0;
+                out_file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+            }
+        }
+    }
+
+    if(!out_file)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             GravityMessages::file_error,
+                             "Error writing gravity coefficient file '%s'.",
+                             file_name.c_str());
+    }
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,177 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Gravity
+ * @{
+ *
+ * @file models/environment/gravity/src/spherical_harmonics_packed_coeffs.cc
+ * Define member functions for the SphericalHarmonicsPackedCoeffs class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((spherical_harmonics_packed_coeffs.cc)
+   (spherical_harmonics_gravity_source.cc)
+   (utils/memory/src/memory_manager.cc))
+
+
+*******************************************************************************/
+
+// System includes
+#include <cmath>
+
+// JEOD includes
+#include "utils/memory/include/jeod_alloc.hh"
+
+// Model includes
+#include "../include/spherical_harmonics_gravity_source.hh"
+#include "../include/spherical_harmonics_packed_coeffs.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+/**
+ * SphericalHarmonicsPackedCoeffs destructor.
+ */
+SphericalHarmonicsPackedCoeffs::~SphericalHarmonicsPackedCoeffs()
+{
+    clear();
+}
+
+/**
+ * Release the packed arrays.
+ */
+void SphericalHarmonicsPackedCoeffs::clear()
+{
+    JEOD_DELETE_ARRAY(terms);
+    JEOD_DELETE_ARRAY(alpha);
+    JEOD_DELETE_ARRAY(beta);
+    JEOD_DELETE_ARRAY(nrdiag);
+    JEOD_DELETE_ARRAY(Pnn);
+    JEOD_DELETE_ARRAY(int_to_double);
+    JEOD_DELETE_ARRAY(degree_rss);
+    degree = 0;
+    order = 0;
+}
+
+/**
+ * Copy the coefficients of an initialized source into the packed layout.
+ * Rows 0 and 1 are zero-filled; the Gottlieb recursion starts at degree 2.
+ * \param[in] source Initialized spherical harmonics gravity source
+ * \param[in] max_degree Highest degree to be packed
+ * \param[in] max_order Highest order to be packed
+ */
+void SphericalHarmonicsPackedCoeffs::build(const SphericalHarmonicsGravitySource & source,
+                                           unsigned int max_degree,
+                                           unsigned int max_order)
+{
+    clear();
+
+    degree = max_degree;
+    order = max_order;
+
+    unsigned int nterms = index(degree + 1, 0);
+    terms = JEOD_ALLOC_CLASS_ARRAY(nterms, Term);
+    alpha = JEOD_ALLOC_PRIM_ARRAY(degree + 1, double);
+    beta = JEOD_ALLOC_PRIM_ARRAY(degree + 1, double);
+    nrdiag = JEOD_ALLOC_PRIM_ARRAY(degree + 1, double);
+    Pnn = JEOD_ALLOC_PRIM_ARRAY(degree + 1, double);
+    int_to_double = JEOD_ALLOC_PRIM_ARRAY(degree + 3, double);
+    degree_rss = JEOD_ALLOC_PRIM_ARRAY(degree + 1, double);
+
+    for(unsigned int ii = 0; ii <= degree + 2; ++ii)
+    {
+        int_to_double[ii] = static_cast<double>(ii);
+    }
+
+    for(unsigned int kk = 0; kk < nterms; ++kk)
+    {
+        Term & term = terms[kk];
+        term.C = 0.0;
+        term.S = 0.0;
+        term.xi = 0.0;
+        term.eta = 0.0;
+        term.zeta = 0.0;
+        term.upsilon = 0.0;
+    }
+
+    // Sectoral terms, equation (7-8) of Gottlieb 1993.
+    Pnn[0] = 1.0;
+    degree_rss[0] = 0.0;
+    if(degree >= 1)
+    {
+        Pnn[1] = std::sqrt(3.0);
+        degree_rss[1] = 0.0;
+    }
+    for(unsigned int ii = 2; ii <= degree; ++ii)
+    {
+        Pnn[ii] = std::sqrt((2.0 * int_to_double[ii] + 1.0) / (2.0 * int_to_double[ii])) * Pnn[ii - 1];
+    }
+
+    for(unsigned int ii = 2; ii <= degree; ++ii)
+    {
+        Term * row_ii = terms + index(ii, 0);
+
+        alpha[ii] = source.alpha[ii];
+        beta[ii] = source.beta[ii];
+        nrdiag[ii] = source.nrdiag[ii];
+
+        for(unsigned int jj = 0; jj <= ii; ++jj)
+        {
+            Term & term = row_ii[jj];
+
+            if(jj < ii)
+            {
+                term.xi = source.xi[ii][jj];
+                term.eta = source.eta[ii][jj];
+            }
+            term.zeta = source.zeta[ii][jj];
+            term.upsilon = source.upsilon[ii][jj];
+        }
+    }
+
+    update_coefficients(source);
+}
+
+/**
+ * Copy the spherical harmonic coefficients of the source into the table
+ * built from it, and recompute the per-degree root sum squares. The
+ * Gottlieb coefficients, which depend only on the degree and order, are
+ * left as they are.
+ * \param[in] source Spherical harmonics gravity source the table was built from
+ */
+void SphericalHarmonicsPackedCoeffs::update_coefficients(const SphericalHarmonicsGravitySource & source)
+{
+    unsigned int source_order = (source.order < order) ? source.order : order;
+
+    for(unsigned int ii = 2; ii <= degree; ++ii)
+    {
+        Term * row_ii = terms + index(ii, 0);
+        double sum_sq = 0.0;
+        unsigned int last = (ii < source_order) ? ii : source_order;
+
+        for(unsigned int jj = 0; jj <= last; ++jj)
+        {
+            Term & term = row_ii[jj];
+            term.C = source.Cnm[ii][jj];
+            term.S = source.Snm[ii][jj];
+            sum_sq += term.C * term.C + term.S * term.S;
+        }
+        degree_rss[ii] = std::sqrt(sum_sq);
+    }
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -27,6 +27,7 @@ Library dependencies:
    (spherical_harmonics_gravity_source.cc)
    (gravity_messages.cc)
    (environment/planet/src/planet.cc)
+   (environment/ephemerides/ephem_interface/src/ephem_ref_frame.cc)
    (utils/message/src/message_handler.cc)
    (utils/ref_frames/src/ref_frame.cc))
 
@@ -36,9 +37,11 @@ Library dependencies:
 
 // System includes
 #include <cstddef>
+#include <limits>
 
 // JEOD includes
 #include "dynamics/dyn_manager/include/base_dyn_manager.hh"
+#include "environment/ephemerides/ephem_interface/include/ephem_ref_frame.hh"
 #include "environment/planet/include/planet.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/message/include/message_handler.hh"
@@ -66,6 +69,7 @@ SphericalHarmonicsTidalEffects::~SphericalHarmonicsTidalEffects()
 {
     JEOD_DELETE_ARRAY(tidal_bodies);
     JEOD_DELETE_ARRAY(tidal_bodies_inertial);
+    JEOD_DELETE_ARRAY(input_times);
     JEOD_DELETE_2D(Knm, degree + 1, true);
 }
 
@@ -144,6 +148,13 @@ void SphericalHarmonicsTidalEffects::initialize(SphericalHarmonicsDeltaCoeffsIni
     // Cache the planet fixed frame associated with the primary body.
     pfix = grav_source->pfix;
 
+    // No update has been made yet; NaN time stamps never compare equal.
+    input_times = JEOD_ALLOC_PRIM_ARRAY(num_tidal_bodies + 2, double);
+    for(unsigned int ii = 0; ii < num_tidal_bodies + 2; ++ii)
+    {
+        input_times[ii] = std::numeric_limits<double>::quiet_NaN();
+    }
+
     // Perform base class initializations.
     SphericalHarmonicsDeltaCoeffs::initialize(gen_var_init, dyn_manager);
 
@@ -179,6 +190,40 @@ void SphericalHarmonicsTidalEffects::update(SphericalHarmonicsGravityControls &)
     // moon_earth_pos will now be the position of moon, in the earth fixed frame
 }
 
+/**
+ * Check whether any of the frames the tidal effect depends on has been
+ * updated since the last check, and record the frames' current time stamps.
+ * The ephemeris and orientation models stamp a frame whenever they update
+ * its state, so unchanged time stamps mean unchanged delta-coefficients.
+ * @return True if the delta-coefficients need to be updated
+ */
+bool SphericalHarmonicsTidalEffects::inputs_changed()
+{
+    if(input_times == nullptr)
+    {
+        return true;
+    }
+
+    bool changed = false;
+    auto note_time = [&changed](const RefFrame * frame, double & last_time)
+    {
+        double time = (frame != nullptr) ? frame->timestamp() : 0.0;
+        if(!(time == last_time))
+        {
+            last_time = time;
+            changed = true;
+        }
+    };
+
+    note_time(pfix, input_times[0]);
+    note_time(grav_source->inertial, input_times[1]);
+    for(unsigned int ii = 0; ii < num_tidal_bodies; ++ii)
+    {
+        note_time(tidal_bodies_inertial[ii], input_times[ii + 2]);
+    }
+    return changed;
+}
+
 } // namespace jeod
 
 /**
@@ -0,0 +1,292 @@
+// Evaluate Earth gravity with solid body tides for a fleet of vehicles and
+// check that the tidal delta-coefficients are computed once per time step
+// and shared by every vehicle's gravity controls. The same evaluations are
+// then repeated with sharing disabled, so that every vehicle recomputes the
+// tides itself, and the accelerations from the two runs must match exactly.
+
+// System includes
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// JEOD includes
+#include "dynamics/dyn_manager/include/base_dyn_manager.hh"
+#include "environment/ephemerides/ephem_manager/include/ephem_manager.hh"
+#include "environment/gravity/data/include/earth_GGM02C.hh"
+#include "environment/gravity/data/include/earth_solid_tides.hh"
+#include "environment/gravity/include/gravity_manager.hh"
+#include "environment/gravity/include/spherical_harmonics_delta_controls.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_controls.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+#include "environment/gravity/include/spherical_harmonics_solid_body_tides.hh"
+#include "environment/gravity/include/spherical_harmonics_solid_body_tides_init.hh"
+#include "environment/planet/include/planet.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/math/include/matrix3x3.hh"
+
+using namespace std;
+using namespace jeod;
+
+/**
+ * Dynamics manager that provides only the ephemerides services needed to
+ * initialize the tidal model.
+ */
+class TestDynManager : public BaseDynManager,
+                       public EphemeridesManager
+{
+public:
+    void set_gravity_manager(GravityManager &) override {}
+    void initialize_gravity_controls() override {}
+    void reset_gravity_controls() override {}
+    void add_mass_body(MassBody &) override {}
+    void add_mass_body(MassBody *) override {}
+    MassBody * find_mass_body(const std::string &) const override
+    {
+        return nullptr;
+    }
+    bool is_mass_body_registered(const MassBody *) const override
+    {
+        return false;
+    }
+    void add_dyn_body(DynBody &) override {}
+    DynBody * find_dyn_body(const std::string &) const override
+    {
+        return nullptr;
+    }
+    std::vector<DynBody *> get_dyn_bodies() const override
+    {
+        return std::vector<DynBody *>();
+    }
+    bool is_dyn_body_registered(const DynBody *) const override
+    {
+        return false;
+    }
+    void add_integ_group(DynamicsIntegrationGroup &) override {}
+    bool is_integ_group_registered(const DynamicsIntegrationGroup *) const override
+    {
+        return false;
+    }
+    void reset_integrators() override {}
+    void reset_integrators(DynamicsIntegrationGroup &) override {}
+    double timestamp() const override
+    {
+        return 0.0;
+    }
+};
+
+/**
+ * Solid body tides that can be told to ignore the input time stamps, which
+ * makes every gravity evaluation recompute the tidal coefficients as the
+ * controls did before the coefficients were shared.
+ */
+class TestSolidBodyTides : public SphericalHarmonicsSolidBodyTides
+{
+public:
+    bool inputs_changed() override
+    {
+        return shared ? SphericalHarmonicsSolidBodyTides::inputs_changed() : true;
+    }
+
+    bool shared{true};
+};
+
+/**
+ * Move the Sun and Moon and rotate the Earth to the given time, and stamp
+ * the frames with that time as the ephemeris and RNP models do.
+ */
+static void move_bodies(double time, Planet & earth, Planet & moon, Planet & sun)
+{
+    double moon_angle = 2.0 * M_PI * time / (27.32 * 86400.0);
+    double sun_angle = 2.0 * M_PI * time / (365.25 * 86400.0);
+    double earth_angle = 7.292115e-5 * time;
+
+    moon.inertial.state.trans.position[0] = 3.844e8 * cos(moon_angle);
+    moon.inertial.state.trans.position[1] = 3.844e8 * sin(moon_angle) * cos(0.09);
+    moon.inertial.state.trans.position[2] = 3.844e8 * sin(moon_angle) * sin(0.09);
+    sun.inertial.state.trans.position[0] = 1.496e11 * cos(sun_angle);
+    sun.inertial.state.trans.position[1] = 1.496e11 * sin(sun_angle) * cos(0.409);
+    sun.inertial.state.trans.position[2] = 1.496e11 * sin(sun_angle) * sin(0.409);
+
+    Matrix3x3::initialize(earth.pfix.state.rot.T_parent_this);
+    earth.pfix.state.rot.T_parent_this[0][0] = cos(earth_angle);
+    earth.pfix.state.rot.T_parent_this[0][1] = sin(earth_angle);
+    earth.pfix.state.rot.T_parent_this[1][0] = -sin(earth_angle);
+    earth.pfix.state.rot.T_parent_this[1][1] = cos(earth_angle);
+    earth.pfix.state.rot.T_parent_this[2][2] = 1.0;
+
+    earth.inertial.set_timestamp(time);
+    earth.pfix.set_timestamp(time);
+    moon.inertial.set_timestamp(time);
+    sun.inertial.set_timestamp(time);
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_vehicles;
+    int num_steps;
+    int num_stages;
+
+    cmdline_parser.add_int("NumVehicles", 100, &num_vehicles);
+    cmdline_parser.add_int("NumSteps", 200, &num_steps);
+    cmdline_parser.add_int("NumStages", 4, &num_stages);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_vehicles <= 0 || num_steps <= 0 || num_stages <= 0)
+    {
+        cerr << "NumVehicles, NumSteps, and NumStages must be positive." << endl;
+        return 1;
+    }
+
+    TestDynManager dyn_manager;
+    GravityManager grav_manager;
+    SphericalHarmonicsGravitySource_earth_GGM02C_default_data earth_gravity_init;
+    SphericalHarmonicsSolidBodyTidesInit_earth_solid_tides_default_data tides_data;
+    SphericalHarmonicsSolidBodyTidesInit tides_init;
+    TestSolidBodyTides tides;
+    SphericalHarmonicsGravitySource earth_grav;
+    SphericalHarmonicsGravitySource moon_grav;
+    SphericalHarmonicsGravitySource sun_grav;
+    Planet earth;
+    Planet moon;
+    Planet sun;
+
+    earth.set_name("Earth");
+    moon.set_name("Moon");
+    sun.set_name("Sun");
+    earth.register_planet(dyn_manager);
+    moon.register_planet(dyn_manager);
+    sun.register_planet(dyn_manager);
+    earth.inertial.add_child(moon.inertial);
+    earth.inertial.add_child(sun.inertial);
+
+    earth_gravity_init.initialize(&earth_grav);
+    earth_grav.initialize_body();
+    earth.grav_source = &earth_grav;
+    earth_grav.inertial = &earth.inertial;
+    earth_grav.pfix = &earth.pfix;
+    grav_manager.add_grav_source(earth_grav);
+    vector<EphemerisRefFrame *> frames(1, &earth.inertial);
+    earth_grav.initialize_state(frames, grav_manager);
+
+    // The tidal model needs only the Sun's and Moon's gravitational parameters.
+    moon_grav.mu = 4.9028e12;
+    sun_grav.mu = 1.32712440018e20;
+    moon.grav_source = &moon_grav;
+    sun.grav_source = &sun_grav;
+
+    tides_data.initialize(&tides_init);
+    earth_grav.add_deltacoeff(tides_init, dyn_manager, tides);
+
+    // One set of gravity controls, each with its own tidal control, per vehicle.
+    unsigned int nveh = static_cast<unsigned int>(num_vehicles);
+    vector<unique_ptr<SphericalHarmonicsGravityControls>> controls;
+    vector<unique_ptr<SphericalHarmonicsDeltaControls>> tide_controls;
+    vector<double> positions(3 * nveh);
+    for(unsigned int ii = 0; ii < nveh; ++ii)
+    {
+        controls.emplace_back(new SphericalHarmonicsGravityControls);
+        tide_controls.emplace_back(new SphericalHarmonicsDeltaControls);
+        SphericalHarmonicsGravityControls & control = *controls.back();
+        SphericalHarmonicsDeltaControls & tide_control = *tide_controls.back();
+
+        control.source_name = earth_grav.name;
+        control.active = true;
+        control.spherical = false;
+        control.degree = 8;
+        control.order = 8;
+        control.initialize_control(grav_manager);
+        tide_control.grav_effect = &tides;
+        tide_control.grav_source = &earth_grav;
+        tide_control.active = true;
+        control.add_deltacontrol(&tide_control);
+
+        double angle = 2.0 * M_PI * ii / nveh;
+        double r_mag = earth_grav.radius + 400.0e3 + 1.0e3 * ii;
+        positions[3 * ii] = r_mag * cos(angle) * cos(0.9);
+        positions[3 * ii + 1] = r_mag * sin(angle) * cos(0.9);
+        positions[3 * ii + 2] = r_mag * sin(0.9);
+    }
+
+    // Several derivative evaluations per time step, as an integrator makes.
+    // Returns the time per evaluation and stores every acceleration.
+    unsigned int num_times = static_cast<unsigned int>(num_steps * num_stages);
+    double num_evals = static_cast<double>(num_times) * nveh;
+    auto run = [&](vector<double> & accels)
+    {
+        accels.resize(3 * num_times * nveh);
+        double * accel = accels.data();
+        auto start = chrono::steady_clock::now();
+        for(int step = 0; step < num_steps; ++step)
+        {
+            for(int stage = 0; stage < num_stages; ++stage)
+            {
+                move_bodies(10.0 * step + (10.0 * stage) / num_stages, earth, moon, sun);
+                for(unsigned int ii = 0; ii < nveh; ++ii)
+                {
+                    double grad[3][3];
+                    double pot;
+                    controls[ii]->gravitation(&positions[3 * ii], 0, accel, grad, &pot);
+                    accel += 3;
+                }
+            }
+        }
+        auto stop = chrono::steady_clock::now();
+        return chrono::duration<double, nano>(stop - start).count() / num_evals;
+    };
+
+    vector<double> shared_accels;
+    vector<double> unshared_accels;
+    unsigned int start_version = earth_grav.deltacoeffs_version;
+    double shared_time = run(shared_accels);
+    unsigned int num_updates = earth_grav.deltacoeffs_version - start_version;
+
+    tides.shared = false;
+    start_version = earth_grav.deltacoeffs_version;
+    double unshared_time = run(unshared_accels);
+    unsigned int num_unshared_updates = earth_grav.deltacoeffs_version - start_version;
+
+    cout << nveh << " vehicles, " << num_times << " time stamps" << endl;
+    cout << "Shared tides:      " << fixed << setprecision(1) << shared_time << " ns per gravity evaluation, "
+         << num_updates << " tidal updates" << endl;
+    cout << "Per-vehicle tides: " << unshared_time << " ns per gravity evaluation, " << num_unshared_updates
+         << " tidal updates" << endl;
+
+    int status = 0;
+    if(num_updates != num_times)
+    {
+        cout << "Expected one tidal update per time stamp" << endl;
+        status = 1;
+    }
+
+    // The shared and per-vehicle tides are computed from the same inputs by
+    // the same code, so the accelerations must be bit-for-bit identical.
+    unsigned int num_mismatches = 0;
+    for(size_t jj = 0; jj < shared_accels.size(); ++jj)
+    {
+        if(!(shared_accels[jj] == unshared_accels[jj]))
+        {
+            if(num_mismatches == 0)
+            {
+                size_t eval = jj / 3;
+                cout << "Acceleration mismatch at time stamp " << eval / nveh << ", vehicle " << eval % nveh
+                     << ", component " << jj % 3 << ": shared " << scientific << setprecision(17)
+                     << shared_accels[jj] << ", per-vehicle " << unshared_accels[jj] << endl;
+            }
+            ++num_mismatches;
+        }
+    }
+    if(num_mismatches != 0)
+    {
+        cout << num_mismatches << " of " << shared_accels.size()
+             << " acceleration components differ between shared and per-vehicle tides" << endl;
+        status = 1;
+    }
+    return status;
+}
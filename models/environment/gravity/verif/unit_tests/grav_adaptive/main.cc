@@ -0,0 +1,193 @@
+// Fly a point from low Earth orbit out to lunar distance and back, evaluating
+// the GGM02C field with a fixed degree and with the adaptive degree. Report
+// the evaluated degree along the way, the error of the adaptive evaluation
+// relative to the central acceleration, and the time per evaluation. Then
+// dither the point about fixed distances to check that the degree does not
+// chatter.
+
+// System includes
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// JEOD includes
+#include "environment/gravity/data/include/earth_GGM02C.hh"
+#include "environment/gravity/include/gravity_manager.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_controls.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+#include "environment/planet/data/include/earth.hh"
+#include "environment/planet/include/planet.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/math/include/matrix3x3.hh"
+
+using namespace std;
+using namespace jeod;
+
+// A point at the given distance, its direction turning along the trajectory.
+static void make_position(double r_mag, double phase, double pos[3])
+{
+    double lat = 0.5 * sin(3.0 * phase);
+    pos[0] = r_mag * cos(lat) * cos(phase);
+    pos[1] = r_mag * cos(lat) * sin(phase);
+    pos[2] = r_mag * sin(lat);
+}
+
+int main(int argc, char * argv[])
+{
+    vector<EphemerisRefFrame *> frameVector;
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    Planet_earth_default_data earth_planet_init;
+    SphericalHarmonicsGravitySource_earth_GGM02C_default_data earth_gravity_init;
+    GravityManager gravModel;
+    SphericalHarmonicsGravitySource gravBody;
+    SphericalHarmonicsGravityControls fixedControls;
+    SphericalHarmonicsGravityControls adaptiveControls;
+    Planet planet;
+    int degree;
+    int num_steps;
+    int num_dither;
+    double tolerance;
+
+    cmdline_parser.add_int("Degree", 70, &degree);
+    cmdline_parser.add_int("NumSteps", 2000, &num_steps);
+    cmdline_parser.add_int("NumDither", 1000, &num_dither);
+    cmdline_parser.add_double("Tolerance", 1.0e-12, &tolerance);
+    cmdline_parser.parse(argc, argv);
+
+    if(degree < 2 || num_steps <= 0 || num_dither <= 0)
+    {
+        cerr << "Degree must be at least 2; NumSteps and NumDither must be positive." << endl;
+        return 1;
+    }
+
+    gravBody.tide_free = true;
+    earth_planet_init.initialize(&planet);
+    earth_gravity_init.initialize(&gravBody);
+    gravBody.initialize_body();
+
+    planet.grav_source = &gravBody;
+    gravBody.inertial = &planet.inertial;
+    gravBody.pfix = &planet.pfix;
+    planet.initialize();
+    gravModel.add_grav_source(gravBody);
+    frameVector.push_back(&planet.inertial);
+    gravBody.initialize_state(frameVector, gravModel);
+
+    SphericalHarmonicsGravityControls * controls[2] = {&fixedControls, &adaptiveControls};
+    for(SphericalHarmonicsGravityControls * control : controls)
+    {
+        control->active = true;
+        control->source_name = gravBody.name;
+        control->initialize_control(gravModel);
+        control->perturbing_only = true;
+        control->set_degree_order(degree, degree);
+    }
+    adaptiveControls.adaptive_degree = true;
+    adaptiveControls.adaptive_tolerance = tolerance;
+
+    // Give the planet-fixed frame an arbitrary orientation.
+    double angle = 0.7;
+    Matrix3x3::initialize(planet.pfix.state.rot.T_parent_this);
+    planet.pfix.state.rot.T_parent_this[0][0] = cos(angle);
+    planet.pfix.state.rot.T_parent_this[0][1] = sin(angle);
+    planet.pfix.state.rot.T_parent_this[1][0] = -sin(angle);
+    planet.pfix.state.rot.T_parent_this[1][1] = cos(angle);
+    planet.pfix.state.rot.T_parent_this[2][2] = 1.0;
+
+    // Out and back, the distance varying geometrically.
+    const double r_low = gravBody.radius + 400.0e3;
+    const double r_moon = 3.844e8;
+    auto nsteps = static_cast<unsigned int>(num_steps);
+    vector<double> radii(2 * nsteps + 1);
+    for(unsigned int ii = 0; ii <= nsteps; ++ii)
+    {
+        radii[ii] = r_low * pow(r_moon / r_low, static_cast<double>(ii) / nsteps);
+        radii[2 * nsteps - ii] = radii[ii];
+    }
+
+    double grad[3][3];
+    double pot;
+    double fixed_ns = 0.0;
+    double adaptive_ns = 0.0;
+    double max_error = 0.0;
+    double next_report = r_low;
+    int rv = 0;
+
+    cout << "Fixed degree " << degree << ", adaptive tolerance " << tolerance << endl;
+    cout << setw(16) << "distance (km)" << setw(10) << "degree" << setw(16) << "rel. error" << endl;
+
+    for(unsigned int ii = 0; ii < radii.size(); ++ii)
+    {
+        double pos[3];
+        double fixed_acc[3];
+        double adaptive_acc[3];
+        make_position(radii[ii], 0.01 * ii, pos);
+
+        auto start = chrono::steady_clock::now();
+        fixedControls.gravitation(pos, 0, fixed_acc, grad, &pot);
+        auto middle = chrono::steady_clock::now();
+        adaptiveControls.gravitation(pos, 0, adaptive_acc, grad, &pot);
+        auto stop = chrono::steady_clock::now();
+        fixed_ns += chrono::duration<double, nano>(middle - start).count();
+        adaptive_ns += chrono::duration<double, nano>(stop - middle).count();
+
+        double central = gravBody.mu / (radii[ii] * radii[ii]);
+        double diff[3] = {adaptive_acc[0] - fixed_acc[0],
+                          adaptive_acc[1] - fixed_acc[1],
+                          adaptive_acc[2] - fixed_acc[2]};
+        double error = sqrt(diff[0] * diff[0] + diff[1] * diff[1] + diff[2] * diff[2]) / central;
+        max_error = (error > max_error) ? error : max_error;
+
+        if((ii <= nsteps) && ((radii[ii] >= next_report) || (ii == nsteps)))
+        {
+            cout << setw(16) << fixed << setprecision(0) << radii[ii] / 1000.0 << setw(10)
+                 << adaptiveControls.effective_degree << setw(16) << scientific << setprecision(2) << error << endl;
+            cout.unsetf(ios::floatfield);
+            next_report *= 2.0;
+        }
+    }
+
+    unsigned int trajectory_changes = adaptiveControls.num_degree_changes;
+    cout << "Back at " << fixed << setprecision(0) << r_low / 1000.0 << " km: degree "
+         << adaptiveControls.effective_degree << endl;
+    cout << "Degree changes over the trajectory: " << trajectory_changes << endl;
+    cout << "Max error relative to central acceleration: " << scientific << setprecision(2) << max_error << endl;
+    cout << "Mean ns per evaluation, fixed: " << fixed << setprecision(1) << fixed_ns / radii.size()
+         << ", adaptive: " << adaptive_ns / radii.size() << endl;
+
+    // The tolerance bounds the summed contribution of the omitted degrees.
+    if(max_error > tolerance)
+    {
+        cout << "Failed: error exceeds the tolerance." << endl;
+        rv = 1;
+    }
+
+    // Dither by 1 m about a range of distances. The hysteresis band allows
+    // at most one change at each.
+    unsigned int max_dither_changes = 0;
+    for(double r_mag = r_low; r_mag < r_moon; r_mag *= 1.05)
+    {
+        unsigned int changes_before = adaptiveControls.num_degree_changes;
+        for(int jj = 0; jj < num_dither; ++jj)
+        {
+            double pos[3];
+            double acc[3];
+            make_position(r_mag + ((jj % 2 == 0) ? 1.0 : -1.0), 0.0, pos);
+            adaptiveControls.gravitation(pos, 0, acc, grad, &pot);
+        }
+        unsigned int changes = adaptiveControls.num_degree_changes - changes_before;
+        max_dither_changes = (changes > max_dither_changes) ? changes : max_dither_changes;
+    }
+    cout << "Most degree changes while dithering about one distance: " << max_dither_changes << endl;
+    if(max_dither_changes > 1)
+    {
+        cout << "Failed: the degree chatters." << endl;
+        rv = 1;
+    }
+
+    return rv;
+}
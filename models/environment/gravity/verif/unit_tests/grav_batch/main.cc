@@ -0,0 +1,201 @@
+// Compare SphericalHarmonicsGravityBatch against the per-body
+// SphericalHarmonicsGravityControls evaluation, for accuracy and for speed.
+
+// System includes
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// JEOD includes
+#include "environment/gravity/data/include/earth_GGM02C.hh"
+#include "environment/gravity/include/gravity_manager.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_batch.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_controls.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+#include "environment/planet/data/include/earth.hh"
+#include "environment/planet/include/planet.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/math/include/matrix3x3.hh"
+
+using namespace std;
+using namespace jeod;
+
+static constexpr unsigned int NUM_DEGREES = 4;
+static const unsigned int test_degrees[NUM_DEGREES] = {8, 36, 70, 150};
+
+/**
+ * Generate reproducible positions between 200 km altitude and GEO.
+ */
+static void make_positions(unsigned int num_points,
+                           double radius,
+                           vector<double> & pos_x,
+                           vector<double> & pos_y,
+                           vector<double> & pos_z)
+{
+    unsigned long seed = 12345;
+    auto uniform = [&seed]()
+    {
+        seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+        return static_cast<double>(seed) / 2147483648.0;
+    };
+
+    for(unsigned int ii = 0; ii < num_points; ++ii)
+    {
+        double r_mag = radius + 200.0e3 + uniform() * 35.6e6;
+        double z = 2.0 * uniform() - 1.0;
+        double lon = 2.0 * M_PI * uniform();
+        double rho = sqrt(1.0 - z * z);
+        pos_x[ii] = r_mag * rho * cos(lon);
+        pos_y[ii] = r_mag * rho * sin(lon);
+        pos_z[ii] = r_mag * z;
+    }
+}
+
+static double rel_diff(double a, double b)
+{
+    double scale = fabs(a) > fabs(b) ? fabs(a) : fabs(b);
+    return (scale > 0.0) ? fabs(a - b) / scale : 0.0;
+}
+
+int main(int argc, char * argv[])
+{
+    vector<EphemerisRefFrame *> frameVector;
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    Planet_earth_default_data earth_planet_init;
+    SphericalHarmonicsGravitySource_earth_GGM02C_default_data earth_gravity_init;
+    GravityManager gravModel;
+    SphericalHarmonicsGravitySource gravBody;
+    SphericalHarmonicsGravityControls gravControls;
+    SphericalHarmonicsGravityBatch gravBatch;
+    Planet planet;
+    int num_points;
+    int num_reps;
+    double tolerance;
+
+    cmdline_parser.add_int("NumPoints", 200, &num_points);
+    cmdline_parser.add_int("NumReps", 20, &num_reps);
+    cmdline_parser.add_double("Tolerance", 1.0e-12, &tolerance);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_points <= 0 || num_reps <= 0)
+    {
+        cerr << "NumPoints and NumReps must be positive." << endl;
+        return 1;
+    }
+
+    gravBody.tide_free = true;
+    gravControls.active = true;
+    earth_planet_init.initialize(&planet);
+    earth_gravity_init.initialize(&gravBody);
+    gravBody.initialize_body();
+
+    planet.grav_source = &gravBody;
+    gravBody.inertial = &planet.inertial;
+    gravBody.pfix = &planet.pfix;
+    planet.initialize();
+    gravControls.source_name = gravBody.name;
+    gravModel.add_grav_source(gravBody);
+    frameVector.push_back(&planet.inertial);
+    gravBody.initialize_state(frameVector, gravModel);
+    gravControls.initialize_control(gravModel);
+    gravControls.perturbing_only = true;
+    gravControls.gradient = true;
+
+    // Give the planet-fixed frame an arbitrary orientation.
+    double angle = 0.7;
+    Matrix3x3::initialize(planet.pfix.state.rot.T_parent_this);
+    planet.pfix.state.rot.T_parent_this[0][0] = cos(angle);
+    planet.pfix.state.rot.T_parent_this[0][1] = sin(angle);
+    planet.pfix.state.rot.T_parent_this[1][0] = -sin(angle);
+    planet.pfix.state.rot.T_parent_this[1][1] = cos(angle);
+    planet.pfix.state.rot.T_parent_this[2][2] = 1.0;
+
+    unsigned int npts = static_cast<unsigned int>(num_points);
+    vector<double> pos_x(npts), pos_y(npts), pos_z(npts);
+    vector<double> acc_x(npts), acc_y(npts), acc_z(npts), pot(npts);
+    vector<double> ref_acc(3 * npts), ref_pot(npts);
+    vector<double> ref_grad(9 * npts), grad(9 * npts);
+    make_positions(npts, gravBody.radius, pos_x, pos_y, pos_z);
+
+    int rv = 0;
+
+    cout << "Points: " << npts << ", repetitions: " << num_reps << endl;
+    cout << setw(8) << "degree" << setw(16) << "per-body ns/pt" << setw(16) << "batch ns/pt" << setw(10) << "speedup"
+         << setw(14) << "max rel diff" << endl;
+
+    for(unsigned int kk = 0; kk < NUM_DEGREES; ++kk)
+    {
+        unsigned int degree = test_degrees[kk];
+        gravControls.set_degree_order(degree, degree);
+        gravControls.set_grad_degree_order(degree, degree);
+        gravBatch.initialize(gravControls);
+
+        auto start = chrono::steady_clock::now();
+        for(int rep = 0; rep < num_reps; ++rep)
+        {
+            for(unsigned int ii = 0; ii < npts; ++ii)
+            {
+                double pos[3] = {pos_x[ii], pos_y[ii], pos_z[ii]};
+                gravControls.gravitation(pos,
+                                         0,
+                                         &ref_acc[3 * ii],
+                                         reinterpret_cast<double(*)[3]>(&ref_grad[9 * ii]),
+                                         &ref_pot[ii]);
+            }
+        }
+        auto middle = chrono::steady_clock::now();
+        for(int rep = 0; rep < num_reps; ++rep)
+        {
+            gravBatch.evaluate(npts,
+                               pos_x.data(),
+                               pos_y.data(),
+                               pos_z.data(),
+                               acc_x.data(),
+                               acc_y.data(),
+                               acc_z.data(),
+                               pot.data(),
+                               reinterpret_cast<double(*)[3][3]>(grad.data()));
+        }
+        auto stop = chrono::steady_clock::now();
+
+        double max_diff = 0.0;
+        for(unsigned int ii = 0; ii < npts; ++ii)
+        {
+            double diffs[5] = {rel_diff(acc_x[ii], ref_acc[3 * ii]),
+                               rel_diff(acc_y[ii], ref_acc[3 * ii + 1]),
+                               rel_diff(acc_z[ii], ref_acc[3 * ii + 2]),
+                               rel_diff(pot[ii], ref_pot[ii]),
+                               0.0};
+            for(unsigned int jj = 0; jj < 9; ++jj)
+            {
+                double diff = rel_diff(grad[9 * ii + jj], ref_grad[9 * ii + jj]);
+                diffs[4] = diff > diffs[4] ? diff : diffs[4];
+            }
+            for(double diff : diffs)
+            {
+                max_diff = diff > max_diff ? diff : max_diff;
+            }
+        }
+
+        double nevals = static_cast<double>(npts) * num_reps;
+        double ref_ns = chrono::duration<double, nano>(middle - start).count() / nevals;
+        double batch_ns = chrono::duration<double, nano>(stop - middle).count() / nevals;
+        cout << setw(8) << degree << setw(16) << fixed << setprecision(1) << ref_ns << setw(16) << batch_ns
+             << setw(10) << setprecision(2) << ref_ns / batch_ns << setw(14) << scientific << setprecision(2)
+             << max_diff << endl;
+        cout.unsetf(ios::floatfield);
+
+        if(max_diff > tolerance)
+        {
+            cout << "Failed tolerance " << tolerance << " at degree " << degree << endl;
+            rv = 1;
+        }
+    }
+
+    return rv;
+}
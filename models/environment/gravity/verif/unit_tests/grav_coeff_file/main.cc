@@ -0,0 +1,171 @@
+// Check that gravity coefficients loaded from JEOD binary and ICGEM (.gfc)
+// files reproduce the compiled-in default data, and compare the load times.
+// System includes
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "environment/gravity/data/include/earth_GGM02C.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+
+using namespace std;
+using namespace jeod;
+
+/**
+ * Write the coefficients of a source as an ICGEM file, using Fortran
+ * exponents on odd degrees to exercise that form.
+ */
+static void write_icgem_file(const SphericalHarmonicsGravitySource & source, const string & file_name)
+{
+    ofstream out(file_name.c_str());
+    out << "generated from JEOD default data\n"
+        << "begin_of_head\n"
+        << "product_type            gravity_field\n"
+        << "modelname               GGM02C\n"
+        << "earth_gravity_constant  " << setprecision(17) << source.mu << "\n"
+        << "radius                  " << source.radius << "\n"
+        << "max_degree              " << source.degree << "\n"
+        << "errors                  no\n"
+        << "norm                    fully_normalized\n"
+        << "tide_system             " << (source.tide_free ? "tide_free" : "zero_tide") << "\n"
+        << "key    L    M    C                  S\n"
+        << "end_of_head\n";
+    out << scientific << setprecision(16);
+    out << "gfc 0 0 1.0 0.0\n";
+    for(unsigned int nn = 2; nn <= source.degree; ++nn)
+    {
+        for(unsigned int mm = 0; mm <= nn; ++mm)
+        {
+            ostringstream line;
+            line << scientific << setprecision(16) << "gfc " << nn << ' ' << mm << ' ' << source.Cnm[nn][mm] << ' '
+                 << source.Snm[nn][mm];
+            string text = line.str();
+            if(nn % 2 == 1)
+            {
+                for(char & ch : text)
+                {
+                    ch = (ch == 'e') ? 'D' : ch;
+                }
+            }
+            out << text << "\n";
+        }
+    }
+}
+
+/**
+ * Count the coefficients of a loaded source that differ from the reference,
+ * up to the loaded degree and order.
+ */
+static unsigned int count_differences(const SphericalHarmonicsGravitySource & ref,
+                                      const SphericalHarmonicsGravitySource & test)
+{
+    unsigned int num_diff = (ref.mu != test.mu) + (ref.radius != test.radius) + (ref.tide_free != test.tide_free);
+    for(unsigned int nn = 2; nn <= test.degree; ++nn)
+    {
+        for(unsigned int mm = 0; mm <= nn; ++mm)
+        {
+            double ref_c = (mm <= test.order) ? ref.Cnm[nn][mm] : 0.0;
+            double ref_s = (mm <= test.order) ? ref.Snm[nn][mm] : 0.0;
+            num_diff += (test.Cnm[nn][mm] != ref_c) + (test.Snm[nn][mm] != ref_s);
+        }
+        num_diff += (test.alpha[nn] != ref.alpha[nn]) + (test.beta[nn] != ref.beta[nn]) +
+                    (test.nrdiag[nn] != ref.nrdiag[nn]);
+        for(unsigned int mm = 0; mm < nn; ++mm)
+        {
+            num_diff += (test.xi[nn][mm] != ref.xi[nn][mm]) + (test.eta[nn][mm] != ref.eta[nn][mm]) +
+                        (test.zeta[nn][mm] != ref.zeta[nn][mm]) + (test.upsilon[nn][mm] != ref.upsilon[nn][mm]);
+        }
+    }
+    return num_diff;
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_reps;
+
+    cmdline_parser.add_int("NumReps", 5, &num_reps);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_reps <= 0)
+    {
+        cerr << "NumReps must be positive." << endl;
+        return 1;
+    }
+
+    const string binary_name = "GGM02C.jeodgrav";
+    const string icgem_name = "GGM02C.gfc";
+    int rv = 0;
+
+    // Reference: the compiled-in default data.
+    SphericalHarmonicsGravitySource_earth_GGM02C_default_data earth_gravity_init;
+    SphericalHarmonicsGravitySource reference;
+    earth_gravity_init.initialize(&reference);
+    reference.initialize_body();
+    reference.write_coefficient_file(binary_name);
+    write_icgem_file(reference, icgem_name);
+
+    double default_ms = 0.0;
+    double binary_ms = 0.0;
+    double icgem_ms = 0.0;
+    unsigned int binary_diff = 0;
+    unsigned int icgem_diff = 0;
+    for(int rep = 0; rep < num_reps; ++rep)
+    {
+        SphericalHarmonicsGravitySource from_default;
+        SphericalHarmonicsGravitySource from_binary;
+        SphericalHarmonicsGravitySource from_icgem;
+
+        auto start = chrono::steady_clock::now();
+        earth_gravity_init.initialize(&from_default);
+        from_default.initialize_body();
+        auto after_default = chrono::steady_clock::now();
+        from_binary.load_coefficient_file(binary_name);
+        auto after_binary = chrono::steady_clock::now();
+        from_icgem.load_coefficient_file(icgem_name);
+        auto after_icgem = chrono::steady_clock::now();
+
+        default_ms += chrono::duration<double, milli>(after_default - start).count();
+        binary_ms += chrono::duration<double, milli>(after_binary - after_default).count();
+        icgem_ms += chrono::duration<double, milli>(after_icgem - after_binary).count();
+        binary_diff += count_differences(reference, from_binary);
+        icgem_diff += count_differences(reference, from_icgem);
+    }
+
+    cout << "Degree " << reference.degree << " field, " << num_reps << " repetitions" << endl;
+    cout << fixed << setprecision(2);
+    cout << "  compiled default data: " << setw(8) << default_ms / num_reps << " ms" << endl;
+    cout << "  binary file:           " << setw(8) << binary_ms / num_reps << " ms, " << binary_diff
+         << " differences" << endl;
+    cout << "  ICGEM file:            " << setw(8) << icgem_ms / num_reps << " ms, " << icgem_diff
+         << " differences" << endl;
+    rv = ((binary_diff == 0) && (icgem_diff == 0)) ? 0 : 1;
+
+    // Truncated loads.
+    SphericalHarmonicsGravitySource truncated_binary;
+    SphericalHarmonicsGravitySource truncated_icgem;
+    truncated_binary.load_coefficient_file(binary_name, 36, 30);
+    truncated_icgem.load_coefficient_file(icgem_name, 36, 30);
+    unsigned int truncated_diff = count_differences(reference, truncated_binary) +
+                                  count_differences(reference, truncated_icgem);
+    bool truncated_size = (truncated_binary.degree == 36) && (truncated_binary.order == 30) &&
+                          (truncated_icgem.degree == 36) && (truncated_icgem.order == 30);
+    cout << "  36x30 truncation:      " << truncated_diff << " differences" << endl;
+    if((truncated_diff != 0) || !truncated_size)
+    {
+        rv = 1;
+    }
+
+    remove(binary_name.c_str());
+    remove(icgem_name.c_str());
+
+    return rv;
+}
@@ -0,0 +1,210 @@
+// Time the per-vehicle spherical harmonics evaluation, with and without the
+// gravity gradient, against the degree of the field, and check it against
+// SphericalHarmonicsGravityBatch. The field is synthetic so that degrees
+// beyond those of the default data can be timed.
+
+// System includes
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// JEOD includes
+#include "environment/gravity/include/gravity_manager.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_batch.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_controls.hh"
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+#include "environment/planet/data/include/earth.hh"
+#include "environment/planet/include/planet.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/math/include/matrix3x3.hh"
+
+using namespace std;
+using namespace jeod;
+
+static constexpr unsigned int NUM_DEGREES = 7;
+static const unsigned int test_degrees[NUM_DEGREES] = {8, 20, 36, 70, 150, 200, 360};
+
+static unsigned long seed = 12345;
+
+static double uniform()
+{
+    seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+    return static_cast<double>(seed) / 2147483648.0;
+}
+
+/**
+ * An Earth-like field whose coefficients follow Kaula's rule.
+ */
+class SyntheticGravitySource : public SphericalHarmonicsGravitySource
+{
+public:
+    void generate(unsigned int new_degree)
+    {
+        name = "Earth";
+        mu = 3.986004415e14;
+        radius = 6.3781363e6;
+        tide_free = true;
+        allocate_coefficients(new_degree, new_degree);
+        for(unsigned int nn = 2; nn <= new_degree; ++nn)
+        {
+            double scale = 1.0e-5 / (nn * nn);
+            for(unsigned int mm = 0; mm <= nn; ++mm)
+            {
+                Cnm[nn][mm] = scale * (2.0 * uniform() - 1.0);
+                Snm[nn][mm] = (mm > 0) ? scale * (2.0 * uniform() - 1.0) : 0.0;
+            }
+        }
+        Cnm[2][0] = -4.84165e-4;
+    }
+};
+
+static double rel_diff(double a, double b)
+{
+    double scale = fabs(a) > fabs(b) ? fabs(a) : fabs(b);
+    return (scale > 0.0) ? fabs(a - b) / scale : 0.0;
+}
+
+int main(int argc, char * argv[])
+{
+    vector<EphemerisRefFrame *> frameVector;
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    Planet_earth_default_data earth_planet_init;
+    GravityManager gravModel;
+    SyntheticGravitySource gravBody;
+    SphericalHarmonicsGravityControls gravControls;
+    SphericalHarmonicsGravityBatch gravBatch;
+    Planet planet;
+    int num_points;
+    int num_reps;
+    double tolerance;
+
+    cmdline_parser.add_int("NumPoints", 200, &num_points);
+    cmdline_parser.add_int("NumReps", 10, &num_reps);
+    cmdline_parser.add_double("Tolerance", 1.0e-12, &tolerance);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_points <= 0 || num_reps <= 0)
+    {
+        cerr << "NumPoints and NumReps must be positive." << endl;
+        return 1;
+    }
+
+    gravControls.active = true;
+    earth_planet_init.initialize(&planet);
+    gravBody.generate(test_degrees[NUM_DEGREES - 1]);
+    gravBody.initialize_body();
+
+    planet.grav_source = &gravBody;
+    gravBody.inertial = &planet.inertial;
+    gravBody.pfix = &planet.pfix;
+    planet.initialize();
+    gravControls.source_name = gravBody.name;
+    gravModel.add_grav_source(gravBody);
+    frameVector.push_back(&planet.inertial);
+    gravBody.initialize_state(frameVector, gravModel);
+    gravControls.initialize_control(gravModel);
+    gravControls.perturbing_only = true;
+
+    // Give the planet-fixed frame an arbitrary orientation.
+    double angle = 0.7;
+    Matrix3x3::initialize(planet.pfix.state.rot.T_parent_this);
+    planet.pfix.state.rot.T_parent_this[0][0] = cos(angle);
+    planet.pfix.state.rot.T_parent_this[0][1] = sin(angle);
+    planet.pfix.state.rot.T_parent_this[1][0] = -sin(angle);
+    planet.pfix.state.rot.T_parent_this[1][1] = cos(angle);
+    planet.pfix.state.rot.T_parent_this[2][2] = 1.0;
+
+    // Positions between 200 km altitude and GEO.
+    auto npts = static_cast<unsigned int>(num_points);
+    vector<double> pos_x(npts), pos_y(npts), pos_z(npts);
+    for(unsigned int ii = 0; ii < npts; ++ii)
+    {
+        double r_mag = gravBody.radius + 200.0e3 + uniform() * 35.6e6;
+        double z = 2.0 * uniform() - 1.0;
+        double lon = 2.0 * M_PI * uniform();
+        double rho = sqrt(1.0 - z * z);
+        pos_x[ii] = r_mag * rho * cos(lon);
+        pos_y[ii] = r_mag * rho * sin(lon);
+        pos_z[ii] = r_mag * z;
+    }
+    vector<double> acc(3 * npts), pot(npts), grad(9 * npts);
+    vector<double> acc_x(npts), acc_y(npts), acc_z(npts), batch_pot(npts), batch_grad(9 * npts);
+
+    int rv = 0;
+
+    cout << "Points: " << npts << ", repetitions: " << num_reps << endl;
+    cout << setw(8) << "degree" << setw(14) << "accel ns" << setw(20) << "accel+gradient ns" << setw(14)
+         << "max rel diff" << endl;
+
+    for(unsigned int degree : test_degrees)
+    {
+        double eval_ns[2];
+        for(unsigned int with_gradient = 0; with_gradient < 2; ++with_gradient)
+        {
+            gravControls.gradient = (with_gradient != 0);
+            gravControls.set_degree_order(degree, degree);
+            gravControls.set_grad_degree_order(with_gradient ? degree : 0, with_gradient ? degree : 0);
+
+            auto start = chrono::steady_clock::now();
+            for(int rep = 0; rep < num_reps; ++rep)
+            {
+                for(unsigned int ii = 0; ii < npts; ++ii)
+                {
+                    double pos[3] = {pos_x[ii], pos_y[ii], pos_z[ii]};
+                    gravControls.gravitation(pos,
+                                             0,
+                                             &acc[3 * ii],
+                                             reinterpret_cast<double(*)[3]>(&grad[9 * ii]),
+                                             &pot[ii]);
+                }
+            }
+            auto stop = chrono::steady_clock::now();
+            eval_ns[with_gradient] = chrono::duration<double, nano>(stop - start).count() / (npts * num_reps);
+        }
+
+        gravBatch.initialize(gravControls);
+        gravBatch.evaluate(npts,
+                           pos_x.data(),
+                           pos_y.data(),
+                           pos_z.data(),
+                           acc_x.data(),
+                           acc_y.data(),
+                           acc_z.data(),
+                           batch_pot.data(),
+                           reinterpret_cast<double(*)[3][3]>(batch_grad.data()));
+
+        double max_diff = 0.0;
+        for(unsigned int ii = 0; ii < npts; ++ii)
+        {
+            double diffs[4] = {rel_diff(acc_x[ii], acc[3 * ii]),
+                               rel_diff(acc_y[ii], acc[3 * ii + 1]),
+                               rel_diff(acc_z[ii], acc[3 * ii + 2]),
+                               rel_diff(batch_pot[ii], pot[ii])};
+            for(double diff : diffs)
+            {
+                max_diff = diff > max_diff ? diff : max_diff;
+            }
+            for(unsigned int jj = 0; jj < 9; ++jj)
+            {
+                double diff = rel_diff(batch_grad[9 * ii + jj], grad[9 * ii + jj]);
+                max_diff = diff > max_diff ? diff : max_diff;
+            }
+        }
+
+        cout << setw(8) << degree << setw(14) << fixed << setprecision(1) << eval_ns[0] << setw(20) << eval_ns[1]
+             << setw(14) << scientific << setprecision(2) << max_diff << endl;
+        cout.unsetf(ios::floatfield);
+
+        if(max_diff > tolerance)
+        {
+            cout << "Failed tolerance " << tolerance << " at degree " << degree << endl;
+            rv = 1;
+        }
+    }
+
+    return rv;
+}
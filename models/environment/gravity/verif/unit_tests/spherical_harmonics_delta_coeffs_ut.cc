@@ -19,3 +19,5 @@ TEST(SphericalHarmonicsDeltaCoeffs, create)
 TEST(SphericalHarmonicsDeltaCoeffs, initialize) {}
 
 TEST(SphericalHarmonicsDeltaCoeffs, update) {}
+
+TEST(SphericalHarmonicsDeltaCoeffs, inputs_changed) {}
@@ -0,0 +1,28 @@
+/*
+ * spherical_harmonics_gravity_batch_ut.cc
+ */
+
+#include "environment/gravity/include/spherical_harmonics_gravity_batch.hh"
+#include "message_handler_mock.hh"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+using testing::_;
+using testing::AnyNumber;
+using testing::Mock;
+
+using namespace jeod;
+
+TEST(SphericalHarmonicsGravityBatch, create)
+{
+    MockMessageHandler mockMessageHandler;
+
+    EXPECT_CALL(mockMessageHandler, process_message(_, _, _, _, _, _, _)).Times(AnyNumber());
+    SphericalHarmonicsGravityBatch staticInst;
+    SphericalHarmonicsGravityBatch * dynInst = new SphericalHarmonicsGravityBatch;
+    delete dynInst;
+}
+
+TEST(SphericalHarmonicsGravityBatch, initialize) {}
+
+TEST(SphericalHarmonicsGravityBatch, evaluate) {}
@@ -25,6 +25,14 @@ TEST(SphericalHarmonicsGravitySource, create)
 
 TEST(SphericalHarmonicsGravitySource, initialize_body) {}
 
+TEST(SphericalHarmonicsGravitySource, update_packed_coeffs) {}
+
 TEST(SphericalHarmonicsGravitySource, find_deltacoeff) {}
 
 TEST(SphericalHarmonicsGravitySource, add_deltacoeff) {}
+
+TEST(SphericalHarmonicsGravitySource, load_coefficient_file) {}
+
+TEST(SphericalHarmonicsGravitySource, write_coefficient_file) {}
+
+TEST(SphericalHarmonicsGravitySource, update_deltacoeff) {}
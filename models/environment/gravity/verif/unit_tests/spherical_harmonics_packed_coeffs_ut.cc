@@ -0,0 +1,32 @@
+/*
+ * spherical_harmonics_packed_coeffs_ut.cc
+ */
+
+#include "environment/gravity/include/spherical_harmonics_packed_coeffs.hh"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace jeod;
+
+TEST(SphericalHarmonicsPackedCoeffs, create)
+{
+    SphericalHarmonicsPackedCoeffs staticInst;
+    SphericalHarmonicsPackedCoeffs * dynInst = new SphericalHarmonicsPackedCoeffs;
+    delete dynInst;
+}
+
+TEST(SphericalHarmonicsPackedCoeffs, index)
+{
+    EXPECT_EQ(0u, SphericalHarmonicsPackedCoeffs::index(0, 0));
+    EXPECT_EQ(1u, SphericalHarmonicsPackedCoeffs::index(1, 0));
+    EXPECT_EQ(3u, SphericalHarmonicsPackedCoeffs::index(2, 0));
+    EXPECT_EQ(5u, SphericalHarmonicsPackedCoeffs::index(2, 2));
+    EXPECT_EQ(6u, SphericalHarmonicsPackedCoeffs::index(3, 0));
+}
+
+TEST(SphericalHarmonicsPackedCoeffs, build) {}
+
+TEST(SphericalHarmonicsPackedCoeffs, update_coefficients) {}
+
+TEST(SphericalHarmonicsPackedCoeffs, clear) {}
@@ -19,3 +19,5 @@ TEST(SphericalHarmonicsTidalEffects, create)
 TEST(SphericalHarmonicsTidalEffects, initialize) {}
 
 TEST(SphericalHarmonicsTidalEffects, update) {}
+
+TEST(SphericalHarmonicsTidalEffects, inputs_changed) {}
@@ -42,6 +42,12 @@ with open('Leap_Second.dat', 'r') as fpIn, open('src/tai_to_utc.cc', 'w') as fpO
   text = Template(filename='tai_to_utc.mako').render(leapSeconds=leapSeconds)
   fpOut.write(text)
 
+# The same table in the form read by TimeConverter_TAI_UTC::load_table_file
+with open('tai_to_utc.csv', 'w') as fpOut:
+  fpOut.write('# UTC truncated Julian date (day), TAI-UTC (s)\n')
+  for leapSecond in leapSeconds:
+     fpOut.write('{0},{1}\n'.format(leapSecond.mjd-40000.0, leapSecond.numSeconds))
+
 ConversionEntry = namedtuple('ConversionEntry', ['year', 'month', 'day', 'mjd', 'dut'])
 
 def getLeapSecondsFromMjd(mjd):
@@ -84,3 +90,9 @@ with open(args.inputFile, 'r') as fpIn, open('src/tai_to_ut1.cc', 'w') as fpOut:
         print("Line: {0} doesn't have at least 7 columns. Skipping...".format(line))
   text = Template(filename='tai_to_ut1.mako').render(entries=entries, getLeapSecondsFromMjd=getLeapSecondsFromMjd )
   fpOut.write(text)
+
+# The same table in the form read by TimeConverter_TAI_UT1::load_table_file
+with open('tai_to_ut1.csv', 'w') as fpOut:
+  fpOut.write('# TAI truncated Julian date (day), UT1-TAI (s)\n')
+  for entry in entries:
+     fpOut.write('{0},{1}\n'.format(entry.mjd-40000.0, entry.dut - getLeapSecondsFromMjd(entry.mjd)))
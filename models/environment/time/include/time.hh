@@ -129,6 +129,14 @@ public:
      */
     std::string update_from_name{""}; //!< trick_units(--)
 
+    /**
+     * Update this time only when it is read via ensure_updated, rather than
+     * with every TimeManager::update. Ignored if another time that is updated
+     * with every TimeManager::update derives from this one.
+     * Must be set before the TimeManager is initialized.
+     */
+    bool lazy_update{}; //!< trick_units(--)
+
     /**
      * Pointer to the TimeManager
      */
@@ -170,6 +178,12 @@ protected:
      */
     TimeLinks links; //!< trick_units(--)
 
+    /**
+     * The TimeManager simtime for which a lazily updated time was last
+     * updated.
+     */
+    double update_simtime{-1.0e300}; //!< trick_units(--)
+
     // Member functions:
 public:
     JeodBaseTime();
@@ -235,6 +249,8 @@ public:
 
     virtual void update();
 
+    void ensure_updated();
+
 protected:
     void add_parent(JeodBaseTime & parent);
 };
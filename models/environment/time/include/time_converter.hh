@@ -188,6 +188,9 @@ protected:
 
     // verify_setup: Verifies that the initializer function can run
     void verify_setup(const JeodBaseTime * parent, const JeodBaseTime * child, const int direction);
+
+    // read_table_file: Reads a two-column lookup table from a text file
+    static int read_table_file(const std::string & file_name, double *& when_vec, double *& val_vec);
 };
 
 /*----------------------------------------------------------------------------*/
@@ -67,6 +67,7 @@ Library dependencies:
 #define JEOD_TIME_CONVERTER_TAI_UT1_HH
 
 // System includes
+#include <string>
 
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
@@ -181,10 +182,19 @@ public:
     // convert_b_to_a: Apply the converter in the reverse direction
     void convert_b_to_a() override;
 
+    // load_table_file: Replace the lookup table with one read from a file
+    void load_table_file(const std::string & file_name);
+
 private:
     // initialize_tai_to_ut1 tables:
     void initialize_tai_to_ut1();
 
+    // find_table_index: Locate the table interval containing a TAI time
+    int find_table_index(double tai_time) const;
+
+    // seek_table: Move the interpolation interval to a TAI time
+    void seek_table(double tai_time);
+
     // used at time reversals to verify the ends of the lookup table
     void verify_table_lookup_ends() override;
 };
@@ -67,6 +67,7 @@ Library dependencies:
 #define JEOD_TIME_CONVERTER_TAI_UTC_HH
 
 // System includes
+#include <string>
 
 // JEOD includes
 #include "utils/sim_interface/include/jeod_class.hh"
@@ -167,6 +168,9 @@ public:
     // convert_b_to_a: Apply the converter in the reverse direction
     void convert_b_to_a() override;
 
+    // load_table_file: Replace the leap second table with one read from a file
+    void load_table_file(const std::string & file_name);
+
 private:
     // initialize_leap_second: Initialize the leap second table
     void initialize_leap_second();
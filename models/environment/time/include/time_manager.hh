@@ -130,6 +130,12 @@ private:
      */
     std::vector<TimeConverter *> converter_vector;
 
+    /**
+     * The times that are updated with every update, in update order.
+     * The remaining times are updated lazily.
+     */
+    std::vector<JeodBaseTime *> eager_time_vector;
+
     // Member functions:
 public:
     TimeManager();
@@ -149,6 +155,8 @@ public:
     bool time_standards_exist();
 
     virtual void update(double time);
+
+    void update_lazy_times();
     void verify_table_lookup_ends();
 
     void register_time(JeodBaseTime & time_ref);
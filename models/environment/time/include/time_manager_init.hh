@@ -193,6 +193,8 @@ private:
     void create_init_tree();
 
     void create_update_tree();
+
+    void select_eager_times();
 };
 
 /*----------------------------------------------------------------------------*/
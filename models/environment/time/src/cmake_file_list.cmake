@@ -13,6 +13,7 @@ time_messages.cc
 time_gps.cc
 time_dyn.cc
 time_converter.cc
+time_converter__read_table_file.cc
 time_gmst.cc
 time_ut1.cc
 time_tdb.cc
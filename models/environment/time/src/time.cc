@@ -37,13 +37,14 @@ LIBRARY DEPENDENCY:
 #include <cstddef>
 
 /* JEOD includes */
+#include "utils/math/include/numerical.hh"
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/message/include/message_handler.hh"
 
 /* Model Includes */
 #include "../include/time.hh"
 #include "../include/time_converter.hh"
-// #include "../include/time_manager.hh"
+#include "../include/time_manager.hh"
 #include "../include/time_manager_init.hh"
 #include "../include/time_messages.hh"
 
@@ -150,6 +151,28 @@ void JeodBaseTime::update()
     }
 }
 
+/**
+ * Brings a lazily updated time up to date with the TimeManager, first
+ * bringing its parent up to date. Times that are updated with every
+ * TimeManager::update are always up to date, and are left as they are.
+ *
+ * \par Assumptions and Limitations
+ *  - The time has been registered with a TimeManager.
+ */
+void JeodBaseTime::ensure_updated()
+{
+    if(lazy_update && !Numerical::compare_exact(update_simtime, time_manager->simtime))
+    {
+        JeodBaseTime * parent = links.parent();
+        if(parent != nullptr)
+        {
+            parent->ensure_updated();
+        }
+        update();
+        update_simtime = time_manager->simtime;
+    }
+}
+
 /**
  * Given a value of seconds, propagate to days.
  *
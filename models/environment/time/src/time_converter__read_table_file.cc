@@ -0,0 +1,155 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Environment
+ * @{
+ * @addtogroup Time
+ * @{
+ *
+ * @file models/environment/time/src/time_converter__read_table_file.cc
+ * Define TimeConverter::read_table_file, which reads the lookup tables used by
+ * the table-driven converters from a text file at run time.
+ */
+
+/******************************************************************************
+PURPOSE:
+  ()
+
+REFERENCE:
+  (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+  ((None))
+
+LIBRARY DEPENDENCY:
+  ((time_converter__read_table_file.cc)
+   (time_converter.cc)
+   (time_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+******************************************************************************/
+
+// System includes
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// JEOD includes
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/time_converter.hh"
+#include "../include/time_messages.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+/**
+ * Read a two-column lookup table from a text file.
+ * Each data line holds a time (truncated Julian days) and the tabulated value
+ * at that time, separated by white space or a comma. Blank lines and lines
+ * starting with '#' are ignored. The times must be strictly increasing.
+ *
+ * \par Assumptions and Limitations
+ *  - The caller owns the returned arrays and must release them with
+ *    JEOD_DELETE_ARRAY.
+ * \param[in] file_name Name of the table file
+ * \param[out] when_vec Newly allocated array of table times
+ * \param[out] val_vec Newly allocated array of table values
+ * @return Index of the last entry in the table
+ */
+int TimeConverter::read_table_file(const std::string & file_name, double *& when_vec, double *& val_vec)
+{
+    std::ifstream table_file(file_name.c_str());
+    if(!table_file)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             TimeMessages::invalid_data_error,
+                             "\n"
+                             "Unable to open the time converter table file '%s'.\n",
+                             file_name.c_str());
+        return -1;
+    }
+
+    std::vector<double> when_data;
+    std::vector<double> val_data;
+    std::string line;
+    unsigned int line_number = 0;
+
+    while(std::getline(table_file, line))
+    {
+        ++line_number;
+        std::replace(line.begin(), line.end(), ',', ' ');
+
+        std::istringstream fields(line);
+        std::string first_field;
+        if(!(fields >> first_field) || (first_field[0] == '#'))
+        {
+            continue;
+        }
+
+        fields.clear();
+        fields.str(line);
+        double when = 0.0;
+        double value = 0.0;
+        if(!(fields >> when >> value))
+        {
+            MessageHandler::fail(__FILE__,
+                                 __LINE__,
+                                 TimeMessages::invalid_data_error,
+                                 "\n"
+                                 "Line %u of the time converter table file '%s' does not contain a time and a value.\n",
+                                 line_number,
+                                 file_name.c_str());
+            return -1;
+        }
+
+        if(!when_data.empty() && (when <= when_data.back()))
+        {
+            MessageHandler::fail(__FILE__,
+                                 __LINE__,
+                                 TimeMessages::invalid_data_error,
+                                 "\n"
+                                 "The times in the time converter table file '%s' are not strictly increasing "
+                                 "(line %u).\n",
+                                 file_name.c_str(),
+                                 line_number);
+            return -1;
+        }
+
+        when_data.push_back(when);
+        val_data.push_back(value);
+    }
+
+    if(when_data.empty())
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             TimeMessages::invalid_data_error,
+                             "\n"
+                             "The time converter table file '%s' contains no data.\n",
+                             file_name.c_str());
+        return -1;
+    }
+
+    when_vec = JEOD_ALLOC_PRIM_ARRAY(when_data.size(), double);
+    val_vec = JEOD_ALLOC_PRIM_ARRAY(val_data.size(), double);
+    std::copy(when_data.begin(), when_data.end(), when_vec);
+    std::copy(val_data.begin(), val_data.end(), val_vec);
+
+    return static_cast<int>(when_data.size()) - 1;
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ */
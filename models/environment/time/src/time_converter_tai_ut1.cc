@@ -27,6 +27,7 @@ LIBRARY DEPENDENCY:
    (time_tai.cc)
    (time_ut1.cc)
    (time_converter.cc)
+   (time_converter__read_table_file.cc)
    (time_messages.cc)
    (utils/message/src/message_handler.cc)
    (utils/named_item/src/named_item.cc))
@@ -35,6 +36,7 @@ LIBRARY DEPENDENCY:
 ******************************************************************************/
 
 // System includes
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 
@@ -225,22 +227,97 @@ void TimeConverter_TAI_UT1::initialize_tai_to_ut1()
     }
     else
     {
-        /* Find the last entry that comes before the current time (trunc_julian_time)
-           Highest value that can be reached is index = last_index - 1
-           because tai_time < when_vec[last_index] by earlier test. */
-        for(index = 0; tai_time >= when_vec[index + 1]; ++index)
-        {
-            ;
-        }
-        prev_when = when_vec[index];
-        prev_value = val_vec[index];
-        next_when = when_vec[index + 1];
-        next_value = val_vec[index + 1];
-        gradient = (next_value - prev_value) / (next_when - prev_when);
+        seek_table(tai_time);
         a_to_b_offset = (prev_value + (tai_time - prev_when) * gradient) / 86400.0;
     }
 }
 
+/**
+ * Find the last table entry that does not follow the given time.
+ * The IERS tables are tabulated daily, so the index is first computed
+ * directly from the table spacing; a binary search is used if that guess
+ * does not bracket the time (e.g., a table with gaps).
+ *
+ * \par Assumptions and Limitations
+ *  - when_vec[0] <= tai_time < when_vec[last_index]
+ * \param[in] tai_time TAI time, truncated Julian days
+ * @return Index of the table interval containing tai_time
+ */
+int TimeConverter_TAI_UT1::find_table_index(double tai_time) const
+{
+    double spacing = (when_vec[last_index] - when_vec[0]) / last_index;
+    auto guess = static_cast<int>((tai_time - when_vec[0]) / spacing);
+
+    if((guess >= 0) && (guess < last_index) && (when_vec[guess] <= tai_time) && (tai_time < when_vec[guess + 1]))
+    {
+        return guess;
+    }
+
+    const double * upper = std::upper_bound(when_vec, when_vec + last_index + 1, tai_time);
+    return static_cast<int>(upper - when_vec) - 1;
+}
+
+/**
+ * Set the interpolation interval to the one containing the given time,
+ * limited to the first and last intervals of the table. Times off either end
+ * of the table are left for the caller to detect by comparing against
+ * prev_when and next_when.
+ *
+ * \par Assumptions and Limitations
+ *  - The table has at least two entries.
+ * \param[in] tai_time TAI time, truncated Julian days
+ */
+void TimeConverter_TAI_UT1::seek_table(double tai_time)
+{
+    if(tai_time < when_vec[0])
+    {
+        index = 0;
+    }
+    else if(tai_time >= when_vec[last_index])
+    {
+        index = last_index - 1;
+    }
+    else
+    {
+        index = find_table_index(tai_time);
+    }
+
+    prev_when = when_vec[index];
+    prev_value = val_vec[index];
+    next_when = when_vec[index + 1];
+    next_value = val_vec[index + 1];
+    gradient = (next_value - prev_value) / (next_when - prev_when);
+}
+
+/**
+ * Replace the lookup table with one read from a file, in place of (or after)
+ * the compiled-in default data. Each line of the file holds a TAI time in
+ * truncated Julian days and the value of UT1-TAI, in seconds, at that time.
+ * The file must be loaded before the converter is initialized.
+ *
+ * \par Assumptions and Limitations
+ *  - data/tai_to_ut1.csv, written by data/parser.py, has the required format.
+ * \param[in] file_name Name of the table file
+ */
+void TimeConverter_TAI_UT1::load_table_file(const std::string & file_name)
+{
+    double * new_when_vec = nullptr;
+    double * new_val_vec = nullptr;
+    int new_last_index = read_table_file(file_name, new_when_vec, new_val_vec);
+    if(new_last_index < 0)
+    {
+        return;
+    }
+
+    JEOD_DELETE_ARRAY(when_vec);
+    JEOD_DELETE_ARRAY(val_vec);
+    when_vec = new_when_vec;
+    val_vec = new_val_vec;
+    last_index = new_last_index;
+    index = -1;
+    override_data_table = false;
+}
+
 /**
  * Convert from TimeTAI to TimeUT1.
  *
@@ -264,7 +341,15 @@ void TimeConverter_TAI_UT1::convert_a_to_b()
         // ut1_ptr->seconds = ut1_ptr->days * 86400;
         return;
     } // else
-      // for conventional (forward-time) simulations:
+
+    /* A jump of more than one interval goes straight to the right part of the
+       table; the loops below then handle at most the step off either end. */
+    if(((tai_time > next_when) || (tai_time < prev_when)) && (last_index > 0))
+    {
+        seek_table(tai_time);
+    }
+
+    // for conventional (forward-time) simulations:
 
     /* "while" is used because updates need not be done regularly, may have to
        catch up with accumulation of points. */
@@ -362,7 +447,18 @@ void TimeConverter_TAI_UT1::convert_b_to_a()
         // tai_ptr->seconds = tai_ptr->days * 86400;
         return;
     } // else
-      // for conventional (forward-time) simulations:
+
+    /* As in convert_a_to_b, a jump of more than one interval goes straight to
+       the right part of the table. The table is indexed by TAI, so the seek
+       uses the previous offset; the loops below correct for a leap across an
+       interval boundary. */
+    if(((ut1_time > next_when + (next_value / 86400.0)) || (ut1_time < prev_when + (prev_value / 86400.0))) &&
+       (last_index > 0))
+    {
+        seek_table(ut1_time - a_to_b_offset);
+    }
+
+    // for conventional (forward-time) simulations:
 
     /* "while" is used because updates need not be done regularly, may have to
         catch up with accumulation of points. */
@@ -27,6 +27,7 @@ LIBRARY DEPENDENCY:
    (time_tai.cc)
    (time_utc.cc)
    (time_converter.cc)
+   (time_converter__read_table_file.cc)
    (time_messages.cc)
    (utils/message/src/message_handler.cc)
    (utils/named_item/src/named_item.cc))
@@ -35,6 +36,7 @@ LIBRARY DEPENDENCY:
 ******************************************************************************/
 
 // System includes
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 
@@ -237,10 +239,8 @@ void TimeConverter_TAI_UTC::initialize_leap_second()
         /* Find the last entry that comes before the current time (trunc_julian_time)
            Highest value that can be reached is index = last_index -1
            because trunc_julian_time < leap_when(last_leap_index) by earlier test. */
-        for(index = 0; trunc_julian_time >= when_vec[index + 1]; ++index)
-        {
-            ;
-        }
+        const double * upper = std::upper_bound(when_vec, when_vec + last_index + 1, trunc_julian_time);
+        index = static_cast<int>(upper - when_vec) - 1;
         prev_when = when_vec[index];
         next_when = when_vec[index + 1];
         /* and take the number of leap seconds recorded in the previous entry (i.e.
@@ -461,6 +461,43 @@ void TimeConverter_TAI_UTC::verify_table_lookup_ends()
     }
 }
 
+/**
+ * Replace the leap second table with one read from a file, in place of (or
+ * after) the compiled-in default data. Each line of the file holds the UTC
+ * time of a change in the leap second count, in truncated Julian days, and
+ * the value of TAI-UTC, in whole seconds, from that time on.
+ * The file must be loaded before the converter is initialized.
+ *
+ * \par Assumptions and Limitations
+ *  - data/tai_to_utc.csv, written by data/parser.py, has the required format.
+ * \param[in] file_name Name of the table file
+ */
+void TimeConverter_TAI_UTC::load_table_file(const std::string & file_name)
+{
+    double * new_when_vec = nullptr;
+    double * file_val_vec = nullptr;
+    int new_last_index = read_table_file(file_name, new_when_vec, file_val_vec);
+    if(new_last_index < 0)
+    {
+        return;
+    }
+
+    int * new_val_vec = JEOD_ALLOC_PRIM_ARRAY(new_last_index + 1, int);
+    for(int ii = 0; ii <= new_last_index; ++ii)
+    {
+        new_val_vec[ii] = static_cast<int>(std::lround(file_val_vec[ii]));
+    }
+    JEOD_DELETE_ARRAY(file_val_vec);
+
+    JEOD_DELETE_ARRAY(when_vec);
+    JEOD_DELETE_ARRAY(val_vec);
+    when_vec = new_when_vec;
+    val_vec = new_val_vec;
+    last_index = new_last_index;
+    index = -1;
+    override_data_table = false;
+}
+
 /**
  * Destroy a TimeConverter_TAI_UTC
  */
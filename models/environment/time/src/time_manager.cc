@@ -403,9 +403,10 @@ void TimeManager::update(double current_simtime)
         // update all times that are to be updated with the manager
         //   These are ordered in some update hierarchy, such that if x updates
         //   from y, y appears in the ordered_update_list array first.
-        for(int ii = 0; ii < num_types; ++ii)
+        //   Lazily updated times are brought up to date when they are read.
+        for(auto time_ptr : eager_time_vector)
         {
-            time_vector[ii]->update();
+            time_ptr->update();
         }
     }
 
@@ -442,13 +443,29 @@ void TimeManager::update_time(double current_simtime)
         // update all times that are to be updated with the manager
         //   These are ordered in some update hierarchy, such that if x updates
         //   from y, y appears in the ordered_update_list array first.
-        for(int ii = 0; ii < num_types; ++ii)
+        //   Lazily updated times are brought up to date when they are read.
+        for(auto time_ptr : eager_time_vector)
         {
-            time_vector[ii]->update();
+            time_ptr->update();
         }
     }
 }
 
+/**
+ * Brings all lazily updated times up to date, typically at the rate at
+ * which they are logged.
+ *
+ * \par Assumptions and Limitations
+ *  - The TimeManager has been initialized.
+ */
+void TimeManager::update_lazy_times()
+{
+    for(auto time_ptr : time_vector)
+    {
+        time_ptr->ensure_updated();
+    }
+}
+
 /**
  * This function is called when the simulation reverses direction (in
  * time.  It calls each time converter that uses a table lookup to check
@@ -39,6 +39,7 @@ LIBRARY DEPENDENCY:
 #include <algorithm>
 #include <cstddef>
 #include <typeinfo>
+#include <vector>
 
 // JEOD includes
 #include "utils/memory/include/jeod_alloc.hh"
@@ -590,6 +591,47 @@ void TimeManagerInit::create_update_tree()
     }
 
     organize_update_list();
+    select_eager_times();
+}
+
+/**
+ * Selects the times that the time manager updates with every update, those
+ * not marked for lazy updates. A time from which such a time derives is
+ * updated with it, as is the dynamic time.
+ *
+ * \par Assumptions and Limitations
+ *  - The update list is in update order, parents before children.
+ */
+void TimeManagerInit::select_eager_times()
+{
+    std::vector<JeodBaseTime *> & time_vector = time_manager->time_vector;
+
+    time_manager->dyn_time.lazy_update = false;
+    for(auto iter = time_vector.rbegin(); iter != time_vector.rend(); ++iter)
+    {
+        JeodBaseTime * parent = (*iter)->links.parent();
+        if(!(*iter)->lazy_update && (parent != nullptr) && parent->lazy_update)
+        {
+            MessageHandler::debug(__FILE__,
+                                  __LINE__,
+                                  TimeMessages::invalid_setup_error,
+                                  "\n"
+                                  "Time (%s) is updated with every update, because time (%s)\n"
+                                  "derives from it.\n",
+                                  parent->name.c_str(),
+                                  (*iter)->name.c_str());
+            parent->lazy_update = false;
+        }
+    }
+
+    time_manager->eager_time_vector.clear();
+    for(auto time_ptr : time_vector)
+    {
+        if(!time_ptr->lazy_update)
+        {
+            time_manager->eager_time_vector.push_back(time_ptr);
+        }
+    }
 }
 
 /**
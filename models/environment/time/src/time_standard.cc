@@ -351,6 +351,7 @@ void TimeStandard::calendar_update(double simtime)
         {
             time_manager->update(simtime);
         }
+        ensure_updated();
         last_calendar_update = simtime;
         calculate_calendar_values();
     }
@@ -678,6 +679,7 @@ void TimeStandard::initialize_from_parent(TimeManagerInit * time_manager_init)
  */
 double TimeStandard::seconds_of_year()
 {
+    ensure_updated();
     if(!Numerical::compare_exact(last_calendar_update, time_manager->simtime))
     {
         calculate_calendar_values();
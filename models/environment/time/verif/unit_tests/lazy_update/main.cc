@@ -0,0 +1,229 @@
+// Step a full time model with every time updated with each time manager
+// update, and again with all but TAI updated lazily and brought up to date
+// only at the logging rate, and check that the two agree whenever the lazy
+// times are brought up to date.
+// System includes
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "environment/time/data/include/tai_to_ut1.hh"
+#include "environment/time/data/include/tai_to_utc.hh"
+#include "environment/time/include/time_converter_dyn_tai.hh"
+#include "environment/time/include/time_converter_std_ude.hh"
+#include "environment/time/include/time_converter_tai_gps.hh"
+#include "environment/time/include/time_converter_tai_tdb.hh"
+#include "environment/time/include/time_converter_tai_tt.hh"
+#include "environment/time/include/time_converter_tai_ut1.hh"
+#include "environment/time/include/time_converter_tai_utc.hh"
+#include "environment/time/include/time_converter_ut1_gmst.hh"
+#include "environment/time/include/time_gmst.hh"
+#include "environment/time/include/time_gps.hh"
+#include "environment/time/include/time_manager.hh"
+#include "environment/time/include/time_manager_init.hh"
+#include "environment/time/include/time_met.hh"
+#include "environment/time/include/time_tai.hh"
+#include "environment/time/include/time_tdb.hh"
+#include "environment/time/include/time_tt.hh"
+#include "environment/time/include/time_ut1.hh"
+#include "environment/time/include/time_utc.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+
+using namespace std;
+using namespace jeod;
+
+/**
+ * The time model of the JEOD all-inclusive time S-module.
+ */
+struct TimeModel
+{
+    TimeManager time_manager;
+    TimeManagerInit time_manager_init;
+    TimeTAI time_tai;
+    TimeConverter_Dyn_TAI time_converter_dyn_tai;
+    TimeUTC time_utc;
+    TimeConverter_TAI_UTC time_converter_tai_utc;
+    TimeUT1 time_ut1;
+    TimeConverter_TAI_UT1 time_converter_tai_ut1;
+    TimeTT time_tt;
+    TimeConverter_TAI_TT time_converter_tai_tt;
+    TimeTDB time_tdb;
+    TimeConverter_TAI_TDB time_converter_tai_tdb;
+    TimeGMST time_gmst;
+    TimeConverter_UT1_GMST time_converter_ut1_gmst;
+    TimeGPS time_gps;
+    TimeConverter_TAI_GPS time_converter_tai_gps;
+    TimeMET time_met_veh1;
+    TimeConverter_STD_UDE time_converter_tai_met_veh1;
+    TimeMET time_met_veh2;
+    TimeConverter_STD_UDE time_converter_tai_met_veh2;
+
+    explicit TimeModel(bool lazy)
+    {
+        TimeConverter_TAI_UTC_tai_to_utc_default_data utc_data;
+        TimeConverter_TAI_UT1_tai_to_ut1_default_data ut1_data;
+        utc_data.initialize(&time_converter_tai_utc);
+        ut1_data.initialize(&time_converter_tai_ut1);
+
+        time_manager.register_time(time_tai);
+        time_manager.register_converter(time_converter_dyn_tai);
+        time_manager.register_time(time_utc);
+        time_manager.register_converter(time_converter_tai_utc);
+        time_manager.register_time(time_ut1);
+        time_manager.register_converter(time_converter_tai_ut1);
+        time_manager.register_time(time_tt);
+        time_manager.register_converter(time_converter_tai_tt);
+        time_manager.register_time(time_tdb);
+        time_manager.register_converter(time_converter_tai_tdb);
+        time_manager.register_time(time_gmst);
+        time_manager.register_converter(time_converter_ut1_gmst);
+        time_manager.register_time(time_gps);
+        time_manager.register_converter(time_converter_tai_gps);
+        time_manager.register_time_named(time_met_veh1, "met_veh1");
+        time_manager.register_converter(time_converter_tai_met_veh1, "TAI", "met_veh1");
+        time_manager.register_time_named(time_met_veh2, "met_veh2");
+        time_manager.register_converter(time_converter_tai_met_veh2, "TAI", "met_veh2");
+
+        time_manager_init.initializer = "TAI";
+        time_manager_init.sim_start_format = TimeEnum::truncated_julian;
+        time_tai.initializing_value = 17000.25;
+        time_tai.update_from_name = "Dyn";
+        for(JeodBaseTime * time : times())
+        {
+            if(time != &time_tai)
+            {
+                time->initialize_from_name = "TAI";
+                time->update_from_name = "TAI";
+                time->lazy_update = lazy;
+            }
+        }
+        time_gmst.initialize_from_name = "UT1";
+        time_gmst.update_from_name = "UT1";
+        time_met_veh1.initialize_from_name = "";
+        time_met_veh1.initial_value_format = TimeEnum::seconds_since_epoch;
+        time_met_veh1.initializing_value = 50.0;
+        time_met_veh2.initialize_from_name = "";
+        time_met_veh2.initial_value_format = TimeEnum::seconds_since_epoch;
+        time_met_veh2.initializing_value = -5.0;
+
+        time_manager.initialize(&time_manager_init);
+    }
+
+    vector<JeodBaseTime *> times()
+    {
+        return {&time_tai,
+                &time_utc,
+                &time_ut1,
+                &time_tt,
+                &time_tdb,
+                &time_gmst,
+                &time_gps,
+                &time_met_veh1,
+                &time_met_veh2};
+    }
+};
+
+/**
+ * Step a time model, bringing its lazy times up to date every log_interval
+ * steps, and return the time per step in nanoseconds.
+ */
+static double step_model(TimeModel & model, int num_steps, int log_interval, double step_size)
+{
+    auto start = chrono::steady_clock::now();
+    for(int step = 1; step <= num_steps; ++step)
+    {
+        model.time_manager.update(step * step_size);
+        if(step % log_interval == 0)
+        {
+            model.time_manager.update_lazy_times();
+        }
+    }
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(stop - start).count() / num_steps;
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_steps;
+    int log_interval;
+    double step_size;
+
+    cmdline_parser.add_int("NumSteps", 100000, &num_steps);
+    cmdline_parser.add_int("LogInterval", 100, &log_interval);
+    cmdline_parser.add_double("StepSize", 1.0e-3, &step_size);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_steps <= 0 || log_interval <= 0)
+    {
+        cerr << "NumSteps and LogInterval must be positive." << endl;
+        return 1;
+    }
+
+    TimeModel eager_model(false);
+    TimeModel lazy_model(true);
+
+    double eager_ns = step_model(eager_model, num_steps, log_interval, step_size);
+    double lazy_ns = step_model(lazy_model, num_steps, log_interval, step_size);
+
+    cout << "Steps: " << num_steps << ", log interval: " << log_interval << endl;
+    cout << fixed << setprecision(1) << "Eager: " << eager_ns << " ns/update" << endl;
+    cout << "Lazy:  " << lazy_ns << " ns/update" << endl;
+    cout.unsetf(ios::floatfield);
+
+    // Step the two models together and compare them at each log point.
+    int num_mismatches = 0;
+    vector<JeodBaseTime *> eager_times = eager_model.times();
+    vector<JeodBaseTime *> lazy_times = lazy_model.times();
+    for(int step = num_steps + 1; step <= num_steps + 10 * log_interval; ++step)
+    {
+        eager_model.time_manager.update(step * step_size);
+        lazy_model.time_manager.update(step * step_size);
+        if(step % log_interval != 0)
+        {
+            continue;
+        }
+        lazy_model.time_manager.update_lazy_times();
+        eager_model.time_utc.calendar_update(step * step_size);
+        lazy_model.time_utc.calendar_update(step * step_size);
+        for(unsigned int ii = 0; ii < eager_times.size(); ++ii)
+        {
+            if(eager_times[ii]->seconds != lazy_times[ii]->seconds)
+            {
+                cout << "Mismatch in " << eager_times[ii]->name.c_str() << " at step " << step << endl;
+                ++num_mismatches;
+            }
+        }
+        if(eager_model.time_utc.calendar_second != lazy_model.time_utc.calendar_second ||
+           eager_model.time_utc.calendar_day != lazy_model.time_utc.calendar_day)
+        {
+            cout << "Mismatch in UTC calendar at step " << step << endl;
+            ++num_mismatches;
+        }
+    }
+
+    // A calendar update brings a lazy time up to date by itself.
+    double simtime = (num_steps + 10 * log_interval + 1) * step_size;
+    eager_model.time_manager.update(simtime);
+    lazy_model.time_manager.update(simtime);
+    eager_model.time_utc.calendar_update(simtime);
+    lazy_model.time_utc.calendar_update(simtime);
+    if(eager_model.time_utc.seconds != lazy_model.time_utc.seconds)
+    {
+        cout << "Mismatch in UTC after a calendar update" << endl;
+        ++num_mismatches;
+    }
+
+    if(num_mismatches != 0)
+    {
+        cout << num_mismatches << " mismatches" << endl;
+        return 1;
+    }
+    cout << "Lazy and eager times agree" << endl;
+    return 0;
+}
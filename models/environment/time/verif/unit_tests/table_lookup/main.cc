@@ -0,0 +1,231 @@
+// Exercise the TAI to UT1 and TAI to UTC table lookups with large time jumps
+// and random start epochs, against a brute-force scan of the same tables, and
+// check that tables loaded from the data files match the compiled-in tables.
+// System includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "environment/time/data/include/tai_to_ut1.hh"
+#include "environment/time/data/include/tai_to_utc.hh"
+#include "environment/time/include/time_converter_dyn_tai.hh"
+#include "environment/time/include/time_converter_tai_ut1.hh"
+#include "environment/time/include/time_converter_tai_utc.hh"
+#include "environment/time/include/time_manager.hh"
+#include "environment/time/include/time_manager_init.hh"
+#include "environment/time/include/time_tai.hh"
+#include "environment/time/include/time_ut1.hh"
+#include "environment/time/include/time_utc.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+
+using namespace std;
+using namespace jeod;
+
+/**
+ * A complete TAI / UT1 / UTC time model, as set up by the JEOD time S-module.
+ */
+struct TimeModel
+{
+    TimeManager time_manager;
+    TimeManagerInit time_manager_init;
+    TimeTAI time_tai;
+    TimeConverter_Dyn_TAI time_converter_dyn_tai;
+    TimeUTC time_utc;
+    TimeConverter_TAI_UTC time_converter_tai_utc;
+    TimeUT1 time_ut1;
+    TimeConverter_TAI_UT1 time_converter_tai_ut1;
+
+    TimeModel(double start_tjt, const string & table_dir)
+    {
+        if(table_dir.empty())
+        {
+            TimeConverter_TAI_UTC_tai_to_utc_default_data utc_data;
+            TimeConverter_TAI_UT1_tai_to_ut1_default_data ut1_data;
+            utc_data.initialize(&time_converter_tai_utc);
+            ut1_data.initialize(&time_converter_tai_ut1);
+        }
+        else
+        {
+            time_converter_tai_utc.load_table_file(table_dir + "/tai_to_utc.csv");
+            time_converter_tai_ut1.load_table_file(table_dir + "/tai_to_ut1.csv");
+        }
+
+        time_manager.register_time(time_tai);
+        time_manager.register_converter(time_converter_dyn_tai);
+        time_manager.register_time(time_utc);
+        time_manager.register_converter(time_converter_tai_utc);
+        time_manager.register_time(time_ut1);
+        time_manager.register_converter(time_converter_tai_ut1);
+
+        time_manager_init.initializer = "TAI";
+        time_manager_init.sim_start_format = TimeEnum::truncated_julian;
+        time_tai.initializing_value = start_tjt;
+        time_tai.update_from_name = "Dyn";
+        time_utc.initialize_from_name = "TAI";
+        time_utc.update_from_name = "TAI";
+        time_ut1.initialize_from_name = "TAI";
+        time_ut1.update_from_name = "TAI";
+
+        time_manager.initialize(&time_manager_init);
+    }
+};
+
+/**
+ * Reference UT1-TAI, in seconds, by linear scan and interpolation.
+ */
+static double reference_ut1(const TimeConverter_TAI_UT1 & conv, double tai_tjt)
+{
+    int ii = 0;
+    while(tai_tjt >= conv.when_vec[ii + 1])
+    {
+        ++ii;
+    }
+    double gradient = (conv.val_vec[ii + 1] - conv.val_vec[ii]) / (conv.when_vec[ii + 1] - conv.when_vec[ii]);
+    return conv.val_vec[ii] + (tai_tjt - conv.when_vec[ii]) * gradient;
+}
+
+/**
+ * Reference TAI-UTC, in seconds, by linear scan.
+ */
+static double reference_utc(const TimeConverter_TAI_UTC & conv, double utc_tjt)
+{
+    int ii = 0;
+    while((ii < conv.last_index) && (utc_tjt >= conv.when_vec[ii + 1]))
+    {
+        ++ii;
+    }
+    return conv.val_vec[ii];
+}
+
+static void make_times(unsigned int num_times, double start, double stop, vector<double> & times)
+{
+    unsigned long seed = 12345;
+    times.resize(num_times);
+    for(unsigned int ii = 0; ii < num_times; ++ii)
+    {
+        seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+        times[ii] = start + (stop - start) * static_cast<double>(seed) / 2147483648.0;
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_jumps;
+    int num_epochs;
+    double tolerance;
+
+    cmdline_parser.add_int("NumJumps", 20000, &num_jumps);
+    cmdline_parser.add_int("NumEpochs", 200, &num_epochs);
+    cmdline_parser.add_double("Tolerance", 1.0e-9, &tolerance);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_jumps <= 0 || num_epochs <= 0)
+    {
+        cerr << "NumJumps and NumEpochs must be positive." << endl;
+        return 1;
+    }
+
+    const char * jeod_home = getenv("JEOD_HOME");
+    string table_dir = (jeod_home != nullptr) ? string(jeod_home) + "/models/environment/time/data" : "../../../data";
+
+    // Both tables cover 1972 (the first leap second entry) to the start of 2025.
+    const double first_tjt = 1320.0;
+    const double last_tjt = 20680.0;
+    int rv = 0;
+
+    // Forward jumps of random size from the start of the tables.
+    vector<double> jumps;
+    make_times(static_cast<unsigned int>(num_jumps), first_tjt, last_tjt, jumps);
+    std::sort(jumps.begin(), jumps.end());
+
+    vector<double> ut1_offsets[2];
+    vector<double> utc_offsets[2];
+    for(unsigned int source = 0; source < 2; ++source)
+    {
+        TimeModel model(first_tjt, (source == 0) ? "" : table_dir);
+        double max_ut1_err = 0.0;
+        double max_utc_err = 0.0;
+
+        vector<double> tai_times;
+        vector<double> utc_times;
+        auto start = chrono::steady_clock::now();
+        for(double tjt : jumps)
+        {
+            model.time_manager.update((tjt - first_tjt) * 86400.0);
+            ut1_offsets[source].push_back(model.time_converter_tai_ut1.get_a_to_b_offset());
+            utc_offsets[source].push_back(model.time_converter_tai_utc.get_a_to_b_offset());
+            tai_times.push_back(model.time_tai.trunc_julian_time);
+            utc_times.push_back(model.time_utc.trunc_julian_time);
+        }
+        auto stop = chrono::steady_clock::now();
+
+        for(unsigned int ii = 0; ii < jumps.size(); ++ii)
+        {
+            double ut1_err = fabs(ut1_offsets[source][ii] * 86400.0 -
+                                  reference_ut1(model.time_converter_tai_ut1, tai_times[ii]));
+            double utc_err = fabs(-utc_offsets[source][ii] * 86400.0 -
+                                  reference_utc(model.time_converter_tai_utc, utc_times[ii]));
+            max_ut1_err = ut1_err > max_ut1_err ? ut1_err : max_ut1_err;
+            max_utc_err = utc_err > max_utc_err ? utc_err : max_utc_err;
+        }
+
+        cout << ((source == 0) ? "Compiled tables" : "Table files    ") << ": " << jumps.size() << " jumps, "
+             << fixed << setprecision(1) << chrono::duration<double, nano>(stop - start).count() / jumps.size()
+             << " ns/update, max UT1 error " << scientific << setprecision(2) << max_ut1_err
+             << " s, max UTC error " << max_utc_err << " s" << endl;
+        cout.unsetf(ios::floatfield);
+
+        if((max_ut1_err > tolerance) || (max_utc_err > tolerance))
+        {
+            cout << "Failed tolerance " << tolerance << endl;
+            rv = 1;
+        }
+    }
+
+    if((ut1_offsets[0] != ut1_offsets[1]) || (utc_offsets[0] != utc_offsets[1]))
+    {
+        cout << "Table files do not reproduce the compiled-in tables" << endl;
+        rv = 1;
+    }
+    else
+    {
+        cout << "Table files reproduce the compiled-in tables" << endl;
+    }
+
+    // Initialization at random epochs, as in a Monte Carlo set, before the
+    // last leap second in the table (2017).
+    vector<double> epochs;
+    make_times(static_cast<unsigned int>(num_epochs), first_tjt, 17750.0, epochs);
+    double init_ns = 0.0;
+    double max_init_err = 0.0;
+    for(double tjt : epochs)
+    {
+        auto start = chrono::steady_clock::now();
+        TimeModel model(tjt, "");
+        auto stop = chrono::steady_clock::now();
+        init_ns += chrono::duration<double, nano>(stop - start).count();
+
+        double err = fabs(model.time_converter_tai_ut1.get_a_to_b_offset() * 86400.0 -
+                          reference_ut1(model.time_converter_tai_ut1, model.time_tai.trunc_julian_time));
+        max_init_err = err > max_init_err ? err : max_init_err;
+    }
+    cout << "Random epochs  : " << epochs.size() << " initializations, " << fixed << setprecision(1)
+         << init_ns / epochs.size() / 1000.0 << " us/initialization, max UT1 error " << scientific
+         << setprecision(2) << max_init_err << " s" << endl;
+
+    if(max_init_err > tolerance)
+    {
+        cout << "Failed tolerance " << tolerance << " at initialization" << endl;
+        rv = 1;
+    }
+
+    return rv;
+}
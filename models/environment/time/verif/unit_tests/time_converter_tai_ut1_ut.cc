@@ -25,3 +25,9 @@ TEST(TimeConverter_TAI_UT1, convert_a_to_b) {}
 TEST(TimeConverter_TAI_UT1, convert_b_to_a) {}
 
 TEST(TimeConverter_TAI_UT1, verify_table_lookup_ends) {}
+
+TEST(TimeConverter_TAI_UT1, load_table_file) {}
+
+TEST(TimeConverter_TAI_UT1, find_table_index) {}
+
+TEST(TimeConverter_TAI_UT1, seek_table) {}
@@ -25,3 +25,5 @@ TEST(TimeConverter_TAI_UTC, convert_a_to_b) {}
 TEST(TimeConverter_TAI_UTC, convert_b_to_a) {}
 
 TEST(TimeConverter_TAI_UTC, verify_table_lookup_ends) {}
+
+TEST(TimeConverter_TAI_UTC, load_table_file) {}
@@ -34,6 +34,8 @@ TEST(TimeManagerInit, create_update_tree) {}
 
 TEST(TimeManagerInit, organize_update_list) {}
 
+TEST(TimeManagerInit, select_eager_times) {}
+
 TEST(TimeManagerInit, get_conv_ptr_index) {}
 
 TEST(TimeManagerInit, get_conv_dir_init) {}
@@ -49,4 +49,6 @@ TEST(TimeManager, update) {}
 
 TEST(TimeManager, update_time) {}
 
+TEST(TimeManager, update_lazy_times) {}
+
 TEST(TimeManager, verify_table_lookup_ends) {}
@@ -19,6 +19,8 @@ TEST(JeodBaseTime, must_be_singleton) {}
 
 TEST(JeodBaseTime, update) {}
 
+TEST(JeodBaseTime, ensure_updated) {}
+
 TEST(JeodBaseTime, set_time_by_seconds) {}
 
 TEST(JeodBaseTime, set_time_by_days) {}
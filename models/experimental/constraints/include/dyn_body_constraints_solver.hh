@@ -342,6 +342,21 @@ private:
      */
     double root_to_this_offset[3]{}; //!< trick_units(m)
 
+    /**
+     * The active constraints at the last solve.
+     */
+    ConstraintsVectorT solved_constraints; //!< trick_io(**)
+
+    /**
+     * The vehicle's inverse mass at the last solve.
+     */
+    double solved_inverse_mass{}; //!< trick_units(1/kg)
+
+    /**
+     * The vehicle's inverse inertia tensor at the last solve.
+     */
+    double solved_inverse_inertia[3][3]{}; //!< trick_units(1/kg/m2)
+
     // Member functions.
 
     /**
@@ -443,6 +458,13 @@ private:
 
     // Functions that implement solve().
 
+    /**
+     * Tell the linear system solver if the set of active constraints or the
+     * vehicle's mass properties have changed since the last solve.
+     * @param vehicle_properties  Properites of the vehicle
+     */
+    void check_for_system_change(const VehicleProperties & vehicle_properties);
+
     /**
      * Updates the vehicle's response to sn accumulated wrench.
      * @param sum  The accumulated value of the calls to get_wrench.
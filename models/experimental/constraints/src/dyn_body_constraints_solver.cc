@@ -460,6 +460,7 @@ void DynBodyConstraintsSolver::solve(const VehicleProperties & vehicle_propertie
     }
 
     // Build the constraints system of equations.
+    check_for_system_change(vehicle_properties);
     constraint_indices.clear();
     constraint_indices.reserve(n_constraints);
     build_system_of_equations(vehicle_properties, non_grav_state, n_constraints, constraint_indices);
@@ -493,6 +494,29 @@ void DynBodyConstraintsSolver::solve(const VehicleProperties & vehicle_propertie
     }
 }
 
+// Tell the solver when the form of the system of equations has changed.
+void DynBodyConstraintsSolver::check_for_system_change(const VehicleProperties & vehicle_properties)
+{
+    double inverse_mass = vehicle_properties.get_inverse_mass();
+    SolverTypes::ConstMatrix3x3RefT inverse_inertia = vehicle_properties.get_inverse_inertia();
+    bool changed = (active_constraints != solved_constraints) || (inverse_mass != solved_inverse_mass);
+    for(unsigned ii = 0; ii < 3; ++ii)
+    {
+        for(unsigned jj = 0; jj < 3; ++jj)
+        {
+            changed = changed || (inverse_inertia[ii][jj] != solved_inverse_inertia[ii][jj]);
+        }
+    }
+
+    if(changed)
+    {
+        solver->system_changed();
+        solved_constraints = active_constraints;
+        solved_inverse_mass = inverse_mass;
+        Matrix3x3::copy(inverse_inertia, solved_inverse_inertia);
+    }
+}
+
 // Construct A and b in the system of equations A*x=b, where
 //  - A is the matrix of partial derivatives, dx_i/dx_j,
 //  - x is the vector of constraint values (not referenced here), and
@@ -543,7 +567,7 @@ void DynBodyConstraintsSolver::build_system_of_equations(const VehicleProperties
             constraint_ii.set_self_coeff(vehicle_properties, solver->make_a_matrix_view(range_ii, range_ii));
 
             // Set the elements of the A matrix for this constraint vs others.
-            for(unsigned jj = 0; jj < n_dims; ++jj)
+            for(unsigned jj = 0; jj < n_constraints; ++jj)
             {
                 if(jj != ii)
                 {
@@ -0,0 +1,274 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2025 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Experimental
+ * @{
+ * @addtogroup ExpMath
+ * @{
+ *
+ * @file
+ * Defines the class LDLTSolver.
+ */
+
+/*
+Purpose: ()
+Library dependencies: ((../src/ldlt_solver.cc))
+*/
+
+#ifndef JEOD_LDLT_SOLVER_HH
+#define JEOD_LDLT_SOLVER_HH
+
+#include "gauss_jordan_solver.hh"
+#include "two_d_array.hh"
+
+#include "utils/container/include/primitive_vector.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/sim_interface/include/jeod_class.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+/**
+ * Solves a linear system of equations A*x = b in which A is a symmetric
+ * positive definite matrix with its rows scaled by positive factors, as is
+ * the constraints matrix I + diag(m)*K. The row scaling is recovered from A,
+ * the symmetric matrix is factored as L*D*L^T, and the factorization is kept
+ * for later solves:
+ *  - If A is unchanged, only the triangular solves are made.
+ *  - If A has changed, the saved factorization is used to iteratively refine
+ *    the solution. A new factorization is made only if the refinement fails
+ *    to converge, if the dimensionality changes, or after system_changed().
+ *
+ * Systems that are not scaled symmetric positive definite are solved by
+ * Gauss-Jordan elimination.
+ */
+class LDLTSolver : public GaussJordanSolver
+{
+    JEOD_MAKE_SIM_INTERFACES(jeod, LDLTSolver)
+
+public:
+    /**
+     * Vector of doubles.
+     */
+    using DoubleVectorT = LinearSystemSolver::DoubleVectorT;
+
+    // Member functions
+
+    /**
+     * Default constructor.
+     */
+    LDLTSolver()
+    {
+        JEOD_REGISTER_CLASS(LDLTSolver);
+    }
+
+    /**
+     * Destructor.
+     */
+    ~LDLTSolver() override = default;
+
+    LDLTSolver(const LDLTSolver &) = delete;
+    LDLTSolver & operator=(const LDLTSolver &) = delete;
+
+    /**
+     * Set the maximum dimensionality of the problem.
+     */
+    void set_max_dimensions(unsigned max_dims_in) override
+    {
+        GaussJordanSolver::set_max_dimensions(max_dims_in);
+        factored_a.reserve(max_dims * max_dims);
+        factor.reserve(max_dims * max_dims);
+        row_scale.reserve(max_dims);
+        link_strength.reserve(max_dims);
+        link_row.reserve(max_dims);
+        residual.reserve(max_dims);
+        correction.reserve(max_dims);
+    }
+
+    /**
+     * Solve for x in A*x = b.
+     */
+    unsigned solve(DoubleVectorT & x) override;
+
+    /**
+     * Discard the saved factorization.
+     */
+    void system_changed() override
+    {
+        factor_valid = false;
+        use_gauss_jordan = false;
+    }
+
+    /**
+     * Get the number of factorizations made.
+     * @return Number of factorizations.
+     */
+    unsigned get_num_factorizations() const
+    {
+        return num_factorizations;
+    }
+
+    /**
+     * Get the number of solves made by refining with an older factorization.
+     * @return Number of refined solves.
+     */
+    unsigned get_num_refined_solves() const
+    {
+        return num_refined_solves;
+    }
+
+    // Member data
+
+    /**
+     * Maximum number of refinement iterations made with a saved
+     * factorization of an earlier A matrix. Fewer are made if the
+     * iterations would cost more than a new factorization, or if they are
+     * converging too slowly. Zero makes a new factorization whenever A
+     * changes.
+     */
+    unsigned max_refinement_iterations{6}; //!< trick_units(--)
+
+    /**
+     * Relative residual, |b - A*x| / (|b| + |A|*|x|) in the infinity norm, at
+     * which refinement stops.
+     */
+    double refinement_tolerance{1e-13}; //!< trick_units(--)
+
+    /**
+     * Relative tolerance on the asymmetry of the row-scaled A matrix.
+     */
+    double symmetry_tolerance{1e-10}; //!< trick_units(--)
+
+protected:
+    /**
+     * Factor the current A matrix.
+     * @return True if A is scaled symmetric positive definite.
+     */
+    bool factorize();
+
+    /**
+     * Solve using the saved factorization.
+     * @param rhs  Right hand side.
+     * @param soln  Solution.
+     */
+    void back_substitute(const DoubleVectorT & rhs, DoubleVectorT & soln) const;
+
+    /**
+     * Refine a solution using the saved factorization.
+     * @param x  Solution, refined in place.
+     * @return True if the refined solution meets the refinement tolerance.
+     */
+    bool refine(DoubleVectorT & x);
+
+    /**
+     * The A matrix that was factored.
+     */
+    TwoDArray factored_a; //!< trick_io(**)
+
+    /**
+     * The factorization: the unit lower triangle of L below the diagonal
+     * and D on the diagonal.
+     */
+    TwoDArray factor; //!< trick_io(**)
+
+    /**
+     * Factors by which the rows of the factored A matrix were multiplied
+     * to make it symmetric.
+     */
+    DoubleVectorT row_scale; //!< trick_io(**)
+
+    /**
+     * Work vector, the strength of the strongest coupling of each row to
+     * a row whose scale factor has been found.
+     */
+    DoubleVectorT link_strength; //!< trick_io(**)
+
+    /**
+     * Work vector, the row that provides that coupling.
+     */
+    UnsignedVectorT link_row; //!< trick_io(**)
+
+    /**
+     * Work vector, b - A*x.
+     */
+    DoubleVectorT residual; //!< trick_io(**)
+
+    /**
+     * Work vector, the correction to x.
+     */
+    DoubleVectorT correction; //!< trick_io(**)
+
+    /**
+     * The dimensionality of the factored A matrix.
+     */
+    unsigned factored_dims{}; //!< trick_io(**)
+
+    /**
+     * Flag indicating that the factorization describes factored_a.
+     */
+    bool factor_valid{}; //!< trick_io(**)
+
+    /**
+     * Flag indicating that the factored A matrix was not scaled symmetric
+     * positive definite, so that Gauss-Jordan elimination is used until the
+     * system changes.
+     */
+    bool use_gauss_jordan{}; //!< trick_io(**)
+
+    /**
+     * Number of factorizations made.
+     */
+    unsigned num_factorizations{}; //!< trick_units(--)
+
+    /**
+     * Number of solves made by refining with an older factorization.
+     */
+    unsigned num_refined_solves{}; //!< trick_units(--)
+};
+
+} // namespace jeod
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
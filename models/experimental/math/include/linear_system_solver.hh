@@ -180,6 +180,13 @@ public:
      */
     virtual unsigned solve(DoubleVectorT & x) = 0;
 
+    /**
+     * Notify the solver that the system of equations has changed in form,
+     * as opposed to a change in the values of A and b. Solvers that keep
+     * information from one solve to the next discard it.
+     */
+    virtual void system_changed() {}
+
     // The copy constructor and copy assignment operator are not implemented
     // to avoid erroneous copies.
     LinearSystemSolver(const LinearSystemSolver &) = delete;
@@ -2,6 +2,7 @@ set(SUBDIR ${CMAKE_CURRENT_LIST_DIR})
 
 set(SRCS
 gauss_jordan_solver.cc
+ldlt_solver.cc
 )
 
 foreach(SRC ${SRCS})
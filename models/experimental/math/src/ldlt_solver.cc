@@ -0,0 +1,313 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Experimental
+ * @{
+ * @addtogroup ExpMath
+ * @{
+ *
+ * @file
+ * Implement class LDLTSolver.
+ */
+
+/*
+Purpose: ()
+*/
+
+#include "../include/ldlt_solver.hh"
+
+#include <algorithm>
+#include <cmath>
+
+//! Namespace jeod
+namespace jeod
+{
+
+unsigned LDLTSolver::solve(DoubleVectorT & x)
+{
+    if(n_dimensions != factored_dims)
+    {
+        system_changed();
+    }
+    if(use_gauss_jordan)
+    {
+        return GaussJordanSolver::solve(x);
+    }
+
+    x.resize(n_dimensions);
+    if(factor_valid)
+    {
+        // Reuse the factorization outright if A has not changed.
+        bool unchanged = true;
+        for(unsigned ii = 0; unchanged && (ii < n_dimensions); ++ii)
+        {
+            for(unsigned jj = 0; jj < n_dimensions; ++jj)
+            {
+                if(a_matrix(ii, jj) != factored_a(ii, jj))
+                {
+                    unchanged = false;
+                    break;
+                }
+            }
+        }
+        if(unchanged)
+        {
+            back_substitute(b_vector, x);
+            return n_dimensions;
+        }
+
+        // Otherwise try to refine the solution with the old factorization.
+        if(max_refinement_iterations > 0)
+        {
+            back_substitute(b_vector, x);
+            if(refine(x))
+            {
+                ++num_refined_solves;
+                return n_dimensions;
+            }
+        }
+    }
+
+    if(!factorize())
+    {
+        use_gauss_jordan = true;
+        return GaussJordanSolver::solve(x);
+    }
+    back_substitute(b_vector, x);
+    return n_dimensions;
+}
+
+bool LDLTSolver::factorize()
+{
+    unsigned n_dims = n_dimensions;
+    factored_dims = n_dims;
+    factor_valid = false;
+    factored_a.resize(n_dims, n_dims);
+    factor.resize(n_dims, n_dims);
+    row_scale.resize(n_dims);
+    link_strength.resize(n_dims);
+    link_row.resize(n_dims);
+    correction.resize(n_dims);
+
+    for(unsigned ii = 0; ii < n_dims; ++ii)
+    {
+        if(!(a_matrix(ii, ii) > 0.0))
+        {
+            return false;
+        }
+        for(unsigned jj = 0; jj < n_dims; ++jj)
+        {
+            factored_a(ii, jj) = a_matrix(ii, jj);
+        }
+        row_scale[ii] = 0.0;
+        link_strength[ii] = 0.0;
+    }
+
+    // Find the row scale factors. Scaled rows i and j are symmetric if
+    // scale_j = scale_i * A(i,j) / A(j,i). The factors are propagated along
+    // the strongest couplings, A(i,j)*A(j,i) / (A(i,i)*A(j,j)), so that
+    // weak couplings, whose values are mostly roundoff, are not used.
+    // Groups of rows that are not coupled are scaled to a unit diagonal.
+    double min_link = symmetry_tolerance * symmetry_tolerance;
+    for(unsigned n_scaled = 0; n_scaled < n_dims; ++n_scaled)
+    {
+        unsigned next = n_dims;
+        double best = min_link;
+        unsigned first_unscaled = n_dims;
+        for(unsigned jj = 0; jj < n_dims; ++jj)
+        {
+            if(row_scale[jj] == 0.0)
+            {
+                first_unscaled = std::min(first_unscaled, jj);
+                if(link_strength[jj] > best)
+                {
+                    best = link_strength[jj];
+                    next = jj;
+                }
+            }
+        }
+        if(next == n_dims)
+        {
+            next = first_unscaled;
+            row_scale[next] = 1.0 / a_matrix(next, next);
+        }
+        else
+        {
+            unsigned prev = link_row[next];
+            row_scale[next] = row_scale[prev] * a_matrix(prev, next) / a_matrix(next, prev);
+            if(!(row_scale[next] > 0.0))
+            {
+                return false;
+            }
+        }
+
+        for(unsigned jj = 0; jj < n_dims; ++jj)
+        {
+            if(row_scale[jj] == 0.0)
+            {
+                double link = std::fabs(a_matrix(next, jj) * a_matrix(jj, next)) /
+                              (a_matrix(next, next) * a_matrix(jj, jj));
+                if(link > link_strength[jj])
+                {
+                    link_strength[jj] = link;
+                    link_row[jj] = next;
+                }
+            }
+        }
+    }
+
+    // Form the lower triangle of the scaled matrix, checking its symmetry.
+    for(unsigned ii = 0; ii < n_dims; ++ii)
+    {
+        factor(ii, ii) = row_scale[ii] * a_matrix(ii, ii);
+        for(unsigned jj = 0; jj < ii; ++jj)
+        {
+            double s_ij = row_scale[ii] * a_matrix(ii, jj);
+            double s_ji = row_scale[jj] * a_matrix(jj, ii);
+            if(std::fabs(s_ij - s_ji) > symmetry_tolerance * std::sqrt(factor(ii, ii) * factor(jj, jj)))
+            {
+                return false;
+            }
+            factor(ii, jj) = 0.5 * (s_ij + s_ji);
+        }
+    }
+
+    // Factor it as L*D*L^T, row by row. correction[kk] holds L(ii,kk)*D(kk).
+    for(unsigned ii = 0; ii < n_dims; ++ii)
+    {
+        for(unsigned jj = 0; jj < ii; ++jj)
+        {
+            double sum = factor(ii, jj);
+            for(unsigned kk = 0; kk < jj; ++kk)
+            {
+                sum -= correction[kk] * factor(jj, kk);
+            }
+            correction[jj] = sum;
+            factor(ii, jj) = sum / factor(jj, jj);
+        }
+        double diag = factor(ii, ii);
+        double pivot_floor = 1e-14 * diag;
+        for(unsigned kk = 0; kk < ii; ++kk)
+        {
+            diag -= correction[kk] * factor(ii, kk);
+        }
+        if(!(diag > pivot_floor))
+        {
+            return false;
+        }
+        factor(ii, ii) = diag;
+    }
+
+    factor_valid = true;
+    ++num_factorizations;
+    return true;
+}
+
+void LDLTSolver::back_substitute(const DoubleVectorT & rhs, DoubleVectorT & soln) const
+{
+    unsigned n_dims = factored_dims;
+
+    // Solve L*y = S*b, where S scales the rows.
+    for(unsigned ii = 0; ii < n_dims; ++ii)
+    {
+        double sum = row_scale[ii] * rhs[ii];
+        for(unsigned kk = 0; kk < ii; ++kk)
+        {
+            sum -= factor(ii, kk) * soln[kk];
+        }
+        soln[ii] = sum;
+    }
+
+    // Solve D*z = y.
+    for(unsigned ii = 0; ii < n_dims; ++ii)
+    {
+        soln[ii] /= factor(ii, ii);
+    }
+
+    // Solve L^T*x = z, a column of L^T (a row of L) at a time.
+    for(unsigned ii = n_dims; ii-- > 0;)
+    {
+        double soln_ii = soln[ii];
+        for(unsigned kk = 0; kk < ii; ++kk)
+        {
+            soln[kk] -= factor(ii, kk) * soln_ii;
+        }
+    }
+}
+
+bool LDLTSolver::refine(DoubleVectorT & x)
+{
+    unsigned n_dims = n_dimensions;
+    residual.resize(n_dims);
+    correction.resize(n_dims);
+
+    // An iteration costs about 4*n^2 operations and a factorization n^3/3,
+    // so no more than n/12 iterations are made.
+    unsigned max_iter = std::min(max_refinement_iterations, n_dims / 12u);
+
+    double b_max = 0.0;
+    double a_max = 0.0;
+    for(unsigned ii = 0; ii < n_dims; ++ii)
+    {
+        double row_sum = 0.0;
+        for(unsigned jj = 0; jj < n_dims; ++jj)
+        {
+            row_sum += std::fabs(a_matrix(ii, jj));
+        }
+        b_max = std::max(b_max, std::fabs(b_vector[ii]));
+        a_max = std::max(a_max, row_sum);
+    }
+
+    double prev_r_max = 0.0;
+    for(unsigned iter = 0;; ++iter)
+    {
+        double r_max = 0.0;
+        double x_max = 0.0;
+        for(unsigned ii = 0; ii < n_dims; ++ii)
+        {
+            double sum = b_vector[ii];
+            for(unsigned jj = 0; jj < n_dims; ++jj)
+            {
+                sum -= a_matrix(ii, jj) * x[jj];
+            }
+            residual[ii] = sum;
+            r_max = std::max(r_max, std::fabs(sum));
+            x_max = std::max(x_max, std::fabs(x[ii]));
+        }
+        double r_target = refinement_tolerance * (b_max + a_max * x_max);
+        if(r_max <= r_target)
+        {
+            return true;
+        }
+        if(iter >= max_iter)
+        {
+            return false;
+        }
+
+        // Give up if the convergence so far will not reach the target in
+        // the iterations that remain.
+        if(iter > 0)
+        {
+            double rate = r_max / prev_r_max;
+            if((rate >= 1.0) || (r_max * std::pow(rate, max_iter - iter) > r_target))
+            {
+                return false;
+            }
+        }
+        prev_r_max = r_max;
+
+        back_substitute(residual, correction);
+        for(unsigned ii = 0; ii < n_dims; ++ii)
+        {
+            x[ii] += correction[ii];
+        }
+    }
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ */
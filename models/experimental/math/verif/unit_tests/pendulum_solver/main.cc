@@ -0,0 +1,221 @@
+// Solve the constraint equations of a vehicle carrying swinging pendulums
+// with the Gauss-Jordan and LDL^T solvers, compare the solutions, and time
+// the solvers for 1 to 60 pendulums.
+// System includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "experimental/math/include/gauss_jordan_solver.hh"
+#include "experimental/math/include/ldlt_solver.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+
+using namespace std;
+using namespace jeod;
+
+static unsigned long seed = 12345;
+
+// The pendulums model propellant slosh in a vehicle under thrust.
+static const double thrust_accel = 0.5;
+
+static double uniform(double lo, double hi)
+{
+    seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+    return lo + (hi - lo) * static_cast<double>(seed) / 2147483648.0;
+}
+
+static void cross(const double a[3], const double b[3], double c[3])
+{
+    c[0] = a[1] * b[2] - a[2] * b[1];
+    c[1] = a[2] * b[0] - a[0] * b[2];
+    c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+static double dot(const double a[3], const double b[3])
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+/**
+ * A point mass on a rigid rod, swinging about a pivot on the vehicle.
+ */
+struct Pendulum
+{
+    double mass;
+    double length;
+    double pivot[3];
+    double amplitude;
+    double frequency;
+    double phase;
+};
+
+/**
+ * A vehicle carrying pendulums. The constraint equations are formed as
+ * ForceConstraintComponent forms them: A(i,j) is the mass of pendulum i
+ * times the acceleration, along rod i at bob i, of the vehicle's response to
+ * a unit force along rod j at bob j, plus one on the diagonal.
+ */
+struct Vehicle
+{
+    double mass;
+    double inverse_inertia[3];
+    vector<Pendulum> pendulums;
+    vector<double> direction;
+    vector<double> position;
+
+    void set_state(double time)
+    {
+        unsigned n_pend = pendulums.size();
+        direction.resize(3 * n_pend);
+        position.resize(3 * n_pend);
+        for(unsigned ii = 0; ii < n_pend; ++ii)
+        {
+            const Pendulum & pend = pendulums[ii];
+            double angle = pend.amplitude * sin(pend.frequency * time + pend.phase);
+            double * dir = &direction[3 * ii];
+            dir[0] = sin(angle) * cos(pend.phase);
+            dir[1] = sin(angle) * sin(pend.phase);
+            dir[2] = -cos(angle);
+            for(unsigned kk = 0; kk < 3; ++kk)
+            {
+                position[3 * ii + kk] = pend.pivot[kk] + pend.length * dir[kk];
+            }
+        }
+    }
+
+    void load(LinearSystemSolver & solver, double time) const
+    {
+        unsigned n_pend = pendulums.size();
+        solver.set_n_dimensions(n_pend);
+        auto a_matrix = solver.make_a_matrix_view({0, n_pend}, {0, n_pend});
+        auto b_vector = solver.make_b_vector_view({0, n_pend});
+        for(unsigned jj = 0; jj < n_pend; ++jj)
+        {
+            const double * dir_j = &direction[3 * jj];
+            double torque[3];
+            double alpha[3];
+            cross(&position[3 * jj], dir_j, torque);
+            for(unsigned kk = 0; kk < 3; ++kk)
+            {
+                alpha[kk] = inverse_inertia[kk] * torque[kk];
+            }
+            for(unsigned ii = 0; ii < n_pend; ++ii)
+            {
+                double accel[3];
+                cross(alpha, &position[3 * ii], accel);
+                for(unsigned kk = 0; kk < 3; ++kk)
+                {
+                    accel[kk] += dir_j[kk] / mass;
+                }
+                a_matrix(ii, jj) = pendulums[ii].mass * dot(&direction[3 * ii], accel) + ((ii == jj) ? 1.0 : 0.0);
+            }
+        }
+        for(unsigned ii = 0; ii < n_pend; ++ii)
+        {
+            const Pendulum & pend = pendulums[ii];
+            double rate = pend.amplitude * pend.frequency * cos(pend.frequency * time + pend.phase);
+            b_vector[ii] = pend.mass * (thrust_accel * cos(pend.amplitude) + pend.length * rate * rate);
+        }
+    }
+};
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_steps;
+
+    cmdline_parser.add_int("NumSteps", 2000, &num_steps);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_steps <= 0)
+    {
+        cerr << "NumSteps must be positive." << endl;
+        return 1;
+    }
+
+    const unsigned pendulum_counts[] = {1, 2, 5, 10, 20, 40, 60};
+    const double time_step = 0.01;
+    const double max_error_allowed = 1e-10;
+    double worst_error = 0.0;
+
+    cout << "Mean time per solve, in microseconds, over " << num_steps << " steps of " << time_step
+         << " s; the vehicle mass changes every 500 steps." << endl;
+    cout << "Pendulums  Gauss-Jordan  LDLT refactor  LDLT reuse (factorizations)  LDLT frozen  max rel. error" << endl;
+    for(unsigned n_pend : pendulum_counts)
+    {
+        Vehicle vehicle;
+        vehicle.mass = 2000.0;
+        vehicle.inverse_inertia[0] = 1.0 / 1500.0;
+        vehicle.inverse_inertia[1] = 1.0 / 1800.0;
+        vehicle.inverse_inertia[2] = 1.0 / 2200.0;
+        for(unsigned ii = 0; ii < n_pend; ++ii)
+        {
+            Pendulum pend;
+            pend.mass = uniform(1.0, 40.0);
+            pend.length = uniform(0.2, 2.0);
+            for(double & coord : pend.pivot)
+            {
+                coord = uniform(-2.0, 2.0);
+            }
+            pend.amplitude = uniform(0.02, 0.2);
+            pend.frequency = sqrt(thrust_accel / pend.length);
+            pend.phase = uniform(0.0, 6.28);
+            vehicle.pendulums.push_back(pend);
+        }
+
+        GaussJordanSolver gauss_jordan;
+        LDLTSolver refactor;
+        LDLTSolver reuse;
+        LDLTSolver frozen;
+        refactor.max_refinement_iterations = 0;
+        LinearSystemSolver * solvers[] = {&gauss_jordan, &refactor, &reuse, &frozen};
+        double solve_us[4] = {};
+        double max_error = 0.0;
+        LinearSystemSolver::DoubleVectorT x[4];
+
+        for(int step = 0; step < num_steps; ++step)
+        {
+            double time = step * time_step;
+            if((step > 0) && (step % 500 == 0))
+            {
+                vehicle.mass -= 1.0;
+                for(LinearSystemSolver * solver : solvers)
+                {
+                    solver->system_changed();
+                }
+            }
+            for(unsigned isolve = 0; isolve < 4; ++isolve)
+            {
+                // The frozen case keeps the pendulums at their initial state.
+                vehicle.set_state((isolve == 3) ? 0.0 : time);
+                vehicle.load(*solvers[isolve], time);
+                auto start = chrono::steady_clock::now();
+                solvers[isolve]->solve(x[isolve]);
+                auto end = chrono::steady_clock::now();
+                solve_us[isolve] += chrono::duration<double, micro>(end - start).count();
+            }
+
+            double x_max = 0.0;
+            double diff_max = 0.0;
+            for(unsigned ii = 0; ii < n_pend; ++ii)
+            {
+                x_max = max(x_max, fabs(x[0][ii]));
+                diff_max = max(diff_max, max(fabs(x[1][ii] - x[0][ii]), fabs(x[2][ii] - x[0][ii])));
+            }
+            max_error = max(max_error, diff_max / x_max);
+        }
+        worst_error = max(worst_error, max_error);
+
+        cout << fixed << setprecision(2) << setw(9) << n_pend << setw(14) << solve_us[0] / num_steps << setw(15)
+             << solve_us[1] / num_steps << setw(13) << solve_us[2] / num_steps << " (" << setw(4)
+             << reuse.get_num_factorizations() << ")" << setw(23) << solve_us[3] / num_steps << scientific
+             << setprecision(1) << setw(16) << max_error << endl;
+    }
+
+    return (worst_error <= max_error_allowed) ? 0 : 1;
+}
@@ -73,6 +73,7 @@ Library dependencies:
 
 // Model includes
 #include "default_aero.hh"
+#include "flat_plate_aero_batch.hh"
 
 //! Namespace jeod
 namespace jeod
@@ -192,6 +193,22 @@ public:
      */
     DefaultAero ballistic_drag; //!< trick_units(--)
 
+    /**
+     * Evaluate a surface made entirely of FlatPlateAeroFacet objects with
+     * the structure-of-arrays flat plate kernels rather than one virtual
+     * call per facet. Surfaces with any other kind of facet always use the
+     * per-facet path.
+     */
+    bool use_flat_plate_batch{true}; //!< trick_units(--)
+
+    /**
+     * Flat plate kernels used when use_flat_plate_batch is set. Changes to
+     * the plates are detected and picked up on the next call. Only the total
+     * force and torque are computed unless
+     * flat_plate_batch.store_facet_outputs is set.
+     */
+    FlatPlateAeroBatch flat_plate_batch; //!< trick_units(--)
+
     AerodynamicDrag();
     virtual ~AerodynamicDrag() = default;
     AerodynamicDrag(const AerodynamicDrag &) = delete;
@@ -0,0 +1,229 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2025 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Aerodynamics
+ * @{
+ *
+ * @file models/interactions/aerodynamics/include/flat_plate_aero_batch.hh
+ * Structure-of-arrays evaluation of the drag on a surface made entirely of
+ * flat plates
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+REFERENCE:
+    (((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+      ((Every facet of the surface is exactly a FlatPlateAeroFacet))
+
+Library dependencies:
+    ((../src/flat_plate_aero_batch.cc))
+
+
+*******************************************************************************/
+
+#ifndef FLAT_PLATE_AERO_BATCH_HH
+#define FLAT_PLATE_AERO_BATCH_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+
+//! Namespace jeod
+namespace jeod
+{
+
+class AeroDragParameters;
+class AeroFacet;
+class AeroSurface;
+class FlatPlateAeroFacet;
+
+/**
+ * Computes the aerodynamic drag on an AeroSurface whose facets are all
+ * FlatPlateAeroFacet objects without a virtual call per facet.
+ *
+ * When a surface is prepared, the plates are ordered by drag coefficient
+ * method and their areas, accommodation coefficients, drag coefficients,
+ * normals and centers of pressure are copied into structure-of-arrays
+ * columns. Each call reads only what can change during a run -- the
+ * normals and centers of pressure of articulated plates, and the
+ * temperatures of the plates whose coefficients depend on them -- and
+ * processes each method in a loop over contiguous data that the compiler
+ * can vectorize. Terms that depend only on the flow (the
+ * speed ratio and the specular coefficient) are computed once per call.
+ * The copied parameters are compared with the plates on each call, and the
+ * surface is prepared again when a plate has changed.
+ * The force and torque sums are taken in facet order, so the results match
+ * FlatPlateAeroFacet::aerodrag_force summed over the facets.
+ */
+class FlatPlateAeroBatch
+{
+    JEOD_MAKE_SIM_INTERFACES(jeod, FlatPlateAeroBatch)
+
+public:
+    FlatPlateAeroBatch() = default;
+    virtual ~FlatPlateAeroBatch() = default;
+    FlatPlateAeroBatch(const FlatPlateAeroBatch &) = delete;
+    FlatPlateAeroBatch & operator=(const FlatPlateAeroBatch &) = delete;
+
+    // Set up for a surface; returns false if the surface is not all flat plates
+    bool prepare(AeroSurface & surface);
+
+    // Forget the prepared surface, so that the plates are read again
+    void reset();
+
+    // Compute the drag force and torque on the prepared surface
+    void compute(double rel_vel_mag,
+                 const double rel_vel_hat[3],
+                 const AeroDragParameters & param,
+                 const double center_grav[3],
+                 double force[3],
+                 double torque[3]);
+
+    /**
+     * Read the plate normals and centers of pressure on every call. Clear
+     * this for a surface whose plates do not articulate; they are then only
+     * compared with the prepared copy, and the surface is prepared again if
+     * a plate has moved.
+     */
+    bool read_geometry{true}; //!< trick_units(--)
+
+    /**
+     * Set each plate's temperature, force, torque and drag coefficient
+     * outputs. Only the total force and torque are computed otherwise, and
+     * a notice saying so is issued on the first call.
+     */
+    bool store_facet_outputs{}; //!< trick_units(--)
+
+protected:
+    /**
+     * Number of drag coefficient methods (see AeroDragEnum::CoefCalcMethod).
+     * Plates with any other method value form one more group.
+     */
+    static constexpr unsigned int num_methods = 4;
+
+    /**
+     * Facet array of the surface last prepared.
+     */
+    AeroFacet ** surface_facets{}; //!< trick_units(--)
+
+    /**
+     * Size of surface_facets.
+     */
+    unsigned int num_plates{}; //!< trick_units(count)
+
+    /**
+     * Is every facet of the prepared surface a FlatPlateAeroFacet?
+     */
+    bool all_flat_plates{}; //!< trick_units(--)
+
+    /**
+     * Start of each method group in the columns, with the end of the last.
+     */
+    unsigned int method_start[num_methods + 2]{}; //!< trick_units(--)
+
+    /**
+     * The plates, in column order.
+     */
+    std::vector<FlatPlateAeroFacet *> plates; //!< trick_io(**)
+
+    /**
+     * The plates' normals, in column order.
+     */
+    std::vector<const double *> plate_normals; //!< trick_io(**)
+
+    /**
+     * The plates' centers of pressure, in column order.
+     */
+    std::vector<const double *> plate_centers; //!< trick_io(**)
+
+    /**
+     * The plates' base facet temperatures, in column order.
+     */
+    std::vector<const double *> plate_temperatures; //!< trick_io(**)
+
+    /**
+     * Column entry of each facet of the surface.
+     */
+    std::vector<unsigned int> facet_column; //!< trick_io(**)
+
+    /**
+     * Column entries of the plates whose drag coefficients depend on the
+     * plate temperature.
+     */
+    std::vector<unsigned int> temperature_columns; //!< trick_io(**)
+
+    /**
+     * Column entries of the windward plates that calculate their
+     * coefficients from the plate angle (AeroDragEnum::Calc_coef).
+     */
+    std::vector<unsigned int> windward_calc; //!< trick_io(**)
+
+    /**
+     * Structure-of-arrays columns, each num_plates long.
+     */
+    std::vector<double> work; //!< trick_io(**)
+
+    /**
+     * Has the notice that per-plate outputs are not stored been issued?
+     */
+    bool facet_output_notice_issued{}; //!< trick_units(--)
+
+    // Have the prepared plates changed since they were copied?
+    bool plates_changed() const;
+};
+
+} // namespace jeod
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
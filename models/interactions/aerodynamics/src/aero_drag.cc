@@ -37,6 +37,7 @@ LIBRARY DEPENDENCY:
     ((aerodynamics_messages.cc)
      (aero_surface.cc)
      (default_aero.cc)
+     (flat_plate_aero_batch.cc)
      (utils/message/src/message_handler.cc))
 
 
@@ -150,6 +151,13 @@ void AerodynamicDrag::aero_drag(double inertial_velocity[3],
         return;
     }
 
+    // Surfaces made only of flat plates are evaluated together.
+    if(use_flat_plate_batch && flat_plate_batch.prepare(*aero_surface_ptr))
+    {
+        flat_plate_batch.compute(rel_vel_mag, rel_vel_struct_hat, param, center_grav, aero_force, aero_torque);
+        return;
+    }
+
     for(i_p = 0; i_p < aero_surface_ptr->facets_size; ++i_p)
     {
         Vector3::initialize(aero_surface_ptr->aero_facets[i_p]->force);
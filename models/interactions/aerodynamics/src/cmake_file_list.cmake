@@ -8,6 +8,7 @@ aero_surface_factory.cc
 flat_plate_thermal_aero_factory.cc
 flat_plate_aero_factory.cc
 flat_plate_aero_facet.cc
+flat_plate_aero_batch.cc
 aero_drag.cc
 )
 
@@ -0,0 +1,584 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Aerodynamics
+ * @{
+ *
+ * @file models/interactions/aerodynamics/src/flat_plate_aero_batch.cc
+ * Structure-of-arrays evaluation of the drag on a surface made entirely of
+ * flat plates
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+    ()
+
+Library dependencies:
+    ((flat_plate_aero_batch.cc)
+     (flat_plate_aero_facet.cc)
+     (aerodynamics_messages.cc)
+     (utils/message/src/message_handler.cc))
+
+
+*******************************************************************************/
+
+// System includes
+#include <cmath>
+#include <cstddef>
+#include <typeinfo>
+
+// JEOD includes
+#include "utils/math/include/numerical.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/surface_model/include/facet.hh"
+
+// Model includes
+#include "../include/aero_drag.hh"
+#include "../include/aero_surface.hh"
+#include "../include/aerodynamics_messages.hh"
+#include "../include/flat_plate_aero_batch.hh"
+#include "../include/flat_plate_aero_facet.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+namespace
+{
+/**
+ * Columns used by FlatPlateAeroBatch. The plate parameters and geometry are
+ * set when the surface is prepared; the rest are set on each call.
+ */
+enum Column
+{
+    col_area,
+    col_epsilon,
+    col_calculate,
+    col_coef_spec,
+    col_coef_diff,
+    col_coef_norm,
+    col_coef_tang,
+    col_nx,
+    col_ny,
+    col_nz,
+    col_cx,
+    col_cy,
+    col_cz,
+    col_temperature,
+    col_sin_alpha,
+    col_windward,
+    col_fx,
+    col_fy,
+    col_fz,
+    col_tx,
+    col_ty,
+    col_tz,
+    col_force_n,
+    col_force_t,
+    num_columns
+};
+} // namespace
+
+/**
+ * Set up for a surface: order the plates by drag coefficient method and
+ * copy their parameters and geometry. Nothing is done unless the surface's
+ * facet array or a prepared plate has changed since the last call or since
+ * reset.
+ * @return True if every facet of the surface is a FlatPlateAeroFacet
+ * \param[in] surface The aero surface
+ */
+bool FlatPlateAeroBatch::prepare(AeroSurface & surface)
+{
+    if((surface.aero_facets == surface_facets) && (surface.facets_size == num_plates) &&
+       !(all_flat_plates && plates_changed()))
+    {
+        return all_flat_plates;
+    }
+
+    surface_facets = surface.aero_facets;
+    num_plates = surface.facets_size;
+    all_flat_plates = (surface_facets != nullptr) && (num_plates > 0);
+    for(unsigned int ii = 0; all_flat_plates && (ii < num_plates); ++ii)
+    {
+        AeroFacet * facet = surface_facets[ii];
+        all_flat_plates = (facet != nullptr) && (typeid(*facet) == typeid(FlatPlateAeroFacet));
+    }
+    if(!all_flat_plates)
+    {
+        plates.clear();
+        plate_normals.clear();
+        plate_centers.clear();
+        plate_temperatures.clear();
+        facet_column.clear();
+        temperature_columns.clear();
+        windward_calc.clear();
+        work.clear();
+        return false;
+    }
+
+    // Group the plates by method, keeping facet order within each method.
+    for(unsigned int gg = 0; gg < num_methods + 2; ++gg)
+    {
+        method_start[gg] = 0;
+    }
+    for(unsigned int ii = 0; ii < num_plates; ++ii)
+    {
+        auto method = static_cast<unsigned int>(static_cast<FlatPlateAeroFacet *>(surface_facets[ii])->coef_method);
+        ++method_start[((method < num_methods) ? method : num_methods) + 1];
+    }
+    for(unsigned int gg = 1; gg < num_methods + 2; ++gg)
+    {
+        method_start[gg] += method_start[gg - 1];
+    }
+
+    unsigned int next[num_methods + 1];
+    for(unsigned int gg = 0; gg <= num_methods; ++gg)
+    {
+        next[gg] = method_start[gg];
+    }
+    facet_column.resize(num_plates);
+    for(unsigned int ii = 0; ii < num_plates; ++ii)
+    {
+        auto method = static_cast<unsigned int>(static_cast<FlatPlateAeroFacet *>(surface_facets[ii])->coef_method);
+        facet_column[ii] = next[(method < num_methods) ? method : num_methods]++;
+    }
+
+    plates.resize(num_plates);
+    plate_normals.resize(num_plates);
+    plate_centers.resize(num_plates);
+    plate_temperatures.resize(num_plates);
+    windward_calc.resize(num_plates);
+    temperature_columns.clear();
+    work.assign(num_columns * static_cast<std::size_t>(num_plates), 0.0);
+    for(unsigned int ii = 0; ii < num_plates; ++ii)
+    {
+        unsigned int jj = facet_column[ii];
+        auto * plate = static_cast<FlatPlateAeroFacet *>(surface_facets[ii]);
+
+        // consistency check, as made by the per-facet model
+        if((plate->calculate_drag_coef == false) && (plate->coef_method == AeroDragEnum::Calc_coef))
+        {
+            MessageHandler::warn(__FILE__,
+                                 __LINE__,
+                                 AerodynamicsMessages::runtime_warns,
+                                 "Must have calculate_drag_coef set to 'true' if \n"
+                                 "using the calc_coef method of obtaining the drag coefficient.\n"
+                                 "Resetting the value of calculate_drag_coef.\n");
+            plate->calculate_drag_coef = true;
+        }
+
+        plates[jj] = plate;
+        plate_normals[jj] = plate->normal;
+        plate_centers[jj] = plate->center_pressure;
+        plate_temperatures[jj] = &plate->base_facet->temperature;
+        work[col_area * num_plates + jj] = plate->area;
+        work[col_epsilon * num_plates + jj] = plate->epsilon;
+        work[col_calculate * num_plates + jj] = plate->calculate_drag_coef ? 1.0 : 0.0;
+        work[col_coef_spec * num_plates + jj] = plate->drag_coef_spec;
+        work[col_coef_diff * num_plates + jj] = plate->drag_coef_diff;
+        work[col_coef_norm * num_plates + jj] = plate->drag_coef_norm;
+        work[col_coef_tang * num_plates + jj] = plate->drag_coef_tang;
+        for(unsigned int kk = 0; kk < 3; ++kk)
+        {
+            work[(col_nx + kk) * num_plates + jj] = plate->normal[kk];
+            work[(col_cx + kk) * num_plates + jj] = plate->center_pressure[kk];
+        }
+    }
+
+    // Only the diffuse part of the drag depends on the plate temperature.
+    for(unsigned int jj = method_start[AeroDragEnum::Diffuse]; jj < method_start[num_methods]; ++jj)
+    {
+        if(plates[jj]->calculate_drag_coef)
+        {
+            temperature_columns.push_back(jj);
+        }
+    }
+    return true;
+}
+
+/**
+ * Forget the prepared surface. The next prepare reads the plates again.
+ */
+void FlatPlateAeroBatch::reset()
+{
+    surface_facets = nullptr;
+    num_plates = 0;
+    all_flat_plates = false;
+}
+
+/**
+ * Have the prepared plates changed since they were copied? A plate that has
+ * been replaced, or whose area, accommodation coefficient, drag coefficient
+ * method, input drag coefficients or, when read_geometry is clear, geometry
+ * differs from the copy has changed.
+ * @return True if the surface must be prepared again
+ */
+bool FlatPlateAeroBatch::plates_changed() const
+{
+    for(unsigned int ii = 0; ii < num_plates; ++ii)
+    {
+        if(surface_facets[ii] != plates[facet_column[ii]])
+        {
+            return true;
+        }
+    }
+
+    for(unsigned int gg = 0; gg <= num_methods; ++gg)
+    {
+        for(unsigned int jj = method_start[gg]; jj < method_start[gg + 1]; ++jj)
+        {
+            const FlatPlateAeroFacet & plate = *plates[jj];
+            auto method = static_cast<unsigned int>(plate.coef_method);
+            bool calculate = (work[col_calculate * num_plates + jj] != 0.0);
+            if((((method < num_methods) ? method : num_methods) != gg) || (plate.calculate_drag_coef != calculate) ||
+               !Numerical::compare_exact(plate.area, work[col_area * num_plates + jj]) ||
+               !Numerical::compare_exact(plate.epsilon, work[col_epsilon * num_plates + jj]))
+            {
+                return true;
+            }
+
+            // Calculated coefficients are outputs, not parameters.
+            if(!calculate && (!Numerical::compare_exact(plate.drag_coef_spec, work[col_coef_spec * num_plates + jj]) ||
+                              !Numerical::compare_exact(plate.drag_coef_diff, work[col_coef_diff * num_plates + jj]) ||
+                              !Numerical::compare_exact(plate.drag_coef_norm, work[col_coef_norm * num_plates + jj]) ||
+                              !Numerical::compare_exact(plate.drag_coef_tang, work[col_coef_tang * num_plates + jj])))
+            {
+                return true;
+            }
+
+            if(read_geometry)
+            {
+                continue;
+            }
+            for(unsigned int kk = 0; kk < 3; ++kk)
+            {
+                if(!Numerical::compare_exact(plate.normal[kk], work[(col_nx + kk) * num_plates + jj]) ||
+                   !Numerical::compare_exact(plate.center_pressure[kk], work[(col_cx + kk) * num_plates + jj]))
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Compute the aerodynamic drag force and torque on the prepared surface.
+ * \param[in] rel_vel_mag The magnitude of the relative velocity\n Units: M/s
+ * \param[in] rel_vel_hat The unit vector of the relative velocity, in the structural frame
+ * \param[in] param The aerodynamic drag parameters
+ * \param[in] center_grav The center of gravity of the vehicle, in the structural frame\n Units: M
+ * \param[out] force Total drag force\n Units: N
+ * \param[out] torque Total drag torque\n Units: N*m
+ */
+void FlatPlateAeroBatch::compute(double rel_vel_mag,
+                                 const double rel_vel_hat[3],
+                                 const AeroDragParameters & param,
+                                 const double center_grav[3],
+                                 double force[3],
+                                 double torque[3])
+{
+    double * col[num_columns];
+    for(unsigned int cc = 0; cc < num_columns; ++cc)
+    {
+        col[cc] = work.data() + cc * static_cast<std::size_t>(num_plates);
+    }
+    const double * area = col[col_area];
+    const double * epsilon = col[col_epsilon];
+    const double * calculate = col[col_calculate];
+    double * c_spec = col[col_coef_spec];
+    double * c_diff = col[col_coef_diff];
+    double * c_norm = col[col_coef_norm];
+    double * c_tang = col[col_coef_tang];
+    double * nx = col[col_nx];
+    double * ny = col[col_ny];
+    double * nz = col[col_nz];
+    double * cx = col[col_cx];
+    double * cy = col[col_cy];
+    double * cz = col[col_cz];
+    double * temperature = col[col_temperature];
+    double * sin_a = col[col_sin_alpha];
+    double * windward = col[col_windward];
+    double * fx = col[col_fx];
+    double * fy = col[col_fy];
+    double * fz = col[col_fz];
+    double * tx = col[col_tx];
+    double * ty = col[col_ty];
+    double * tz = col[col_tz];
+    double * force_n = col[col_force_n];
+    double * force_t = col[col_force_t];
+
+    const double v0 = rel_vel_hat[0];
+    const double v1 = rel_vel_hat[1];
+    const double v2 = rel_vel_hat[2];
+    const double dynamic_pressure = param.dynamic_pressure;
+    const bool gas_unset = (std::fpclassify(param.gas_const) == FP_ZERO) ||
+                           (std::fpclassify(param.temp_free_stream) == FP_ZERO);
+
+    // Refresh the geometry of articulated plates and the temperatures that
+    // are used.
+    if(read_geometry)
+    {
+        for(unsigned int jj = 0; jj < num_plates; ++jj)
+        {
+            const double * normal = plate_normals[jj];
+            const double * center = plate_centers[jj];
+            nx[jj] = normal[0];
+            ny[jj] = normal[1];
+            nz[jj] = normal[2];
+            cx[jj] = center[0];
+            cy[jj] = center[1];
+            cz[jj] = center[2];
+        }
+    }
+    for(unsigned int jj : temperature_columns)
+    {
+        temperature[jj] = *plate_temperatures[jj];
+    }
+
+    // A plate that is not windward-facing has no aerodynamic drag on it.
+    for(unsigned int jj = 0; jj < num_plates; ++jj)
+    {
+        sin_a[jj] = v0 * nx[jj] + v1 * ny[jj] + v2 * nz[jj];
+        windward[jj] = (sin_a[jj] > 0.0) ? 1.0 : 0.0;
+    }
+
+    // Checks made by the per-facet model on windward plates only.
+    if(gas_unset || (method_start[num_methods] != num_plates))
+    {
+        for(unsigned int jj = 0; jj < num_plates; ++jj)
+        {
+            if((windward[jj] != 0.0) && (calculate[jj] != 0.0) && gas_unset)
+            {
+                MessageHandler::fail(__FILE__,
+                                     __LINE__,
+                                     AerodynamicsMessages::runtime_error,
+                                     "Either the gas_const or temp_free_stream field(s) of "
+                                     "aero_drag_param_ptr was not initialized.  "
+                                     "Please initialize both of these values.");
+            }
+            if((windward[jj] != 0.0) && (jj >= method_start[num_methods]))
+            {
+                MessageHandler::fail(__FILE__,
+                                     __LINE__,
+                                     AerodynamicsMessages::runtime_error,
+                                     (calculate[jj] != 0.0)
+                                         ? "The choice for calculating the coefficients of drag in the "
+                                           "flat plate model for aerodynamics was invalid. Please supply "
+                                           "a valid choice.\n"
+                                         : "The choice for calculating the aerodynamic drag in the "
+                                           "flat plate model for aerodynamics was invalid. Please supply "
+                                           "a valid choice.\n");
+                windward[jj] = 0.0;
+            }
+        }
+    }
+
+    // Flow terms shared by all plates. They are only used by plates that
+    // calculate their coefficients, which requires nonzero gas parameters.
+    double temp_free_stream = param.temp_free_stream;
+    double s = 0.0;
+    double s_2 = 1.0;
+    double exp_s2 = 0.0;
+    double coef_spec = 0.0;
+    if(!gas_unset)
+    {
+        s = rel_vel_mag / sqrt(2.0 * param.gas_const * temp_free_stream);
+        s_2 = s * s;
+        exp_s2 = exp(-s_2);
+        coef_spec = ((2.0 * M_2_SQRTPI) * s * exp_s2 + (2.0 + 4.0 * s_2)) / (s_2);
+    }
+    else
+    {
+        temp_free_stream = 1.0;
+    }
+
+    // Specular: force along the normal.
+    for(unsigned int jj = method_start[AeroDragEnum::Specular]; jj < method_start[AeroDragEnum::Specular + 1]; ++jj)
+    {
+        bool wind = (windward[jj] != 0.0);
+        double force_base = -dynamic_pressure * area[jj];
+        c_spec[jj] = (wind && (calculate[jj] != 0.0)) ? coef_spec : c_spec[jj];
+        double fn = force_base * c_spec[jj] * sin_a[jj] * sin_a[jj];
+        force_n[jj] = wind ? fn : 0.0;
+        fx[jj] = wind ? nx[jj] * fn : 0.0;
+        fy[jj] = wind ? ny[jj] * fn : 0.0;
+        fz[jj] = wind ? nz[jj] * fn : 0.0;
+    }
+
+    // Diffuse: force along the relative velocity.
+    for(unsigned int jj = method_start[AeroDragEnum::Diffuse]; jj < method_start[AeroDragEnum::Diffuse + 1]; ++jj)
+    {
+        bool wind = (windward[jj] != 0.0);
+        double force_base = -dynamic_pressure * area[jj];
+        double temp_ratio = temperature[jj] / temp_free_stream;
+        double coef = ((M_2_SQRTPI)*s * exp_s2 + sqrt(temp_ratio) * (2.0 / M_2_SQRTPI) * s + (1.0 + 2.0 * s_2)) /
+                      (s * s);
+        c_diff[jj] = (wind && (calculate[jj] != 0.0)) ? coef : c_diff[jj];
+        double ft = force_base * c_diff[jj] * sin_a[jj];
+        force_t[jj] = wind ? ft : 0.0;
+        fx[jj] = wind ? v0 * ft : 0.0;
+        fy[jj] = wind ? v1 * ft : 0.0;
+        fz[jj] = wind ? v2 * ft : 0.0;
+    }
+
+    // Mixed: a blend of the two.
+    for(unsigned int jj = method_start[AeroDragEnum::Mixed]; jj < method_start[AeroDragEnum::Mixed + 1]; ++jj)
+    {
+        bool wind = (windward[jj] != 0.0);
+        bool calc = wind && (calculate[jj] != 0.0);
+        double force_base = -dynamic_pressure * area[jj];
+        double temp_ratio = temperature[jj] / temp_free_stream;
+        double coef = ((M_2_SQRTPI)*s * exp_s2 + sqrt(temp_ratio) * (2.0 / M_2_SQRTPI) * s + (1.0 + 2.0 * s_2)) /
+                      (s * s);
+        c_spec[jj] = calc ? coef_spec : c_spec[jj];
+        c_diff[jj] = calc ? coef : c_diff[jj];
+        double fn = epsilon[jj] * force_base * c_spec[jj] * sin_a[jj] * sin_a[jj];
+        double ft = (1.0 - epsilon[jj]) * force_base * c_diff[jj] * sin_a[jj];
+        force_n[jj] = wind ? fn : 0.0;
+        force_t[jj] = wind ? ft : 0.0;
+        fx[jj] = wind ? v0 * ft + nx[jj] * fn : 0.0;
+        fy[jj] = wind ? v1 * ft + ny[jj] * fn : 0.0;
+        fz[jj] = wind ? v2 * ft + nz[jj] * fn : 0.0;
+    }
+
+    // Calculated coefficients: pressure along the normal and friction along
+    // the plate, which vanishes when the plate is full-on to the flow. Only
+    // the windward plates are evaluated; these are the costly ones.
+    unsigned int num_windward_calc = 0;
+    for(unsigned int jj = method_start[AeroDragEnum::Calc_coef]; jj < method_start[num_methods + 1]; ++jj)
+    {
+        windward_calc[num_windward_calc] = jj;
+        num_windward_calc += ((jj < method_start[num_methods]) && (windward[jj] != 0.0)) ? 1 : 0;
+        fx[jj] = fy[jj] = fz[jj] = 0.0;
+        force_n[jj] = force_t[jj] = 0.0;
+    }
+    for(unsigned int kk = 0; kk < num_windward_calc; ++kk)
+    {
+        unsigned int jj = windward_calc[kk];
+        double sin_alpha = sin_a[jj];
+        double one_p_epsilon = 1 + epsilon[jj];
+        double one_m_epsilon = 1 - epsilon[jj];
+        double s_sinalpha = s * sin_alpha;
+        double s_sa2 = s_sinalpha * s_sinalpha;
+        double exp_ssa2 = exp(-s_sa2);
+        double erf_ssa = erf(s_sinalpha);
+        double local_temp_reflect = (one_m_epsilon)*temperature[jj] + epsilon[jj] * temp_free_stream;
+        double temp_ratio = local_temp_reflect / temp_free_stream;
+        double force_base = -dynamic_pressure * area[jj];
+
+        c_norm[jj] = ((M_2_SQRTPI * one_p_epsilon) * s_sinalpha * exp_ssa2 +
+                      one_m_epsilon * sqrt(temp_ratio) * (2.0 / M_2_SQRTPI) * s_sinalpha +
+                      one_p_epsilon * (1.0 + 2.0 * s_sa2) * erf_ssa) /
+                     (s_2);
+        force_n[jj] = force_base * c_norm[jj];
+
+        if(Numerical::compare_exact(sin_alpha, 1))
+        {
+            fx[jj] = nx[jj] * force_n[jj];
+            fy[jj] = ny[jj] * force_n[jj];
+            fz[jj] = nz[jj] * force_n[jj];
+        }
+        else
+        {
+            double cos_alpha = sqrt(1 - (sin_alpha * sin_alpha));
+            double cos_a_inv = 1 / cos_alpha;
+            double tangent_x = (v0 - nx[jj] * sin_alpha) * cos_a_inv;
+            double tangent_y = (v1 - ny[jj] * sin_alpha) * cos_a_inv;
+            double tangent_z = (v2 - nz[jj] * sin_alpha) * cos_a_inv;
+
+            // exp_ssa2 and erf_ssa are the exp(-s_sinalpha * s_sinalpha) and
+            // erf(s_sinalpha) of the per-facet expression.
+            c_tang[jj] = fabs((2.0 * one_m_epsilon / (2.0 / M_2_SQRTPI)) * s * cos_alpha *
+                              (exp_ssa2 + (2.0 / M_2_SQRTPI) * s_sinalpha * erf_ssa)) /
+                         (s * s);
+            force_t[jj] = force_base * c_tang[jj];
+            fx[jj] = tangent_x * force_t[jj] + nx[jj] * force_n[jj];
+            fy[jj] = tangent_y * force_t[jj] + ny[jj] * force_n[jj];
+            fz[jj] = tangent_z * force_t[jj] + nz[jj] * force_n[jj];
+        }
+    }
+
+    // Torques about the center of gravity. The leading 0.0 + matches the
+    // per-facet increment of a zeroed torque.
+    const double cg0 = center_grav[0];
+    const double cg1 = center_grav[1];
+    const double cg2 = center_grav[2];
+    for(unsigned int jj = 0; jj < num_plates; ++jj)
+    {
+        double rx = cx[jj] - cg0;
+        double ry = cy[jj] - cg1;
+        double rz = cz[jj] - cg2;
+        tx[jj] = 0.0 + (ry * fz[jj] - rz * fy[jj]);
+        ty[jj] = 0.0 + (rz * fx[jj] - rx * fz[jj]);
+        tz[jj] = 0.0 + (rx * fy[jj] - ry * fx[jj]);
+    }
+
+    // Sum the forces and torques in facet order. Leeward plates add zero,
+    // as they do in the per-facet model.
+    force[0] = force[1] = force[2] = 0.0;
+    torque[0] = torque[1] = torque[2] = 0.0;
+    for(unsigned int ii = 0; ii < num_plates; ++ii)
+    {
+        unsigned int jj = facet_column[ii];
+        force[0] += fx[jj];
+        force[1] += fy[jj];
+        force[2] += fz[jj];
+        torque[0] += tx[jj];
+        torque[1] += ty[jj];
+        torque[2] += tz[jj];
+    }
+
+    if(!store_facet_outputs)
+    {
+        if(!facet_output_notice_issued)
+        {
+            MessageHandler::inform(__FILE__,
+                                   __LINE__,
+                                   AerodynamicsMessages::runtime_warns,
+                                   "The flat plate fast path computes only the total drag force and torque.\n"
+                                   "The per-plate force, torque, temperature and drag coefficient outputs\n"
+                                   "are not updated. Set flat_plate_batch.store_facet_outputs to update\n"
+                                   "them, or clear use_flat_plate_batch to use the per-facet model.\n");
+            facet_output_notice_issued = true;
+        }
+        return;
+    }
+
+    // Per-plate outputs, as set by FlatPlateAeroFacet::aerodrag_force. A
+    // specular plate keeps its tangential force and a diffuse plate its
+    // normal force unless it is leeward. The plates are visited in facet
+    // order, which is usually their order in memory.
+    for(unsigned int ii = 0; ii < num_plates; ++ii)
+    {
+        unsigned int jj = facet_column[ii];
+        FlatPlateAeroFacet & plate = *plates[jj];
+        bool wind = (windward[jj] != 0.0);
+        bool has_normal = (jj < method_start[AeroDragEnum::Diffuse]) || (jj >= method_start[AeroDragEnum::Mixed]);
+        bool has_tangential = (jj >= method_start[AeroDragEnum::Diffuse]);
+        plate.temperature = *plate_temperatures[jj];
+        plate.force[0] = fx[jj];
+        plate.force[1] = fy[jj];
+        plate.force[2] = fz[jj];
+        plate.torque[0] = tx[jj];
+        plate.torque[1] = ty[jj];
+        plate.torque[2] = tz[jj];
+        plate.force_n = (has_normal || !wind) ? force_n[jj] : plate.force_n;
+        plate.force_t = (has_tangential || !wind) ? force_t[jj] : plate.force_t;
+        plate.drag_coef_spec = c_spec[jj];
+        plate.drag_coef_diff = c_diff[jj];
+        plate.drag_coef_norm = c_norm[jj];
+        plate.drag_coef_tang = c_tang[jj];
+    }
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ */
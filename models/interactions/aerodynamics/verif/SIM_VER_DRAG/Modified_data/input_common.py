@@ -17,5 +17,7 @@ aero_test.T_inertial_struct = [ [1,0,0],\
 
 aero_test.aero_drag.use_default_behavior = False
 aero_test.aero_drag.set_aero_surface(aero_test.aero_surface)
+# The per-plate forces are logged.
+aero_test.aero_drag.flat_plate_batch.store_facet_outputs = True
 
 trick.stop(360.0)
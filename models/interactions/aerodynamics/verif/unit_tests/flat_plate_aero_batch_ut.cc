@@ -0,0 +1,21 @@
+/*
+ * flat_plate_aero_batch_ut.cc
+ */
+
+#include "interactions/aerodynamics/include/flat_plate_aero_batch.hh"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace jeod;
+
+TEST(FlatPlateAeroBatch, create)
+{
+    FlatPlateAeroBatch staticInst;
+    FlatPlateAeroBatch * dynInst = new FlatPlateAeroBatch;
+    delete dynInst;
+}
+
+TEST(FlatPlateAeroBatch, prepare) {}
+
+TEST(FlatPlateAeroBatch, compute) {}
@@ -0,0 +1,205 @@
+// Compare the flat plate drag kernels against the per-facet flat plate model
+// on a surface with plates of every drag coefficient method, and time both.
+// System includes
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "environment/atmosphere/base_atmos/include/atmosphere_state.hh"
+#include "interactions/aerodynamics/include/aero_drag.hh"
+#include "interactions/aerodynamics/include/aero_surface.hh"
+#include "interactions/aerodynamics/include/flat_plate_aero_facet.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/surface_model/include/flat_plate.hh"
+
+using namespace std;
+using namespace jeod;
+
+static unsigned long seed = 12345;
+
+static double uniform(double lo, double hi)
+{
+    seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+    return lo + (hi - lo) * static_cast<double>(seed) / 2147483648.0;
+}
+
+static void random_unit(double vec[3])
+{
+    double mag;
+    do
+    {
+        for(unsigned int ii = 0; ii < 3; ++ii)
+        {
+            vec[ii] = uniform(-1.0, 1.0);
+        }
+        mag = sqrt(vec[0] * vec[0] + vec[1] * vec[1] + vec[2] * vec[2]);
+    } while((mag < 0.1) || (mag > 1.0));
+    for(unsigned int ii = 0; ii < 3; ++ii)
+    {
+        vec[ii] /= mag;
+    }
+}
+
+/**
+ * The per-facet outputs of a plate.
+ */
+static void record_outputs(const FlatPlateAeroFacet & plate, vector<double> & out)
+{
+    out.insert(out.end(), plate.force, plate.force + 3);
+    out.insert(out.end(), plate.torque, plate.torque + 3);
+    out.push_back(plate.force_n);
+    out.push_back(plate.force_t);
+    out.push_back(plate.drag_coef_norm);
+    out.push_back(plate.drag_coef_tang);
+    out.push_back(plate.drag_coef_spec);
+    out.push_back(plate.drag_coef_diff);
+}
+
+static bool bit_equal(const vector<double> & a, const vector<double> & b)
+{
+    return (a.size() == b.size()) && (memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0);
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_plates;
+    int num_reps;
+
+    cmdline_parser.add_int("NumPlates", 2000, &num_plates);
+    cmdline_parser.add_int("NumReps", 200, &num_reps);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_plates <= 0 || num_reps <= 0)
+    {
+        cerr << "NumPlates and NumReps must be positive." << endl;
+        return 1;
+    }
+
+    // The surface: plates of all four methods, with and without calculated
+    // coefficients. The first plate is full-on to the flow in the first
+    // repetition.
+    vector<FlatPlate> base_plates(num_plates);
+    vector<double> centers(3 * num_plates);
+    double vel_dir[3];
+    random_unit(vel_dir);
+
+    AeroSurface surface;
+    surface.allocate_array(num_plates);
+    for(int ii = 0; ii < num_plates; ++ii)
+    {
+        FlatPlateAeroFacet * plate = JEOD_ALLOC_CLASS_OBJECT(FlatPlateAeroFacet, ());
+        surface.aero_facets[ii] = plate;
+        FlatPlate & base = base_plates[ii];
+        random_unit(base.normal);
+        if(ii == 0)
+        {
+            for(unsigned int jj = 0; jj < 3; ++jj)
+            {
+                base.normal[jj] = -vel_dir[jj];
+            }
+        }
+        base.temperature = uniform(200.0, 400.0);
+        for(unsigned int jj = 0; jj < 3; ++jj)
+        {
+            centers[3 * ii + jj] = uniform(-5.0, 5.0);
+        }
+        plate->base_facet = &base;
+        plate->normal = base.normal;
+        plate->center_pressure = &centers[3 * ii];
+        plate->area = uniform(0.1, 4.0);
+        plate->coef_method = static_cast<AeroDragEnum::CoefCalcMethod>(ii % 4);
+        plate->calculate_drag_coef = ((ii % 4) == AeroDragEnum::Calc_coef) || ((ii / 4) % 2 == 0);
+        plate->epsilon = uniform(0.0, 1.0);
+        plate->drag_coef_spec = uniform(1.0, 3.0);
+        plate->drag_coef_diff = uniform(1.0, 3.0);
+    }
+
+    AerodynamicDrag drag;
+    drag.use_default_behavior = false;
+    drag.flat_plate_batch.store_facet_outputs = true;
+    drag.set_aero_surface(surface);
+    drag.param.gas_const = 287.0;
+    drag.param.temp_free_stream = 1000.0;
+    drag.constant_density = true;
+    drag.density = 1.0e-11;
+
+    AtmosphereState atmos;
+    double T_inertial_struct[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+    double center_grav[3] = {0.1, -0.2, 0.3};
+
+    // Bit-for-bit comparison of the two paths. After the first repetition,
+    // one plate's parameters are changed before each comparison, as an input
+    // file event might change them.
+    unsigned int num_mismatch = 0;
+    vector<double> velocities(3 * num_reps);
+    for(int rep = 0; rep < num_reps; ++rep)
+    {
+        double * velocity = &velocities[3 * rep];
+        if(rep > 0)
+        {
+            random_unit(vel_dir);
+            auto * changed = static_cast<FlatPlateAeroFacet *>(surface.aero_facets[rep % num_plates]);
+            changed->area = uniform(0.1, 4.0);
+            changed->epsilon = uniform(0.0, 1.0);
+            if(!changed->calculate_drag_coef)
+            {
+                changed->drag_coef_spec = uniform(1.0, 3.0);
+                changed->drag_coef_diff = uniform(1.0, 3.0);
+            }
+        }
+        double speed = uniform(6000.0, 8000.0);
+        for(unsigned int jj = 0; jj < 3; ++jj)
+        {
+            velocity[jj] = speed * vel_dir[jj];
+        }
+
+        vector<double> results[2];
+        for(unsigned int path = 0; path < 2; ++path)
+        {
+            drag.use_flat_plate_batch = (path == 1);
+            drag.aero_drag(velocity, &atmos, T_inertial_struct, 1000.0, center_grav);
+            results[path].assign(drag.aero_force, drag.aero_force + 3);
+            results[path].insert(results[path].end(), drag.aero_torque, drag.aero_torque + 3);
+            for(int ii = 0; ii < num_plates; ++ii)
+            {
+                record_outputs(*static_cast<FlatPlateAeroFacet *>(surface.aero_facets[ii]), results[path]);
+            }
+        }
+        num_mismatch += bit_equal(results[0], results[1]) ? 0 : 1;
+    }
+
+    // Timing over the same velocities: the per-facet model, the kernels,
+    // the kernels without the per-plate outputs, and the kernels without
+    // the per-plate outputs for plates that do not articulate.
+    double elapsed_ns[4];
+    for(unsigned int path = 0; path < 4; ++path)
+    {
+        drag.use_flat_plate_batch = (path > 0);
+        drag.flat_plate_batch.store_facet_outputs = (path < 2);
+        drag.flat_plate_batch.read_geometry = (path < 3);
+        auto start = chrono::steady_clock::now();
+        for(int rep = 0; rep < num_reps; ++rep)
+        {
+            drag.aero_drag(&velocities[3 * rep], &atmos, T_inertial_struct, 1000.0, center_grav);
+        }
+        auto stop = chrono::steady_clock::now();
+        elapsed_ns[path] = chrono::duration<double, nano>(stop - start).count() / num_reps / num_plates;
+    }
+
+    cout << num_plates << " plates, " << num_reps << " repetitions" << endl;
+    cout << fixed << setprecision(1);
+    cout << "  per-facet model:          " << setw(8) << elapsed_ns[0] << " ns/plate" << endl;
+    cout << "  flat plate kernels:       " << setw(8) << elapsed_ns[1] << " ns/plate" << endl;
+    cout << "  kernels, totals only:     " << setw(8) << elapsed_ns[2] << " ns/plate" << endl;
+    cout << "  kernels, fixed geometry:  " << setw(8) << elapsed_ns[3] << " ns/plate" << endl;
+    cout << "  repetitions not bit-identical: " << num_mismatch << endl;
+
+    return (num_mismatch == 0) ? 0 : 1;
+}
@@ -68,7 +68,12 @@
 #define CONTACT_HH
 
 // System includes
+#include <cstddef>
+#include <functional>
 #include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 /* JEOD includes */
 #include "dynamics/dyn_manager/include/class_declarations.hh"
@@ -77,6 +82,7 @@
 
 // Model includes
 #include "class_declarations.hh"
+#include "contact_broad_phase.hh"
 #include "contact_facet.hh"
 #include "contact_pair.hh"
 #include "pair_interaction.hh"
@@ -85,6 +91,24 @@
 namespace jeod
 {
 
+/**
+ * Key identifying an unordered pair of contact facets, lower address first.
+ */
+using ContactFacetPairKey = std::pair<const ContactFacet *, const ContactFacet *>;
+
+/**
+ * Hash function for a ContactFacetPairKey.
+ */
+struct ContactFacetPairHash
+{
+    std::size_t operator()(const ContactFacetPairKey & key) const
+    {
+        std::size_t h1 = std::hash<const void *>()(key.first);
+        std::size_t h2 = std::hash<const void *>()(key.second);
+        return h1 ^ (h2 + static_cast<std::size_t>(0x9e3779b97f4a7c15ULL) + (h1 << 6) + (h1 >> 2));
+    }
+};
+
 /**
  * An base contact class for use in the surface model.
  */
@@ -104,6 +128,24 @@ public:
      */
     double contact_limit_factor{}; //!< trick_units(--)
 
+    /**
+     * toggles the sweep-and-prune broad phase that culls pairs before
+     * in_range is called, true=on false=off
+     */
+    bool use_broad_phase{true}; //!< trick_units(--)
+
+    /**
+     * distance added to the broad phase bounding boxes so that round-off in
+     * the facet positions can never cull a pair that is in range.
+     */
+    double broad_phase_margin{1.0e-3}; //!< trick_units(m)
+
+    /**
+     * toggles updating the relative states of active pairs culled by the
+     * broad phase, for simulations that log them, true=on false=off
+     */
+    bool update_culled_pair_states{}; //!< trick_units(--)
+
     Contact();
     virtual ~Contact();
     Contact & operator=(const Contact &) = delete;
@@ -163,6 +205,78 @@ protected:
      * list of all possible pair interaction types
      */
     JeodPointerList<PairInteraction>::type pair_interactions; //!< trick_io(**)
+
+    /**
+     * complete pairs keyed on their facets, used for duplicate checks
+     */
+    std::unordered_multimap<ContactFacetPairKey, ContactPair *, ContactFacetPairHash> pair_registry; //!< trick_io(**)
+
+    /**
+     * size of contact_pairs when pair_registry was last synchronized
+     */
+    std::size_t registry_list_size{}; //!< trick_io(**)
+
+    /**
+     * last element of contact_pairs when pair_registry was last synchronized
+     */
+    ContactPair * registry_list_back{}; //!< trick_io(**)
+
+    /**
+     * sweep-and-prune over the facets of pairs with a finite interaction distance
+     */
+    ContactBroadPhase broad_phase; //!< trick_io(**)
+
+    /**
+     * is the broad phase consistent with the pair registry
+     */
+    bool broad_phase_valid{}; //!< trick_io(**)
+
+    /**
+     * complete pairs in contact_pairs order
+     */
+    std::vector<ContactPair *> broad_phase_pairs; //!< trick_io(**)
+
+    /**
+     * facets represented in the broad phase, by broad phase entry
+     */
+    std::vector<ContactFacet *> broad_phase_facets; //!< trick_io(**)
+
+    /**
+     * half of the largest interaction distance of any pair using each facet
+     */
+    std::vector<double> broad_phase_half_width; //!< trick_io(**)
+
+    /**
+     * indices into broad_phase_pairs of culled pairs, keyed on their facets
+     */
+    std::unordered_multimap<ContactFacetPairKey, unsigned int, ContactFacetPairHash> culled_pairs; //!< trick_io(**)
+
+    /**
+     * indices into broad_phase_pairs of pairs that cannot be culled
+     */
+    std::vector<unsigned int> unculled_pairs; //!< trick_io(**)
+
+    /**
+     * work area for the broad phase overlaps
+     */
+    std::vector<ContactBroadPhase::Overlap> overlaps; //!< trick_io(**)
+
+    /**
+     * work area for the indices of pairs that pass the broad phase
+     */
+    std::vector<unsigned int> candidates; //!< trick_io(**)
+
+    // Form the registry key for a pair of facets.
+    static ContactFacetPairKey make_pair_key(const ContactFacet * facet_1, const ContactFacet * facet_2);
+
+    // Append a pair to the pair list and the registry.
+    void add_pair(ContactPair * pair);
+
+    // Rebuild the pair registry if the pair list has changed behind its back.
+    void sync_pair_registry();
+
+    // Rebuild the broad phase from the pair registry.
+    void build_broad_phase();
 };
 
 } // namespace jeod
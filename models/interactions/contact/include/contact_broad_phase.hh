@@ -0,0 +1,146 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2025 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Contact
+ * @{
+ *
+ * @file models/interactions/contact/include/contact_broad_phase.hh
+ * Sweep-and-prune broad phase used to cull contact pairs
+ */
+
+/*****************************************************************************
+
+ Purpose:
+    ()
+
+ Reference:
+   (((Baraff, D.) (Dynamic Simulation of Non-Penetrating Rigid Bodies)
+     (Ph.D. thesis, Cornell University) (1992)))
+
+ Assumptions and Limitations:
+     ((Entries are bounded by axis-aligned cubes that contain their spheres
+       of interaction.))
+
+ Library dependencies:
+    ((../src/contact_broad_phase.cc))
+
+
+
+*****************************************************************************/
+
+#ifndef CONTACT_BROAD_PHASE_HH
+#define CONTACT_BROAD_PHASE_HH
+
+// System includes
+#include <utility>
+#include <vector>
+
+/* JEOD includes */
+#include "utils/sim_interface/include/jeod_class.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+/**
+ * Finds the entries whose bounding boxes overlap by sorting the boxes along
+ * the x axis (sweep and prune). The sort order is retained between calls so
+ * that the re-sort of slowly moving entries is nearly linear.
+ */
+class ContactBroadPhase
+{
+    JEOD_MAKE_SIM_INTERFACES(jeod, ContactBroadPhase)
+
+public:
+    /**
+     * Index pair of two entries with overlapping boxes, lower index first.
+     */
+    using Overlap = std::pair<unsigned int, unsigned int>;
+
+    ContactBroadPhase() = default;
+    virtual ~ContactBroadPhase() = default;
+    ContactBroadPhase & operator=(const ContactBroadPhase &) = delete;
+    ContactBroadPhase(const ContactBroadPhase &) = delete;
+
+    // Set the number of entries, discarding the retained sort order.
+    void resize(unsigned int num_entries);
+
+    /**
+     * Get the number of entries.
+     * @return Number of entries
+     */
+    unsigned int size() const
+    {
+        return static_cast<unsigned int>(half_width.size());
+    }
+
+    // Set the center and half width of an entry's box.
+    void set_entry(unsigned int index, const double center[3], double half_width_in);
+
+    // Find all overlapping pairs of boxes.
+    void find_overlaps(std::vector<Overlap> & overlaps);
+
+protected:
+    /**
+     * Box centers.
+     */
+    std::vector<double> centers; //!< trick_io(**)
+
+    /**
+     * Box half widths.
+     */
+    std::vector<double> half_width; //!< trick_io(**)
+
+    /**
+     * Entry indices in order of increasing box lower x bound.
+     */
+    std::vector<unsigned int> order; //!< trick_io(**)
+};
+
+} // namespace jeod
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
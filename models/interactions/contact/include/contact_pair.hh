@@ -104,6 +104,9 @@ public:
     // test whether the pair is in range for interaction
     bool in_range();
 
+    // update the relative state between the facets
+    void update_relstate();
+
     // check to make sure the pair is valid for contact.
     bool is_active();
 
@@ -143,6 +146,9 @@ public:
 protected:
     /**
      * Current relative state between the subject and the target in the subject frame.
+     * It is updated by in_range. When the Contact broad phase culls the pair, in_range
+     * is not called and the state keeps its last value unless
+     * Contact::update_culled_pair_states is set.
      */
     RelativeDerivedState rel_state; //!< trick_units(--)
 
@@ -6,6 +6,7 @@ line_point_contact_pair.cc
 line_contact_facet.cc
 point_contact_pair.cc
 contact.cc
+contact_broad_phase.cc
 line_contact_pair.cc
 contact_params.cc
 contact_surface_factory.cc
@@ -23,11 +23,16 @@
 
  Library dependencies:
     ((contact.cc)
+     (contact_broad_phase.cc)
      (contact_pair.cc))
 
 
 *****************************************************************************/
 
+/* System includes */
+#include <algorithm>
+#include <functional>
+
 /* JEOD includes */
 #include "dynamics/mass/include/mass.hh"
 #include "utils/memory/include/jeod_alloc.hh"
@@ -85,7 +90,12 @@ Contact::~Contact()
  */
 void Contact::check_contact()
 {
-    if(active)
+    if(!active)
+    {
+        return;
+    }
+
+    if(!use_broad_phase)
     {
         std::list<ContactPair *>::iterator cp;
 
@@ -96,6 +106,70 @@ void Contact::check_contact()
                 (*cp)->in_contact();
             }
         }
+        return;
+    }
+
+    sync_pair_registry();
+    if(!broad_phase_valid)
+    {
+        build_broad_phase();
+    }
+
+    // Bound each facet by a box about its vehicle point. All positions are
+    // expressed relative to the first facet, so only relative positions,
+    // which in_range also uses, matter.
+    candidates.clear();
+    if(!broad_phase_facets.empty())
+    {
+        const RefFrame & reference = *(broad_phase_facets.front()->vehicle_point);
+        for(unsigned int ii = 0; ii < broad_phase_facets.size(); ++ii)
+        {
+            double position[3];
+            broad_phase_facets[ii]->vehicle_point->compute_position_from(reference, position);
+            broad_phase.set_entry(ii, position, broad_phase_half_width[ii] + broad_phase_margin);
+        }
+
+        broad_phase.find_overlaps(overlaps);
+        for(const auto & overlap : overlaps)
+        {
+            auto range = culled_pairs.equal_range(
+                make_pair_key(broad_phase_facets[overlap.first], broad_phase_facets[overlap.second]));
+            for(auto entry = range.first; entry != range.second; ++entry)
+            {
+                candidates.push_back(entry->second);
+            }
+        }
+    }
+    candidates.insert(candidates.end(), unculled_pairs.begin(), unculled_pairs.end());
+
+    // Resolve the candidates in pair list order so that the forces are
+    // accumulated in the same order as without the broad phase.
+    std::sort(candidates.begin(), candidates.end());
+    for(unsigned int index : candidates)
+    {
+        ContactPair * pair = broad_phase_pairs[index];
+        if(pair->is_active() && pair->in_range())
+        {
+            pair->in_contact();
+        }
+    }
+
+    // The culled pairs are out of range; their relative states are only
+    // needed by simulations that log them.
+    if(update_culled_pair_states)
+    {
+        auto next = candidates.cbegin();
+        for(unsigned int index = 0; index < broad_phase_pairs.size(); ++index)
+        {
+            while((next != candidates.cend()) && (*next < index))
+            {
+                ++next;
+            }
+            if(((next == candidates.cend()) || (*next != index)) && broad_phase_pairs[index]->is_active())
+            {
+                broad_phase_pairs[index]->update_relstate();
+            }
+        }
     }
 }
 
@@ -129,7 +203,7 @@ void Contact::initialize_contact(DynManager * manager)
                     if(pair != nullptr)
                     {
                         pair->initialize_relstate(dyn_manager);
-                        contact_pairs.push_back(pair);
+                        add_pair(pair);
                     }
                 }
             }
@@ -145,18 +219,123 @@ void Contact::initialize_contact(DynManager * manager)
  */
 bool Contact::unique_pair(const ContactFacet * facet_1, const ContactFacet * facet_2)
 {
-    std::list<ContactPair *>::iterator cp;
+    sync_pair_registry();
+    return pair_registry.count(make_pair_key(facet_1, facet_2)) == 0;
+}
 
-    for(cp = contact_pairs.begin(); cp != contact_pairs.end(); ++cp)
+/**
+ * Form the registry key for a pair of facets. The key does not depend on
+ * the order of the facets.
+ * @return Key with the lower facet address first
+ * \param[in] facet_1 ContactFacet
+ * \param[in] facet_2 ContactFacet
+ */
+ContactFacetPairKey Contact::make_pair_key(const ContactFacet * facet_1, const ContactFacet * facet_2)
+{
+    if(std::less<const ContactFacet *>()(facet_2, facet_1))
     {
-        if(((*cp)->get_subject() == facet_1 && (*cp)->get_target() == facet_2) ||
-           ((*cp)->get_subject() == facet_2 && (*cp)->get_target() == facet_1))
+        return ContactFacetPairKey(facet_2, facet_1);
+    }
+    return ContactFacetPairKey(facet_1, facet_2);
+}
+
+/**
+ * Append a pair to the pair list and, if it is complete, to the registry.
+ * \param[in] pair ContactPair to add
+ */
+void Contact::add_pair(ContactPair * pair)
+{
+    sync_pair_registry();
+
+    contact_pairs.push_back(pair);
+    if(pair->is_complete())
+    {
+        pair_registry.emplace(make_pair_key(pair->get_subject(), pair->get_target()), pair);
+    }
+
+    registry_list_size = contact_pairs.size();
+    registry_list_back = pair;
+    broad_phase_valid = false;
+}
+
+/**
+ * Rebuild the pair registry from the pair list if the list was changed
+ * other than through add_pair, for example by a checkpoint restore.
+ */
+void Contact::sync_pair_registry()
+{
+    ContactPair * list_back = contact_pairs.empty() ? nullptr : contact_pairs.back();
+    if((registry_list_size == contact_pairs.size()) && (registry_list_back == list_back))
+    {
+        return;
+    }
+
+    pair_registry.clear();
+    for(auto * pair : contact_pairs)
+    {
+        if(pair->is_complete())
+        {
+            pair_registry.emplace(make_pair_key(pair->get_subject(), pair->get_target()), pair);
+        }
+    }
+
+    registry_list_size = contact_pairs.size();
+    registry_list_back = list_back;
+    broad_phase_valid = false;
+}
+
+/**
+ * Rebuild the broad phase. Each facet of a pair with a finite interaction
+ * distance becomes a broad phase entry whose box half width is half the
+ * largest interaction distance of the pairs it belongs to; any two facets
+ * in range of one another then have overlapping boxes. Pairs with no
+ * interaction distance limit are always passed on to in_range.
+ */
+void Contact::build_broad_phase()
+{
+    std::unordered_map<const ContactFacet *, unsigned int> facet_index;
+
+    broad_phase_pairs.clear();
+    broad_phase_facets.clear();
+    broad_phase_half_width.clear();
+    culled_pairs.clear();
+    unculled_pairs.clear();
+
+    for(auto * pair : contact_pairs)
+    {
+        if(!pair->is_complete())
         {
-            return false;
+            continue;
+        }
+
+        unsigned int pair_index = static_cast<unsigned int>(broad_phase_pairs.size());
+        broad_phase_pairs.push_back(pair);
+
+        ContactFacet * facets[2] = {pair->get_subject(), pair->get_target()};
+        if((pair->interaction_distance <= 0.0) || (facets[0]->vehicle_point == nullptr) ||
+           (facets[1]->vehicle_point == nullptr))
+        {
+            unculled_pairs.push_back(pair_index);
+            continue;
+        }
+
+        for(auto * facet : facets)
+        {
+            auto found = facet_index.find(facet);
+            if(found == facet_index.end())
+            {
+                found = facet_index.emplace(facet, static_cast<unsigned int>(broad_phase_facets.size())).first;
+                broad_phase_facets.push_back(facet);
+                broad_phase_half_width.push_back(0.0);
+            }
+            double & half_width = broad_phase_half_width[found->second];
+            half_width = std::max(half_width, 0.5 * pair->interaction_distance);
         }
+        culled_pairs.emplace(make_pair_key(facets[0], facets[1]), pair_index);
     }
 
-    return true;
+    broad_phase.resize(static_cast<unsigned int>(broad_phase_facets.size()));
+    broad_phase_valid = true;
 }
 
 /**
@@ -171,7 +350,7 @@ void Contact::register_contact(ContactFacet * facet)
     pair = facet->create_pair();
     if(pair != nullptr)
     {
-        contact_pairs.push_back(pair);
+        add_pair(pair);
     }
 }
 
@@ -205,7 +384,7 @@ void Contact::register_contact(ContactFacet * facet1, ContactFacet * facet2)
     if(pair != nullptr)
     {
         (pair)->initialize_relstate(dyn_manager);
-        contact_pairs.push_back(pair);
+        add_pair(pair);
     }
 }
 
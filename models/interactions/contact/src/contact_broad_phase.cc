@@ -0,0 +1,130 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup Contact
+ * @{
+ *
+ * @file models/interactions/contact/src/contact_broad_phase.cc
+ * Sweep-and-prune broad phase used to cull contact pairs
+ */
+
+/*****************************************************************************
+
+ Purpose:
+    ()
+
+ Reference:
+   (((Baraff, D.) (Dynamic Simulation of Non-Penetrating Rigid Bodies)
+     (Ph.D. thesis, Cornell University) (1992)))
+
+ Assumptions and Limitations:
+     ((N/A))
+
+ Library dependencies:
+    ((contact_broad_phase.cc))
+
+
+*****************************************************************************/
+
+/* System includes */
+#include <cmath>
+
+/* Model includes */
+#include "../include/contact_broad_phase.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+/**
+ * Set the number of entries. All entries are reset to empty boxes at the
+ * origin and the retained sort order is reset to the index order.
+ * \param[in] num_entries Number of entries
+ */
+void ContactBroadPhase::resize(unsigned int num_entries)
+{
+    centers.assign(3 * num_entries, 0.0);
+    half_width.assign(num_entries, 0.0);
+    order.resize(num_entries);
+    for(unsigned int ii = 0; ii < num_entries; ++ii)
+    {
+        order[ii] = ii;
+    }
+}
+
+/**
+ * Set the center and half width of an entry's box.
+ * \param[in] index Entry index
+ * \param[in] center Box center\n Units: M
+ * \param[in] half_width_in Box half width\n Units: M
+ */
+void ContactBroadPhase::set_entry(unsigned int index, const double center[3], double half_width_in)
+{
+    centers[3 * index] = center[0];
+    centers[3 * index + 1] = center[1];
+    centers[3 * index + 2] = center[2];
+    half_width[index] = half_width_in;
+}
+
+/**
+ * Find all pairs of entries whose boxes overlap. Boxes that just touch
+ * are reported as overlapping.
+ * \param[out] overlaps Overlapping index pairs, lower index first
+ */
+void ContactBroadPhase::find_overlaps(std::vector<Overlap> & overlaps)
+{
+    overlaps.clear();
+
+    const unsigned int num_entries = size();
+
+    // Re-sort on the lower x bound. Insertion sort is linear when the
+    // retained order is already nearly correct, as it is from one cycle to
+    // the next.
+    for(unsigned int ii = 1; ii < num_entries; ++ii)
+    {
+        unsigned int idx = order[ii];
+        double lower = centers[3 * idx] - half_width[idx];
+        unsigned int jj = ii;
+        while((jj > 0) && (centers[3 * order[jj - 1]] - half_width[order[jj - 1]] > lower))
+        {
+            order[jj] = order[jj - 1];
+            --jj;
+        }
+        order[jj] = idx;
+    }
+
+    // Sweep along x. Every entry whose lower x bound lies within the current
+    // entry's x extent overlaps it in x; test the other two axes directly.
+    for(unsigned int ii = 0; ii < num_entries; ++ii)
+    {
+        unsigned int idx = order[ii];
+        const double * center_ii = &centers[3 * idx];
+        double upper = center_ii[0] + half_width[idx];
+
+        for(unsigned int jj = ii + 1; jj < num_entries; ++jj)
+        {
+            unsigned int jdx = order[jj];
+            const double * center_jj = &centers[3 * jdx];
+            if(center_jj[0] - half_width[jdx] > upper)
+            {
+                break;
+            }
+
+            double reach = half_width[idx] + half_width[jdx];
+            if((std::fabs(center_ii[1] - center_jj[1]) <= reach) && (std::fabs(center_ii[2] - center_jj[2]) <= reach))
+            {
+                overlaps.push_back((idx < jdx) ? Overlap(idx, jdx) : Overlap(jdx, idx));
+            }
+        }
+    }
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -57,6 +57,14 @@ bool ContactPair::in_range()
     return false;
 }
 
+/**
+ * update the relative state between the facets without testing the range
+ */
+void ContactPair::update_relstate()
+{
+    rel_state.update();
+}
+
 /**
  * Determine if contact can occur between the two facets.
  * @return bool
@@ -0,0 +1,230 @@
+// Scaling benchmark for the contact broad phase and pair registry.
+// For each facet count, the pairs in range are found by brute force and by
+// ContactBroadPhase followed by the exact range test; the two sets must
+// agree. Pair registration through the hash registry is timed against the
+// linear duplicate scan it replaced.
+
+// System includes
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// JEOD includes
+#include "interactions/contact/include/contact.hh"
+#include "interactions/contact/include/contact_broad_phase.hh"
+#include "test_harness/include/cmdline_parser.hh"
+
+using namespace std;
+using namespace jeod;
+
+static constexpr unsigned int NUM_CASES = 6;
+static const unsigned int facet_counts[NUM_CASES] = {10, 50, 100, 500, 1000, 5000};
+
+// Largest facet count for which the linear duplicate scan is timed.
+static constexpr unsigned int MAX_LINEAR_SCAN = 200;
+
+// Largest facet count for which pair registration is timed.
+static constexpr unsigned int MAX_REGISTRATION = 1000;
+
+// Contact limit factor applied to the facet dimensions.
+static constexpr double LIMIT_FACTOR = 2.0;
+
+static unsigned long seed = 12345;
+
+static double uniform()
+{
+    seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+    return static_cast<double>(seed) / 2147483648.0;
+}
+
+static double elapsed_ms(chrono::steady_clock::time_point start, chrono::steady_clock::time_point stop)
+{
+    return chrono::duration<double, milli>(stop - start).count();
+}
+
+int main(int argc, char * argv[])
+{
+    CmdlineParser cmdline_parser;
+    int num_cycles;
+
+    cmdline_parser.add_int("NumCycles", 10, &num_cycles);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_cycles <= 0)
+    {
+        cerr << "NumCycles must be positive." << endl;
+        return 1;
+    }
+
+    int rv = 0;
+
+    cout << setw(8) << "facets" << setw(12) << "in range" << setw(12) << "overlaps" << setw(16) << "brute ms/cyc"
+         << setw(16) << "broad ms/cyc" << setw(14) << "hash reg ms" << setw(14) << "list reg ms" << endl;
+
+    for(unsigned int kk = 0; kk < NUM_CASES; ++kk)
+    {
+        unsigned int nfacets = facet_counts[kk];
+
+        // Facets scattered through a cube sized for a constant density.
+        double side = 4.0 * cbrt(static_cast<double>(nfacets));
+        vector<double> position(3 * nfacets);
+        vector<double> max_dimension(nfacets);
+        double largest = 0.0;
+        for(unsigned int ii = 0; ii < nfacets; ++ii)
+        {
+            for(unsigned int jj = 0; jj < 3; ++jj)
+            {
+                position[3 * ii + jj] = side * uniform();
+            }
+            max_dimension[ii] = 0.1 + 0.4 * uniform();
+            largest = max_dimension[ii] > largest ? max_dimension[ii] : largest;
+        }
+
+        auto in_range = [&](unsigned int ii, unsigned int jj)
+        {
+            double dx = position[3 * ii] - position[3 * jj];
+            double dy = position[3 * ii + 1] - position[3 * jj + 1];
+            double dz = position[3 * ii + 2] - position[3 * jj + 2];
+            double limit = (max_dimension[ii] + max_dimension[jj]) * LIMIT_FACTOR;
+            return sqrt(dx * dx + dy * dy + dz * dz) <= limit;
+        };
+
+        // Every facet may pair with every other, as with Contact's
+        // all-inclusive registration, so each half width is bounded by the
+        // facet's pairing with the largest facet.
+        ContactBroadPhase broad_phase;
+        vector<ContactBroadPhase::Overlap> overlaps;
+        broad_phase.resize(nfacets);
+
+        unsigned int brute_count = 0;
+        unsigned int broad_count = 0;
+        unsigned int overlap_count = 0;
+        double brute_ms = 0.0;
+        double broad_ms = 0.0;
+
+        for(int cycle = 0; cycle < num_cycles; ++cycle)
+        {
+            // Drift the facets a little each cycle.
+            for(unsigned int ii = 0; ii < 3 * nfacets; ++ii)
+            {
+                position[ii] += 0.05 * (uniform() - 0.5);
+            }
+
+            auto start = chrono::steady_clock::now();
+            brute_count = 0;
+            for(unsigned int ii = 0; ii < nfacets; ++ii)
+            {
+                for(unsigned int jj = ii + 1; jj < nfacets; ++jj)
+                {
+                    brute_count += in_range(ii, jj) ? 1 : 0;
+                }
+            }
+            auto middle = chrono::steady_clock::now();
+
+            for(unsigned int ii = 0; ii < nfacets; ++ii)
+            {
+                double half_width = 0.5 * (max_dimension[ii] + largest) * LIMIT_FACTOR;
+                broad_phase.set_entry(ii, &position[3 * ii], half_width);
+            }
+            broad_phase.find_overlaps(overlaps);
+            broad_count = 0;
+            for(const auto & overlap : overlaps)
+            {
+                broad_count += in_range(overlap.first, overlap.second) ? 1 : 0;
+            }
+            auto stop = chrono::steady_clock::now();
+
+            overlap_count = static_cast<unsigned int>(overlaps.size());
+            brute_ms += elapsed_ms(start, middle);
+            broad_ms += elapsed_ms(middle, stop);
+
+            if(broad_count != brute_count)
+            {
+                cout << "Broad phase missed " << brute_count - broad_count << " pairs with " << nfacets
+                     << " facets" << endl;
+                rv = 1;
+            }
+        }
+
+        // Pair registration. Facet addresses are stood in for by the
+        // addresses of the position entries.
+        vector<const ContactFacet *> facets(nfacets);
+        for(unsigned int ii = 0; ii < nfacets; ++ii)
+        {
+            facets[ii] = reinterpret_cast<const ContactFacet *>(&position[3 * ii]);
+        }
+
+        double hash_ms = -1.0;
+        if(nfacets <= MAX_REGISTRATION)
+        {
+            auto start = chrono::steady_clock::now();
+            unordered_multimap<ContactFacetPairKey, unsigned int, ContactFacetPairHash> registry;
+            for(unsigned int ii = 0; ii < nfacets; ++ii)
+            {
+                for(unsigned int jj = 0; jj < nfacets; ++jj)
+                {
+                    ContactFacetPairKey key = (ii < jj) ? ContactFacetPairKey(facets[ii], facets[jj])
+                                                        : ContactFacetPairKey(facets[jj], facets[ii]);
+                    if((ii != jj) && (registry.count(key) == 0))
+                    {
+                        registry.emplace(key, ii);
+                    }
+                }
+            }
+            hash_ms = elapsed_ms(start, chrono::steady_clock::now());
+        }
+
+        double list_ms = -1.0;
+        if(nfacets <= MAX_LINEAR_SCAN)
+        {
+            auto start = chrono::steady_clock::now();
+            list<ContactFacetPairKey> registry;
+            for(unsigned int ii = 0; ii < nfacets; ++ii)
+            {
+                for(unsigned int jj = 0; jj < nfacets; ++jj)
+                {
+                    bool unique = (ii != jj);
+                    for(auto entry = registry.begin(); unique && (entry != registry.end()); ++entry)
+                    {
+                        unique = !((entry->first == facets[ii] && entry->second == facets[jj]) ||
+                                   (entry->first == facets[jj] && entry->second == facets[ii]));
+                    }
+                    if(unique)
+                    {
+                        registry.emplace_back(facets[ii], facets[jj]);
+                    }
+                }
+            }
+            list_ms = elapsed_ms(start, chrono::steady_clock::now());
+        }
+
+        cout << setw(8) << nfacets << setw(12) << brute_count << setw(12) << overlap_count << fixed
+             << setprecision(3) << setw(16) << brute_ms / num_cycles << setw(16) << broad_ms / num_cycles;
+        if(hash_ms >= 0.0)
+        {
+            cout << setw(14) << hash_ms;
+        }
+        else
+        {
+            cout << setw(14) << "skipped";
+        }
+        if(list_ms >= 0.0)
+        {
+            cout << setw(14) << list_ms;
+        }
+        else
+        {
+            cout << setw(14) << "skipped";
+        }
+        cout << endl;
+        cout.unsetf(ios::floatfield);
+    }
+
+    return rv;
+}
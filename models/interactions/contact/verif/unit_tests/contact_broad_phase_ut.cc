@@ -0,0 +1,53 @@
+/*
+ * contact_broad_phase_ut.cc
+ */
+
+#include "interactions/contact/include/contact_broad_phase.hh"
+
+#include <algorithm>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace jeod;
+
+TEST(ContactBroadPhase, create)
+{
+    ContactBroadPhase staticInst;
+    ContactBroadPhase * dynInst = new ContactBroadPhase;
+    delete dynInst;
+}
+
+TEST(ContactBroadPhase, resize) {}
+
+TEST(ContactBroadPhase, set_entry) {}
+
+TEST(ContactBroadPhase, find_overlaps)
+{
+    ContactBroadPhase broad_phase;
+    std::vector<ContactBroadPhase::Overlap> overlaps;
+    double center_0[3] = {0.0, 0.0, 0.0};
+    double center_1[3] = {1.5, 0.0, 0.0};
+    double center_2[3] = {1.5, 3.0, 0.0};
+    double center_3[3] = {-10.0, 0.0, 0.0};
+
+    broad_phase.resize(4);
+    broad_phase.set_entry(0, center_0, 1.0);
+    broad_phase.set_entry(1, center_1, 1.0);
+    broad_phase.set_entry(2, center_2, 1.0);
+    broad_phase.set_entry(3, center_3, 1.0);
+    broad_phase.find_overlaps(overlaps);
+
+    ASSERT_EQ(1u, overlaps.size());
+    EXPECT_EQ(0u, overlaps[0].first);
+    EXPECT_EQ(1u, overlaps[0].second);
+
+    // Move entry 3 next to entry 2; the retained order must be re-sorted.
+    double moved_3[3] = {2.0, 4.0, 0.5};
+    broad_phase.set_entry(3, moved_3, 1.0);
+    broad_phase.find_overlaps(overlaps);
+
+    ASSERT_EQ(2u, overlaps.size());
+    EXPECT_NE(overlaps.end(), std::find(overlaps.begin(), overlaps.end(), ContactBroadPhase::Overlap(0, 1)));
+    EXPECT_NE(overlaps.end(), std::find(overlaps.begin(), overlaps.end(), ContactBroadPhase::Overlap(2, 3)));
+}
@@ -11,6 +11,8 @@ using namespace jeod;
 
 TEST(ContactPair, in_range) {}
 
+TEST(ContactPair, update_relstate) {}
+
 TEST(ContactPair, is_active) {}
 
 TEST(ContactPair, is_complete) {}
@@ -0,0 +1,174 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2025 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup RadiationPressure
+ * @{
+ *
+ * @file models/interactions/radiation_pressure/include/flat_plate_radiation_batch.hh
+ * Structure-of-arrays evaluation of the radiation interaction with a surface
+ * made entirely of flat plates
+ */
+
+/************************** TRICK HEADER***************************************
+PURPOSE:
+()
+
+REFERENCE:
+(((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+((Every facet of the surface is exactly a FlatPlateRadiationFacet))
+
+Library dependencies:
+((../src/flat_plate_radiation_batch.cc))
+
+
+*******************************************************************************/
+
+#ifndef JEOD_FLAT_PLATE_RADIATION_BATCH_HH
+#define JEOD_FLAT_PLATE_RADIATION_BATCH_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+// Model includes
+
+//! Namespace jeod
+namespace jeod
+{
+
+class FlatPlateRadiationFacet;
+class RadiationFacet;
+class RadiationSurface;
+
+/**
+ * Computes the primary source interaction and the radiation pressure on a
+ * RadiationSurface whose facets are all FlatPlateRadiationFacet objects
+ * without a virtual call per facet.
+ *
+ * When a surface is prepared, the plates' areas, diffuse fractions, moment
+ * arms and normals are copied into structure-of-arrays columns. Each call
+ * reads the normals of articulated plates and evaluates the plates in one
+ * pass, storing the per-plate values that the thermal model and the third
+ * body interactions use. The surface force and torque are summed in facet
+ * order, so the results match the per-facet FlatPlateRadiationFacet methods.
+ * The copied parameters are compared with the plates on each call, and the
+ * surface is prepared again when a plate has changed.
+ */
+class FlatPlateRadiationBatch
+{
+    JEOD_MAKE_SIM_INTERFACES(jeod, FlatPlateRadiationBatch)
+
+public:
+    FlatPlateRadiationBatch() = default;
+    virtual ~FlatPlateRadiationBatch() = default;
+    FlatPlateRadiationBatch(const FlatPlateRadiationBatch &) = delete;
+    FlatPlateRadiationBatch & operator=(const FlatPlateRadiationBatch &) = delete;
+
+    // Set up for a surface; returns false if the surface is not all flat plates
+    bool prepare(RadiationSurface & surface);
+
+    // Forget the prepared surface, so that the plates are read again
+    void reset();
+
+    // Compute the plates' interaction with the primary source
+    void incident_radiation(double flux_mag, const double flux_struc_hat[3], bool calculate_forces);
+
+    // Complete the plate forces and sum the force and torque on the surface
+    void radiation_pressure(double force[3], double torque[3]);
+
+    /**
+     * Read the plate normals on every call. Clear this for a surface whose
+     * plates do not articulate; they are then only compared with the
+     * prepared copy, and the surface is prepared again if a plate has moved.
+     */
+    bool read_geometry{true}; //!< trick_units(--)
+
+protected:
+    /**
+     * Facet array of the surface last prepared.
+     */
+    RadiationFacet ** surface_facets{}; //!< trick_units(--)
+
+    /**
+     * Size of surface_facets.
+     */
+    unsigned int num_plates{}; //!< trick_units(count)
+
+    /**
+     * Is every facet of the prepared surface a FlatPlateRadiationFacet?
+     */
+    bool all_flat_plates{}; //!< trick_units(--)
+
+    /**
+     * Have the normal columns been read since the last radiation_pressure?
+     */
+    bool normals_current{}; //!< trick_units(--)
+
+    /**
+     * The plates, in facet order.
+     */
+    std::vector<FlatPlateRadiationFacet *> plates; //!< trick_io(**)
+
+    /**
+     * Structure-of-arrays columns, each num_plates long.
+     */
+    std::vector<double> work; //!< trick_io(**)
+
+    // Copy the normals of a range of plates into the normal columns
+    void read_normals(unsigned int first, unsigned int last);
+
+    // Have the prepared plates changed since they were copied?
+    bool plates_changed() const;
+};
+
+} // namespace jeod
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
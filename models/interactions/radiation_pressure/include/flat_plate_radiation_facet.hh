@@ -87,6 +87,8 @@ class FlatPlateRadiationFacet : public RadiationFacet
 {
     JEOD_MAKE_SIM_INTERFACES(jeod, FlatPlateRadiationFacet)
 
+    friend class FlatPlateRadiationBatch;
+
     // Member data
 
 public:
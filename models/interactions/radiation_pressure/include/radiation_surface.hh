@@ -70,6 +70,7 @@ Library dependencies:
 #include "utils/surface_model/include/interaction_surface.hh"
 
 // Model includes
+#include "flat_plate_radiation_batch.hh"
 
 //! Namespace jeod
 namespace jeod
@@ -129,6 +130,20 @@ public:
      */
     unsigned int ii_facet{}; //!< trick_units(--)
 
+    /**
+     * Evaluate a surface made entirely of FlatPlateRadiationFacet objects
+     * in one pass over the plates rather than with one virtual call per
+     * facet. Surfaces with any other kind of facet always
+     * use the per-facet path.
+     */
+    bool use_flat_plate_batch{true}; //!< trick_units(--)
+
+    /**
+     * Flat plate evaluation used when use_flat_plate_batch is set. Changes to
+     * the plates are detected and picked up on the next call.
+     */
+    FlatPlateRadiationBatch flat_plate_batch; //!< trick_units(--)
+
     // Member functions
 public:
     RadiationSurface();
@@ -147,6 +147,30 @@ public:
      */
     RefFrame * local_frame_ptr{}; //!< trick_units(--)
 
+    /**
+     * Skip the shadow calculation while the vehicle cannot yet have reached
+     * the penumbra. After each calculation that finds the vehicle in full
+     * light, the time needed to reach the edge of the shadow is bounded from
+     * the vehicle's distance to that edge and its rate of motion relative to
+     * the shadow since the previous calculation; no calculation is made
+     * before that time. Third body state updates are deferred likewise.
+     * Default: false
+     */
+    bool predict_eclipses{}; //!< trick_units(--)
+
+    /**
+     * Factor by which the rate of motion relative to the shadow is assumed
+     * to exceed its average over the previous calculation interval when
+     * predicting eclipses.
+     */
+    double prediction_speed_factor{2.0}; //!< trick_units(--)
+
+    /**
+     * Longest time for which the shadow calculation is skipped when
+     * predicting eclipses.
+     */
+    double max_prediction_interval{60.0}; //!< trick_units(s)
+
 protected:
     // Reference data:
     /**
@@ -226,6 +250,33 @@ protected:
      */
     double source_to_third_hat_inrtl[3]{}; //!< trick_units(--)
 
+    // Eclipse prediction data:
+    /**
+     * Flag indicating that the prediction data describe a previous shadow
+     * calculation.
+     */
+    bool have_prediction_history{}; //!< trick_units(--)
+
+    /**
+     * Time of the last shadow calculation made while predicting eclipses.
+     */
+    double last_shadow_time{}; //!< trick_units(s)
+
+    /**
+     * third_to_cg_inrtl at the last shadow calculation.
+     */
+    double last_third_to_cg[3]{}; //!< trick_units(m)
+
+    /**
+     * source_to_third_hat_inrtl at the last shadow calculation.
+     */
+    double last_source_to_third_hat[3]{}; //!< trick_units(--)
+
+    /**
+     * Time before which the vehicle is known to be in full light.
+     */
+    double full_light_until{}; //!< trick_units(s)
+
     // Member functions
 public:
     RadiationThirdBody() = default;
@@ -239,6 +290,11 @@ public:
 
     virtual double process_third_body(double real_time, RefFrame & veh_struc_frame);
 
+    void evaluate_shadows(double real_time,
+                          unsigned int num_vehicles,
+                          const double * source_to_cg,
+                          double * illum_factors);
+
     /**
      * Setter for the name.
      */
@@ -296,6 +352,8 @@ protected:
     double generate_alpha(double rho_adj, double delta);
     bool test_for_state_update(double time);
     void calculate_shadow();
+    double compute_illumination(const double source_to_cg[3], double d_source_to_cg);
+    void predict_full_light(double real_time);
     virtual bool update_third_body_state();
 };
 
@@ -14,6 +14,7 @@ radiation_surface_factory.cc
 radiation_third_body.cc
 radiation_pressure.cc
 flat_plate_radiation_facet.cc
+flat_plate_radiation_batch.cc
 )
 
 foreach(SRC ${SRCS})
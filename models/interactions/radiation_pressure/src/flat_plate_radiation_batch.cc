@@ -0,0 +1,326 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Interactions
+ * @{
+ * @addtogroup RadiationPressure
+ * @{
+ *
+ * @file models/interactions/radiation_pressure/src/flat_plate_radiation_batch.cc
+ * Structure-of-arrays evaluation of the radiation interaction with a surface
+ * made entirely of flat plates
+ */
+
+/*****************************************************************************
+PURPOSE:
+()
+
+REFERENCE:
+(((None)))
+
+ASSUMPTIONS AND LIMITATIONS:
+((Every facet of the surface is exactly a FlatPlateRadiationFacet))
+
+LIBRARY DEPENDENCY:
+((flat_plate_radiation_batch.cc)
+(flat_plate_radiation_facet.cc)
+(radiation_messages.cc)
+(interactions/thermal_rider/src/thermal_integrable_object.cc)
+(utils/message/src/message_handler.cc))
+
+
+
+******************************************************************************/
+
+// System includes
+#include <cstddef>
+#include <typeinfo>
+
+// JEOD includes
+#include "utils/math/include/numerical.hh"
+#include "utils/message/include/message_handler.hh"
+#include "utils/surface_model/include/facet.hh"
+
+// Model includes
+#include "../include/flat_plate_radiation_batch.hh"
+#include "../include/flat_plate_radiation_facet.hh"
+#include "../include/radiation_messages.hh"
+#include "../include/radiation_surface.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+namespace
+{
+/**
+ * Columns used by FlatPlateRadiationBatch. The areas, diffuse fractions and
+ * moment arms are set when the surface is prepared; the normals may be read
+ * on each call.
+ */
+enum Column
+{
+    col_area,
+    col_diffuse,
+    col_nx,
+    col_ny,
+    col_nz,
+    col_rx,
+    col_ry,
+    col_rz,
+    num_columns
+};
+} // namespace
+
+/**
+ * Set up for a surface: copy the plates' areas, diffuse fractions, moment
+ * arms and normals. Nothing is done unless the surface's facet array or a
+ * prepared plate has changed since the last call or since reset.
+ * @return True if every facet of the surface is a FlatPlateRadiationFacet
+ * \param[in] surface The radiation surface, already initialized
+ */
+bool FlatPlateRadiationBatch::prepare(RadiationSurface & surface)
+{
+    if((surface.facets == surface_facets) && (surface.num_facets == num_plates) &&
+       !(all_flat_plates && plates_changed()))
+    {
+        return all_flat_plates;
+    }
+
+    surface_facets = surface.facets;
+    num_plates = surface.num_facets;
+    all_flat_plates = (surface_facets != nullptr) && (num_plates > 0);
+    for(unsigned int ii = 0; all_flat_plates && (ii < num_plates); ++ii)
+    {
+        RadiationFacet * facet = surface_facets[ii];
+        all_flat_plates = (facet != nullptr) && (typeid(*facet) == typeid(FlatPlateRadiationFacet));
+    }
+    if(!all_flat_plates)
+    {
+        plates.clear();
+        work.clear();
+        return false;
+    }
+
+    plates.resize(num_plates);
+    work.assign(num_columns * static_cast<std::size_t>(num_plates), 0.0);
+    for(unsigned int ii = 0; ii < num_plates; ++ii)
+    {
+        auto * plate = static_cast<FlatPlateRadiationFacet *>(surface_facets[ii]);
+        plates[ii] = plate;
+        work[col_area * num_plates + ii] = plate->base_facet->area;
+        work[col_diffuse * num_plates + ii] = plate->diffuse;
+        for(unsigned int kk = 0; kk < 3; ++kk)
+        {
+            work[(col_rx + kk) * num_plates + ii] = plate->crot_to_cp[kk];
+        }
+    }
+    read_normals(0, num_plates);
+    return true;
+}
+
+/**
+ * Forget the prepared surface. The next prepare reads the plates again.
+ */
+void FlatPlateRadiationBatch::reset()
+{
+    surface_facets = nullptr;
+    num_plates = 0;
+    all_flat_plates = false;
+    normals_current = false;
+}
+
+/**
+ * Have the prepared plates changed since they were copied? A plate that has
+ * been replaced, or whose area, diffuse fraction, moment arm or, when
+ * read_geometry is clear, normal differs from the copy has changed.
+ * @return True if the surface must be prepared again
+ */
+bool FlatPlateRadiationBatch::plates_changed() const
+{
+    for(unsigned int ii = 0; ii < num_plates; ++ii)
+    {
+        const FlatPlateRadiationFacet * plate = plates[ii];
+        if((surface_facets[ii] != plate) ||
+           !Numerical::compare_exact(plate->base_facet->area, work[col_area * num_plates + ii]) ||
+           !Numerical::compare_exact(plate->diffuse, work[col_diffuse * num_plates + ii]))
+        {
+            return true;
+        }
+        for(unsigned int kk = 0; kk < 3; ++kk)
+        {
+            if(!Numerical::compare_exact(plate->crot_to_cp[kk], work[(col_rx + kk) * num_plates + ii]) ||
+               (!read_geometry && !Numerical::compare_exact(plate->normal[kk], work[(col_nx + kk) * num_plates + ii])))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Copy the normals of a range of plates into the normal columns.
+ * \param[in] first First plate of the range
+ * \param[in] last One past the last plate of the range
+ */
+void FlatPlateRadiationBatch::read_normals(unsigned int first, unsigned int last)
+{
+    double * nx = work.data() + col_nx * static_cast<std::size_t>(num_plates);
+    double * ny = work.data() + col_ny * static_cast<std::size_t>(num_plates);
+    double * nz = work.data() + col_nz * static_cast<std::size_t>(num_plates);
+    for(unsigned int ii = first; ii < last; ++ii)
+    {
+        const double * normal = plates[ii]->normal;
+        nx[ii] = normal[0];
+        ny[ii] = normal[1];
+        nz[ii] = normal[2];
+    }
+}
+
+/**
+ * Compute the prepared plates' interaction with the primary source, as
+ * FlatPlateRadiationFacet::incident_radiation does for each plate.
+ * \param[in] flux_mag Magnitude of incident flux
+ * \param[in] flux_struc_hat unit vector of incident flux
+ * \param[in] calculate_forces boolean indicating whether to calculate forces.
+ */
+void FlatPlateRadiationBatch::incident_radiation(double flux_mag,
+                                                 const double flux_struc_hat[3],
+                                                 bool calculate_forces)
+{
+    const double * area = work.data() + col_area * static_cast<std::size_t>(num_plates);
+    const double * diffuse = work.data() + col_diffuse * static_cast<std::size_t>(num_plates);
+    const double * nx = work.data() + col_nx * static_cast<std::size_t>(num_plates);
+    const double * ny = work.data() + col_ny * static_cast<std::size_t>(num_plates);
+    const double * nz = work.data() + col_nz * static_cast<std::size_t>(num_plates);
+
+    if(read_geometry)
+    {
+        read_normals(0, num_plates);
+    }
+    normals_current = true;
+
+    const double f0 = flux_struc_hat[0];
+    const double f1 = flux_struc_hat[1];
+    const double f2 = flux_struc_hat[2];
+    const double two_thirds = FlatPlateRadiationFacet::two_thirds;
+    const double speed_of_light = FlatPlateRadiationFacet::speed_of_light;
+    for(unsigned int ii = 0; ii < num_plates; ++ii)
+    {
+        FlatPlateRadiationFacet & plate = *plates[ii];
+        double sin_theta = -(f0 * nx[ii] + f1 * ny[ii] + f2 * nz[ii]);
+        plate.sin_theta = sin_theta;
+        if(sin_theta < 0)
+        { /* plate is not illuminated */
+            continue;
+        }
+        double albedo = plate.albedo;
+        plate.cx_area = area[ii] * sin_theta;
+        plate.areaxflux_e = plate.cx_area * flux_mag;
+        plate.thermal.power_absorb += (1.0 - albedo) * plate.areaxflux_e;
+        if(!calculate_forces)
+        {
+            continue;
+        }
+
+        double areaxflux = plate.areaxflux_e / speed_of_light;
+        double absorbed = areaxflux * (1.0 - albedo);
+        double ref_flux = areaxflux * albedo;
+        double diffuse_flux = diffuse[ii] * ref_flux;
+        double specular_flux = 2 * (diffuse[ii] - 1) * ref_flux * sin_theta;
+        plate.areaxflux = areaxflux;
+        plate.F_absorption[0] += f0 * absorbed;
+        plate.F_absorption[1] += f1 * absorbed;
+        plate.F_absorption[2] += f2 * absorbed;
+        plate.F_diffuse[0] += (f0 - nx[ii] * two_thirds) * diffuse_flux;
+        plate.F_diffuse[1] += (f1 - ny[ii] * two_thirds) * diffuse_flux;
+        plate.F_diffuse[2] += (f2 - nz[ii] * two_thirds) * diffuse_flux;
+        plate.F_specular[0] += nx[ii] * specular_flux;
+        plate.F_specular[1] += ny[ii] * specular_flux;
+        plate.F_specular[2] += nz[ii] * specular_flux;
+    }
+}
+
+/**
+ * Complete the prepared plates' forces and torques, as
+ * FlatPlateRadiationFacet::radiation_pressure does for each plate, and sum
+ * them in facet order.
+ * \param[out] force Force on the surface\n Units: N
+ * \param[out] torque Torque on the surface\n Units: N*m
+ */
+void FlatPlateRadiationBatch::radiation_pressure(double force[3], double torque[3])
+{
+    const double * nx = work.data() + col_nx * static_cast<std::size_t>(num_plates);
+    const double * ny = work.data() + col_ny * static_cast<std::size_t>(num_plates);
+    const double * nz = work.data() + col_nz * static_cast<std::size_t>(num_plates);
+    const double * rx = work.data() + col_rx * static_cast<std::size_t>(num_plates);
+    const double * ry = work.data() + col_ry * static_cast<std::size_t>(num_plates);
+    const double * rz = work.data() + col_rz * static_cast<std::size_t>(num_plates);
+
+    // The normals are current if the primary source was evaluated.
+    if(read_geometry && !normals_current)
+    {
+        read_normals(0, num_plates);
+    }
+    normals_current = false;
+
+    const double two_thirds = FlatPlateRadiationFacet::two_thirds;
+    const double speed_of_light = FlatPlateRadiationFacet::speed_of_light;
+    force[0] = force[1] = force[2] = 0.0;
+    torque[0] = torque[1] = torque[2] = 0.0;
+    for(unsigned int ii = 0; ii < num_plates; ++ii)
+    {
+        FlatPlateRadiationFacet & plate = *plates[ii];
+        if(plate.thermal.integrable_object.active)
+        {
+            plate.thermal.integrable_object.compute_temp_dot();
+        }
+
+        if(plate.thermal.power_emit < 0)
+        {
+            MessageHandler::fail(__FILE__,
+                                 __LINE__,
+                                 RadiationMessages::unknown_numerical_error,
+                                 "\n"
+                                 "On facet(%s), the calculation of emitted power yielded negative emission"
+                                 ",\n which is a non-physical situation corresponding to emission \n"
+                                 "producing a net gain in thermal energy.\n",
+                                 plate.base_facet->name.c_str());
+        }
+        else
+        {
+            double emission = -two_thirds * plate.thermal.power_emit / speed_of_light;
+            plate.F_emission[0] = nx[ii] * emission;
+            plate.F_emission[1] = ny[ii] * emission;
+            plate.F_emission[2] = nz[ii] * emission;
+        }
+
+        double fx = plate.F_absorption[0] + plate.F_specular[0] + plate.F_diffuse[0] + plate.F_emission[0];
+        double fy = plate.F_absorption[1] + plate.F_specular[1] + plate.F_diffuse[1] + plate.F_emission[1];
+        double fz = plate.F_absorption[2] + plate.F_specular[2] + plate.F_diffuse[2] + plate.F_emission[2];
+        double tx = ry[ii] * fz - rz[ii] * fy;
+        double ty = rz[ii] * fx - rx[ii] * fz;
+        double tz = rx[ii] * fy - ry[ii] * fx;
+        plate.force[0] = fx;
+        plate.force[1] = fy;
+        plate.force[2] = fz;
+        plate.torque[0] = tx;
+        plate.torque[1] = ty;
+        plate.torque[2] = tz;
+        force[0] += fx;
+        force[1] += fy;
+        force[2] += fz;
+        torque[0] += tx;
+        torque[1] += ty;
+        torque[2] += tz;
+    }
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ */
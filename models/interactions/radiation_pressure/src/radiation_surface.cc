@@ -23,6 +23,7 @@ ASSUMPTIONS AND LIMITATIONS:
 Library dependencies:
 ((radiation_surface.cc)
 (radiation_facet.cc)
+(flat_plate_radiation_batch.cc)
 (radiation_messages.cc)
 (interactions/thermal_rider/src/thermal_facet_rider.cc)
 (utils/message/src/message_handler.cc))
@@ -86,6 +87,7 @@ void RadiationSurface::initialize(double center_grav[3])
     {
         facets[ii_facet]->initialize_geom(center_grav);
     }
+    flat_plate_batch.reset();
 
     for(ii_facet = 0; ii_facet < num_facets; ++ii_facet)
     {
@@ -229,6 +231,13 @@ void RadiationSurface::allocate_interaction_facet(Facet * facet,
  */
 void RadiationSurface::incident_radiation(double flux_mag, const double flux_struc_hat[3], bool calculate_forces)
 {
+    // Surfaces made only of flat plates are evaluated together.
+    if(use_flat_plate_batch && flat_plate_batch.prepare(*this))
+    {
+        flat_plate_batch.incident_radiation(flux_mag, flux_struc_hat, calculate_forces);
+        return;
+    }
+
     for(ii_facet = 0; ii_facet < num_facets; ++ii_facet)
     {
         facets[ii_facet]->incident_radiation(flux_mag, flux_struc_hat, calculate_forces);
@@ -295,6 +304,12 @@ void RadiationSurface::equalize_absorption_emission()
  */
 void RadiationSurface::radiation_pressure()
 {
+    if(use_flat_plate_batch && flat_plate_batch.prepare(*this))
+    {
+        flat_plate_batch.radiation_pressure(force, torque);
+        return;
+    }
+
     Vector3::initialize(force);
     Vector3::initialize(torque);
 
@@ -31,6 +31,8 @@ LIBRARY DEPENDENCY:
 ******************************************************************************/
 
 // System includes
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 
 // JEOD includes
@@ -185,11 +187,25 @@ void RadiationThirdBody::initialize(DynManager * dyn_mgr_ptr)
 }
 
 /**
- * Calculates the effect of shadowing by a third body.
+ * Calculates the effect of shadowing by a third body on the vehicle
+ * illuminated by the primary source.
  */
 void RadiationThirdBody::calculate_shadow()
 {
-    Vector3::diff(primary_source_ptr->source_to_cg, source_to_third_inrtl, third_to_cg_inrtl);
+    illum_factor = compute_illumination(primary_source_ptr->source_to_cg, primary_source_ptr->d_source_to_cg);
+}
+
+/**
+ * Calculates the effect of shadowing by a third body on a vehicle, given the
+ * vehicle's position relative to the primary source. Sets third_to_cg_inrtl,
+ * r_par and r_perp as a side effect.
+ * @return Illumination factor
+ * \param[in] source_to_cg Vector from the primary source to the vehicle center of gravity\n Units: m
+ * \param[in] d_source_to_cg Magnitude of source_to_cg\n Units: m
+ */
+double RadiationThirdBody::compute_illumination(const double source_to_cg[3], double d_source_to_cg)
+{
+    Vector3::diff(source_to_cg, source_to_third_inrtl, third_to_cg_inrtl);
 
     // r_par is the component of that vector aligned with the sun-body vector
     // r_perp is the component perpendicular to r_par.
@@ -200,8 +216,7 @@ void RadiationThirdBody::calculate_shadow()
     // vehicle:
     if(r_par < 0)
     {
-        illum_factor = 1;
-        return;
+        return 1;
     }
 
     // Otherwise, continue with the calculation.
@@ -222,8 +237,7 @@ void RadiationThirdBody::calculate_shadow()
                               "Putting the vehicle in total shadow and exiting.\n",
                               r_mag2,
                               name.c_str());
-        illum_factor = 0.0;
-        return;
+        return 0.0;
     }
 
     // Compute the distance off the line connecting the two planetary bodies
@@ -244,12 +258,9 @@ void RadiationThirdBody::calculate_shadow()
         // shadow.  Otherwise it is in full shadow,
         if(r_perp < radius)
         {
-            illum_factor = 0;
-        }
-        else
-        {
-            illum_factor = 1;
+            return 0;
         }
+        return 1;
     }
     else if(shadow_geometry == Conical || shadow_geometry == Con)
     {
@@ -277,26 +288,23 @@ void RadiationThirdBody::calculate_shadow()
 
         if(r_perp_x_d >= (r_plus * r_par) + radius_x_d)
         { // Region B (none):
-            illum_factor = 1;
-            return;
+            return 1;
         }
         if(r_perp_x_d <= (r_minus * r_par) + radius_x_d)
         { // Region C (total):
-            illum_factor = 0;
-            return;
+            return 0;
         }
 
         // Here is the first example of why I'm using if(){return}.  All
         // subsequent calculations will require the ratio of the angular sizes,
         // shadow-body over source, but the previous calculations did not.
         // So doing that now.  ang_ratio is shadow-body over source.
-        double ang_ratio_2_a = r_ratio * primary_source_ptr->d_source_to_cg;
+        double ang_ratio_2_a = r_ratio * d_source_to_cg;
         double ang_ratio_2 = ang_ratio_2_a * ang_ratio_2_a / r_mag2;
 
         if(r_perp_x_d <= -((r_minus * r_par) + radius_x_d))
         { // Region D (annular)
-            illum_factor = 1 - ang_ratio_2;
-            return;
+            return 1 - ang_ratio_2;
         }
 
         double ang_ratio = sqrt(ang_ratio_2);
@@ -308,18 +316,11 @@ void RadiationThirdBody::calculate_shadow()
         double delta = radius_x_d - r_perp_x_d + (radius + primary_source_ptr->radius) * r_par;
         if(ang_ratio_2 >= 1)
         { // ThirdBody has a larger angular size
-            illum_factor = 1 - generate_alpha(1 / ang_ratio, delta / (2 * primary_source_ptr->radius * r_par));
+            return 1 - generate_alpha(1 / ang_ratio, delta / (2 * primary_source_ptr->radius * r_par));
         }
-        else
-        {
-            illum_factor = 1 -
-                           ang_ratio_2 * generate_alpha(ang_ratio, delta / (2 * radius * (d_source_to_third + r_par)));
-        }
-    }
-    else
-    {
-        illum_factor = 1;
+        return 1 - ang_ratio_2 * generate_alpha(ang_ratio, delta / (2 * radius * (d_source_to_third + r_par)));
     }
+    return 1;
 }
 
 /**
@@ -392,6 +393,13 @@ double RadiationThirdBody::process_third_body(double real_time, RefFrame & veh_s
         return 1.0;
     }
 
+    // Nothing changes while the vehicle is known to be in full light.
+    if(predict_eclipses && (real_time >= last_shadow_time) && (real_time < full_light_until))
+    {
+        illum_factor = 1.0;
+        return illum_factor;
+    }
+
     // if state-update fails, return an illumination factor of 1.0
     if(!test_for_state_update(real_time))
     {
@@ -407,9 +415,131 @@ double RadiationThirdBody::process_third_body(double real_time, RefFrame & veh_s
     }
 
     calculate_shadow();
+    if(predict_eclipses)
+    {
+        predict_full_light(real_time);
+    }
+    else
+    {
+        have_prediction_history = false;
+        full_light_until = real_time;
+    }
     return illum_factor;
 }
 
+/**
+ * Bounds the time for which the vehicle will remain in full light, following
+ * a shadow calculation. The vehicle is out of full light only where
+ * r_par >= 0 and r_perp < radius + slope * r_par, where the slope is that of
+ * the outer edge of the penumbra (zero for a cylindrical shadow). The larger
+ * of the distances to the two bounding half-planes is a lower bound on the
+ * distance to the shadow. The rate at which the vehicle approaches the shadow
+ * is bounded by prediction_speed_factor times the average rate of change of
+ * third_to_cg_inrtl, plus that of the shadow axis, since the previous
+ * calculation.
+ * \param[in] real_time Time of the shadow calculation\n Units: s
+ */
+void RadiationThirdBody::predict_full_light(double real_time)
+{
+    double dt = real_time - last_shadow_time;
+    bool have_rate = have_prediction_history && (dt > 0.0);
+    double rate = 0.0;
+    if(have_rate)
+    {
+        double delta_pos[3];
+        double delta_hat[3];
+        Vector3::diff(third_to_cg_inrtl, last_third_to_cg, delta_pos);
+        Vector3::diff(source_to_third_hat_inrtl, last_source_to_third_hat, delta_hat);
+        rate = (Vector3::vmag(delta_pos) + Vector3::vmag(third_to_cg_inrtl) * Vector3::vmag(delta_hat)) / dt;
+    }
+
+    Vector3::copy(third_to_cg_inrtl, last_third_to_cg);
+    Vector3::copy(source_to_third_hat_inrtl, last_source_to_third_hat);
+    last_shadow_time = real_time;
+    have_prediction_history = true;
+    full_light_until = real_time;
+
+    if(!have_rate || (illum_factor < 1.0))
+    {
+        return;
+    }
+
+    double slope = 0.0;
+    if(shadow_geometry == Conical || shadow_geometry == Con)
+    {
+        slope = r_plus / d_source_to_third;
+    }
+    else if(shadow_geometry != Cylindrical && shadow_geometry != Cyl)
+    {
+        return;
+    }
+
+    // r_perp is not computed by the shadow calculation on the lit side.
+    double perp2 = Vector3::vmagsq(third_to_cg_inrtl) - r_par * r_par;
+    double perp = (perp2 > 0.0) ? std::sqrt(perp2) : 0.0;
+    double margin = std::max(-r_par, (perp - radius - slope * r_par) / std::sqrt(1.0 + slope * slope));
+    if(margin <= 0.0)
+    {
+        return;
+    }
+
+    double interval = max_prediction_interval;
+    if(rate > 0.0)
+    {
+        interval = std::min(margin / (prediction_speed_factor * rate), interval);
+    }
+    full_light_until = real_time + interval;
+}
+
+/**
+ * Evaluates the shadowing of many vehicles by this third body at one time.
+ * The third body state is updated at most once, as for a single vehicle, and
+ * each vehicle's illumination factor is that which process_third_body would
+ * yield if the vehicle were the one illuminated by the primary source.
+ * Eclipse prediction is not applied. The members describing the relative
+ * position of a vehicle are left describing the last vehicle.
+ * \param[in] real_time Current time.\n Units: s
+ * \param[in] num_vehicles Number of vehicles
+ * \param[in] source_to_cg Vectors from the primary source to each vehicle
+ *            center of gravity, three per vehicle\n Units: m
+ * \param[out] illum_factors Illumination factor of each vehicle
+ */
+void RadiationThirdBody::evaluate_shadows(double real_time,
+                                          unsigned int num_vehicles,
+                                          const double * source_to_cg,
+                                          double * illum_factors)
+{
+    if(num_vehicles == 0)
+    {
+        return;
+    }
+
+    if(!active || !initialized || !test_for_state_update(real_time))
+    {
+        if(active)
+        {
+            MessageHandler::error(__FILE__,
+                                  __LINE__,
+                                  RadiationMessages::operational_setup_error,
+                                  "\n"
+                                  "RadiationThirdBody::evaluate_shadows() called for body (%s)\n"
+                                  "without the model being initialized, or its state-update failed.\n"
+                                  "Deactivating this RadiationThirdBody.\n",
+                                  name.c_str());
+            active = false;
+        }
+        std::fill(illum_factors, illum_factors + num_vehicles, 1.0);
+        return;
+    }
+
+    for(unsigned int ii = 0; ii < num_vehicles; ++ii)
+    {
+        const double * vehicle_pos = source_to_cg + 3 * static_cast<std::size_t>(ii);
+        illum_factors[ii] = compute_illumination(vehicle_pos, Vector3::vmag(vehicle_pos));
+    }
+    illum_factor = illum_factors[num_vehicles - 1];
+}
+
 /**
  * Tests for necessity of updating third body state, and calls
  * appropriate update method (polymorphic) if needed.
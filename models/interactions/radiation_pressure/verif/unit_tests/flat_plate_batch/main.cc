@@ -0,0 +1,180 @@
+// Compare the flat plate radiation kernels against the per-facet flat plate
+// model on a surface with plates facing every way, and time both.
+// System includes
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "interactions/radiation_pressure/include/flat_plate_radiation_facet.hh"
+#include "interactions/radiation_pressure/include/radiation_surface.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/memory/include/jeod_alloc.hh"
+#include "utils/surface_model/include/flat_plate_thermal.hh"
+
+using namespace std;
+using namespace jeod;
+
+static unsigned long seed = 12345;
+
+static double uniform(double lo, double hi)
+{
+    seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+    return lo + (hi - lo) * static_cast<double>(seed) / 2147483648.0;
+}
+
+static void random_unit(double vec[3])
+{
+    double mag;
+    do
+    {
+        for(unsigned int ii = 0; ii < 3; ++ii)
+        {
+            vec[ii] = uniform(-1.0, 1.0);
+        }
+        mag = sqrt(vec[0] * vec[0] + vec[1] * vec[1] + vec[2] * vec[2]);
+    } while((mag < 0.1) || (mag > 1.0));
+    for(unsigned int ii = 0; ii < 3; ++ii)
+    {
+        vec[ii] /= mag;
+    }
+}
+
+/**
+ * The per-facet outputs of a plate.
+ */
+static void record_outputs(const FlatPlateRadiationFacet & plate, vector<double> & out)
+{
+    out.push_back(plate.cx_area);
+    out.push_back(plate.areaxflux);
+    out.push_back(plate.areaxflux_e);
+    out.push_back(plate.thermal.power_absorb);
+    out.insert(out.end(), plate.F_absorption, plate.F_absorption + 3);
+    out.insert(out.end(), plate.F_diffuse, plate.F_diffuse + 3);
+    out.insert(out.end(), plate.F_specular, plate.F_specular + 3);
+    out.insert(out.end(), plate.F_emission, plate.F_emission + 3);
+    out.insert(out.end(), plate.force, plate.force + 3);
+    out.insert(out.end(), plate.torque, plate.torque + 3);
+}
+
+static bool bit_equal(const vector<double> & a, const vector<double> & b)
+{
+    return (a.size() == b.size()) && (memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0);
+}
+
+/**
+ * One update of the surface, as made by RadiationPressure::update_facet_surface
+ * with an inactive thermal model and no third bodies.
+ */
+static void update_surface(RadiationSurface & surface, double flux_mag, const double flux_hat[3])
+{
+    surface.initialize_runtime_values();
+    surface.incident_radiation(flux_mag, flux_hat, true);
+    surface.equalize_absorption_emission();
+    surface.radiation_pressure();
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_plates;
+    int num_reps;
+
+    cmdline_parser.add_int("NumPlates", 2000, &num_plates);
+    cmdline_parser.add_int("NumReps", 200, &num_reps);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_plates <= 0 || num_reps <= 0)
+    {
+        cerr << "NumPlates and NumReps must be positive." << endl;
+        return 1;
+    }
+
+    // The surface: randomly oriented plates with random optical properties.
+    vector<FlatPlateThermal> base_plates(num_plates);
+    RadiationSurface surface;
+    surface.allocate_array(num_plates);
+    for(int ii = 0; ii < num_plates; ++ii)
+    {
+        FlatPlateThermal & base = base_plates[ii];
+        random_unit(base.normal);
+        for(unsigned int jj = 0; jj < 3; ++jj)
+        {
+            base.position[jj] = uniform(-5.0, 5.0);
+        }
+        base.area = uniform(0.1, 4.0);
+        base.temperature = uniform(200.0, 400.0);
+
+        FlatPlateRadiationFacet * plate = JEOD_ALLOC_CLASS_OBJECT(FlatPlateRadiationFacet, ());
+        plate->base_facet = &base;
+        plate->albedo = uniform(0.0, 1.0);
+        plate->diffuse = uniform(0.0, 1.0);
+        plate->thermal.emissivity = uniform(0.1, 1.0);
+        plate->thermal.heat_capacity = 1000.0 * base.area;
+        plate->define_facet(&base);
+        surface.facets[ii] = plate;
+    }
+    double center_grav[3] = {0.1, -0.2, 0.3};
+    surface.initialize(center_grav);
+
+    // Bit-for-bit comparison of the two paths. After the first repetition,
+    // one plate's area and diffuse fraction are changed before each
+    // comparison, as an input file event might change them.
+    unsigned int num_mismatch = 0;
+    vector<double> directions(3 * num_reps);
+    vector<double> flux_mags(num_reps);
+    for(int rep = 0; rep < num_reps; ++rep)
+    {
+        double * flux_hat = &directions[3 * rep];
+        random_unit(flux_hat);
+        flux_mags[rep] = uniform(1300.0, 1400.0);
+        if(rep > 0)
+        {
+            base_plates[rep % num_plates].area = uniform(0.1, 4.0);
+            static_cast<FlatPlateRadiationFacet *>(surface.facets[rep % num_plates])->diffuse = uniform(0.0, 1.0);
+        }
+
+        vector<double> results[2];
+        for(unsigned int path = 0; path < 2; ++path)
+        {
+            surface.use_flat_plate_batch = (path == 1);
+            update_surface(surface, flux_mags[rep], flux_hat);
+            results[path].assign(surface.force, surface.force + 3);
+            results[path].insert(results[path].end(), surface.torque, surface.torque + 3);
+            for(int ii = 0; ii < num_plates; ++ii)
+            {
+                record_outputs(*static_cast<FlatPlateRadiationFacet *>(surface.facets[ii]), results[path]);
+            }
+        }
+        num_mismatch += bit_equal(results[0], results[1]) ? 0 : 1;
+    }
+
+    // Timing over the same fluxes: the per-facet model, the kernels, and the
+    // kernels for plates that do not articulate.
+    double elapsed_ns[3];
+    for(unsigned int path = 0; path < 3; ++path)
+    {
+        surface.use_flat_plate_batch = (path > 0);
+        surface.flat_plate_batch.read_geometry = (path < 2);
+        auto start = chrono::steady_clock::now();
+        for(int rep = 0; rep < num_reps; ++rep)
+        {
+            update_surface(surface, flux_mags[rep], &directions[3 * rep]);
+        }
+        auto stop = chrono::steady_clock::now();
+        elapsed_ns[path] = chrono::duration<double, nano>(stop - start).count() / num_reps / num_plates;
+    }
+
+    cout << num_plates << " plates, " << num_reps << " repetitions" << endl;
+    cout << fixed << setprecision(1);
+    cout << "  per-facet model:          " << setw(8) << elapsed_ns[0] << " ns/plate" << endl;
+    cout << "  flat plate kernels:       " << setw(8) << elapsed_ns[1] << " ns/plate" << endl;
+    cout << "  kernels, fixed geometry:  " << setw(8) << elapsed_ns[2] << " ns/plate" << endl;
+    cout << "  repetitions not bit-identical: " << num_mismatch << endl;
+
+    return (num_mismatch == 0) ? 0 : 1;
+}
@@ -0,0 +1,30 @@
+/*
+ * flat_plate_radiation_batch_ut.cc
+ */
+
+#include "interactions/radiation_pressure/include/flat_plate_radiation_batch.hh"
+#include "message_handler_mock.hh"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+using testing::_;
+using testing::AnyNumber;
+using testing::Mock;
+
+using namespace jeod;
+
+TEST(FlatPlateRadiationBatch, create)
+{
+    MockMessageHandler mockMessageHandler;
+
+    EXPECT_CALL(mockMessageHandler, process_message(_, _, _, _, _, _, _)).Times(AnyNumber());
+    FlatPlateRadiationBatch staticInst;
+    FlatPlateRadiationBatch * dynInst = new FlatPlateRadiationBatch;
+    delete dynInst;
+}
+
+TEST(FlatPlateRadiationBatch, prepare) {}
+
+TEST(FlatPlateRadiationBatch, incident_radiation) {}
+
+TEST(FlatPlateRadiationBatch, radiation_pressure) {}
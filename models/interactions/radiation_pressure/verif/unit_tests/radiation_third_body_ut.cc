@@ -20,6 +20,12 @@ TEST(RadiationThirdBody, initialize) {}
 
 TEST(RadiationThirdBody, calculate_shadow) {}
 
+TEST(RadiationThirdBody, compute_illumination) {}
+
+TEST(RadiationThirdBody, predict_full_light) {}
+
+TEST(RadiationThirdBody, evaluate_shadows) {}
+
 TEST(RadiationThirdBody, generate_alpha) {}
 
 TEST(RadiationThirdBody, convert_shadow_from_int) {}
@@ -0,0 +1,237 @@
+// Check that eclipse prediction and the multi-vehicle shadow evaluator
+// reproduce the per-call shadow calculation for vehicles around the Earth,
+// and time them.
+// System includes
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "interactions/radiation_pressure/include/radiation_source.hh"
+#include "interactions/radiation_pressure/include/radiation_third_body.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+
+using namespace std;
+using namespace jeod;
+
+static const double two_pi = 2.0 * M_PI;
+static const double astronomical_unit = 1.495978707e11;
+static const double earth_radius = 6.378137e6;
+static const double earth_mu = 3.986004418e14;
+static const double seconds_per_year = 3.15576e7;
+
+static unsigned long seed = 12345;
+
+static double uniform(double lo, double hi)
+{
+    seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+    return lo + (hi - lo) * static_cast<double>(seed) / 2147483648.0;
+}
+
+/**
+ * The Earth as a shadowing body, with the Sun-to-Earth vector on a circle in
+ * the X-Y plane rather than from an ephemeris.
+ */
+class TestThirdBody : public RadiationThirdBody
+{
+public:
+    double ephem_time{};
+    unsigned int num_state_updates{};
+
+    void setup(RadiationSource & source)
+    {
+        primary_source_ptr = &source;
+        name = "Earth";
+        radius = earth_radius;
+        r_plus = radius + source.radius;
+        r_minus = radius - source.radius;
+        r_ratio = radius / source.radius;
+        initialized = true;
+    }
+
+    void sun_to_earth(double time, double pos[3]) const
+    {
+        double angle = two_pi * time / seconds_per_year;
+        pos[0] = astronomical_unit * cos(angle);
+        pos[1] = astronomical_unit * sin(angle);
+        pos[2] = 0.0;
+    }
+
+protected:
+    bool update_third_body_state() override
+    {
+        ++num_state_updates;
+        sun_to_earth(ephem_time, source_to_third_inrtl);
+        d_source_to_third = sqrt(source_to_third_inrtl[0] * source_to_third_inrtl[0] +
+                                 source_to_third_inrtl[1] * source_to_third_inrtl[1] +
+                                 source_to_third_inrtl[2] * source_to_third_inrtl[2]);
+        for(unsigned int ii = 0; ii < 3; ++ii)
+        {
+            source_to_third_hat_inrtl[ii] = source_to_third_inrtl[ii] / d_source_to_third;
+        }
+        return true;
+    }
+};
+
+/**
+ * A circular orbit about the Earth.
+ */
+struct Orbit
+{
+    const char * label;
+    double radius;
+    double inclination;
+    double node;
+};
+
+static void vehicle_position(const TestThirdBody & earth, const Orbit & orbit, double time, RadiationSource & source)
+{
+    double rate = sqrt(earth_mu / (orbit.radius * orbit.radius * orbit.radius));
+    double arg = rate * time;
+    double xo = orbit.radius * cos(arg);
+    double yo = orbit.radius * sin(arg);
+    double earth_pos[3];
+    earth.sun_to_earth(time, earth_pos);
+    source.source_to_cg[0] = earth_pos[0] + xo * cos(orbit.node) - yo * cos(orbit.inclination) * sin(orbit.node);
+    source.source_to_cg[1] = earth_pos[1] + xo * sin(orbit.node) + yo * cos(orbit.inclination) * cos(orbit.node);
+    source.source_to_cg[2] = earth_pos[2] + yo * sin(orbit.inclination);
+    source.d_source_to_cg = sqrt(source.source_to_cg[0] * source.source_to_cg[0] +
+                                 source.source_to_cg[1] * source.source_to_cg[1] +
+                                 source.source_to_cg[2] * source.source_to_cg[2]);
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_orbits;
+    int num_vehicles;
+
+    cmdline_parser.add_int("NumOrbits", 3, &num_orbits);
+    cmdline_parser.add_int("NumVehicles", 2000, &num_vehicles);
+    cmdline_parser.parse(argc, argv);
+
+    if((num_orbits <= 0) || (num_vehicles <= 0))
+    {
+        cerr << "NumOrbits and NumVehicles must be positive." << endl;
+        return 1;
+    }
+
+    RefFrame veh_struc_frame;
+    unsigned int num_mismatch = 0;
+
+    // Eclipse prediction, one-second steps along several orbits.
+    const Orbit orbits[] = {
+        {"LEO, low beta", earth_radius + 4.0e5, 0.9, 0.3},
+        {"LEO, high beta", earth_radius + 4.0e5, 1.4, 1.9},
+        {"MEO", earth_radius + 2.02e7, 0.96, 0.0},
+        {"GEO", 4.2164e7, 0.0, 0.0},
+    };
+    cout << "Eclipse prediction, " << num_orbits << " orbits in 1 s steps" << endl;
+    for(const Orbit & orbit : orbits)
+    {
+        RadiationSource full_source;
+        RadiationSource predict_source;
+        TestThirdBody full;
+        TestThirdBody predict;
+        full.setup(full_source);
+        predict.setup(predict_source);
+        predict.predict_eclipses = true;
+
+        double period = two_pi * sqrt(orbit.radius * orbit.radius * orbit.radius / earth_mu);
+        auto num_steps = static_cast<unsigned int>(num_orbits * period);
+        unsigned int num_shadowed = 0;
+        unsigned int orbit_mismatch = 0;
+        double full_ns = 0.0;
+        double predict_ns = 0.0;
+        for(unsigned int step = 0; step < num_steps; ++step)
+        {
+            auto time = static_cast<double>(step);
+            vehicle_position(full, orbit, time, full_source);
+            predict_source.source_to_cg[0] = full_source.source_to_cg[0];
+            predict_source.source_to_cg[1] = full_source.source_to_cg[1];
+            predict_source.source_to_cg[2] = full_source.source_to_cg[2];
+            predict_source.d_source_to_cg = full_source.d_source_to_cg;
+            full.ephem_time = time;
+            predict.ephem_time = time;
+
+            auto start = chrono::steady_clock::now();
+            double full_illum = full.process_third_body(time, veh_struc_frame);
+            auto middle = chrono::steady_clock::now();
+            double predict_illum = predict.process_third_body(time, veh_struc_frame);
+            auto end = chrono::steady_clock::now();
+            full_ns += chrono::duration<double, nano>(middle - start).count();
+            predict_ns += chrono::duration<double, nano>(end - middle).count();
+
+            num_shadowed += (full_illum < 1.0);
+            orbit_mismatch += (memcmp(&full_illum, &predict_illum, sizeof(double)) != 0);
+        }
+        num_mismatch += orbit_mismatch;
+
+        cout << fixed << setprecision(1);
+        cout << "  " << left << setw(15) << orbit.label << right << " shadowed " << setw(5)
+             << 100.0 * num_shadowed / num_steps << "%, calculated " << setw(5)
+             << 100.0 * predict.num_state_updates / num_steps << "%, " << setw(6) << full_ns / num_steps
+             << " ns -> " << setw(6) << predict_ns / num_steps << " ns per call, " << orbit_mismatch
+             << " mismatches" << endl;
+    }
+
+    // Multi-vehicle evaluation against one call per vehicle.
+    RadiationSource source;
+    TestThirdBody earth;
+    earth.setup(source);
+    earth.ephem_time = 1.0e6;
+    double earth_pos[3];
+    earth.sun_to_earth(earth.ephem_time, earth_pos);
+    vector<double> positions(3 * static_cast<size_t>(num_vehicles));
+    for(int ii = 0; ii < num_vehicles; ++ii)
+    {
+        double dist = uniform(1.02, 8.0) * earth_radius;
+        double lon = uniform(0.0, two_pi);
+        double lat = asin(uniform(-1.0, 1.0));
+        positions[3 * ii] = earth_pos[0] + dist * cos(lat) * cos(lon);
+        positions[3 * ii + 1] = earth_pos[1] + dist * cos(lat) * sin(lon);
+        positions[3 * ii + 2] = earth_pos[2] + dist * sin(lat);
+    }
+
+    vector<double> single(num_vehicles);
+    vector<double> batch(num_vehicles);
+    auto start = chrono::steady_clock::now();
+    for(int ii = 0; ii < num_vehicles; ++ii)
+    {
+        for(unsigned int kk = 0; kk < 3; ++kk)
+        {
+            source.source_to_cg[kk] = positions[3 * ii + kk];
+        }
+        source.d_source_to_cg = sqrt(source.source_to_cg[0] * source.source_to_cg[0] +
+                                     source.source_to_cg[1] * source.source_to_cg[1] +
+                                     source.source_to_cg[2] * source.source_to_cg[2]);
+        earth.force_state_update = true;
+        single[ii] = earth.process_third_body(earth.ephem_time, veh_struc_frame);
+    }
+    auto middle = chrono::steady_clock::now();
+    earth.force_state_update = true;
+    earth.evaluate_shadows(earth.ephem_time, num_vehicles, positions.data(), batch.data());
+    auto end = chrono::steady_clock::now();
+
+    unsigned int batch_mismatch = 0;
+    unsigned int num_shadowed = 0;
+    for(int ii = 0; ii < num_vehicles; ++ii)
+    {
+        num_shadowed += (single[ii] < 1.0);
+        batch_mismatch += (memcmp(&single[ii], &batch[ii], sizeof(double)) != 0);
+    }
+    num_mismatch += batch_mismatch;
+
+    cout << "Multi-vehicle evaluation, " << num_vehicles << " vehicles, " << num_shadowed << " shadowed" << endl;
+    cout << "  one call per vehicle: " << setw(8) << chrono::duration<double, micro>(middle - start).count()
+         << " us" << endl;
+    cout << "  evaluate_shadows:     " << setw(8) << chrono::duration<double, micro>(end - middle).count() << " us, "
+         << batch_mismatch << " mismatches" << endl;
+
+    return (num_mismatch == 0) ? 0 : 1;
+}
@@ -60,6 +60,7 @@ Purpose:
 #define JEOD_MEMORY_CHECKPOINTABLE_H
 
 // System includes
+#include <cstddef>
 #include <string>
 #include <typeinfo>
 
@@ -70,6 +71,9 @@ Purpose:
 namespace jeod
 {
 
+class BinaryCheckpointWriter;
+class BinaryCheckpointReader;
+
 /**
  * A JeodCheckpointable is an object whose contents are opaque to Trick,
  * and presumably other simulation engines, whose contents can nonetheless
@@ -118,6 +122,18 @@ public:
     // Return the value of the final action.
     virtual const std::string get_final_value();
 
+    // Return the size of an element in the binary form of the contents.
+    virtual std::size_t get_binary_element_size();
+
+    // Return the number of elements in the binary form of the contents.
+    virtual std::size_t get_binary_element_count();
+
+    // Write the binary form of the contents.
+    virtual void write_binary_contents(BinaryCheckpointWriter & writer);
+
+    // Restore contents from their binary form.
+    virtual int perform_binary_restore(BinaryCheckpointReader & reader, std::size_t count);
+
     // Pure virtual functions
 
     /**
@@ -206,6 +222,59 @@ inline const std::string JeodCheckpointable::get_final_value()
     return "";
 }
 
+/**
+ * In general, return the size in bytes of an element in the binary form of
+ * the contents, which a binary checkpoint writes as raw bytes in place of the
+ * per-item actions.
+ *
+ * The default implementation is zero: the object has no binary form.
+ */
+inline std::size_t JeodCheckpointable::get_binary_element_size()
+{
+    return 0;
+}
+
+/**
+ * In general, return the number of elements that write_binary_contents writes.
+ *
+ * The default implementation is zero.
+ */
+inline std::size_t JeodCheckpointable::get_binary_element_count()
+{
+    return 0;
+}
+
+/**
+ * In general, write get_binary_element_count elements of
+ * get_binary_element_size bytes each to the writer.
+ *
+ * The default implementation is to do nothing.
+ *
+ * @param writer The binary checkpoint writer.
+ */
+inline void JeodCheckpointable::write_binary_contents(BinaryCheckpointWriter & writer JEOD_UNUSED)
+{
+    ; // Empty
+}
+
+/**
+ * In general, read count elements written by write_binary_contents and add
+ * them to the object, as the insert actions of the text form would. The
+ * binary checkpoint reader performs the init action before and the final
+ * action after this method.
+ *
+ * The default implementation is to fail.
+ *
+ * @param reader The binary checkpoint reader.
+ * @param count  Number of elements to be read.
+ * @return       Success (zero) / failure (non-zero).
+ */
+inline int JeodCheckpointable::perform_binary_restore(BinaryCheckpointReader & reader JEOD_UNUSED,
+                                                      std::size_t count JEOD_UNUSED)
+{
+    return 1;
+}
+
 /**
  * In general, perform object-specific operations that need to be performed in
  * anticipation of a checkpoint, typically allocating and populating memory.
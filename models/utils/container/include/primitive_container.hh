@@ -63,10 +63,14 @@ Purpose:
 #include "primitive_serializer.hh"
 
 // JEOD includes
+#include "utils/sim_interface/include/binary_checkpoint.hh"
 #include "utils/sim_interface/include/jeod_class.hh"
 
 // System includes
+#include <cstddef>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 //! Namespace jeod
 namespace jeod
@@ -154,7 +158,126 @@ public:
         this->insert(this->end(), serializer.from_string(value));
     }
 
+    /**
+     * Return the size of an element in the binary form of the contents.
+     * Arithmetic types other than bool are written as raw bytes; other
+     * types have no binary form.
+     */
+    std::size_t get_binary_element_size() override
+    {
+        return (binary_layout::value == no_binary_form) ? 0 : sizeof(ElemType);
+    }
+
+    /**
+     * Return the number of elements in the binary form of the contents.
+     */
+    std::size_t get_binary_element_count() override
+    {
+        return this->size();
+    }
+
+    /**
+     * Write the contents as raw bytes, in one piece if they are contiguous.
+     */
+    void write_binary_contents(BinaryCheckpointWriter & writer) override
+    {
+        write_binary_contents(writer, binary_layout());
+    }
+
+    /**
+     * Append count elements read as raw bytes to the contents, in one piece
+     * if the contents are contiguous.
+     */
+    int perform_binary_restore(BinaryCheckpointReader & reader, std::size_t count) override
+    {
+        return perform_binary_restore(reader, count, binary_layout());
+    }
+
 protected:
+    // Binary forms of the contents.
+    static const int no_binary_form = 0;
+    static const int element_binary_form = 1;
+    static const int contiguous_binary_form = 2;
+
+    /**
+     * The binary form of the contents: none, element by element, or the
+     * storage of a std::vector in one piece.
+     */
+    using binary_layout = std::integral_constant<
+        int,
+        !(std::is_arithmetic<ElemType>::value && !std::is_same<ElemType, bool>::value) ? no_binary_form
+        : std::is_same<typename ContainerType::stl_container_type, std::vector<ElemType>>::value
+            ? contiguous_binary_form
+            : element_binary_form>;
+
+    /**
+     * Write nothing; the contents have no binary form.
+     */
+    void write_binary_contents(BinaryCheckpointWriter &, std::integral_constant<int, no_binary_form>) {}
+
+    /**
+     * Write the contents element by element.
+     */
+    void write_binary_contents(BinaryCheckpointWriter & writer, std::integral_constant<int, element_binary_form>)
+    {
+        for(const ElemType & elem : this->contents)
+        {
+            writer.write(&elem, sizeof(ElemType));
+        }
+    }
+
+    /**
+     * Write the contents in one piece.
+     */
+    void write_binary_contents(BinaryCheckpointWriter & writer, std::integral_constant<int, contiguous_binary_form>)
+    {
+        writer.write(this->contents.data(), this->contents.size() * sizeof(ElemType));
+    }
+
+    /**
+     * Fail; the contents have no binary form.
+     */
+    int perform_binary_restore(BinaryCheckpointReader &, std::size_t, std::integral_constant<int, no_binary_form>)
+    {
+        return 1;
+    }
+
+    /**
+     * Insert the elements one at a time.
+     */
+    int perform_binary_restore(BinaryCheckpointReader & reader,
+                               std::size_t count,
+                               std::integral_constant<int, element_binary_form>)
+    {
+        ElemType elem;
+        for(std::size_t ii = 0; ii < count; ++ii)
+        {
+            if(!reader.read(&elem, sizeof(ElemType)))
+            {
+                return 1;
+            }
+            this->insert(this->end(), elem);
+        }
+        return 0;
+    }
+
+    /**
+     * Read the elements directly into the storage of the vector.
+     */
+    int perform_binary_restore(BinaryCheckpointReader & reader,
+                               std::size_t count,
+                               std::integral_constant<int, contiguous_binary_form>)
+    {
+        std::size_t offset = this->contents.size();
+        this->contents.resize(offset + count);
+        if(!reader.read(this->contents.data() + offset, count * sizeof(ElemType)))
+        {
+            this->contents.resize(offset);
+            return 1;
+        }
+        return 0;
+    }
+
     // Member data
 
     /**
@@ -0,0 +1,198 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2025 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ *
+ * @file models/utils/integration/include/jeod_thread_pool.hh
+ * Define the class JeodThreadPool, a small pool of worker threads used to
+ * spread independent per-body computations across processors.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+ICG: (No)
+
+Library dependencies:
+  ((../src/jeod_thread_pool.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_THREAD_POOL_HH
+#define JEOD_THREAD_POOL_HH
+
+// System includes
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//! Namespace jeod
+namespace jeod
+{
+
+/**
+ * A JeodThreadPool executes an indexed set of independent tasks using a
+ * persistent set of worker threads plus the calling thread.
+ * Tasks are handed out one index at a time from a shared counter, so a
+ * thread that finishes early picks up the next unclaimed index. The pool
+ * makes no promise about which thread runs which index; callers that need
+ * reproducible results must store per-index results and combine them in
+ * index order after run() returns.
+ */
+class JeodThreadPool
+{
+public:
+    /**
+     * The function invoked for each task index.
+     */
+    using Task = std::function<void(unsigned int)>;
+
+    JeodThreadPool() = default;
+    ~JeodThreadPool();
+
+    JeodThreadPool(const JeodThreadPool &) = delete;
+    JeodThreadPool & operator=(const JeodThreadPool &) = delete;
+
+    // Set the number of threads, including the calling thread.
+    void set_num_threads(unsigned int num_threads);
+
+    /**
+     * Get the number of threads, including the calling thread.
+     * @return Number of threads used by run().
+     */
+    unsigned int get_num_threads() const
+    {
+        return static_cast<unsigned int>(workers.size()) + 1;
+    }
+
+    // Invoke task(index) for each index in [0, num_tasks).
+    void run(unsigned int num_tasks, const Task & task);
+
+private:
+    // Worker thread main loop.
+    void worker_loop(unsigned long seen_batch);
+
+    // Claim and execute task indices until none remain.
+    void process_tasks();
+
+    // Stop and join the worker threads.
+    void stop_workers();
+
+    /**
+     * Worker threads. The calling thread is not included.
+     */
+    std::vector<std::thread> workers;
+
+    /**
+     * Protects the members that describe the current batch of work.
+     */
+    std::mutex mutex;
+
+    /**
+     * Signals the workers that a batch is available or that they should exit.
+     */
+    std::condition_variable work_available;
+
+    /**
+     * Signals the calling thread that the workers have finished a batch.
+     */
+    std::condition_variable work_done;
+
+    /**
+     * Task of the batch in progress.
+     */
+    const Task * current_task{};
+
+    /**
+     * Number of tasks in the batch in progress.
+     */
+    unsigned int num_tasks{};
+
+    /**
+     * Next unclaimed task index.
+     */
+    std::atomic<unsigned int> next_index{};
+
+    /**
+     * Number of workers still working on the batch in progress.
+     */
+    unsigned int active_workers{};
+
+    /**
+     * Incremented for each batch; lets workers distinguish a new batch
+     * from a spurious wakeup.
+     */
+    unsigned long batch_id{};
+
+    /**
+     * Set when the workers are to exit.
+     */
+    bool stopping{};
+
+    /**
+     * The exception thrown by the lowest-indexed failed task, if any.
+     */
+    std::exception_ptr error;
+
+    /**
+     * Index of the task that threw the saved exception.
+     */
+    unsigned int error_index{};
+};
+
+} // namespace jeod
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -101,19 +101,21 @@ public:
      */
     enum CorrectorMethod
     {
-        FunctionalIteration = 0,      ///< Functional iteration.
-        NewtonIterUserJac = 1,        ///< Modified Newton iteration with
-                                      //    user-supplied analytical Jacobian
-        NewtonIterInternalJac = 2,    ///< Modified Newton iteration with internally
-                                      //   generated numerical Jacobian
-        JacobiNewtonInternalJac = 3,  ///< Modified Jacobi-Newton iteration with
-                                      //   internally generated numerical Jacobian
-        NewtonIterUserBandJac = 4,    ///< Modified Newton iteration with
-                                      //   user-supplied banded Jacobian
-                                      //   NOT SUPPORTED
-        NewtonIterInternalBandJac = 5 ///< Modified Newton iteration with internally
-                                      //   generated banded Jacobian.
-                                      //   NOT SUPPORTED.
+        FunctionalIteration = 0,        ///< Functional iteration.
+        NewtonIterUserJac = 1,          ///< Modified Newton iteration with
+                                        //    user-supplied analytical Jacobian
+        NewtonIterInternalJac = 2,      ///< Modified Newton iteration with internally
+                                        //   generated numerical Jacobian
+        JacobiNewtonInternalJac = 3,    ///< Modified Jacobi-Newton iteration with
+                                        //   internally generated numerical Jacobian
+        NewtonIterUserBandJac = 4,      ///< Modified Newton iteration with
+                                        //   user-supplied banded Jacobian
+                                        //   NOT SUPPORTED
+        NewtonIterInternalBandJac = 5,  ///< Modified Newton iteration with internally
+                                        //   generated banded Jacobian.
+        NewtonIterInternalSparseJac = 6 ///< Modified Newton iteration with internally
+                                        //   generated Jacobian of user-specified
+                                        //   sparsity.  Not an LSODE option.
     };
 
     /**
@@ -144,6 +146,7 @@ public:
     void check_interface_data();
     void set_rel_tol(int index, double value);
     void set_abs_tol(int index, double value);
+    void add_jacobian_nonzero(unsigned int row, unsigned int col);
     void allocate_arrays();
     void destroy_allocated_arrays();
 
@@ -201,6 +204,32 @@ public:
      */
     CorrectorMethod corrector_method{FunctionalIteration}; //!< trick_units(--)
 
+    /**
+     * Was ML, in IWORK[1].
+     * Lower half-bandwidth of the Jacobian, used with corrector_method
+     * NewtonIterInternalBandJac.
+     */
+    unsigned int jacobian_lower_half_bandwidth{}; //!< trick_units(--)
+    /**
+     * Was MU, in IWORK[2].
+     * Upper half-bandwidth of the Jacobian, used with corrector_method
+     * NewtonIterInternalBandJac.
+     */
+    unsigned int jacobian_upper_half_bandwidth{}; //!< trick_units(--)
+
+    /**
+     * Rows of the elements of the Jacobian that may be non-zero, used with
+     * corrector_method NewtonIterInternalSparseJac.  Element k of this vector
+     * and element k of jacobian_nonzero_cols locate one such element.
+     * The diagonal need not be listed.
+     */
+    std::vector<unsigned int> jacobian_nonzero_rows; //!< trick_units(--)
+    /**
+     * Columns of the elements of the Jacobian that may be non-zero.
+     * See jacobian_nonzero_rows.
+     */
+    std::vector<unsigned int> jacobian_nonzero_cols; //!< trick_units(--)
+
     /**
      * was HMIN, in DLS001 common block.
      * Minimum absolute value of step size allowable.
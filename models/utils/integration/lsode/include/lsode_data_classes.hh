@@ -121,9 +121,14 @@ public:
     LsodeDataArrays & operator=(const LsodeDataArrays &) = delete;
     LsodeDataArrays(const LsodeDataArrays &) = delete;
 
-    void allocate_arrays(unsigned int num_odes, LsodeControlDataInterface::CorrectorMethod corrector_method);
+    void allocate_arrays(const LsodeControlDataInterface & control_data);
     void destroy_allocated_arrays();
 
+protected:
+    void build_jacobian_pattern(const LsodeControlDataInterface & control_data);
+
+public:
+
     /**
      * Was IWM(21) or IPVT.
      * Pivot vector generated in dgefa, and used in dgesl.
@@ -157,7 +162,12 @@ public:
      * 0:     0
      * 1,2:   n x n
      * 3:     1 x n
-     * 4,5:   (2*ml+mu+1) x n.
+     * 5:     n x (2*ml+mu+1), see band_storage
+     * 6:     as 5 if band_storage is set, else n x n.
+     * In n x n storage, lin_alg[i][j] is element (i,j) of the matrix.
+     * In band storage, lin_alg[j][ml+mu+i-j] is element (i,j), so that each
+     * column is contiguous, with the first ml elements of each column
+     * reserved for fill-in during factorization.
      */
     double ** lin_alg{}; //!< trick_units(--)
     /**
@@ -176,6 +186,51 @@ public:
      */
     double * accum_correction{}; //!< trick_units(--)
 
+    /**
+     * Was IWM(1), ML.
+     * Lower half-bandwidth of the iteration matrix in band storage.
+     */
+    unsigned int band_lower{}; //!< trick_units(--)
+    /**
+     * Was IWM(2), MU.
+     * Upper half-bandwidth of the iteration matrix in band storage.
+     */
+    unsigned int band_upper{}; //!< trick_units(--)
+    /**
+     * Indicator of whether lin_alg holds the iteration matrix in band storage.
+     */
+    bool band_storage{}; //!< trick_units(--)
+
+    /**
+     * Rows of the elements of the Jacobian that are evaluated, for the
+     * internally generated banded and sparse Jacobians, stored column by
+     * column.  The rows of column j are jacobian_rows[jacobian_col_start[j]]
+     * to jacobian_rows[jacobian_col_start[j+1]-1].
+     */
+    unsigned int * jacobian_rows{}; //!< trick_units(--)
+    /**
+     * Start of each column in jacobian_rows, with num_odes+1 elements.
+     */
+    unsigned int * jacobian_col_start{}; //!< trick_units(--)
+    /**
+     * Columns of the Jacobian, grouped so that no two columns of a group
+     * have an evaluated element in the same row.  All columns of a group
+     * are differenced with a single derivative evaluation.  The columns of
+     * group g are jacobian_group_cols[jacobian_group_start[g]] to
+     * jacobian_group_cols[jacobian_group_start[g+1]-1].
+     */
+    unsigned int * jacobian_group_cols{}; //!< trick_units(--)
+    /**
+     * Start of each group in jacobian_group_cols, with
+     * num_jacobian_groups+1 elements.
+     */
+    unsigned int * jacobian_group_start{}; //!< trick_units(--)
+    /**
+     * Number of column groups; the number of derivative evaluations needed
+     * to generate the Jacobian.
+     */
+    unsigned int num_jacobian_groups{}; //!< trick_units(--)
+
     /**
      * Number of record, this is the value used for data allocation.
      */
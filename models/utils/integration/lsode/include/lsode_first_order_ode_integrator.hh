@@ -246,6 +246,8 @@ protected:
     void jacobian_prep_init();                 // was DPREPJ
     bool jacobian_prep_loop();                 // was DPREPJ
     bool jacobian_prep_wrap_up();              // was DPREPJ
+    void jacobian_prep_perturb_group();        // was DPREPJ
+    void jacobian_prep_load_group();           // was DPREPJ
     void linear_chord_iteration();             // was DSOLSY, also SLVS
     void load_ew_values();                     // was DEWSET
 
@@ -259,6 +261,8 @@ protected:
     double magnitude_of_weighted_array(unsigned int ix, double ** v); // was DVNORM
     int gauss_elim_factor();                                          // was DGEFA
     void linear_solver();                                             // was DGESL
+    int band_gauss_elim_factor();                                     // was DGBFA
+    void band_linear_solver();                                        // was DGBSL
     unsigned int index_of_max_magnitude(unsigned int num_points,      // was IDAMAX
                                         double ** mx,
                                         int starting_ix);
@@ -365,13 +369,8 @@ public:
      */
     double max_rel_change_without_jacobian{0.3}; //!< trick_units(--)
 
-    // Used for corrector_method = 4 or 5, which are not supported.
-    //   int jacobian_lower_half_bandwidth; /* trick_units(--) @n
-    //       was ML/
-    //       */
-    //   int jacobian_upper_half_bandwidth; /* trick_units(--) @n
-    //       was MU.
-    //       */
+    // The half-bandwidths used for corrector_method = 5 (ML and MU) are in
+    // control_data.
 
     // Miscellaneous
 
@@ -91,35 +91,65 @@ void LsodeControlDataInterface::check_interface_data()
                                         "integration_method must be 1 or 2\n",
                                         integration_method);
     }
-    if(corrector_method < 0 || corrector_method > 5)
+    if(corrector_method < 0 || corrector_method > 6)
     {
         er7_utils::MessageHandler::fail(__FILE__,
                                         __LINE__,
                                         er7_utils::IntegrationMessages::invalid_request,
                                         "Illegal value for corrector_method (%u).\n"
-                                        "corrector_method must be between 1 and 4 (inclusive).\n",
+                                        "corrector_method must be between 0 and 6 (inclusive).\n",
                                         corrector_method);
     }
-    // if (jacobian_lower_half_bandwidth < 0 ||
-    //     jacobian_lower_half_bandwidth >= num_odes) {
-    //    er7_utils::MessageHandler::fail (__FILE__, __LINE__,
-    //       er7_utils::IntegrationMessages::invalid_request,
-    //       "jacobian_lower_half_bandwidth (%u) illegal value.\n"
-    //       "Must be >=0 and < %u (the number of equations to solve)",
-    //       jacobian_lower_half_bandwidth,num_equations_to_solve);
-    //    calculation_phase = -3;
-    //    return;
-    // }
-    // if (jacobian_upper_half_bandwidth < 0 ||
-    //     jacobian_upper_half_bandwidth >= num_odes) {
-    //    er7_utils::MessageHandler::fail (__FILE__, __LINE__,
-    //       er7_utils::IntegrationMessages::invalid_request,
-    //       "jacobian_upper_half_bandwidth (%u) illegal value.\n"
-    //       "Must be >=0 and < %u (the number of equations to solve)",
-    //       jacobian_upper_half_bandwidth,num_equations_to_solve);
-    //    calculation_phase = -3;
-    //    return;
-    // }
+    if(corrector_method == NewtonIterInternalBandJac)
+    {
+        if(jacobian_lower_half_bandwidth >= num_odes)
+        {
+            er7_utils::MessageHandler::fail(__FILE__,
+                                            __LINE__,
+                                            er7_utils::IntegrationMessages::invalid_request,
+                                            "jacobian_lower_half_bandwidth (%u) illegal value.\n"
+                                            "Must be < %u (the number of equations to solve)",
+                                            jacobian_lower_half_bandwidth,
+                                            num_odes);
+        }
+        if(jacobian_upper_half_bandwidth >= num_odes)
+        {
+            er7_utils::MessageHandler::fail(__FILE__,
+                                            __LINE__,
+                                            er7_utils::IntegrationMessages::invalid_request,
+                                            "jacobian_upper_half_bandwidth (%u) illegal value.\n"
+                                            "Must be < %u (the number of equations to solve)",
+                                            jacobian_upper_half_bandwidth,
+                                            num_odes);
+        }
+    }
+    if(corrector_method == NewtonIterInternalSparseJac)
+    {
+        if(jacobian_nonzero_rows.size() != jacobian_nonzero_cols.size())
+        {
+            er7_utils::MessageHandler::fail(__FILE__,
+                                            __LINE__,
+                                            er7_utils::IntegrationMessages::invalid_request,
+                                            "jacobian_nonzero_rows and jacobian_nonzero_cols have different sizes "
+                                            "(%u and %u).\n",
+                                            static_cast<unsigned int>(jacobian_nonzero_rows.size()),
+                                            static_cast<unsigned int>(jacobian_nonzero_cols.size()));
+        }
+        for(unsigned int ii = 0; ii < jacobian_nonzero_rows.size(); ++ii)
+        {
+            if((jacobian_nonzero_rows[ii] >= num_odes) ||
+               ((ii < jacobian_nonzero_cols.size()) && (jacobian_nonzero_cols[ii] >= num_odes)))
+            {
+                er7_utils::MessageHandler::fail(__FILE__,
+                                                __LINE__,
+                                                er7_utils::IntegrationMessages::invalid_request,
+                                                "Jacobian non-zero element %u is outside the Jacobian.\n"
+                                                "Rows and columns must be < %u (the number of equations to solve)",
+                                                ii,
+                                                num_odes);
+            }
+        }
+    }
 
 // DGH: Commented out. These are unsigned ints. They cannot be negative.
 #if 0
@@ -243,14 +273,14 @@ void LsodeControlDataInterface::check_interface_data()
                                         "Jacobian-generation function.\n");
     }
 
-    if(corrector_method > 3) // 4 or 5.  Uses banded Jacobian.
+    if(corrector_method == NewtonIterUserBandJac)
     {
-        //          Check bandwidth.
         er7_utils::MessageHandler::fail(__FILE__,
                                         __LINE__,
                                         er7_utils::IntegrationMessages::invalid_request,
-                                        "Corrector_methods 4 and 5 (using banded Jacobians) not currently"
-                                        "supported.\n");
+                                        "Corrector_method =4 (i.e. newtonian iteration with user-supplied "
+                                        "banded jacobian)\nnot supported.  There is no means to specify a "
+                                        "Jacobian-generation function.\n");
     }
 }
 
@@ -319,6 +349,18 @@ void LsodeControlDataInterface::destroy_allocated_arrays()
     error_control_vector_copied_over = false;
 }
 
+/**
+ * Mark an element of the Jacobian as possibly non-zero, for use with
+ * corrector_method NewtonIterInternalSparseJac.
+ * \param[in] row Row of the element
+ * \param[in] col Column of the element
+ */
+void LsodeControlDataInterface::add_jacobian_nonzero(unsigned int row, unsigned int col)
+{
+    jacobian_nonzero_rows.push_back(row);
+    jacobian_nonzero_cols.push_back(col);
+}
+
 /**
  * set values from external
  */
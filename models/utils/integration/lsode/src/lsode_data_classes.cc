@@ -31,6 +31,8 @@ Library dependencies:
 *******************************************************************************/
 
 // System includes
+#include <algorithm>
+#include <vector>
 
 // Integration includes
 #include "er7_utils/integration/core/include/integration_messages.hh"
@@ -49,12 +51,12 @@ using namespace jeod;
 /**
  * Allocates memory for the variable size arrays
  */
-void LsodeDataArrays::allocate_arrays(unsigned int num_odes_in,
-                                      LsodeControlDataInterface::CorrectorMethod corrector_method)
+void LsodeDataArrays::allocate_arrays(const LsodeControlDataInterface & control_data)
 {
     // This is a code chunk adapted from lines  1321-1325 in original fortran.
 
-    num_odes = num_odes_in;
+    num_odes = control_data.num_odes;
+    LsodeControlDataInterface::CorrectorMethod corrector_method = control_data.corrector_method;
 
     // num_odes appears to be at least as large as num_equations, which
     // may be variable (in original Lsode).
@@ -98,6 +100,23 @@ void LsodeDataArrays::allocate_arrays(unsigned int num_odes_in,
         index1 = 1;
         index2 = num_odes;
     }
+    // if (miter.ge.4) lenwm=(2*ml+mu+1)*n+2
+    // The band is stored column by column rather than row by row.
+    // A sparse Jacobian is also held in band storage, unless that would be
+    // no smaller than n x n storage.
+    else if(corrector_method == LsodeControlDataInterface::NewtonIterInternalBandJac ||
+            corrector_method == LsodeControlDataInterface::NewtonIterInternalSparseJac)
+    {
+        build_jacobian_pattern(control_data);
+        index2 = 2 * band_lower + band_upper + 1;
+        band_storage = (corrector_method == LsodeControlDataInterface::NewtonIterInternalBandJac) ||
+                       (index2 < num_odes);
+        index1 = num_odes;
+        if(!band_storage)
+        {
+            index2 = num_odes;
+        }
+    }
     else
     {
         er7_utils::MessageHandler::fail(__FILE__,
@@ -109,16 +128,6 @@ void LsodeDataArrays::allocate_arrays(unsigned int num_odes_in,
         index1 = 0;
         index2 = 0;
     }
-    //   //if (miter.ge.4) lenwm=(2*ml+mu+1)*n+2
-    // MITER = 4 or 5 not supported.
-    //   else {
-    //      index1 =
-    //            2*jacobian_lower_half_bandwidth + jacobian_upper_half_bandwidth +1;
-    //      if (index1 < 2) {
-    //         index1 = 1;
-    //      }
-    //      index2 = num_odes;
-    //   }
 
     // lin_alg[index1][index2]
     // lewt = lwm + lenwm means lin_alg takes up lenwm spaces:
@@ -142,6 +151,115 @@ void LsodeDataArrays::allocate_arrays(unsigned int num_odes_in,
     allocated = true;
 }
 
+/**
+ * Identifies the elements of the Jacobian to be evaluated by differencing,
+ * finds the bandwidth they span, and groups the columns so that the columns
+ * of a group can be differenced together.
+ * \param[in] control_data Integrator controls
+ */
+void LsodeDataArrays::build_jacobian_pattern(const LsodeControlDataInterface & control_data)
+{
+    std::vector<std::vector<unsigned int>> col_rows(num_odes);
+    if(control_data.corrector_method == LsodeControlDataInterface::NewtonIterInternalBandJac)
+    {
+        band_lower = control_data.jacobian_lower_half_bandwidth;
+        band_upper = control_data.jacobian_upper_half_bandwidth;
+        for(unsigned int jj = 0; jj < num_odes; ++jj)
+        {
+            unsigned int first = (jj > band_upper) ? jj - band_upper : 0;
+            unsigned int last = std::min(jj + band_lower, num_odes - 1);
+            for(unsigned int ii = first; ii <= last; ++ii)
+            {
+                col_rows[jj].push_back(ii);
+            }
+        }
+    }
+    else
+    {
+        // The diagonal is always evaluated.
+        for(unsigned int jj = 0; jj < num_odes; ++jj)
+        {
+            col_rows[jj].push_back(jj);
+        }
+        for(unsigned int kk = 0; kk < control_data.jacobian_nonzero_rows.size(); ++kk)
+        {
+            col_rows[control_data.jacobian_nonzero_cols[kk]].push_back(control_data.jacobian_nonzero_rows[kk]);
+        }
+        band_lower = 0;
+        band_upper = 0;
+        for(unsigned int jj = 0; jj < num_odes; ++jj)
+        {
+            std::vector<unsigned int> & rows = col_rows[jj];
+            std::sort(rows.begin(), rows.end());
+            rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+            band_upper = std::max(band_upper, jj - rows.front());
+            band_lower = std::max(band_lower, rows.back() - jj);
+        }
+    }
+
+    jacobian_col_start = er7_utils::alloc::allocate_array<unsigned int>(num_odes + 1);
+    jacobian_col_start[0] = 0;
+    for(unsigned int jj = 0; jj < num_odes; ++jj)
+    {
+        jacobian_col_start[jj + 1] = jacobian_col_start[jj] + col_rows[jj].size();
+    }
+    jacobian_rows = er7_utils::alloc::allocate_array<unsigned int>(jacobian_col_start[num_odes]);
+    for(unsigned int jj = 0; jj < num_odes; ++jj)
+    {
+        std::copy(col_rows[jj].begin(), col_rows[jj].end(), jacobian_rows + jacobian_col_start[jj]);
+    }
+
+    // Each column joins the first group that has no column with an evaluated
+    // element in any of the column's rows.  For a banded Jacobian this puts
+    // columns j, j+ml+mu+1, j+2*(ml+mu+1), ... in one group, as DPREPJ does.
+    std::vector<std::vector<unsigned int>> row_groups(num_odes);
+    std::vector<unsigned int> col_group(num_odes);
+    std::vector<unsigned int> group_marks;
+    num_jacobian_groups = 0;
+    for(unsigned int jj = 0; jj < num_odes; ++jj)
+    {
+        for(unsigned int kk = jacobian_col_start[jj]; kk < jacobian_col_start[jj + 1]; ++kk)
+        {
+            for(unsigned int group : row_groups[jacobian_rows[kk]])
+            {
+                group_marks[group] = jj + 1;
+            }
+        }
+        unsigned int group = 0;
+        while((group < num_jacobian_groups) && (group_marks[group] == jj + 1))
+        {
+            ++group;
+        }
+        if(group == num_jacobian_groups)
+        {
+            ++num_jacobian_groups;
+            group_marks.push_back(0);
+        }
+        col_group[jj] = group;
+        for(unsigned int kk = jacobian_col_start[jj]; kk < jacobian_col_start[jj + 1]; ++kk)
+        {
+            row_groups[jacobian_rows[kk]].push_back(group);
+        }
+    }
+
+    jacobian_group_start = er7_utils::alloc::allocate_array<unsigned int>(num_jacobian_groups + 1);
+    std::fill(jacobian_group_start, jacobian_group_start + num_jacobian_groups + 1, 0);
+    for(unsigned int jj = 0; jj < num_odes; ++jj)
+    {
+        ++jacobian_group_start[col_group[jj] + 1];
+    }
+    for(unsigned int group = 0; group < num_jacobian_groups; ++group)
+    {
+        jacobian_group_start[group + 1] += jacobian_group_start[group];
+    }
+    jacobian_group_cols = er7_utils::alloc::allocate_array<unsigned int>(num_odes);
+    std::vector<unsigned int> fill_point(jacobian_group_start, jacobian_group_start + num_jacobian_groups);
+    for(unsigned int jj = 0; jj < num_odes; ++jj)
+    {
+        jacobian_group_cols[fill_point[col_group[jj]]++] = jj;
+    }
+}
+
 /**
  * Allows for refactoring and reallocation of newly sized arrays.
  */
@@ -164,7 +282,20 @@ void LsodeDataArrays::destroy_allocated_arrays()
             er7_utils::alloc::deallocate_array<double>(lin_alg[ii]);
         }
         er7_utils::alloc::deallocate_array<double *>(lin_alg);
+        if(jacobian_rows != nullptr)
+        {
+            er7_utils::alloc::deallocate_array<unsigned int>(jacobian_rows);
+            er7_utils::alloc::deallocate_array<unsigned int>(jacobian_col_start);
+            er7_utils::alloc::deallocate_array<unsigned int>(jacobian_group_cols);
+            er7_utils::alloc::deallocate_array<unsigned int>(jacobian_group_start);
+            jacobian_rows = nullptr;
+            jacobian_col_start = nullptr;
+            jacobian_group_cols = nullptr;
+            jacobian_group_start = nullptr;
+        }
     }
+    num_jacobian_groups = 0;
+    band_storage = false;
     allocated = false;
 }
 
@@ -341,7 +341,7 @@ void LsodeFirstOrderODEIntegrator::process_entry_point_cycle_start()
  */
 void LsodeFirstOrderODEIntegrator::manager_initialize_calculation_part1()
 {
-    arrays.allocate_arrays(control_data.num_odes, control_data.corrector_method);
+    arrays.allocate_arrays(control_data);
     control_data.allocate_arrays();
     // ##-----------------------------------------------------------------------
     // ## Block C.
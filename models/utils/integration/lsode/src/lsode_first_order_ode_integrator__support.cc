@@ -31,6 +31,7 @@ Library dependencies:
 *******************************************************************************/
 
 // System includes
+#include <algorithm>
 #include <cmath> //std
 #include <cmath> //sqrt
 
@@ -361,11 +362,18 @@ void LsodeFirstOrderODEIntegrator::interpolate_y()
  * coefficient matrix.
  * This is done by gauss_elim_factor (DGEFA) if
  *          corrector_method = NewtonIterUserJac or NewtonIterInternalJac,
- *       and by linear_solver (DGBFA) if
- *          corrector_method = NewtonIterUserBandJac or NewtonIterInternalBandJac.
+ *       and by band_gauss_elim_factor (DGBFA) if
+ *          corrector_method = NewtonIterInternalBandJac.
+ * With corrector_method = NewtonIterInternalSparseJac, the Jacobian is held
+ * and factored as a banded Jacobian unless the bandwidth spanned by its
+ * non-zero elements makes full storage no larger.
  *
- * Note that the corrector_method using the banded Jacobians is not supported in
- * this release, so linear_solver is not used.
+ * The banded and sparse Jacobians are generated with one external call per
+ * group of columns rather than one per column (see
+ * LsodeDataArrays::build_jacobian_pattern).
+ *
+ * Note that the corrector_methods using user-supplied Jacobians are not
+ * supported in this release.
  *
  * FTEM and ACOR were effectively the same, now arrays.accum_correction.
  * SAVF is now arrays.save.
@@ -446,57 +454,30 @@ void LsodeFirstOrderODEIntegrator::jacobian_prep_init()
                                             er7_utils::IntegrationMessages::invalid_request,
                                             "Corrector_method (MITER) 4 (Modified Newton iteration with"
                                             " user-supplied banded Jacobian) not supported.");
-            //      // 400
-            //      // arrays.lin_alg is a  (2*ml + mu *1)*n matrix
-            //      //jacobian_lower_half_bandwidth = iwm[1];
-            //      //jacobian_upper_half_bandwidth = iwm[2];
-            //      //jacobian_lower_half_bandwidth3 = jacobian_lower_half_bandwidth + 3;
-            //      mband = jacobian_lower_half_bandwidth + jacobian_upper_half_bandwidth + 1;
-            //      meband = mband + jacobian_lower_half_bandwidth;
-            //      for (int ii = 0; ii < meband; ii++) { // do 410
-            //         for (int jj = 0; jj < control_data.num_odes; jj++) { // do 410
-            //            // 410
-            //            arrays.lin_alg[ii][jj] = 0.0;
-            //         }
-            //      }
             break;
 
         case LsodeControlDataInterface::NewtonIterInternalBandJac:
-            // Option not currently supported.
-            er7_utils::MessageHandler::fail(__FILE__,
-                                            __LINE__,
-                                            er7_utils::IntegrationMessages::invalid_request,
-                                            "Corrector_method (MITER) 5 (Modified Newton iteration with"
-                                            " internally generated banded Jacobian) not supported.");
-            //      // 500
-            //      // arrays.lin_alg is a  (2*ml + mu + 1)*n matrix
-            //      //jacobian_lower_half_bandwidth = iwm[1];
-            //      //jacobian_upper_half_bandwidth = iwm[2];
-            //      mband = jacobian_lower_half_bandwidth + jacobian_upper_half_bandwidth + 1;
-            //
-            //      // mba = min (mband, control_data.num_odes):
-            //      mba = mband;
-            //      if (mba > control_data.num_odes) {
-            //         mba = control_data.num_odes;
-            //      }
-            //
-            //      meband = mband + jacobian_lower_half_bandwidth;
-            //      fac = magnitude_of_weighted_array (arrays.save);
-            //      r0 = 1000.0 * std::abs(step_size) * epsilon * control_data.num_odes * fac;
-            //      if (r0 == 0.0) {
-            //          r0 = 1.0;
-            //      }
-            //      data_prepj.r0=r0;
-            //      data_prepj.index_max = mba;
-            //      data_prepj.index = 0;
-            //
-            //      for (int j = 0; j < mba; j++) { // do 560
-            //      for (int ii = 0; ii < control_data.num_odes; ii+=mband) { // do 530
-            //         r = std::max( (arrays.lin_alg_1 * std::abs(y[ii])) ,
-            //                       (r0 / arrays.error_weight[ii]));
-            //         // 530
-            //         y[ii] = y[ii] + r;
-            //      }}
+        case LsodeControlDataInterface::NewtonIterInternalSparseJac:
+            // Need to make a series of calls to compute the derivatives in order
+            // to approximate the Jacobian, one per group of columns.  Set up
+            // the first call.
+            // 500
+            data_prepj.fac = magnitude_of_weighted_array(arrays.save);
+            data_prepj.r0 = 1000.0 * epsilon * std::abs(step_size) * control_data.num_odes * data_prepj.fac;
+            if(std::fpclassify(data_prepj.r0) == FP_ZERO)
+            {
+                data_prepj.r0 = 1.0;
+            }
+            data_prepj.index_max = arrays.num_jacobian_groups;
+
+            // Elements that are not evaluated are zero.
+            for(unsigned int ii = 0; ii < arrays.lin_alg_index1; ii++)
+            {
+                unsigned int length = arrays.band_storage ? 2 * arrays.band_lower + arrays.band_upper + 1
+                                                          : control_data.num_odes;
+                std::fill(arrays.lin_alg[ii], arrays.lin_alg[ii] + length, 0.0);
+            }
+            jacobian_prep_perturb_group();
             break;
         case LsodeControlDataInterface::FunctionalIteration:
         default:
@@ -528,7 +509,7 @@ bool LsodeFirstOrderODEIntegrator::jacobian_prep_loop()
             for(unsigned int ii = 0; ii < control_data.num_odes; ii++) // do 220
             {
                 // 220
-                arrays.lin_alg[jj][ii] = (arrays.accum_correction[ii] - arrays.save[ii]) * data_prepj.fac;
+                arrays.lin_alg[ii][jj] = (arrays.accum_correction[ii] - arrays.save[ii]) * data_prepj.fac;
             }
             y[jj] = data_prepj.yj;
 
@@ -550,62 +531,79 @@ bool LsodeFirstOrderODEIntegrator::jacobian_prep_loop()
             // there is no loop in this case, go straight to wrap-up
             break;
 
-            // Unsupported cases:
-            //    case  LsodeControlDataInterface::NewtonIterUserBandJac:
-            //       // there is no loop in this case, go straight to wrap-up
-            //       break;
+        case LsodeControlDataInterface::NewtonIterInternalBandJac:
+        case LsodeControlDataInterface::NewtonIterInternalSparseJac:
+            jacobian_prep_load_group();
 
-            //
-            //
-            //   case   LsodeControlDataInterface::NewtonIterInternalBandJac:
-            //      load_derivatives(arrays.accum_correction);
-            //      for (int jj = data_prepj.index; jj < control_data.num_odes; jj+=mband) { // do 550
-            //         y[jj] = arrays.history[jj][0];
-            //         r = std::max( (arrays.lin_alg_1 * std::abs(y[jj])) ,
-            //                       (data_prepj.r0/arrays.error_weight[jj]));
-            //         fac = -data_prepj.hl0/r;
-            //         int i1 = std::max((jj+1)-jacobian_upper_half_bandwidth,1);
-            //
-            //         //int i2 = std::min((jj+1)+jacobian_lower_half_bandwidth,control_data.num_odes);
-            //         int i2 = (jj+1)+jacobian_lower_half_bandwidth;
-            //         if (i2 > control_data.num_odes) {
-            //            i2 = control_data.num_odes;
-            //         }
-            //
-            //         int ii = (jj+1)*(meband-1) - jacobian_lower_half_bandwidth + 2;
-            //         //FIXME  Reconstruct this from documentation.  it looks
-            //         //dodgy.  This is setting into arrays.lin_alg across data
-            //         //adresses that span the first index.
-            //         for (int i = i1-1; i < i2; i++) { // do 540
-            //            // 540
-            //            arrays.lin_alg[/*FIXME*/jj][i] = (arrays.accum_correction[i] - arrays.save[i]) * fac;
-            //         }
-            //      // 550
-            //      }
-            //
-            //      data_prepj.index++;
-            //      if (data_prepj.index < data_prepj.index_max) {
-            //         // Prepare for next call to generate derivatives.
-            //         for (int ii = data_prepj.index; ii < control_data.num_odes; ii+=mband) { // do 530
-            //            r = std::max( (arrays.lin_alg_1 * std::abs(y[ii])) ,
-            //                          (data_prepj.r0 / arrays.error_weight[ii]));
-            //            // 530
-            //            y[ii] = y[ii] + r;
-            //         }
-            //         return false; // re-cycle
-            //      }
-            //      break; // loop finished
+            data_prepj.index++;
+            if(data_prepj.index < data_prepj.index_max) // refactor of DO 560
+            {
+                // Prepare for next call to generate derivatives.
+                jacobian_prep_perturb_group();
+                return false; // re-cycle
+            }
+            break; // loop finished.
 
         // 560
         case LsodeControlDataInterface::FunctionalIteration:
         case LsodeControlDataInterface::NewtonIterUserBandJac:
-        case LsodeControlDataInterface::NewtonIterInternalBandJac:
         default:
             break;
     }
     return true; // loops finished.
 }
 
+/***************************************************************************
+ * Perturbs the state in each column of the current group of columns
+ * (data_prepj.index) ahead of the external call that differences them.
+ ***************************************************************************/
+void LsodeFirstOrderODEIntegrator::jacobian_prep_perturb_group()
+{
+    unsigned int group = data_prepj.index;
+    for(unsigned int kk = arrays.jacobian_group_start[group]; kk < arrays.jacobian_group_start[group + 1]; kk++)
+    {
+        // do 530
+        unsigned int jj = arrays.jacobian_group_cols[kk];
+        double r = std::max((arrays.lin_alg_1 * std::abs(y[jj])), (data_prepj.r0 / arrays.error_weight[jj]));
+        y[jj] += r;
+    }
+}
+
+/***************************************************************************
+ * Loads the columns of the current group of columns (data_prepj.index),
+ * differenced and scaled by -hl0, into arrays.lin_alg, and restores the
+ * state in those columns.
+ ***************************************************************************/
+void LsodeFirstOrderODEIntegrator::jacobian_prep_load_group()
+{
+    unsigned int group = data_prepj.index;
+    unsigned int diagonal = arrays.band_lower + arrays.band_upper;
+
+    load_derivatives(arrays.accum_correction);
+    for(unsigned int kk = arrays.jacobian_group_start[group]; kk < arrays.jacobian_group_start[group + 1]; kk++)
+    {
+        // do 550
+        unsigned int jj = arrays.jacobian_group_cols[kk];
+        y[jj] = arrays.history[jj][0];
+        double r = std::max((arrays.lin_alg_1 * std::abs(y[jj])), (data_prepj.r0 / arrays.error_weight[jj]));
+        double fac = -data_prepj.hl0 / r;
+        for(unsigned int ll = arrays.jacobian_col_start[jj]; ll < arrays.jacobian_col_start[jj + 1]; ll++)
+        {
+            // do 540
+            unsigned int ii = arrays.jacobian_rows[ll];
+            double element = (arrays.accum_correction[ii] - arrays.save[ii]) * fac;
+            if(arrays.band_storage)
+            {
+                arrays.lin_alg[jj][diagonal + ii - jj] = element;
+            }
+            else
+            {
+                arrays.lin_alg[ii][jj] = element;
+            }
+        }
+    }
+}
+
 /***************************************************************************
  * Wraps up the dprepj routine following completion of the loops.
  ***************************************************************************/
@@ -666,23 +664,36 @@ bool LsodeFirstOrderODEIntegrator::jacobian_prep_wrap_up()
             }
             break;
 
-            // Unsupported cases:
-        case LsodeControlDataInterface::NewtonIterUserBandJac:
-            //      for (int ii = 0; ii < meband; ii++) { // do 420
-            //         for (int jj = 0; jj < control_data.num_odes; jj++) { // do 420
-            //            // 420
-            //            arrays.lin_alg[ii][jj] *= (-data_prepj.hl0);
-            //         }
-            //      }
-            //      // fall-through (go to 570)
-            //
-
         case LsodeControlDataInterface::NewtonIterInternalBandJac:
-            //      // 570
-            //      This code was so far from complete that it has been stripped.
-            //      If this option gets implemented at a later date, the code from
-            //      lines 570 - end must be re-implemented, including the DGBFA
-            //      method.
+        case LsodeControlDataInterface::NewtonIterInternalSparseJac:
+            // ## Add identity matrix and do LU decomposition on P. -----------------
+            //  570
+            if(arrays.band_storage)
+            {
+                for(unsigned int ii = 0; ii < control_data.num_odes; ii++) // do 580
+                {
+                    arrays.lin_alg[ii][arrays.band_lower + arrays.band_upper] += 1.0;
+                }
+                if(band_gauss_elim_factor() != 0) // was DGBFA, returns IER,
+                {
+                    iteration_matrix_singular = true;
+                }
+            }
+            else
+            {
+                for(unsigned int ii = 0; ii < control_data.num_odes; ii++)
+                {
+                    arrays.lin_alg[ii][ii] += 1.0;
+                }
+                if(gauss_elim_factor() != 0)
+                {
+                    iteration_matrix_singular = true;
+                }
+            }
+            break;
+
+            // Unsupported case:
+        case LsodeControlDataInterface::NewtonIterUserBandJac:
             er7_utils::MessageHandler::fail(__FILE__,
                                             __LINE__,
                                             er7_utils::IntegrationMessages::invalid_request,
@@ -729,6 +740,9 @@ bool LsodeFirstOrderODEIntegrator::jacobian_prep_wrap_up()
  *
  * If corrector_method == NewtonIterUserJac || NewtonIterInternalJac,
  * it calls linear_solver (was DGESL).
+ * If corrector_method == NewtonIterInternalBandJac, it calls
+ * band_linear_solver (was DGBSL), as it does for NewtonIterInternalSparseJac
+ * when that Jacobian is held in band storage.
  * If corrector_method = JacobiNewtonInternalJac it updates the coefficient
  *     hl0 = step_size * method_coeff_first (previously H*EL0) in the diagonal
  *     matrix, and then computes the solution.
@@ -774,21 +788,21 @@ void LsodeFirstOrderODEIntegrator::linear_chord_iteration()
             }
             break;
 
-            // Not supported:
-            //   case LsodeControlDataInterface::NewtonIterUserBandJac:
-            //   case LsodeControlDataInterface::NewtonIterInternalBandJac:
-            //      // 400
-            //      //jacobian_lower_half_bandwidth = iwm[1];
-            //      //jacobian_upper_half_bandwidth = iwm[2];
-            //      //FIXME  Need to reconstruct to identify where the matrix starts
-            //      //and ends in wm in this case.
-            //      //meband = 2*jacobian_lower_half_bandwidth + jacobian_upper_half_bandwidth + 1;
-            //      dgbsl(); // THIS METHOD HAS NOT BEEN IMPLEMENTED.  IT MUST BE
-            //      IMPLEMENTED BEFORE THIS OPTION CAN BE PROVIDED.
-            //      return;
+        case LsodeControlDataInterface::NewtonIterInternalBandJac:
+        case LsodeControlDataInterface::NewtonIterInternalSparseJac:
+            // 400
+            if(arrays.band_storage)
+            {
+                band_linear_solver();
+            }
+            else
+            {
+                linear_solver();
+            }
+            break;
+
         case LsodeControlDataInterface::FunctionalIteration:
         case LsodeControlDataInterface::NewtonIterUserBandJac:
-        case LsodeControlDataInterface::NewtonIterInternalBandJac:
         default:
             break;
     }
@@ -31,6 +31,7 @@ Library dependencies:
 *******************************************************************************/
 
 // System includes
+#include <algorithm>
 #include <cmath> //std
 #include <cmath> // sqrt
 
@@ -232,7 +233,7 @@ int LsodeFirstOrderODEIntegrator::gauss_elim_factor()
             }
             else
             {
-                info = k;
+                info = k + 1;
                 // 50
             }
             // 60
@@ -243,7 +244,7 @@ int LsodeFirstOrderODEIntegrator::gauss_elim_factor()
     arrays.pivots[control_data.num_odes - 1] = control_data.num_odes - 1;
     if(std::fpclassify(arrays.lin_alg[control_data.num_odes - 1][control_data.num_odes - 1]) == FP_ZERO)
     {
-        info = control_data.num_odes - 1;
+        info = control_data.num_odes;
     }
     return info;
 }
@@ -291,10 +292,150 @@ void LsodeFirstOrderODEIntegrator::linear_solver()
     // 50
 }
 
-// DGBFA and DGBSL to be implemented at a later time, subject to
-// confirmation of their desirability.  There are enough loose ends
-// already.
-// See lsode_first_order_ode_integrator_non_implemented.cc for content of these functions
+/**
+ * Factors the banded iteration matrix (arrays.lin_alg in band storage) by
+ * Gaussian elimination with partial pivoting.
+ *
+ * Modified version of DGBFA.  Column j of the band is arrays.lin_alg[j], with
+ * element (i,j) of the matrix at arrays.lin_alg[j][ml+mu+i-j]; the first ml
+ * elements of each column receive the fill-in from the pivoting.
+ * Returns 0, or k+1 if the k-th pivot is zero.
+ */
+int LsodeFirstOrderODEIntegrator::band_gauss_elim_factor()
+{
+    unsigned int num_odes = control_data.num_odes;
+    unsigned int ml = arrays.band_lower;
+    unsigned int mu = arrays.band_upper;
+    unsigned int m = ml + mu; // row of the diagonal
+    double ** abd = arrays.lin_alg;
+    int info = 0;
+
+    // zero initial fill-in columns
+    unsigned int jz = std::min(num_odes, m + 1);
+    for(unsigned int j = mu + 1; j < jz; j++) // do 20
+    {
+        for(unsigned int i = m - j; i < ml; i++)
+        {
+            abd[j][i] = 0.0;
+        }
+    }
+
+    unsigned int ju = 0;
+    for(unsigned int k = 0; k + 1 < num_odes; k++) // do 50
+    {
+        // zero next fill-in column
+        if(jz < num_odes)
+        {
+            std::fill(abd[jz], abd[jz] + ml, 0.0);
+            jz++;
+        }
+
+        // find l = pivot index
+        unsigned int lm = std::min(ml, num_odes - 1 - k);
+        unsigned int l = m;
+        for(unsigned int i = m + 1; i <= m + lm; i++)
+        {
+            if(std::abs(abd[k][i]) > std::abs(abd[k][l]))
+            {
+                l = i;
+            }
+        }
+        arrays.pivots[k] = l + k - m;
+
+        // zero pivot implies this column already triangularized
+        if(std::fpclassify(abd[k][l]) == FP_ZERO)
+        {
+            info = k + 1;
+            continue;
+        }
+
+        // interchange if necessary
+        if(l != m)
+        {
+            std::swap(abd[k][l], abd[k][m]);
+        }
+
+        // compute multipliers
+        double t = -1.0 / abd[k][m];
+        for(unsigned int i = m + 1; i <= m + lm; i++)
+        {
+            abd[k][i] *= t;
+        }
+
+        // row elimination with column indexing
+        ju = std::min(std::max(ju, mu + arrays.pivots[k] + 1), num_odes);
+        unsigned int mm = m;
+        for(unsigned int j = k + 1; j < ju; j++) // do 40
+        {
+            l--;
+            mm--;
+            t = abd[j][l];
+            if(l != mm)
+            {
+                abd[j][l] = abd[j][mm];
+                abd[j][mm] = t;
+            }
+            for(unsigned int i = 1; i <= lm; i++)
+            {
+                abd[j][mm + i] += t * abd[k][m + i];
+            }
+        }
+    }
+
+    arrays.pivots[num_odes - 1] = num_odes - 1;
+    if(std::fpclassify(abd[num_odes - 1][m]) == FP_ZERO)
+    {
+        info = num_odes;
+    }
+    return info;
+}
+
+/**
+ * Solves the equation A X = Y for the banded matrix A factored by
+ * band_gauss_elim_factor, overwriting Y with X.
+ *
+ * Modified version of DGBSL.
+ */
+void LsodeFirstOrderODEIntegrator::band_linear_solver()
+{
+    unsigned int num_odes = control_data.num_odes;
+    unsigned int ml = arrays.band_lower;
+    unsigned int m = arrays.band_lower + arrays.band_upper;
+    double ** abd = arrays.lin_alg;
+
+    // job = 0 , solve  a * x = b;
+    // first solve  l*y = b;
+    if(ml != 0)
+    {
+        for(unsigned int k = 0; k + 1 < num_odes; k++) // do 20
+        {
+            unsigned int lm = std::min(ml, num_odes - 1 - k);
+            unsigned int l = arrays.pivots[k];
+            double t = y[l];
+            if(l != k)
+            {
+                y[l] = y[k];
+                y[k] = t;
+            }
+            for(unsigned int i = 1; i <= lm; i++)
+            {
+                y[k + i] += t * abd[k][m + i];
+            }
+        }
+    }
+
+    // now solve  u*x = y;
+    for(unsigned int k = num_odes; k-- > 0;) // do 40
+    {
+        y[k] /= abd[k][m];
+        unsigned int lm = std::min(k, m);
+        double t = -y[k];
+        for(unsigned int i = 0; i < lm; i++)
+        {
+            y[k - lm + i] += t * abd[k][m - lm + i];
+        }
+    }
+}
 
 /**
  * Modified version of IDAMAX.  IDAMAX has 2 operations, one for
@@ -310,8 +451,8 @@ void LsodeFirstOrderODEIntegrator::linear_solver()
  *
  * @note
  * The only call to this method passed "k" in for both indices, so I stripped the
- * second argument.  If DGBFA gets implemented, it will have to be added back in;
- * the call from DGBFA is for array starting at (M,K)
+ * second argument.  band_gauss_elim_factor (was DGBFA) searches its band
+ * column directly.
  */
 // confirmation of their desirability.  There are enough loose ends
 // already.
@@ -332,8 +473,8 @@ Purpose:(Modified version of IDAMAX.  IDAMAX has 2 operations, one for
 
 @note
 The only call to this method passed "k" in for both indices, so I stripped the
-second argument.  If DGBFA gets implemented, it will have to be added back in;
-the call from DGBFA is for array starting at (M,K))
+second argument.  band_gauss_elim_factor (was DGBFA) searches its band
+column directly.)
 ******************************************************************************/
 unsigned int LsodeFirstOrderODEIntegrator::index_of_max_magnitude(unsigned int num_points,
                                                                   double ** array,
@@ -348,7 +489,7 @@ unsigned int LsodeFirstOrderODEIntegrator::index_of_max_magnitude(unsigned int n
         if(test_value > max_value)
         {
             max_value = test_value;
-            idamax = ii;
+            idamax = start_ix + ii;
         }
     }
     return idamax;
@@ -24,3 +24,5 @@ TEST(LsodeControlDataInterface, destroy_allocated_arrays) {}
 TEST(LsodeControlDataInterface, set_rel_tol) {}
 
 TEST(LsodeControlDataInterface, set_abs_tol) {}
+
+TEST(LsodeControlDataInterface, add_jacobian_nonzero) {}
@@ -23,6 +23,10 @@ TEST(LsodeFirstOrderODEIntegrator, jacobian_prep_init) {}
 
 TEST(LsodeFirstOrderODEIntegrator, jacobian_prep_loop) {}
 
+TEST(LsodeFirstOrderODEIntegrator, jacobian_prep_perturb_group) {}
+
+TEST(LsodeFirstOrderODEIntegrator, jacobian_prep_load_group) {}
+
 TEST(LsodeFirstOrderODEIntegrator, jacobian_prep_wrap_up) {}
 
 TEST(LsodeFirstOrderODEIntegrator, linear_chord_iteration) {}
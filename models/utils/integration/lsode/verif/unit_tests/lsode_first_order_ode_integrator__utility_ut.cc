@@ -25,6 +25,10 @@ TEST(LsodeFirstOrderODEIntegrator, gauss_elim_factor) {}
 
 TEST(LsodeFirstOrderODEIntegrator, linear_solver) {}
 
+TEST(LsodeFirstOrderODEIntegrator, band_gauss_elim_factor) {}
+
+TEST(LsodeFirstOrderODEIntegrator, band_linear_solver) {}
+
 TEST(LsodeFirstOrderODEIntegrator, index_of_max_magnitude) {}
 
 TEST(LsodeFirstOrderODEIntegrator, load_derivatives) {}
@@ -0,0 +1,239 @@
+// Integrate the temperatures of a conducting, radiating plate, a stiff system
+// of 1,000 states by default, with LSODE's backward differentiation method
+// using banded and sparse internally generated Jacobians (and optionally the
+// dense Jacobian), compare the results, and time them.
+// System includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/integration/lsode/include/lsode_first_order_ode_integrator.hh"
+#include "utils/integration/lsode/include/lsode_integration_controls.hh"
+
+using namespace std;
+using namespace jeod;
+
+/**
+ * A rectangular plate of num_cols by num_rows nodes, numbered along the
+ * rows. Each node conducts heat to its four neighbors and radiates; the
+ * first column is also held against a hot edge.
+ */
+struct Plate
+{
+    unsigned int num_cols;
+    unsigned int num_rows;
+    double conductance;
+    double emission;
+    double hot_temperature;
+
+    unsigned int size() const
+    {
+        return num_cols * num_rows;
+    }
+
+    void derivatives(const double * temp, double * temp_dot) const
+    {
+        for(unsigned int row = 0; row < num_rows; ++row)
+        {
+            for(unsigned int col = 0; col < num_cols; ++col)
+            {
+                unsigned int ii = row * num_cols + col;
+                double ti = temp[ii];
+                double flow = (col > 0) ? temp[ii - 1] - ti : hot_temperature - ti;
+                if(col + 1 < num_cols)
+                {
+                    flow += temp[ii + 1] - ti;
+                }
+                if(row > 0)
+                {
+                    flow += temp[ii - num_cols] - ti;
+                }
+                if(row + 1 < num_rows)
+                {
+                    flow += temp[ii + num_cols] - ti;
+                }
+                temp_dot[ii] = conductance * flow - emission * ti * ti * ti * ti;
+            }
+        }
+    }
+
+    void add_conduction_pattern(LsodeControlDataInterface & data) const
+    {
+        for(unsigned int ii = 0; ii < size(); ++ii)
+        {
+            if(ii % num_cols > 0)
+            {
+                data.add_jacobian_nonzero(ii, ii - 1);
+            }
+            if(ii % num_cols + 1 < num_cols)
+            {
+                data.add_jacobian_nonzero(ii, ii + 1);
+            }
+            if(ii >= num_cols)
+            {
+                data.add_jacobian_nonzero(ii, ii - num_cols);
+            }
+            if(ii + num_cols < size())
+            {
+                data.add_jacobian_nonzero(ii, ii + num_cols);
+            }
+        }
+    }
+};
+
+/**
+ * Exposes the integrator's counters.
+ */
+class TestLsodeIntegrator : public LsodeFirstOrderODEIntegrator
+{
+public:
+    TestLsodeIntegrator(const LsodeControlDataInterface & data_in,
+                        er7_utils::IntegrationControls & controls,
+                        unsigned int size)
+        : LsodeFirstOrderODEIntegrator(data_in, controls, size)
+    {
+    }
+
+    unsigned int get_num_steps() const
+    {
+        return num_steps_taken;
+    }
+
+    unsigned int get_num_jacobians() const
+    {
+        return num_jacobian_evals;
+    }
+};
+
+/**
+ * Outcome of one integration.
+ */
+struct Run
+{
+    vector<double> temp;
+    unsigned int num_steps;
+    unsigned int num_jacobians;
+    unsigned long num_derivs;
+    double seconds;
+};
+
+static Run integrate(const Plate & plate,
+                     LsodeControlDataInterface::CorrectorMethod corrector_method,
+                     int num_cycles,
+                     double cycle_dt)
+{
+    unsigned int size = plate.size();
+    LsodeControlDataInterface data;
+    data.num_odes = size;
+    data.integration_method = LsodeControlDataInterface::ImplicitBackDiffStiff;
+    data.corrector_method = corrector_method;
+    data.max_num_steps = 5000;
+    data.set_rel_tol(0, 1.0e-6);
+    data.set_abs_tol(0, 1.0e-8);
+    data.jacobian_lower_half_bandwidth = plate.num_cols;
+    data.jacobian_upper_half_bandwidth = plate.num_cols;
+    if(corrector_method == LsodeControlDataInterface::NewtonIterInternalSparseJac)
+    {
+        plate.add_conduction_pattern(data);
+    }
+
+    LsodeIntegrationControls controls;
+    TestLsodeIntegrator integrator(data, controls, size);
+    Run run;
+    run.temp.assign(size, 0.0);
+    run.num_derivs = 0;
+    vector<double> temp_dot(size);
+
+    auto start = chrono::steady_clock::now();
+    for(int cycle = 0; cycle < num_cycles; ++cycle)
+    {
+        // The integrator returns for new derivatives until the cycle is done.
+        bool done = false;
+        while(!done)
+        {
+            plate.derivatives(run.temp.data(), temp_dot.data());
+            ++run.num_derivs;
+            done = integrator.integrate(cycle_dt, 1, temp_dot.data(), run.temp.data()).get_passed();
+        }
+    }
+    auto end = chrono::steady_clock::now();
+
+    run.num_steps = integrator.get_num_steps();
+    run.num_jacobians = integrator.get_num_jacobians();
+    run.seconds = chrono::duration<double>(end - start).count();
+    return run;
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_cols;
+    int num_rows;
+    int num_cycles;
+    int run_dense;
+
+    cmdline_parser.add_int("NumCols", 40, &num_cols);
+    cmdline_parser.add_int("NumRows", 25, &num_rows);
+    cmdline_parser.add_int("NumCycles", 100, &num_cycles);
+    cmdline_parser.add_int("RunDense", 0, &run_dense);
+    cmdline_parser.parse(argc, argv);
+
+    if((num_cols <= 1) || (num_rows <= 0) || (num_cycles <= 0))
+    {
+        cerr << "NumCols must exceed 1; NumRows and NumCycles must be positive." << endl;
+        return 1;
+    }
+
+    Plate plate;
+    plate.num_cols = num_cols;
+    plate.num_rows = num_rows;
+    plate.conductance = 1.0e4;
+    plate.emission = 1.0e-3;
+    plate.hot_temperature = 1.0;
+    const double cycle_dt = 0.01;
+    const double max_difference_allowed = 1.0e-9;
+
+    struct Method
+    {
+        const char * label;
+        LsodeControlDataInterface::CorrectorMethod method;
+    };
+    vector<Method> methods = {{"banded", LsodeControlDataInterface::NewtonIterInternalBandJac},
+                              {"sparse", LsodeControlDataInterface::NewtonIterInternalSparseJac}};
+    if(run_dense != 0)
+    {
+        methods.push_back({"dense", LsodeControlDataInterface::NewtonIterInternalJac});
+    }
+
+    cout << plate.size() << " states, " << num_cycles << " cycles of " << cycle_dt << " s" << endl;
+    cout << "Jacobian  steps  Jacobians  derivative calls  seconds  max rel. difference" << endl;
+    vector<double> reference;
+    double worst_difference = 0.0;
+    for(const Method & method : methods)
+    {
+        Run run = integrate(plate, method.method, num_cycles, cycle_dt);
+        if(reference.empty())
+        {
+            reference = run.temp;
+        }
+        double difference = 0.0;
+        for(unsigned int ii = 0; ii < plate.size(); ++ii)
+        {
+            difference = max(difference, fabs(run.temp[ii] - reference[ii]) / max(fabs(reference[ii]), 1.0e-3));
+        }
+        worst_difference = max(worst_difference, difference);
+
+        cout << left << setw(8) << method.label << right << setw(7) << run.num_steps << setw(11)
+             << run.num_jacobians << setw(18) << run.num_derivs << fixed << setprecision(3) << setw(9)
+             << run.seconds << scientific << setprecision(1) << setw(21) << difference << endl;
+        cout.unsetf(ios::floatfield);
+    }
+
+    return (worst_difference <= max_difference_allowed) ? 0 : 1;
+}
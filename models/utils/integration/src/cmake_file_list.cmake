@@ -2,6 +2,7 @@ set(SUBDIR ${CMAKE_CURRENT_LIST_DIR})
 
 set(SRCS
 jeod_integration_group.cc
+jeod_thread_pool.cc
 integration_messages.cc
 jeod_integration_time.cc
 generalized_second_order_ode_technique.cc
@@ -0,0 +1,248 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2025 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Integration
+ * @{
+ *
+ * @file models/utils/integration/src/jeod_thread_pool.cc
+ * Define JeodThreadPool methods.
+ */
+
+/*****************************************************************************
+Purpose:
+  ()
+
+Library dependencies:
+  ((jeod_thread_pool.cc))
+
+
+******************************************************************************/
+
+// Local includes
+#include "../include/jeod_thread_pool.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+/**
+ * JeodThreadPool destructor.
+ */
+JeodThreadPool::~JeodThreadPool()
+{
+    stop_workers();
+}
+
+/**
+ * Set the number of threads used by run().
+ * The calling thread counts as one of the threads, so a pool with one
+ * thread has no workers and runs every task on the calling thread.
+ * This must not be called while a run() is in progress.
+ * @param[in] num_threads  Total number of threads. Zero is treated as one.
+ */
+void JeodThreadPool::set_num_threads(unsigned int num_threads)
+{
+    if(num_threads == 0)
+    {
+        num_threads = 1;
+    }
+
+    if(num_threads == get_num_threads())
+    {
+        return;
+    }
+
+    stop_workers();
+
+    workers.reserve(num_threads - 1);
+    for(unsigned int ii = 1; ii < num_threads; ++ii)
+    {
+        workers.emplace_back(&JeodThreadPool::worker_loop, this, batch_id);
+    }
+}
+
+/**
+ * Invoke task(index) for each index in [0, num_tasks), spreading the calls
+ * over the pool's threads, and wait for all of them to complete.
+ * If any task throws, the exception thrown by the lowest-indexed failing
+ * task is rethrown on the calling thread after all tasks have finished.
+ * Unlike a serial loop, tasks after the failing one may still have run.
+ * @param[in] num_tasks_in  Number of tasks.
+ * @param[in] task          Function to be invoked for each task index.
+ */
+void JeodThreadPool::run(unsigned int num_tasks_in, const Task & task)
+{
+    // Nothing to share: run the tasks in order on this thread.
+    if(workers.empty() || (num_tasks_in <= 1))
+    {
+        for(unsigned int ii = 0; ii < num_tasks_in; ++ii)
+        {
+            task(ii);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        current_task = &task;
+        num_tasks = num_tasks_in;
+        next_index = 0;
+        active_workers = static_cast<unsigned int>(workers.size());
+        error = nullptr;
+        ++batch_id;
+    }
+    work_available.notify_all();
+
+    // The calling thread works on the batch alongside the workers.
+    process_tasks();
+
+    std::exception_ptr task_error;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(active_workers != 0)
+        {
+            work_done.wait(lock);
+        }
+        current_task = nullptr;
+        task_error = error;
+        error = nullptr;
+    }
+
+    if(task_error)
+    {
+        std::rethrow_exception(task_error);
+    }
+}
+
+/**
+ * Worker thread main loop: wait for a batch, help process it, report back.
+ * @param[in] seen_batch  Identifier of the last batch issued before the
+ *                        worker was created. Passed in rather than read by
+ *                        the worker, which may not start running until after
+ *                        the next batch has been issued.
+ */
+void JeodThreadPool::worker_loop(unsigned long seen_batch)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while(true)
+    {
+        while(!stopping && (batch_id == seen_batch))
+        {
+            work_available.wait(lock);
+        }
+        if(stopping)
+        {
+            return;
+        }
+        seen_batch = batch_id;
+
+        lock.unlock();
+        process_tasks();
+        lock.lock();
+
+        if(--active_workers == 0)
+        {
+            work_done.notify_one();
+        }
+    }
+}
+
+/**
+ * Claim and execute task indices from the current batch until none remain.
+ */
+void JeodThreadPool::process_tasks()
+{
+    while(true)
+    {
+        unsigned int index = next_index.fetch_add(1);
+        if(index >= num_tasks)
+        {
+            break;
+        }
+
+        try
+        {
+            (*current_task)(index);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(!error || (index < error_index))
+            {
+                error = std::current_exception();
+                error_index = index;
+            }
+        }
+    }
+}
+
+/**
+ * Stop and join the worker threads.
+ */
+void JeodThreadPool::stop_workers()
+{
+    if(workers.empty())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    work_available.notify_all();
+
+    for(auto & worker : workers)
+    {
+        worker.join();
+    }
+    workers.clear();
+    stopping = false;
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ */
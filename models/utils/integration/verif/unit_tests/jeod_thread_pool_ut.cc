@@ -0,0 +1,73 @@
+/*
+ * jeod_thread_pool_ut.cc
+ */
+
+#include "utils/integration/include/jeod_thread_pool.hh"
+
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <vector>
+
+using namespace jeod;
+
+TEST(JeodThreadPool, create)
+{
+    JeodThreadPool staticInst;
+    EXPECT_EQ(staticInst.get_num_threads(), 1u);
+    JeodThreadPool * dynInst = new JeodThreadPool;
+    delete dynInst;
+}
+
+TEST(JeodThreadPool, set_num_threads)
+{
+    JeodThreadPool pool;
+    pool.set_num_threads(4);
+    EXPECT_EQ(pool.get_num_threads(), 4u);
+    pool.set_num_threads(0);
+    EXPECT_EQ(pool.get_num_threads(), 1u);
+}
+
+TEST(JeodThreadPool, run)
+{
+    JeodThreadPool pool;
+    pool.set_num_threads(4);
+
+    std::vector<unsigned int> counts(37, 0);
+    auto count_task = [&counts](unsigned int index)
+    {
+        counts[index] += index + 1;
+    };
+    for(unsigned int rep = 0; rep < 100; ++rep)
+    {
+        pool.run(static_cast<unsigned int>(counts.size()), count_task);
+    }
+
+    for(unsigned int ii = 0; ii < counts.size(); ++ii)
+    {
+        EXPECT_EQ(counts[ii], 100 * (ii + 1));
+    }
+}
+
+TEST(JeodThreadPool, run_exception)
+{
+    JeodThreadPool pool;
+    pool.set_num_threads(3);
+
+    auto failing_task = [](unsigned int index)
+    {
+        if(index == 2 || index == 5)
+        {
+            throw std::runtime_error(std::to_string(index));
+        }
+    };
+    try
+    {
+        pool.run(8, failing_task);
+        FAIL();
+    }
+    catch(const std::runtime_error & err)
+    {
+        EXPECT_STREQ(err.what(), "2");
+    }
+}
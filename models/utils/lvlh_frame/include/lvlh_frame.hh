@@ -78,6 +78,10 @@ namespace jeod
 /**
  * The class used to represent an LVLH reference frame associated
  * with a subject DynBody.
+ * LvlhFrame objects with the same subject and planet share one computation:
+ * the first to be initialized computes the frame state, at most once per
+ * pair of subject and planet timestamps when updated by the others, which
+ * copy it.
  */
 class LvlhFrame
 {
@@ -123,6 +127,28 @@ private:
      */
     bool initialized{}; //!< trick_units(--)
 
+    /**
+     * The LvlhFrame, of the same subject and planet, that computes the frame
+     * state that this one copies; null if this one computes it.
+     */
+    LvlhFrame * shared_source{}; //!< trick_units(--)
+
+    /**
+     * Indicates whether the frame state has been computed.
+     */
+    bool computed{}; //!< trick_units(--)
+
+    /**
+     * The subject frame's timestamp when the frame state was last computed.
+     */
+    double computed_timestamp{}; //!< trick_units(--)
+
+    /**
+     * The planet-centered inertial frame's timestamp when the frame state
+     * was last computed.
+     */
+    double computed_planet_timestamp{}; //!< trick_units(--)
+
     // Methods
 public:
     // Default constructor and destructor
@@ -139,6 +165,12 @@ public:
     // frame, which is the planet-centered inertial.
     void update();
 
+    // Is the frame state copied from another LvlhFrame?
+    bool is_shared() const
+    {
+        return shared_source != nullptr;
+    }
+
     // Specify the defining frame's name
     void set_subject_name(const std::string & new_name);
 
@@ -154,6 +186,10 @@ public:
 protected:
     // Calculate the current LVLH frame orientation based on given state.
     void compute_lvlh_frame(const RefFrameTrans & rel_trans);
+
+    // Compute the frame state unless already computed for the current
+    // subject and planet timestamps.
+    void update_if_stale();
 };
 
 } // namespace jeod
@@ -26,11 +26,15 @@ Library dependencies:
 *******************************************************************************/
 
 // System includes
+#include <algorithm>
 #include <cstddef>
+#include <mutex>
+#include <vector>
 
 // JEOD includes
 #include "dynamics/dyn_manager/include/dyn_manager.hh"
 #include "environment/planet/include/base_planet.hh"
+#include "utils/math/include/numerical.hh"
 #include "utils/math/include/vector3.hh"
 #include "utils/message/include/message_handler.hh"
 #include "utils/named_item/include/named_item.hh"
@@ -43,6 +47,29 @@ Library dependencies:
 namespace jeod
 {
 
+namespace
+{
+/**
+ * The initialized LvlhFrame objects, searched for one with the same subject
+ * and planet when another is initialized.
+ */
+std::vector<LvlhFrame *> & lvlh_frame_registry()
+{
+    static std::vector<LvlhFrame *> registry;
+    return registry;
+}
+
+/**
+ * Guards the registry, as frames may be created and destroyed on different
+ * threads.
+ */
+std::mutex & lvlh_frame_registry_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+} // namespace
+
 /**
  * Destruct an LvlhFrame object.
  */
@@ -57,6 +84,35 @@ LvlhFrame::~LvlhFrame()
         local_dm->remove_ref_frame(frame);
     }
 
+    // Hand the computation of a shared frame state to the first of the
+    // frames that copy it.
+    std::lock_guard<std::mutex> lock(lvlh_frame_registry_mutex());
+    std::vector<LvlhFrame *> & registry = lvlh_frame_registry();
+    registry.erase(std::remove(registry.begin(), registry.end(), this), registry.end());
+    LvlhFrame * new_source = nullptr;
+    for(auto other : registry)
+    {
+        if(other->shared_source != this)
+        {
+            continue;
+        }
+        if(new_source == nullptr)
+        {
+            new_source = other;
+            other->shared_source = nullptr;
+            other->computed = false;
+            if(local_dm != nullptr)
+            {
+                local_dm->add_ref_frame(other->frame);
+                other->local_dm = local_dm;
+            }
+        }
+        else
+        {
+            other->shared_source = new_source;
+        }
+    }
+
     // Remove the initialization-time frame subscriptions.
     if(subject_frame != nullptr)
     {
@@ -161,10 +217,38 @@ void LvlhFrame::initialize(DynManager & dyn_manager)
     // Name the LVLH frame as <subject_frame>.<planet>.lvlh
     frame.set_name(subject_name, planet_name, "lvlh");
 
+    // Copy the frame state from an LvlhFrame with the same subject and
+    // planet if there is one. Its frame is the one known by that name.
+    {
+        std::lock_guard<std::mutex> lock(lvlh_frame_registry_mutex());
+        for(auto other : lvlh_frame_registry())
+        {
+            if((other->subject_frame == subject_frame) &&
+               (other->planet_centered_inertial == planet_centered_inertial))
+            {
+                shared_source = (other->shared_source != nullptr) ? other->shared_source : other;
+                break;
+            }
+        }
+        lvlh_frame_registry().push_back(this);
+    }
+
     // Add the LVLH frame to the dynamics manager's frame list,
     // connect it to the planet's inertial frame, and subscribe
     // to that frame.
-    dyn_manager.add_ref_frame(frame);
+    if(shared_source == nullptr)
+    {
+        dyn_manager.add_ref_frame(frame);
+    }
+    else
+    {
+        local_dm = nullptr;
+        MessageHandler::debug(__FILE__,
+                              __LINE__,
+                              LvlhFrameMessages::trace,
+                              "LVLH frame '%s' shares the state computed for an existing frame.",
+                              frame.get_name().c_str());
+    }
     planet_centered_inertial->add_child(frame);
     planet_centered_inertial->subscribe();
 
@@ -179,10 +263,20 @@ void LvlhFrame::initialize(DynManager & dyn_manager)
 }
 
 /**
- * Update the state.
+ * Update the state. A frame state shared with another LvlhFrame is copied
+ * from it, computed first unless already computed for the current subject
+ * and planet timestamps.
  */
 void LvlhFrame::update()
 {
+    if(shared_source != nullptr)
+    {
+        shared_source->update_if_stale();
+        frame.state = shared_source->frame.state;
+        frame.set_timestamp(shared_source->frame.timestamp());
+        return;
+    }
+
     // Compute the LVLH frame directly from the subject frame's position and
     // velocity if the planet centered inertial frame is the direct parent
     // of the subject frame.
@@ -202,6 +296,22 @@ void LvlhFrame::update()
 
     // Timestamp the frame per the vehicle timestamp.
     frame.set_timestamp(subject_frame->timestamp());
+    computed = true;
+    computed_timestamp = subject_frame->timestamp();
+    computed_planet_timestamp = planet_centered_inertial->timestamp();
+}
+
+/**
+ * Update the state unless it has already been computed for the current
+ * subject and planet timestamps.
+ */
+void LvlhFrame::update_if_stale()
+{
+    if(!computed || !Numerical::compare_exact(computed_timestamp, subject_frame->timestamp()) ||
+       !Numerical::compare_exact(computed_planet_timestamp, planet_centered_inertial->timestamp()))
+    {
+        update();
+    }
 }
 
 /**
@@ -1,7 +1,8 @@
 #include "utils/quaternion/include/quat.hh"
-#include "utils/trick_csv/include/read_trk_csv.hh"
+#include "utils/trick_csv/include/trk_csv_reader.hh"
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 double dot(const double * v1, const double * v2)
 {
@@ -76,19 +77,37 @@ void compare(const int numRows, const int numCols, double ** p1, double ** p2, c
     std::cout << "Error found at element [" << maxErrRow << "][" << maxErrCol << "]\n";
 }
 
+// Read every column of a log, row after row; rows[ii] points to row ii.
+int readLog(const char * fileName, std::vector<double> & table, std::vector<double *> & rows)
+{
+    TrkCsvReader log(fileName);
+    unsigned long numRows = log.readRows(table);
+    unsigned int numCols = log.getNumCols();
+
+    rows.resize(numRows);
+    for(unsigned long ii = 0; ii < numRows; ++ii)
+    {
+        rows[ii] = table.data() + ii * numCols;
+    }
+    return numCols;
+}
+
 int main(int arg_c, char ** arg_v)
 {
     (void)arg_c;
     (void)arg_v;
 
-    ReadTrkCsv vehState("log_VehState.csv");
-    ReadTrkCsv lvlhState("log_LvlhState.csv");
+    std::vector<double> vehTable;
+    std::vector<double *> vehRows;
+    std::vector<double> lvlhTable;
+    std::vector<double *> lvlhRows;
+    readLog("log_VehState.csv", vehTable, vehRows);
+    readLog("log_LvlhState.csv", lvlhTable, lvlhRows);
 
     // First check for internal consistency
-    double ** stateValues = vehState.getValues();
-    double ** lvlhValues = lvlhState.getValues();
-    int numCols = lvlhState.getNumCols();
-    int numRows = lvlhState.getNumRows();
+    double ** stateValues = vehRows.data();
+    double ** lvlhValues = lvlhRows.data();
+    int numRows = lvlhRows.size();
 
     std::cout << "Checking for consistency with existing code\n";
     compare(numRows, 36, lvlhValues, lvlhValues, 1, 37);
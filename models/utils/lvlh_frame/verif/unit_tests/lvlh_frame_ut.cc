@@ -29,3 +29,7 @@ TEST(LvlhFrame, set_planet_name) {}
 TEST(LvlhFrame, set_planet) {}
 
 TEST(LvlhFrame, compute_lvlh_frame) {}
+
+TEST(LvlhFrame, update_if_stale) {}
+
+TEST(LvlhFrame, is_shared) {}
@@ -0,0 +1,284 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2025 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Memory
+ * @{
+ *
+ * @file models/utils/memory/include/memory_alloc_table.hh
+ * Define the class JeodMemoryAllocTable, the memory manager's allocation table.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((../src/memory_alloc_table.cc))
+
+
+
+*******************************************************************************/
+
+#ifndef JEOD_MEMORY_ALLOC_TABLE_HH
+#define JEOD_MEMORY_ALLOC_TABLE_HH
+
+/**
+ * \addtogroup classes
+ * @{
+ */
+
+// System includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+// Model includes
+#include "memory_item.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+class JeodMemoryTypeDescriptor;
+
+/**
+ * Maps the addresses of allocated memory to descriptions of that memory.
+ *
+ * The table is split into shards selected by a hash of the address. Each
+ * shard is an open-addressing hash table with linear probing and its own
+ * mutex, so threads that allocate and free memory at the same time rarely
+ * wait on one another. The hash table answers only whether an address is the
+ * start of a recorded allocation.
+ *
+ * Entries may also be indexed by address range in an ordered map guarded by
+ * a single mutex. The index is what finds the allocation that contains an
+ * address and what detects overlapping allocations; the memory manager
+ * indexes every entry except those made in release mode.
+ *
+ * \par Thread Safety
+ * The insert, find, find_containing, remove, and remove_oldest methods may be
+ * called concurrently. The visit and clear methods may not; they are meant for use
+ * by the memory manager's destructor after all other threads have finished.
+ */
+class JeodMemoryAllocTable
+{
+public:
+    /**
+     * A table entry: an allocated address and its descriptions.
+     * An entry with a null address is an empty slot.
+     */
+    struct Entry
+    {
+        /**
+         * Start of the allocated memory.
+         */
+        const void * addr{}; //!< trick_io(**)
+
+        /**
+         * Type of the allocated memory.
+         */
+        const JeodMemoryTypeDescriptor * tdesc{}; //!< trick_io(**)
+
+        /**
+         * Description of the allocated memory.
+         */
+        JeodMemoryItem item; //!< trick_io(**)
+
+        /**
+         * The entry is in the address range index.
+         */
+        bool indexed{}; //!< trick_io(**)
+    };
+
+    JeodMemoryAllocTable() = default;
+    ~JeodMemoryAllocTable() = default;
+    JeodMemoryAllocTable(const JeodMemoryAllocTable &) = delete;
+    JeodMemoryAllocTable & operator=(const JeodMemoryAllocTable &) = delete;
+
+    // Add an entry; fails if the address is already in the table or, for an
+    // indexed entry, if the memory overlaps that of an indexed entry.
+    bool insert(const void * addr,
+                const JeodMemoryItem & item,
+                const JeodMemoryTypeDescriptor & tdesc,
+                const void * index_end,
+                std::size_t & table_size);
+
+    // Find the entry for an address.
+    bool find(const void * addr, Entry & found);
+
+    // Find the indexed entry whose memory contains an address.
+    bool find_containing(const void * addr, Entry & found);
+
+    // Find and delete the entry for an address.
+    bool remove(const void * addr, Entry & found);
+
+    // Find and delete the entry with the smallest unique id.
+    bool remove_oldest(Entry & found);
+
+    // Delete all entries.
+    void clear();
+
+    /**
+     * Number of entries in the table.
+     * @return Table size
+     */
+    std::size_t size() const
+    {
+        return num_entries.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Indicate whether the table is empty.
+     * @return True if there are no entries
+     */
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * Call visitor(entry) for each entry in the table.
+     * Not thread safe; see the class description.
+     * \param[in] visitor Function or function object taking a const Entry &
+     */
+    template<typename Visitor> void visit(Visitor visitor) const
+    {
+        for(const Shard & shard : shards)
+        {
+            for(const Entry & entry : shard.slots)
+            {
+                if(entry.addr != nullptr)
+                {
+                    visitor(entry);
+                }
+            }
+        }
+    }
+
+    /**
+     * Number of shards. Must be a power of two.
+     */
+    static const unsigned int num_shards = 64;
+
+    /**
+     * Shift that maps a hash value to a shard index.
+     */
+    static const unsigned int shard_shift = 58;
+
+private:
+    /**
+     * One independently locked part of the table.
+     */
+    struct Shard
+    {
+        /**
+         * Serializes access to the shard.
+         */
+        std::mutex mutex; //!< trick_io(**)
+
+        /**
+         * Hash slots. The size is zero or a power of two.
+         */
+        std::vector<Entry> slots; //!< trick_io(**)
+
+        /**
+         * Number of occupied slots.
+         */
+        std::size_t count{}; //!< trick_io(**)
+    };
+
+    // Hash an address.
+    static uint64_t hash(const void * addr);
+
+    // First slot probed for a hash value.
+    static std::size_t home_slot(uint64_t hash_value, std::size_t mask);
+
+    // Find the slot that holds an address; returns false if absent.
+    static bool find_slot(const Shard & shard, const void * addr, uint64_t hash_value, std::size_t & slot);
+
+    // Delete the entry in a slot, closing the probe sequence around it.
+    void erase_slot(Shard & shard, std::size_t slot);
+
+    // Double the number of slots in a shard.
+    static void grow(Shard & shard);
+
+    // Remove an entry from the address range index.
+    void unindex(const Entry & entry);
+
+    /**
+     * The shards, selected by the high bits of the address hash.
+     */
+    Shard shards[num_shards]; //!< trick_io(**)
+
+    /**
+     * Serializes access to the address range index.
+     */
+    std::mutex index_mutex; //!< trick_io(**)
+
+    /**
+     * Address range index: maps the start of each indexed entry's memory to
+     * the end of that memory.
+     */
+    std::map<const void *, const void *> index; //!< trick_io(**)
+
+    /**
+     * Total number of entries.
+     */
+    std::atomic<std::size_t> num_entries{}; //!< trick_io(**)
+};
+
+} // namespace jeod
+
+/**
+ * @}
+ */
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
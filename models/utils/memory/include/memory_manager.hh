@@ -53,6 +53,7 @@ Purpose:
 
 Library dependencies:
   ((../src/memory_manager.cc)
+   (../src/memory_alloc_table.cc)
    (../src/memory_manager_protected.cc)
    (../src/memory_manager_static.cc))
 
@@ -73,9 +74,9 @@ Library dependencies:
  */
 
 // System includes
+#include <atomic>
 #include <cstddef>
 #include <list>
-#include <map>
 #include <ostream>
 #include <pthread.h>
 #include <string>
@@ -89,6 +90,7 @@ Library dependencies:
 #include "utils/sim_interface/include/simulation_interface.hh"
 
 // Model includes
+#include "memory_alloc_table.hh"
 #include "memory_item.hh"
 #include "memory_table.hh"
 #include "memory_type.hh"
@@ -115,16 +117,21 @@ namespace jeod
  * \par Thread Safety
  * This class contains objects that must be accessed and updated in a
  * thread-safe manner. The member data that must be used atomically are
- *  - JeodMemoryManager::alloc_table - Maps memory addresses to memory items
  *  - JeodMemoryManager::type_table - Maps RTTI names to type descriptors
  *  - JeodMemoryManager::string_table - Maps unique strings to themselves.
- *  - JeodMemoryManager::cur_data_size - Current size of allocated data.
- *  - JeodMemoryManager::max_data_size - Maximum of the above.
- *  - JeodMemoryManager::max_table_size - Maximum allocation table size.
- *  - JeodMemoryManager::allocation_number - Number of allocations made.
  * \par
- * To ensure the constraint is satisfied, access to the these elements is
- * protected by means of a mutex and is limited to a small number of methods.
+ * The allocation table, JeodMemoryManager::alloc_table, is a sharded table
+ * that locks only the shard an address hashes to, and the allocation
+ * statistics (JeodMemoryManager::cur_data_size, max_data_size,
+ * max_table_size, and allocation_number) are atomic variables. Outside of
+ * release mode, the table's address range index, which has a single lock,
+ * is also updated; in release mode allocating and freeing memory in
+ * different threads does not serialize on a single lock. Type and allocation site lookups made on behalf of the
+ * JEOD_ALLOC macros are cached per thread, so the mutex that protects the
+ * type and string tables is taken only on the first use of a type or a site.
+ * \par
+ * To ensure the constraint is satisfied, access to the type and string tables
+ * is protected by means of a mutex and is limited to a small number of methods.
  * A pair of methods, JeodMemoryManager::begin_atomic_block and
  * JeodMemoryManager::end_atomic_block systematize the use of the mutex.
  * The methods that operate on the protected data are
@@ -314,6 +321,9 @@ public:
     // Enable/disable guard words
     static void set_guard_enabled(bool value);
 
+    // Enable/disable release mode
+    static void set_release_mode(bool value);
+
     // Testing interfaces
 
     // Query whether all allocated memory has been freed.
@@ -349,7 +359,7 @@ private:
     /**
      * An AllocTable maps memory addresses to memory descriptions.
      */
-    using AllocTable = std::map<const void *, JeodMemoryItem>;
+    using AllocTable = JeodMemoryAllocTable;
 
     /**
      * The type type itself is a memory table with copy implemented by clone().
@@ -369,6 +379,12 @@ private:
      */
     static JeodMemoryManager * Master; //!< trick_io(*o) trick_units(--)
 
+    /**
+     * Number of memory managers constructed so far, used to give each
+     * manager an identifier that the per-thread lookup caches can check.
+     */
+    static std::atomic<unsigned int> num_instances; //!< trick_io(**)
+
     // Member functions
 
     // Methods called by the public interfaces
@@ -384,6 +400,7 @@ private:
     void register_memory_internal(const void * addr,
                                   uint32_t unique_id,
                                   bool placement_new,
+                                  bool is_guarded,
                                   bool is_array,
                                   unsigned int nelems,
                                   const TypeEntry & tentry,
@@ -437,6 +454,9 @@ private:
     // Add a string to the string table.
     unsigned int add_string_atomic(const std::string & str);
 
+    // Get the string table index that identifies an allocation site.
+    unsigned int get_alloc_site_index_atomic(const char * file, unsigned int line);
+
     // alloc_table accessors
 
     // Create a unique identifier for an allocation
@@ -496,23 +516,28 @@ private:
     /**
      * Number of allocated user bytes (excludes management overhead).
      */
-    JEOD_SIZE_T cur_data_size{}; //!< trick_io(*o) trick_units(--)
+    std::atomic<JEOD_SIZE_T> cur_data_size{}; //!< trick_io(**)
 
     /**
      * Maximum value attained by cur_data_size.
      */
-    JEOD_SIZE_T max_data_size{}; //!< trick_io(*o) trick_units(--)
+    std::atomic<JEOD_SIZE_T> max_data_size{}; //!< trick_io(**)
 
     /**
      * Maximum value attained by alloc_table.size().
      */
-    unsigned int max_table_size{}; //!< trick_io(*o) trick_units(--)
+    std::atomic<unsigned int> max_table_size{}; //!< trick_io(**)
 
     /**
      * Number of allocations.
      * This always increments and can be adjusted upward on restarts.
      */
-    unsigned int allocation_number{}; //!< trick_io(*o) trick_units(--)
+    std::atomic<unsigned int> allocation_number{}; //!< trick_io(**)
+
+    /**
+     * Identifies this manager to the per-thread lookup caches.
+     */
+    unsigned int instance_id{}; //!< trick_io(**)
 
     // Several of the remaining are hidden from Trick.
     // The memory model is not Trick-checkpointable.
@@ -548,6 +573,14 @@ private:
      * If not set, guards will never be established.
      */
     bool guard_enabled{true}; //!< trick_units(--)
+
+    /**
+     * Release mode: allocations are recorded with only what is needed to
+     * free them. Guard words, allocation site strings, per-allocation debug
+     * messages, and the address range index (overlap and interior pointer
+     * checks) are skipped whatever the guard and debug settings are.
+     */
+    bool release_mode{false}; //!< trick_units(--)
 };
 
 /**
@@ -2,6 +2,7 @@ set(SUBDIR ${CMAKE_CURRENT_LIST_DIR})
 
 set(SRCS
 memory_type.cc
+memory_alloc_table.cc
 memory_manager_protected.cc
 memory_manager_static.cc
 memory_item.cc
@@ -0,0 +1,380 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup Memory
+ * @{
+ *
+ * @file models/utils/memory/src/memory_alloc_table.cc
+ * Implement the JeodMemoryAllocTable class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Library dependencies:
+  ((memory_item.cc))
+
+
+*******************************************************************************/
+
+/**
+ * \addtogroup classes
+ * @{
+ */
+
+// System includes
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <vector>
+
+// Model includes
+#include "../include/memory_alloc_table.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+/**
+ * Hash an address.
+ * Allocations are aligned, so the low bits of an address carry little
+ * information; a multiplicative hash spreads the rest over the upper bits.
+ * The top bits select the shard (see shard_shift) and middle bits the first
+ * slot probed (see home_slot).
+ * @return Hash value
+ * \param[in] addr Address
+ */
+uint64_t JeodMemoryAllocTable::hash(const void * addr)
+{
+    auto key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(addr));
+    return key * UINT64_C(0x9E3779B97F4A7C15);
+}
+
+/**
+ * First slot probed for a hash value.
+ * @return Slot index
+ * \param[in] hash_value Hash of an address
+ * \param[in] mask Number of slots in the shard, less one
+ */
+std::size_t JeodMemoryAllocTable::home_slot(uint64_t hash_value, std::size_t mask)
+{
+    return static_cast<std::size_t>(hash_value >> 24) & mask;
+}
+
+/**
+ * Find the slot that holds an address.
+ * @return True if the address is in the shard
+ * \param[in] shard Shard, locked by the caller
+ * \param[in] addr Address
+ * \param[in] hash_value Hash of the address
+ * \param[out] slot Slot holding the address
+ */
+bool JeodMemoryAllocTable::find_slot(const Shard & shard,
+                                     const void * addr,
+                                     uint64_t hash_value,
+                                     std::size_t & slot)
+{
+    if(shard.slots.empty())
+    {
+        return false;
+    }
+    std::size_t mask = shard.slots.size() - 1;
+    for(std::size_t ii = home_slot(hash_value, mask);; ii = (ii + 1) & mask)
+    {
+        const void * slot_addr = shard.slots[ii].addr;
+        if(slot_addr == addr)
+        {
+            slot = ii;
+            return true;
+        }
+        if(slot_addr == nullptr)
+        {
+            return false;
+        }
+    }
+}
+
+/**
+ * Double the number of slots in a shard, starting at 16 slots.
+ * \param[in,out] shard Shard, locked by the caller
+ */
+void JeodMemoryAllocTable::grow(Shard & shard)
+{
+    std::vector<Entry> old_slots(shard.slots.empty() ? 16 : 2 * shard.slots.size());
+    old_slots.swap(shard.slots);
+    std::size_t mask = shard.slots.size() - 1;
+    for(const Entry & entry : old_slots)
+    {
+        if(entry.addr != nullptr)
+        {
+            std::size_t ii = home_slot(hash(entry.addr), mask);
+            while(shard.slots[ii].addr != nullptr)
+            {
+                ii = (ii + 1) & mask;
+            }
+            shard.slots[ii] = entry;
+        }
+    }
+}
+
+/**
+ * Delete the entry in a slot. Entries later in the same probe sequence are
+ * shifted back so that no tombstones are needed.
+ * \param[in,out] shard Shard, locked by the caller
+ * \param[in] slot Occupied slot
+ */
+void JeodMemoryAllocTable::erase_slot(Shard & shard, std::size_t slot)
+{
+    std::size_t mask = shard.slots.size() - 1;
+    std::size_t hole = slot;
+    for(std::size_t ii = (hole + 1) & mask; shard.slots[ii].addr != nullptr; ii = (ii + 1) & mask)
+    {
+        // An entry can fill the hole unless its home slot lies cyclically
+        // in (hole, ii], in which case moving it would hide it from lookups.
+        std::size_t home = home_slot(hash(shard.slots[ii].addr), mask);
+        bool stays = (hole <= ii) ? ((hole < home) && (home <= ii)) : ((hole < home) || (home <= ii));
+        if(!stays)
+        {
+            shard.slots[hole] = shard.slots[ii];
+            hole = ii;
+        }
+    }
+    shard.slots[hole] = Entry();
+    --shard.count;
+    num_entries.fetch_sub(1, std::memory_order_relaxed);
+}
+
+/**
+ * Remove an entry from the address range index.
+ * \param[in] entry Entry that has been deleted from its shard
+ */
+void JeodMemoryAllocTable::unindex(const Entry & entry)
+{
+    if(entry.indexed)
+    {
+        std::lock_guard<std::mutex> lock(index_mutex);
+        index.erase(entry.addr);
+    }
+}
+
+/**
+ * Add an entry to the table.
+ * The address range index is checked and updated before the shard is
+ * locked; the two locks are never held at the same time.
+ * @return True if added, false if the address is already in the table or
+ *         the memory overlaps that of an indexed entry
+ * \param[in] addr Start of the allocated memory
+ * \param[in] item Description of that memory
+ * \param[in] tdesc Type of that memory
+ * \param[in] index_end End of the allocated memory, or null if the entry
+ *            is not to be indexed
+ * \param[out] table_size Number of entries after the addition
+ */
+bool JeodMemoryAllocTable::insert(const void * addr,
+                                  const JeodMemoryItem & item,
+                                  const JeodMemoryTypeDescriptor & tdesc,
+                                  const void * index_end,
+                                  std::size_t & table_size)
+{
+    if(index_end != nullptr)
+    {
+        std::lock_guard<std::mutex> lock(index_mutex);
+
+        // The memory overlaps the indexed entry that starts at or before it
+        // if that entry ends after addr, and the next entry if that one
+        // starts before index_end.
+        auto next = index.upper_bound(addr);
+        if((next != index.end()) && (next->first < index_end))
+        {
+            return false;
+        }
+        if((next != index.begin()) && (addr < std::prev(next)->second))
+        {
+            return false;
+        }
+        index.emplace_hint(next, addr, index_end);
+    }
+
+    uint64_t hash_value = hash(addr);
+    Shard & shard = shards[hash_value >> shard_shift];
+    std::unique_lock<std::mutex> lock(shard.mutex);
+
+    std::size_t slot = 0;
+    if(find_slot(shard, addr, hash_value, slot))
+    {
+        // The address was registered without being indexed.
+        lock.unlock();
+        if(index_end != nullptr)
+        {
+            std::lock_guard<std::mutex> index_lock(index_mutex);
+            index.erase(addr);
+        }
+        return false;
+    }
+
+    // Keep the load factor at or below one half.
+    if(2 * (shard.count + 1) > shard.slots.size())
+    {
+        grow(shard);
+    }
+    std::size_t mask = shard.slots.size() - 1;
+    slot = home_slot(hash_value, mask);
+    while(shard.slots[slot].addr != nullptr)
+    {
+        slot = (slot + 1) & mask;
+    }
+    shard.slots[slot].addr = addr;
+    shard.slots[slot].tdesc = &tdesc;
+    shard.slots[slot].item = item;
+    shard.slots[slot].indexed = (index_end != nullptr);
+    ++shard.count;
+    table_size = num_entries.fetch_add(1, std::memory_order_relaxed) + 1;
+    return true;
+}
+
+/**
+ * Find the entry for an address.
+ * @return True if found
+ * \param[in] addr Address
+ * \param[out] found Copy of the entry; untouched if not found
+ */
+bool JeodMemoryAllocTable::find(const void * addr, Entry & found)
+{
+    uint64_t hash_value = hash(addr);
+    Shard & shard = shards[hash_value >> shard_shift];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    std::size_t slot = 0;
+    if(!find_slot(shard, addr, hash_value, slot))
+    {
+        return false;
+    }
+    found = shard.slots[slot];
+    return true;
+}
+
+/**
+ * Find the indexed entry whose memory contains an address.
+ * Entries that are not indexed are not considered.
+ * @return True if found
+ * \param[in] addr Address
+ * \param[out] found Copy of the entry; untouched if not found
+ */
+bool JeodMemoryAllocTable::find_containing(const void * addr, Entry & found)
+{
+    const void * start = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(index_mutex);
+        auto next = index.upper_bound(addr);
+        if((next == index.begin()) || !(addr < std::prev(next)->second))
+        {
+            return false;
+        }
+        start = std::prev(next)->first;
+    }
+    return find(start, found);
+}
+
+/**
+ * Find and delete the entry for an address.
+ * @return True if found
+ * \param[in] addr Address
+ * \param[out] found Copy of the deleted entry; untouched if not found
+ */
+bool JeodMemoryAllocTable::remove(const void * addr, Entry & found)
+{
+    uint64_t hash_value = hash(addr);
+    Shard & shard = shards[hash_value >> shard_shift];
+    std::unique_lock<std::mutex> lock(shard.mutex);
+
+    std::size_t slot = 0;
+    if(!find_slot(shard, addr, hash_value, slot))
+    {
+        return false;
+    }
+    found = shard.slots[slot];
+    erase_slot(shard, slot);
+    lock.unlock();
+
+    unindex(found);
+    return true;
+}
+
+/**
+ * Find and delete the entry with the smallest unique id.
+ * All shards are locked, in order, for the duration of the search.
+ * @return True if the table was not empty
+ * \param[out] found Copy of the deleted entry; untouched if the table is empty
+ */
+bool JeodMemoryAllocTable::remove_oldest(Entry & found)
+{
+    std::unique_lock<std::mutex> locks[num_shards];
+    for(unsigned int ii = 0; ii < num_shards; ++ii)
+    {
+        locks[ii] = std::unique_lock<std::mutex>(shards[ii].mutex);
+    }
+
+    Shard * target_shard = nullptr;
+    std::size_t target_slot = 0;
+    uint32_t target_id = UINT32_MAX;
+    for(Shard & shard : shards)
+    {
+        for(std::size_t ii = 0; ii < shard.slots.size(); ++ii)
+        {
+            const Entry & entry = shard.slots[ii];
+            if((entry.addr != nullptr) && ((target_shard == nullptr) || (entry.item.get_unique_id() < target_id)))
+            {
+                target_shard = &shard;
+                target_slot = ii;
+                target_id = entry.item.get_unique_id();
+            }
+        }
+    }
+
+    if(target_shard == nullptr)
+    {
+        return false;
+    }
+    found = target_shard->slots[target_slot];
+    erase_slot(*target_shard, target_slot);
+    for(std::unique_lock<std::mutex> & lock : locks)
+    {
+        lock.unlock();
+    }
+
+    unindex(found);
+    return true;
+}
+
+/**
+ * Delete all entries and release the slots.
+ * Not thread safe; see the class description.
+ */
+void JeodMemoryAllocTable::clear()
+{
+    for(Shard & shard : shards)
+    {
+        std::vector<Entry>().swap(shard.slots);
+        shard.count = 0;
+    }
+    index.clear();
+    num_entries.store(0, std::memory_order_relaxed);
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
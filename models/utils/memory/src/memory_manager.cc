@@ -37,7 +37,6 @@ Library dependencies:
 #include <iostream>
 #include <map>
 #include <pthread.h>
-#include <sstream>
 #include <typeinfo>
 
 // JEOD includes
@@ -69,6 +68,7 @@ JeodMemoryManager::JeodMemoryManager(JeodMemoryInterface & interface)
     {
         // This is the master memory manager.
         Master = this;
+        instance_id = ++num_instances;
 
 // Populate the type table with commonly-used names for integer types.
 // This avoids someone overriding 'int' with 'int32_t' and such.
@@ -152,16 +152,14 @@ JeodMemoryManager::~JeodMemoryManager()
 
         // Make leaks opaque to the simulation engine.
         // FUTURE_FEATURE: Garbage collect here?
-        for(auto & it : alloc_table)
-        {
-            const void * addr = it.first;
-            const JeodMemoryItem & item = it.second;
-            const JeodMemoryTypeDescriptor & tdesc = get_type_descriptor_nolock(item);
-            if(item.get_is_registered())
+        alloc_table.visit(
+            [this](const AllocTable::Entry & entry)
             {
-                sim_interface.deregister_allocation(addr, item, tdesc, __FILE__, __LINE__);
-            }
-        }
+                if(entry.item.get_is_registered())
+                {
+                    sim_interface.deregister_allocation(entry.addr, entry.item, *entry.tdesc, __FILE__, __LINE__);
+                }
+            });
 
         // Delete the allocations.
         alloc_table.clear();
@@ -182,10 +180,10 @@ void JeodMemoryManager::generate_shutdown_report()
     if(debug_level > 0)
     {
         // FUTURE_FEATURE: Do a better job of counting.
-        // It would be nice to know the size of a red-black tree node.
-        unsigned int telem_size = sizeof(AllocTable::value_type);
+        // The table holds at most two slots per entry.
+        unsigned int telem_size = 2 * sizeof(AllocTable::Entry);
         unsigned int item_size = sizeof(JeodMemoryItem);
-        unsigned int total_size = max_table_size * (telem_size + item_size);
+        unsigned int total_size = max_table_size * telem_size;
 
         // Generate a summary report.
         MessageHandler::inform(__FILE__,
@@ -197,11 +195,11 @@ void JeodMemoryManager::generate_shutdown_report()
                                "  Item descriptor size: %7d\n"
                                "  Memory overhead:      %7d\n"
                                "  Allocated data size:  %7d",
-                               max_table_size,
+                               max_table_size.load(),
                                telem_size,
                                item_size,
                                total_size,
-                               max_data_size);
+                               static_cast<int>(max_data_size.load()));
 
         // Report any memory that has not been freed.
         // Note: This reports only. Unfreed memory is a leak.
@@ -219,35 +217,33 @@ void JeodMemoryManager::generate_shutdown_report()
                                  MemoryMessages::corrupted_memory,
                                  "Not all JEOD-allocated memory has been freed!");
 
-            for(auto & it : alloc_table)
-            {
-                const void * addr = it.first;
-                const JeodMemoryItem & item = it.second;
-                const JeodMemoryTypeDescriptor & tdesc = get_type_descriptor_nolock(item);
-                unsigned int alloc_idx = item.get_alloc_index();
-                if(alloc_idx == 0)
+            alloc_table.visit(
+                [this](const AllocTable::Entry & entry)
                 {
-                    MessageHandler::warn(__FILE__,
-                                         __LINE__,
-                                         MemoryMessages::debug,
-                                         "Memory at %p was not freed\n"
-                                         "  Type=%s\n",
-                                         addr,
-                                         tdesc.type_spec(item).c_str());
-                }
-                else
-                {
-                    MessageHandler::warn(__FILE__,
-                                         __LINE__,
-                                         MemoryMessages::debug,
-                                         "Memory at %p was not freed\n"
-                                         "  Type=%s\n"
-                                         "  Allocated at %s",
-                                         addr,
-                                         tdesc.type_spec(item).c_str(),
-                                         string_table.get(alloc_idx)->c_str());
-                }
-            }
+                    unsigned int alloc_idx = entry.item.get_alloc_index();
+                    if(alloc_idx == 0)
+                    {
+                        MessageHandler::warn(__FILE__,
+                                             __LINE__,
+                                             MemoryMessages::debug,
+                                             "Memory at %p was not freed\n"
+                                             "  Type=%s\n",
+                                             entry.addr,
+                                             entry.tdesc->type_spec(entry.item).c_str());
+                    }
+                    else
+                    {
+                        MessageHandler::warn(__FILE__,
+                                             __LINE__,
+                                             MemoryMessages::debug,
+                                             "Memory at %p was not freed\n"
+                                             "  Type=%s\n"
+                                             "  Allocated at %s",
+                                             entry.addr,
+                                             entry.tdesc->type_spec(entry.item).c_str(),
+                                             string_table.get(alloc_idx)->c_str());
+                    }
+                });
         }
     }
 }
@@ -338,14 +334,15 @@ void JeodMemoryManager::restart_reallocate(const std::string & mangled_type_name
     }
 
     std::size_t elem_size = type->get_size();
+    bool guard = guard_enabled && !release_mode;
     void * addr;
 
     // Allocate and construct the object.
-    addr = allocate_memory(nelements, elem_size, guard_enabled, 0);
+    addr = allocate_memory(nelements, elem_size, guard, 0);
     type->construct_array(nelements, addr);
 
     // Register with the simulation engine.
-    register_memory_internal(addr, unique_id, true, is_array, nelements, tentry, __FILE__, __LINE__);
+    register_memory_internal(addr, unique_id, true, guard, is_array, nelements, tentry, __FILE__, __LINE__);
 }
 
 /******************************************************************************/
@@ -388,9 +385,10 @@ void * JeodMemoryManager::create_memory_internal(
     bool is_array, unsigned int nelems, int fill, const TypeEntry & tentry, const char * file, unsigned int line)
 {
     std::size_t elem_size = tentry.tdesc->get_size();
-    void * addr = allocate_memory(nelems, elem_size, guard_enabled, fill);
+    bool guard = guard_enabled && !release_mode;
+    void * addr = allocate_memory(nelems, elem_size, guard, fill);
 
-    register_memory_internal(addr, 0, true, is_array, nelems, tentry, file, line);
+    register_memory_internal(addr, 0, true, guard, is_array, nelems, tentry, file, line);
 
     return addr;
 }
@@ -412,6 +410,7 @@ void * JeodMemoryManager::create_memory_internal(
  * \param[in] addr Memory to be registered
  * \param[in] unique_id Unique id
  * \param[in] placement_new Was memory allocated by this model?
+ * \param[in] is_guarded Is the memory surrounded by guard words?
  * \param[in] is_array Was memory allocated as an array?
  * \param[in] nelems Array size
  * \param[in] tentry Type entry
@@ -421,6 +420,7 @@ void * JeodMemoryManager::create_memory_internal(
 void JeodMemoryManager::register_memory_internal(const void * addr,
                                                  uint32_t unique_id,
                                                  bool placement_new,
+                                                 bool is_guarded,
                                                  bool is_array,
                                                  unsigned int nelems,
                                                  const TypeEntry & tentry,
@@ -446,22 +446,19 @@ void JeodMemoryManager::register_memory_internal(const void * addr,
         return;
     }
 
-    // Construct and save a string describing the place the memory was
-    // allocated, but only if debugging levels are high enough.
-    if((file == nullptr) || (debug_level <= 1))
+    // Identify the place the memory was allocated, but only if debugging
+    // levels are high enough.
+    if((file == nullptr) || (debug_level <= 1) || release_mode)
     {
         alloc_idx = 0;
     }
     else
     {
-        std::ostringstream id;
-        id << file << ":" << line;
-
-        alloc_idx = add_string_atomic(id.str());
+        alloc_idx = get_alloc_site_index_atomic(file, line);
     }
 
     // Create the memory item that describes the allocated memory.
-    JeodMemoryItem item(placement_new, is_array, true, tdesc.is_structured(), nelems, tidx, alloc_idx);
+    JeodMemoryItem item(placement_new, is_array, is_guarded, tdesc.is_structured(), nelems, tidx, alloc_idx);
 
     // Provided unique_id is non-zero (called from restart_reallocate):
     // Use the provided number.
@@ -493,7 +490,7 @@ void JeodMemoryManager::register_memory_internal(const void * addr,
     add_allocation_atomic(addr, item, tdesc, file, line);
 
     // Report the allocation.
-    if(debug_level > 2)
+    if((debug_level > 2) && !release_mode)
     {
         MessageHandler::debug(__FILE__,
                               __LINE__,
@@ -615,7 +612,7 @@ void JeodMemoryManager::destroy_memory_internal(void * addr, bool delete_array,
                                found_addr);
 
     // Print debugging info if enabled.
-    if(debug_level > 2)
+    if((debug_level > 2) && !release_mode)
     {
         unsigned int alloc_idx = found_item.get_alloc_index();
         if(alloc_idx == 0)
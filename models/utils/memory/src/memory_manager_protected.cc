@@ -33,12 +33,12 @@ Library dependencies:
 
 // System includes
 #define __STDC_LIMIT_MACROS
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
-#include <map>
 #include <pthread.h>
 #include <sstream>
 #include <typeinfo>
@@ -55,6 +55,61 @@ Library dependencies:
 namespace jeod
 {
 
+namespace
+{
+/**
+ * Number of entries in each per-thread lookup cache. Must be a power of two.
+ */
+const unsigned int thread_cache_size = 64;
+
+/**
+ * A per-thread cache entry for type table lookups by std::type_info.
+ */
+struct TypeCacheEntry
+{
+    unsigned int manager_id;                ///< Manager that made the entry; zero if unused
+    const std::type_info * typeid_info;     ///< Type looked up
+    uint32_t index;                         ///< Type table index
+    const JeodMemoryTypeDescriptor * tdesc; ///< Type table descriptor
+};
+
+/**
+ * A per-thread cache entry for allocation site string indices.
+ */
+struct SiteCacheEntry
+{
+    unsigned int manager_id; ///< Manager that made the entry; zero if unused
+    const char * file;       ///< Source file of the site
+    unsigned int line;       ///< Source line of the site
+    unsigned int index;      ///< String table index
+};
+
+/**
+ * Type table lookups made by this thread.
+ * Types are never removed from the type table while a manager exists.
+ */
+thread_local TypeCacheEntry type_cache[thread_cache_size];
+
+/**
+ * Allocation site lookups made by this thread.
+ * Strings are never removed from the string table while a manager exists.
+ */
+thread_local SiteCacheEntry site_cache[thread_cache_size];
+
+/**
+ * Raise an atomic maximum to at least the given value.
+ * \param[in,out] maximum Maximum to update
+ * \param[in] value Candidate value
+ */
+template<typename T> void update_maximum(std::atomic<T> & maximum, T value)
+{
+    T current = maximum.load(std::memory_order_relaxed);
+    while((current < value) && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+} // namespace
+
 /*******************************************************************************
  * begin_atomic_block and end_atomic_block
  ******************************************************************************/
@@ -208,6 +263,39 @@ unsigned int JeodMemoryManager::add_string_atomic(const std::string & str)
     return idx;
 }
 
+/**
+ * Get the string table index of the "file:line" string that identifies an
+ * allocation site, adding the string to the table if needed.
+ *
+ * \par Assumptions and Limitations
+ *  - Operations on the map must be atomic.
+ *     This method satisfies that requirement.
+ *  - Sites are cached per thread by file name pointer and line number,
+ *     so the table is locked only the first time a thread uses a site.
+ * @return String table index
+ * \param[in] file Source file containing JEOD_ALLOC
+ * \param[in] line Line number containing JEOD_ALLOC
+ */
+unsigned int JeodMemoryManager::get_alloc_site_index_atomic(const char * file, unsigned int line)
+{
+    std::size_t hash = (reinterpret_cast<uintptr_t>(file) >> 3) ^ (line * 0x9E3779B1U);
+    SiteCacheEntry & cached = site_cache[(hash ^ (hash >> 11)) & (thread_cache_size - 1)];
+    if((cached.manager_id == instance_id) && (cached.file == file) && (cached.line == line))
+    {
+        return cached.index;
+    }
+
+    std::ostringstream id;
+    id << file << ":" << line;
+    unsigned int idx = add_string_atomic(id.str());
+
+    cached.manager_id = instance_id;
+    cached.file = file;
+    cached.line = line;
+    cached.index = idx;
+    return idx;
+}
+
 /*******************************************************************************
  * type_table methods
  ******************************************************************************/
@@ -267,12 +355,21 @@ bool JeodMemoryManager::get_type_index_nolock(const JeodMemoryTypeDescriptor & t
  *     across all allocatable types and is invariant.
  *  - Operations on the map must be atomic.
  *     This method satisfies that requirement.
+ *  - Types are cached per thread by std::type_info address, so the table is
+ *     locked only the first time a thread uses a type.
  * @return Type descriptor index
  * \param[in] tdesc Type pre-descriptor
  */
 const JeodMemoryManager::TypeEntry JeodMemoryManager::get_type_entry_atomic(JeodMemoryTypePreDescriptor & tdesc)
 {
     const std::type_info & typeid_info = tdesc.get_typeid();
+    TypeCacheEntry & cached =
+        type_cache[(reinterpret_cast<uintptr_t>(&typeid_info) >> 4) & (thread_cache_size - 1)];
+    if((cached.manager_id == instance_id) && (cached.typeid_info == &typeid_info))
+    {
+        return TypeEntry(cached.index, cached.tdesc);
+    }
+
     const std::string key(typeid_info.name());
     uint32_t index = 0;
     const JeodMemoryTypeDescriptor * table_tdesc = nullptr;
@@ -317,6 +414,11 @@ const JeodMemoryManager::TypeEntry JeodMemoryManager::get_type_entry_atomic(Jeod
                               table_tdesc->get_name().c_str());
     }
 
+    cached.manager_id = instance_id;
+    cached.typeid_info = &typeid_info;
+    cached.index = index;
+    cached.tdesc = table_tdesc;
+
     // Return the found/added type index.
     return TypeEntry(index, table_tdesc);
 }
@@ -473,7 +575,7 @@ const JeodMemoryTypeDescriptor & JeodMemoryManager::get_type_descriptor_atomic(u
  * Create a unique identifier for an allocation.
  *
  * \par Assumptions and Limitations
- *  - Operations on the map must be atomic.
+ *  - The allocation number must be updated atomically.
  *     This method satisfies that requirement.
  * @return Allocation ID
  * \param[in] file Source file containing JEOD_ALLOC
@@ -484,43 +586,25 @@ const JeodMemoryTypeDescriptor & JeodMemoryManager::get_type_descriptor_atomic(u
 Purpose:
   (Create a unique identifier for an allocation.)
 Assumptions and limitations:
-  ((Operations on the map must be atomic.
+  ((The allocation number must be updated atomically.
     This method satisfies that requirement.))
 */
 uint32_t JeodMemoryManager::get_alloc_id_atomic(const char * file, unsigned int line)
 {
-    uint32_t unique_id = 0;
-
-    // Construct the unique identifier in protected mode.
-    try
-    {
-        begin_atomic_block();
-
-        // Bump the allocation number.
-        ++allocation_number;
-
-        // Check for overflow.
-        if((allocation_number == UINT32_MAX) || (allocation_number == 0))
-        {
-            end_atomic_block(true);
-            MessageHandler::fail(__FILE__,
-                                 __LINE__,
-                                 MemoryMessages::corrupted_memory,
-                                 "Memory allocation limit exceeded at %s:%d.",
-                                 file,
-                                 line);
-            return unique_id;
-        }
+    // Bump the allocation number. The incremented allocation number is the
+    // unique identifier.
+    uint32_t unique_id = allocation_number.fetch_add(1) + 1;
 
-        // The incremented allocation number is the unique identifier.
-        unique_id = allocation_number;
-
-        end_atomic_block(false);
-    }
-    catch(...)
+    // Check for overflow.
+    if((unique_id == UINT32_MAX) || (unique_id == 0))
     {
-        end_atomic_block(true);
-        throw;
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             MemoryMessages::corrupted_memory,
+                             "Memory allocation limit exceeded at %s:%d.",
+                             file,
+                             line);
+        return 0;
     }
 
     return unique_id;
@@ -530,29 +614,13 @@ uint32_t JeodMemoryManager::get_alloc_id_atomic(const char * file, unsigned int
  * Reset the unique identifier for a restart.
  *
  * \par Assumptions and Limitations
- *  - Operations on the map must be atomic.
+ *  - The allocation number must be updated atomically.
  *     This method satisfies that requirement.
  * \param[in] unique_id Unique id of a restored allocation
  */
 void JeodMemoryManager::reset_alloc_id_atomic(uint32_t unique_id)
 {
-    // Update the allocation number in protected mode.
-    try
-    {
-        begin_atomic_block();
-
-        if(allocation_number < unique_id)
-        {
-            allocation_number = unique_id;
-        }
-
-        end_atomic_block(false);
-    }
-    catch(...)
-    {
-        end_atomic_block(true);
-        throw;
-    }
+    update_maximum(allocation_number, static_cast<unsigned int>(unique_id));
 }
 
 /**
@@ -560,8 +628,9 @@ void JeodMemoryManager::reset_alloc_id_atomic(uint32_t unique_id)
  * and delete it if delete_entry is true.
  *
  * The matching is strict. A match occurs only if the input address is a key in
- * the allocation table. An error is reported if the input address is inside
- * the allocated space corresponding to one of the allocation table entries.
+ * the allocation table. Outside of release mode, a warning is issued if the
+ * input address is inside the allocated space corresponding to one of the
+ * allocation table entries.
  *
  * Output values:
  *  - Entry not found:
@@ -574,7 +643,7 @@ void JeodMemoryManager::reset_alloc_id_atomic(uint32_t unique_id)
  *      found item's type.
  *
  * \par Assumptions and Limitations
- *  - Operations on the map must be atomic.
+ *  - Operations on the table must be atomic.
  *     This method satisfies that requirement.
  * \param[in] addr Address
  * \param[in] delete_entry Indicates entry is to be deleted
@@ -592,95 +661,43 @@ void JeodMemoryManager::find_alloc_entry_atomic(const void * addr,
                                                 JeodMemoryItem & found_item,
                                                 const JeodMemoryTypeDescriptor *& found_type)
 {
-    bool address_inside = false;
-    const void * test_addr = nullptr;
-    const JeodMemoryItem * test_item = nullptr;
-    const JeodMemoryTypeDescriptor * test_type = nullptr;
+    AllocTable::Entry entry;
 
     // Set the output values to indicate the address was not found.
     found_addr = nullptr;
     found_type = nullptr;
 
-    try
+    // Find, and delete if requested to do so, with the address's shard locked.
+    bool found = delete_entry ? alloc_table.remove(addr, entry) : alloc_table.find(addr, entry);
+    if(!found)
     {
-        begin_atomic_block();
-
-        // Find first entry whose address is strictly greater than
-        // the subject address.
-        auto iter = alloc_table.upper_bound(addr);
-
-        // There is no match if the upper bound is the beginning of the table.
-        // If the found iterator is not begin(), the entry before the found
-        // entry *might* be a match. It is:
-        // - A match if the input address and entry key are equal.
-        // - Not a match if the input address is outside of the memory space
-        //   represented by found entry.
-        // - A mismatch if the input address is inside the memory space
-        //   represented by found entry.
-        if(iter != alloc_table.begin())
+        // Mismatch: Report an address inside an allocated buffer.
+        // The range search is skipped in release mode.
+        if((!release_mode) && alloc_table.find_containing(addr, entry))
         {
-            --iter;
-            test_addr = iter->first;
-            test_item = &(iter->second);
-            test_type = &(get_type_descriptor_nolock(iter->second));
-
-            // Test as described above.
-            // Match: Set output values and delete if requested to do so.
-            if(addr == test_addr)
-            {
-                // Set the outputs. Note that found_item is copied.
-                found_addr = const_cast<void *>(test_addr);
-                found_item = *test_item;
-                found_type = test_type;
-
-                // Delete if requested to do so.
-                if(delete_entry)
-                {
-                    // Update the allocation statistics.
-                    cur_data_size -= found_type->buffer_size(found_item);
-
-                    // Delete the entry.
-                    alloc_table.erase(iter);
-                }
-                // No else: Nothing to do here if delete_entry is false.
-            }
-
-            // Mismatch: Set error flag so condition can be reported.
-            // (The error report is generated outside the atomic block.)
-            else if(addr < test_type->buffer_end(test_addr, *test_item))
-            {
-                address_inside = true;
-            }
-            // No else: Output items set to indicate not_found at onset.
+            MessageHandler::warn(__FILE__,
+                                 __LINE__,
+                                 MemoryMessages::suspect_pointer,
+                                 "Suspect use of %s at %s:%d\n"
+                                 "Pointer %p points inside allocated block of type %s.",
+                                 delete_entry ? "JEOD_DELETE" : "JEOD_IS_ALLOCATED",
+                                 file,
+                                 line,
+                                 addr,
+                                 entry.tdesc->get_name().c_str());
         }
-        // No else: Output items set to indicate not_found at onset.
-
-        end_atomic_block(false);
-    }
-    catch(...)
-    {
-        end_atomic_block(true);
-        throw;
+        return;
     }
 
-    if(address_inside)
+    // Set the outputs. Note that found_item is copied.
+    found_addr = const_cast<void *>(entry.addr);
+    found_item = entry.item;
+    found_type = entry.tdesc;
+
+    // Update the allocation statistics.
+    if(delete_entry)
     {
-        const char allocationStrings[2][18] = {"JEOD_IS_ALLOCATED", "JEOD_DELETE"};
-        int index = 1;
-        if(delete_entry)
-        {
-            index = 0;
-        }
-        MessageHandler::warn(__FILE__,
-                             __LINE__,
-                             MemoryMessages::suspect_pointer,
-                             "Suspect use of %s at %s:%d\n",
-                             "Pointer %p points inside allocated block of type %s.",
-                             allocationStrings[index],
-                             file,
-                             line,
-                             addr,
-                             test_type->get_name().c_str());
+        cur_data_size.fetch_sub(found_type->buffer_size(found_item), std::memory_order_relaxed);
     }
 }
 
@@ -688,9 +705,11 @@ void JeodMemoryManager::find_alloc_entry_atomic(const void * addr,
  * Add the specified addr/item pair to the table.
  *
  * \par Assumptions and Limitations
- *  - Operations on the map must be atomic.
+ *  - Operations on the table must be atomic.
  *     This method satisfies that requirement.
  *  - The specified address must not already be in the table.
+ *  - Outside of release mode, the new buffer must not overlap registered
+ *    memory.
  * \param[in] addr Newly allocated memory
  * \param[in] item Description of that memory
  * \param[in] tdesc Description of the type
@@ -703,87 +722,36 @@ void JeodMemoryManager::add_allocation_atomic(const void * addr,
                                               const char * file,
                                               unsigned int line)
 {
-    // Insert/update the table with the table locked.
-    try
-    {
-        begin_atomic_block();
-
-        // Sanity check: The new buffer should not overlap with registered memory.
-        // First find the table entries whose addresses are:
-        //   beg_iter -- strictly greater than the start of the buffer
-        //   end_iter -- greater than or equal to the end of the buffer
-        auto beg_iter(alloc_table.upper_bound(addr));
-        auto end_iter(alloc_table.lower_bound(tdesc.buffer_end(addr, item.get_nelems())));
-
-        // Now bump the beg_iter down a notch if its predecessor contains
-        // the start of the buffer.
-        if(beg_iter != alloc_table.begin())
-        {
-            --beg_iter;
-            // Oops. Undo the above if there is no overlap with the predecessor.
-            if(addr >= get_type_descriptor_nolock(beg_iter->second).buffer_end(beg_iter->first, beg_iter->second))
-            {
-                ++beg_iter;
-            }
-        }
-
-        // We have an overlap if the end_iter is not equal to the beg_iter.
-        // Possible causes:
-        //  1. C++ delete was used to delete the overlapping memory.
-        //  2. The memory manager was called outside the jeod_alloc.hh context.
-        //  3. Something is terribly fouled up.
-        // Not knowing which is which, the prudent thing to do is to fail the sim.
-        if(beg_iter != end_iter)
-        {
-            end_atomic_block(true);
-            MessageHandler::fail(__FILE__,
-                                 __LINE__,
-                                 MemoryMessages::corrupted_memory,
-                                 "The memory manager is corrupted:\n"
-                                 "Memory allocated at %s:%d overlaps with registered memory.",
-                                 file,
-                                 line);
-            return;
-        }
-
-        // No overlap: Insert the item in the table.
-        std::pair<AllocTable::iterator, bool> ret = alloc_table.insert(AllocTable::value_type(addr, item));
-
-        // The above *had* to work. The overlap check ensures no overlap.
-        // Just in case it didn't, ...
-        if(!ret.second)
-        {
-            end_atomic_block(true);
-            MessageHandler::fail(__FILE__,
-                                 __LINE__,
-                                 MemoryMessages::corrupted_memory,
-                                 "Impossible condition!\n"
-                                 "Memory allocated at %s:%d has already been registered.",
-                                 file,
-                                 line);
-            return;
-        }
-
-        // Update stats on allocated memory and the tables.
-        cur_data_size += tdesc.buffer_size(item);
-
-        if(max_data_size < cur_data_size)
-        {
-            max_data_size = cur_data_size;
-        }
-
-        if(max_table_size < alloc_table.size())
-        {
-            max_table_size = alloc_table.size();
-        }
-
-        end_atomic_block(false);
-    }
-    catch(...)
+    std::size_t table_size = 0;
+
+    // Outside of release mode the buffer is also indexed by address range,
+    // which checks that it does not overlap registered memory.
+    const void * index_end = release_mode ? nullptr : tdesc.buffer_end(addr, item);
+
+    // Insert the item in the table with the address's shard locked.
+    // This fails if the address is already registered or, outside of release
+    // mode, if the buffer overlaps registered memory. Possible causes:
+    //  1. C++ delete was used to delete previously registered memory.
+    //  2. The memory manager was called outside the jeod_alloc.hh context.
+    //  3. Something is terribly fouled up.
+    // Not knowing which is which, the prudent thing to do is to fail the sim.
+    if(!alloc_table.insert(addr, item, tdesc, index_end, table_size))
     {
-        end_atomic_block(true);
-        throw;
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             MemoryMessages::corrupted_memory,
+                             "The memory manager is corrupted:\n"
+                             "Memory allocated at %s:%d overlaps with registered memory.",
+                             file,
+                             line);
+        return;
     }
+
+    // Update stats on allocated memory and the tables.
+    JEOD_SIZE_T data_size = cur_data_size.fetch_add(tdesc.buffer_size(item), std::memory_order_relaxed) +
+                            tdesc.buffer_size(item);
+    update_maximum(max_data_size, data_size);
+    update_maximum(max_table_size, static_cast<unsigned int>(table_size));
 }
 
 /**
@@ -792,7 +760,7 @@ void JeodMemoryManager::add_allocation_atomic(const void * addr,
  * The addr and type are set to NULL if the table is empty.
  *
  * \par Assumptions and Limitations
- *  - Operations on the map must be atomic.
+ *  - Operations on the table must be atomic.
  *     This method satisfies that requirement.
  *  - If the restore doesn't work the sim will be knee deep in alligators.
  * \param[out] addr Address found in table
@@ -803,54 +771,25 @@ void JeodMemoryManager::delete_oldest_alloc_entry_atomic(void *& addr,
                                                          JeodMemoryItem & item,
                                                          const JeodMemoryTypeDescriptor *& type)
 {
-    // Insert/update the table with the table locked.
-    try
-    {
-        begin_atomic_block();
-
-        // We are done when the table is finally empty.
-        if(alloc_table.empty())
-        {
-            allocation_number = 0;
-            addr = nullptr;
-            type = nullptr;
-        }
-
-        // Not done. Find the oldest element, set outputs, and delete.
-        else
-        {
-            AllocTable::iterator target_iter;
-            uint32_t target_id = UINT32_MAX;
-
-            // Find the oldest element -- the one with the smallest unique id.
-            for(auto iter = alloc_table.begin(); iter != alloc_table.end(); ++iter)
-            {
-                uint32_t iter_id = iter->second.get_unique_id();
-                if(iter_id < target_id)
-                {
-                    target_iter = iter;
-                    target_id = iter_id;
-                }
-            }
-
-            // Save info about this found element in the function args.
-            addr = const_cast<void *>(target_iter->first);
-            item = target_iter->second;
-            type = &(get_type_descriptor_nolock(item));
+    AllocTable::Entry entry;
 
-            // Update the allocation statistics.
-            cur_data_size -= type->buffer_size(item);
-
-            // Delete the entry.
-            alloc_table.erase(target_iter);
-        }
-
-        end_atomic_block(false);
+    // We are done when the table is finally empty.
+    if(!alloc_table.remove_oldest(entry))
+    {
+        allocation_number = 0;
+        addr = nullptr;
+        type = nullptr;
     }
-    catch(...)
+
+    // Not done. Set outputs from the deleted oldest element.
+    else
     {
-        end_atomic_block(true);
-        throw;
+        addr = const_cast<void *>(entry.addr);
+        item = entry.item;
+        type = entry.tdesc;
+
+        // Update the allocation statistics.
+        cur_data_size.fetch_sub(type->buffer_size(item), std::memory_order_relaxed);
     }
 }
 
@@ -31,6 +31,7 @@ Library dependencies:
  */
 
 // System includes
+#include <atomic>
 #include <string>
 
 // JEOD includes
@@ -48,6 +49,9 @@ namespace jeod
 // Linkage for JeodMemoryManager::Master
 JeodMemoryManager * JeodMemoryManager::Master = nullptr;
 
+// Linkage for JeodMemoryManager::num_instances
+std::atomic<unsigned int> JeodMemoryManager::num_instances(0);
+
 /**
  * Many of the static methods are a pass-through to a private non-static method,
  * with the static method testing that the pass-through is valid. This method
@@ -121,6 +125,25 @@ void JeodMemoryManager::set_guard_enabled(bool value)
     }
 }
 
+/**
+ * Set the release_mode flag.
+ * In release mode the memory manager records each allocation with only what
+ * it needs to free it: no guard words, no allocation site strings, and no
+ * per-allocation debug messages. The allocation statistics are still kept.
+ * Each allocation remembers how it was made, so the mode can be changed at
+ * any time.
+ * \param[in] value New value
+ */
+void JeodMemoryManager::set_release_mode(bool value)
+{
+    // Throw a non-fatal error if the singleton memory manager is not available.
+    if(check_master(false, __LINE__))
+    {
+        // Set the manager's release_mode flag.
+        Master->release_mode = value;
+    }
+}
+
 /**
  * Query whether all allocated memory has been freed.
  *
@@ -0,0 +1,26 @@
+/*
+ * memory_alloc_table_ut.cc
+ */
+
+#include "utils/memory/include/memory_alloc_table.hh"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace jeod;
+
+TEST(JeodMemoryAllocTable, create) {}
+
+TEST(JeodMemoryAllocTable, insert) {}
+
+TEST(JeodMemoryAllocTable, find) {}
+
+TEST(JeodMemoryAllocTable, find_containing) {}
+
+TEST(JeodMemoryAllocTable, remove) {}
+
+TEST(JeodMemoryAllocTable, remove_oldest) {}
+
+TEST(JeodMemoryAllocTable, clear) {}
+
+TEST(JeodMemoryAllocTable, visit) {}
@@ -2,10 +2,20 @@
  * memory_manager_protected_ut.cc
  */
 
+#include "memory_interface_mock.hh"
+#include "message_handler_mock.hh"
+#include "simulation_interface_mock.hh"
+#include "utils/memory/include/jeod_alloc.hh"
 #include "utils/memory/include/memory_manager.hh"
+#include "utils/memory/include/memory_messages.hh"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+using testing::_;
+using testing::AnyNumber;
+using testing::Mock;
+using testing::Return;
+using testing::StrEq;
 
 using namespace jeod;
 
@@ -17,6 +27,8 @@ TEST(JeodMemoryManager, get_string_atomic) {}
 
 TEST(JeodMemoryManager, add_string_atomic) {}
 
+TEST(JeodMemoryManager, get_alloc_site_index_atomic) {}
+
 TEST(JeodMemoryManager, get_type_index_nolock) {}
 
 TEST(JeodMemoryManager, get_type_entry_atomic) {}
@@ -27,7 +39,61 @@ TEST(JeodMemoryManager, get_alloc_id_atomic) {}
 
 TEST(JeodMemoryManager, reset_alloc_id_atomic) {}
 
-TEST(JeodMemoryManager, find_alloc_entry_atomic) {}
+TEST(JeodMemoryManager, find_alloc_entry_atomic)
+{
+    MockMessageHandler mockMessageHandler;
+    MockJeodMemoryInterface mockMemoryInterface;
+    MockJeodSimulationInterface mockSimInterface(mockMemoryInterface);
+    JeodMemoryManager memoryManager(mockMemoryInterface);
+
+    EXPECT_CALL(mockMessageHandler, process_message(_, _, _, _, _, _, _)).Times(AnyNumber());
+    ON_CALL(mockMemoryInterface, register_allocation(_, _, _, _, _)).WillByDefault(Return(true));
+    EXPECT_CALL(mockMemoryInterface, register_allocation(_, _, _, _, _)).Times(AnyNumber());
+    EXPECT_CALL(mockMemoryInterface, deregister_allocation(_, _, _, _, _)).Times(AnyNumber());
+
+    double * array = JEOD_ALLOC_PRIM_ARRAY(4, double);
+    double local = 0.0;
+
+    {
+        // The start of the block matches without complaint.
+        EXPECT_CALL(mockMessageHandler,
+                    process_message(MessageHandler::Warning, _, _, _, StrEq(MemoryMessages::suspect_pointer), _, _))
+            .Times(0);
+        EXPECT_TRUE(JEOD_IS_ALLOCATED(array));
+
+        // So does memory that was not allocated by JEOD.
+        EXPECT_FALSE(JEOD_IS_ALLOCATED(&local));
+        Mock::VerifyAndClear(&mockMessageHandler);
+    }
+
+    {
+        // A pointer inside the block does not match and is reported.
+        EXPECT_CALL(mockMessageHandler, process_message(_, _, _, _, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(mockMessageHandler,
+                    process_message(MessageHandler::Warning, _, _, _, StrEq(MemoryMessages::suspect_pointer), _, _))
+            .Times(1);
+        EXPECT_FALSE(JEOD_IS_ALLOCATED(array + 2));
+        Mock::VerifyAndClear(&mockMessageHandler);
+    }
+
+    {
+        // The check is skipped for allocations made in release mode.
+        EXPECT_CALL(mockMessageHandler, process_message(_, _, _, _, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(mockMessageHandler,
+                    process_message(MessageHandler::Warning, _, _, _, StrEq(MemoryMessages::suspect_pointer), _, _))
+            .Times(0);
+        JeodMemoryManager::set_release_mode(true);
+        double * release_array = JEOD_ALLOC_PRIM_ARRAY(4, double);
+        EXPECT_FALSE(JEOD_IS_ALLOCATED(release_array + 2));
+        JEOD_DELETE_ARRAY(release_array);
+        JeodMemoryManager::set_release_mode(false);
+        Mock::VerifyAndClear(&mockMessageHandler);
+    }
+
+    // For non-unit destructor process_message calls.
+    EXPECT_CALL(mockMessageHandler, process_message(_, _, _, _, _, _, _)).Times(AnyNumber());
+    JEOD_DELETE_ARRAY(array);
+}
 
 TEST(JeodMemoryManager, add_allocation_atomic) {}
 
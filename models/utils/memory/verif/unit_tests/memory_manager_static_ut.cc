@@ -15,6 +15,8 @@ TEST(JeodMemoryManager, set_debug_level) {}
 
 TEST(JeodMemoryManager, set_guard_enabled) {}
 
+TEST(JeodMemoryManager, set_release_mode) {}
+
 TEST(JeodMemoryManager, is_table_empty) {}
 
 TEST(JeodMemoryManager, register_class) {}
@@ -4,6 +4,7 @@
 
 #include "utils/memory/include/jeod_alloc.hh"
 #include "utils/memory/include/memory_messages.hh"
+#include <chrono>
 #include <unistd.h>
 
 #include "test_harness/include/cmdline_parser.hh"
@@ -527,6 +528,117 @@ void * run_thread(void * arg)
     return thread->run();
 }
 
+/**
+ * Contention benchmark: each thread keeps a ring of live allocations of mixed
+ * types and sizes and repeatedly replaces the oldest one.
+ */
+class ContentionThread
+{
+public:
+    static const unsigned int ring_size = 64;
+
+    ContentionThread() = default;
+
+    void start(unsigned int num_allocs)
+    {
+        nallocs = num_allocs;
+        pthread_create(&thread, nullptr, run_contention_thread, reinterpret_cast<void *>(this));
+    }
+
+    void join()
+    {
+        pthread_join(thread, nullptr);
+    }
+
+    void run()
+    {
+        double * arrays[ring_size] = {};
+        Foo * objects[ring_size] = {};
+        for(unsigned int ii = 0; ii < nallocs; ++ii)
+        {
+            unsigned int slot = ii % ring_size;
+            if(ii % 2 == 0)
+            {
+                JEOD_DELETE_ARRAY(arrays[slot]);
+                arrays[slot] = JEOD_ALLOC_PRIM_ARRAY(1 + ii % 29, double);
+            }
+            else
+            {
+                JEOD_DELETE_OBJECT(objects[slot]);
+                objects[slot] = JEOD_ALLOC_CLASS_OBJECT(Foo, ());
+            }
+        }
+        for(unsigned int slot = 0; slot < ring_size; ++slot)
+        {
+            JEOD_DELETE_ARRAY(arrays[slot]);
+            JEOD_DELETE_OBJECT(objects[slot]);
+        }
+    }
+
+private:
+    static void * run_contention_thread(void * arg)
+    {
+        reinterpret_cast<ContentionThread *>(arg)->run();
+        return nullptr;
+    }
+
+    unsigned int nallocs{};
+    pthread_t thread{};
+};
+
+/**
+ * Time num_allocs allocate / free pairs in each of num_threads threads.
+ * @return Wall clock time per allocate / free pair, in nanoseconds.
+ */
+double time_contention(unsigned int num_threads, unsigned int num_allocs)
+{
+    ContentionThread threads[64];
+    auto start = std::chrono::steady_clock::now();
+    for(unsigned int ii = 0; ii < num_threads; ++ii)
+    {
+        threads[ii].start(num_allocs);
+    }
+    for(unsigned int ii = 0; ii < num_threads; ++ii)
+    {
+        threads[ii].join();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (double(num_threads) * num_allocs);
+}
+
+/**
+ * Run the contention benchmark with one thread and with num_threads threads.
+ */
+int run_contention_benchmark(unsigned int num_threads, unsigned int num_allocs, bool release_mode)
+{
+    MessageHandler::set_suppression_level(MessageHandler::Notice);
+    JeodMemoryManager::set_debug_level(JeodMemoryManager::Error_details);
+    JeodMemoryManager::set_release_mode(release_mode);
+    sim_interface.add_verboten_code("utils/memory");
+
+    num_threads = (num_threads < 1) ? 1 : ((num_threads > 64) ? 64 : num_threads);
+    double single_ns = time_contention(1, num_allocs);
+    double multi_ns = time_contention(num_threads, num_allocs);
+    bool all_freed = JeodMemoryManager::is_table_empty();
+
+    print_debug(0,
+                stdout,
+                "%s mode, %u allocate/free pairs per thread\n"
+                "  %2u thread:  %8.1f ns per pair\n"
+                "  %2u threads: %8.1f ns per pair (%.2f million pairs/s)\n",
+                release_mode ? "Release" : "Tracking",
+                num_allocs,
+                1U,
+                single_ns,
+                num_threads,
+                multi_ns,
+                1.0e3 / multi_ns);
+
+    sim_interface.shutdown();
+    print_debug(0, stdout, "Contention benchmark %s\n", all_freed ? "passed" : "failed");
+    return all_freed ? 0 : 1;
+}
+
 int main(int argc, char ** argv)
 {
     TestThread * runs[12];
@@ -534,6 +646,10 @@ int main(int argc, char ** argv)
 
     int message_level;
     unsigned int memory_level;
+    bool contention = false;
+    bool release_mode = false;
+    int num_contention_threads;
+    int num_contention_allocs;
 
     CmdlineParser cmdline_parser;
 
@@ -542,8 +658,19 @@ int main(int argc, char ** argv)
     // Option -inside  => overwrite data inside the allocated classes.
     cmdline_parser.add("outside", &overwrite_outside);
     cmdline_parser.add("leak", &leave_unfreed_memory);
+    cmdline_parser.add("contention", &contention);
+    cmdline_parser.add("release", &release_mode);
+    cmdline_parser.add_int("NumThreads", 8, &num_contention_threads);
+    cmdline_parser.add_int("NumAllocs", 200000, &num_contention_allocs);
     cmdline_parser.parse(argc, argv);
 
+    // Option -contention => run the contention benchmark instead of the test.
+    // Option -release    => run the benchmark with the memory manager in release mode.
+    if(contention)
+    {
+        return run_contention_benchmark(num_contention_threads, num_contention_allocs, release_mode);
+    }
+
     // Determine the message handler and memory manager report thresholds.
 #if JEOD_MEMORY_DEBUG == 3
     message_level = MessageHandler::Debug;
@@ -0,0 +1,225 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2025 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup OrbitalElements
+ * @{
+ *
+ * @file models/utils/orbital_elements/include/orbital_elements_batch.hh
+ * Orbital elements of many objects, stored as arrays.
+ */
+
+/*****************************************************************************
+PURPOSE:
+    ()
+
+REFERENCE:
+    (((Vallado, David A.) (Fundamentals of Astrodynamics and Applications)
+      (McGraw-Hill) (New York) (1997))
+     ((Danby, J. M. A. and Burkardt, T. M.) (The Solution of Kepler's
+      Equation, I) (Celestial Mechanics, Vol. 31) (1983) (pages 95-107)))
+
+ASSUMPTIONS AND LIMITATIONS:
+    ((none))
+ Library dependencies:
+  ((../src/orbital_elements_batch.cc))
+
+
+******************************************************************************/
+
+#ifndef ORBITAL_ELEMENTS_BATCH_HH
+#define ORBITAL_ELEMENTS_BATCH_HH
+
+// System includes
+#include <vector>
+
+// JEOD includes
+#include "utils/sim_interface/include/jeod_class.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+class OrbitalElements;
+
+/**
+ * Represents the states of many objects about one planet in terms of
+ * Keplerian orbital elements, with each element stored as an array indexed
+ * by object. The transformations give the same results as those of
+ * OrbitalElements applied to each object, and the orbits may be of any
+ * type, but Kepler's equation is solved with a fixed number of iterations
+ * in loops over all objects of a type rather than iterated to convergence
+ * one object at a time.
+ */
+class OrbitalElementsBatch
+{
+    JEOD_MAKE_SIM_INTERFACES(jeod, OrbitalElementsBatch)
+
+    // Member data
+public:
+    // Orbit definition parameters
+    /**
+     * Semi-major-axis (a)
+     */
+    std::vector<double> semi_major_axis; //!< trick_io(**)
+    /**
+     * Semiparameter (p)
+     */
+    std::vector<double> semiparam; //!< trick_io(**)
+    /**
+     * Magnitude of eccentricity (e)
+     */
+    std::vector<double> e_mag; //!< trick_io(**)
+    /**
+     * Orbit inclination (i)
+     */
+    std::vector<double> inclination; //!< trick_io(**)
+    /**
+     * Argument of periapsis (w)
+     */
+    std::vector<double> arg_periapsis; //!< trick_io(**)
+    /**
+     * Longitude of ascending node (Omega)
+     */
+    std::vector<double> long_asc_node; //!< trick_io(**)
+
+    // Orbital position parameters
+    /**
+     * Magnitude of orbital radius
+     */
+    std::vector<double> r_mag; //!< trick_io(**)
+    /**
+     * Magnitude of orbital velocity
+     */
+    std::vector<double> vel_mag; //!< trick_io(**)
+    /**
+     * True Anomaly (v)
+     */
+    std::vector<double> true_anom; //!< trick_io(**)
+    /**
+     * Mean Anomaly (M)
+     */
+    std::vector<double> mean_anom; //!< trick_io(**)
+    /**
+     * Mean motion of orbit (n)
+     */
+    std::vector<double> mean_motion; //!< trick_io(**)
+    /**
+     * Eccentric (E), Hyperbolic (H), or Parabolic (B) anomaly
+     */
+    std::vector<double> orbital_anom; //!< trick_io(**)
+    /**
+     * Sine of the true anomaly
+     */
+    std::vector<double> sin_v; //!< trick_io(**)
+    /**
+     * Cosine of the true anomaly
+     */
+    std::vector<double> cos_v; //!< trick_io(**)
+    /**
+     * Specific orbital energy
+     */
+    std::vector<double> orb_energy; //!< trick_io(**)
+    /**
+     * Specific orbital angular momentum
+     */
+    std::vector<double> orb_ang_momentum; //!< trick_io(**)
+
+protected:
+    /**
+     * Indices of the objects of each orbit type, circular, elliptical,
+     * hyperbolic and parabolic, as last sorted.
+     */
+    std::vector<unsigned int> type_index[4]; //!< trick_io(**)
+    /**
+     * Mean anomalies of the objects of one orbit type.
+     */
+    std::vector<double> work_mean_anom; //!< trick_io(**)
+    /**
+     * Eccentricities of the objects of one orbit type.
+     */
+    std::vector<double> work_e_mag; //!< trick_io(**)
+    /**
+     * Orbital anomalies of the objects of one orbit type.
+     */
+    std::vector<double> work_orbital_anom; //!< trick_io(**)
+
+public:
+    OrbitalElementsBatch() = default;
+    virtual ~OrbitalElementsBatch() = default;
+    OrbitalElementsBatch(const OrbitalElementsBatch &) = delete;
+    OrbitalElementsBatch & operator=(const OrbitalElementsBatch &) = delete;
+
+    // Set and get the number of objects
+    void resize(unsigned int num_objects);
+    unsigned int size() const;
+
+    // Copy the elements of one object to and from an OrbitalElements
+    void set_elements(unsigned int index, const OrbitalElements & elements);
+    void get_elements(unsigned int index, OrbitalElements & elements) const;
+
+    // Transformation routines
+    int from_cartesian(double mu, const double pos[][3], const double vel[][3]);
+    int to_cartesian(double mu, double pos[][3], double vel[][3]);
+
+    // Utility routines
+    int nu_to_anomalies();
+    int mean_anom_to_nu();
+
+    // Kepler's equation for many objects at once
+    static unsigned int KepEqtnE(unsigned int num, const double * M, const double * e, double * E);
+
+    static unsigned int KepEqtnH(unsigned int num, const double * M, const double * e, double * H);
+
+    static void KepEqtnB(unsigned int num, const double * M, double * B);
+
+protected:
+    void sort_by_type();
+};
+
+} // namespace jeod
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -3,6 +3,7 @@ set(SUBDIR ${CMAKE_CURRENT_LIST_DIR})
 set(SRCS
 orbital_elements_messages.cc
 orbital_elements.cc
+orbital_elements_batch.cc
 )
 
 foreach(SRC ${SRCS})
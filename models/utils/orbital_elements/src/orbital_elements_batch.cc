@@ -0,0 +1,745 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup OrbitalElements
+ * @{
+ *
+ * @file models/utils/orbital_elements/src/orbital_elements_batch.cc
+ * Define methods for the OrbitalElementsBatch class.
+ */
+
+/*******************************************************************************
+
+Purpose:
+  ()
+
+Reference:
+   (((Vallado, D.) (Fundamentals of Astrodynamics and Applications, 2nd Ed.)
+     (Kluwer Acedemic Publishers) (2001) (Pages 135-230) (ISBN:0-07-066834-5))
+    ((Danby, J. M. A. and Burkardt, T. M.) (The Solution of Kepler's
+     Equation, I) (Celestial Mechanics, Vol. 31) (1983) (pages 95-107)))
+
+Assumptions and limitations:
+  ((This class works for all types of orbits.))
+
+Library dependencies:
+  ((orbital_elements_batch.cc)
+   (orbital_elements.cc)
+   (orbital_elements_messages.cc)
+   (utils/message/src/message_handler.cc))
+
+
+
+*******************************************************************************/
+
+// System includes
+#include <cmath>
+#include <cstddef>
+
+// JEOD includes
+#include "utils/math/include/vector3.hh"
+#include "utils/message/include/message_handler.hh"
+
+// Model includes
+#include "../include/orbital_elements.hh"
+#include "../include/orbital_elements_batch.hh"
+#include "../include/orbital_elements_messages.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+namespace
+{
+/**
+ * Orbit types, in the order of OrbitalElementsBatch::type_index.
+ */
+enum OrbitType
+{
+    Circular = 0,
+    Elliptical = 1,
+    Hyperbolic = 2,
+    Parabolic = 3
+};
+
+/**
+ * Tolerance for circular and equatorial orbits, as in OrbitalElements.
+ */
+constexpr double circular_tol = 1.0e-13;
+
+/**
+ * Tolerance for the switch between elliptical, parabolic and hyperbolic
+ * orbits, as in OrbitalElements.
+ */
+constexpr double switch_tol = 1.0e-2;
+
+/**
+ * Iterations of Halley's method applied to the starting values of the
+ * eccentric and hyperbolic anomalies. Three suffice for a full double
+ * precision solution for all elliptical and hyperbolic eccentricities
+ * handled as such.
+ */
+constexpr unsigned int num_kepler_iterations = 3;
+
+/**
+ * Size of the final correction above which a solution of Kepler's equation
+ * is deemed not to have converged. Halley's method converges cubically, so
+ * the error left after a correction this small is of the order of 1e-15.
+ */
+constexpr double kepler_tol = 1.0e-5;
+
+/**
+ * Positive root of x^3 + p*x - q = 0 for non-negative p and q, in a form
+ * that does not lose precision when p is large compared to q.
+ * @return Root
+ * \param[in] p Linear coefficient
+ * \param[in] q Constant term
+ */
+inline double cubic_root(double p, double q)
+{
+    double half_q = 0.5 * q;
+    double t = cbrt(half_q + sqrt(half_q * half_q + p * p * p / 27.0));
+    double v = p / (3.0 * t);
+    return (t > 0.0) ? q / (t * t + p / 3.0 + v * v) : 0.0;
+}
+
+/**
+ * Angle between two vectors, as computed by OrbitalElements.
+ * @return Angle, between 0 and pi
+ * \param[in] vec_a First vector
+ * \param[in] vec_b Second vector
+ */
+inline double vector_angle(const double vec_a[3], const double vec_b[3])
+{
+    double cross_vec[3];
+    Vector3::cross(vec_a, vec_b, cross_vec);
+    return atan2(Vector3::vmag(cross_vec), Vector3::dot(vec_a, vec_b));
+}
+} // namespace
+
+/**
+ * Set the number of objects. The elements of objects added are zero, except
+ * for the cosine of the true anomaly, which is one.
+ * \param[in] num_objects Number of objects
+ */
+void OrbitalElementsBatch::resize(unsigned int num_objects)
+{
+    for(std::vector<double> * element : {&semi_major_axis,
+                                         &semiparam,
+                                         &e_mag,
+                                         &inclination,
+                                         &arg_periapsis,
+                                         &long_asc_node,
+                                         &r_mag,
+                                         &vel_mag,
+                                         &true_anom,
+                                         &mean_anom,
+                                         &mean_motion,
+                                         &orbital_anom,
+                                         &sin_v,
+                                         &orb_energy,
+                                         &orb_ang_momentum})
+    {
+        element->resize(num_objects, 0.0);
+    }
+    cos_v.resize(num_objects, 1.0);
+}
+
+/**
+ * Return the number of objects.
+ * @return Number of objects
+ */
+unsigned int OrbitalElementsBatch::size() const
+{
+    return static_cast<unsigned int>(e_mag.size());
+}
+
+/**
+ * Set the elements of one object from an OrbitalElements object.
+ * \param[in] index Index of the object
+ * \param[in] elements Elements of the object
+ */
+void OrbitalElementsBatch::set_elements(unsigned int index, const OrbitalElements & elements)
+{
+    semi_major_axis[index] = elements.semi_major_axis;
+    semiparam[index] = elements.semiparam;
+    e_mag[index] = elements.e_mag;
+    inclination[index] = elements.inclination;
+    arg_periapsis[index] = elements.arg_periapsis;
+    long_asc_node[index] = elements.long_asc_node;
+    r_mag[index] = elements.r_mag;
+    vel_mag[index] = elements.vel_mag;
+    true_anom[index] = elements.true_anom;
+    mean_anom[index] = elements.mean_anom;
+    mean_motion[index] = elements.mean_motion;
+    orbital_anom[index] = elements.orbital_anom;
+    sin_v[index] = elements.sin_v;
+    cos_v[index] = elements.cos_v;
+    orb_energy[index] = elements.orb_energy;
+    orb_ang_momentum[index] = elements.orb_ang_momentum;
+}
+
+/**
+ * Copy the elements of one object to an OrbitalElements object.
+ * \param[in] index Index of the object
+ * \param[out] elements Elements of the object
+ */
+void OrbitalElementsBatch::get_elements(unsigned int index, OrbitalElements & elements) const
+{
+    elements.semi_major_axis = semi_major_axis[index];
+    elements.semiparam = semiparam[index];
+    elements.e_mag = e_mag[index];
+    elements.inclination = inclination[index];
+    elements.arg_periapsis = arg_periapsis[index];
+    elements.long_asc_node = long_asc_node[index];
+    elements.r_mag = r_mag[index];
+    elements.vel_mag = vel_mag[index];
+    elements.true_anom = true_anom[index];
+    elements.mean_anom = mean_anom[index];
+    elements.mean_motion = mean_motion[index];
+    elements.orbital_anom = orbital_anom[index];
+    elements.sin_v = sin_v[index];
+    elements.cos_v = cos_v[index];
+    elements.orb_energy = orb_energy[index];
+    elements.orb_ang_momentum = orb_ang_momentum[index];
+}
+
+/**
+ * Sort the objects by orbit type, per their eccentricities.
+ */
+void OrbitalElementsBatch::sort_by_type()
+{
+    for(auto & indices : type_index)
+    {
+        indices.clear();
+    }
+    unsigned int num = size();
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        double e = e_mag[ii];
+        if(e < circular_tol)
+        {
+            type_index[Circular].push_back(ii);
+        }
+        else if(e < (1.0 - switch_tol))
+        {
+            type_index[Elliptical].push_back(ii);
+        }
+        else if(e > (1.0 + switch_tol))
+        {
+            type_index[Hyperbolic].push_back(ii);
+        }
+        else
+        {
+            type_index[Parabolic].push_back(ii);
+        }
+    }
+}
+
+/**
+ * Compute the orbital elements of all objects from their inertial positions
+ * and velocities, as OrbitalElements::from_cartesian does for one object.
+ * @return Zero
+ * \param[in] mu Gravitational parameter of the planet\n Units: M3/s2
+ * \param[in] pos Inertial positions, one per object\n Units: M
+ * \param[in] vel Inertial velocities, one per object\n Units: M/s
+ */
+int OrbitalElementsBatch::from_cartesian(double mu, const double pos[][3], const double vel[][3])
+{
+    const double K[3] = {0.0, 0.0, 1.0};
+    const double I[3] = {1.0, 0.0, 0.0};
+    unsigned int num = size();
+
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        const double * r = pos[ii];
+        const double * v = vel[ii];
+        double ang_momntm[3];
+        double line_of_nodes[3];
+        double eccentricity[3];
+
+        r_mag[ii] = Vector3::vmag(r);
+        vel_mag[ii] = Vector3::vmag(v);
+
+        Vector3::cross(r, v, ang_momntm);
+        orb_ang_momentum[ii] = Vector3::vmag(ang_momntm);
+        Vector3::cross(K, ang_momntm, line_of_nodes);
+
+        double pos_dot_vel = Vector3::dot(r, v);
+        double v2 = vel_mag[ii] * vel_mag[ii];
+        for(unsigned int jj = 0; jj < 3; ++jj)
+        {
+            eccentricity[jj] = (v2 - mu / r_mag[ii]) * r[jj] / mu - (pos_dot_vel * v[jj] / mu);
+        }
+        double e = Vector3::vmag(eccentricity);
+        e_mag[ii] = e;
+        orb_energy[ii] = (v2 / 2.0) - (mu / r_mag[ii]);
+
+        // Semi-major-axis, semiparameter, and mean motion
+        if(e < circular_tol)
+        {
+            semi_major_axis[ii] = r_mag[ii];
+            semiparam[ii] = r_mag[ii];
+            mean_motion[ii] = sqrt(mu / semi_major_axis[ii]) / semi_major_axis[ii];
+        }
+        else if(e < (1.0 - switch_tol))
+        {
+            semi_major_axis[ii] = -mu / (2.0 * orb_energy[ii]);
+            semiparam[ii] = semi_major_axis[ii] * (1.0 - e * e);
+            mean_motion[ii] = sqrt(mu / semi_major_axis[ii]) / semi_major_axis[ii];
+        }
+        else if(e > (1.0 + switch_tol))
+        {
+            semi_major_axis[ii] = -mu / (2.0 * orb_energy[ii]);
+            semiparam[ii] = semi_major_axis[ii] * (1.0 - e * e);
+            mean_motion[ii] = sqrt(mu / -semi_major_axis[ii]) / -semi_major_axis[ii];
+        }
+        else
+        {
+            semi_major_axis[ii] = 0.0;
+            semiparam[ii] = orb_ang_momentum[ii] * orb_ang_momentum[ii] / mu;
+            mean_motion[ii] = 2.0 * sqrt(mu / semiparam[ii]) / semiparam[ii];
+        }
+
+        double incl = vector_angle(K, ang_momntm);
+        inclination[ii] = incl;
+        bool equatorial = (incl < circular_tol) || ((M_PI - circular_tol) < incl);
+        bool prograde = incl < circular_tol;
+
+        // Longitude of ascending node, argument of periapsis, & true anomaly
+        if(equatorial && (e < circular_tol))
+        {
+            long_asc_node[ii] = 0.0;
+            arg_periapsis[ii] = 0.0;
+            true_anom[ii] = vector_angle(I, r);
+            if(prograde ? (r[1] < 0.0) : (r[1] > 0.0))
+            {
+                true_anom[ii] = 2.0 * M_PI - true_anom[ii];
+            }
+        }
+        else if(equatorial)
+        {
+            long_asc_node[ii] = 0.0;
+            arg_periapsis[ii] = vector_angle(I, eccentricity);
+            if(prograde ? (eccentricity[1] < 0.0) : (eccentricity[1] > 0.0))
+            {
+                arg_periapsis[ii] = 2.0 * M_PI - arg_periapsis[ii];
+            }
+            true_anom[ii] = vector_angle(eccentricity, r);
+            if(pos_dot_vel < 0.0)
+            {
+                true_anom[ii] = 2.0 * M_PI - true_anom[ii];
+            }
+        }
+        else
+        {
+            long_asc_node[ii] = vector_angle(I, line_of_nodes);
+            if(line_of_nodes[1] < 0.0)
+            {
+                long_asc_node[ii] = 2.0 * M_PI - long_asc_node[ii];
+            }
+
+            if(e < circular_tol)
+            {
+                arg_periapsis[ii] = 0.0;
+                true_anom[ii] = vector_angle(line_of_nodes, r);
+                if(r[2] < 0.0)
+                {
+                    true_anom[ii] = 2.0 * M_PI - true_anom[ii];
+                }
+            }
+            else
+            {
+                arg_periapsis[ii] = vector_angle(line_of_nodes, eccentricity);
+                if(eccentricity[2] < 0.0)
+                {
+                    arg_periapsis[ii] = 2.0 * M_PI - arg_periapsis[ii];
+                }
+                true_anom[ii] = vector_angle(eccentricity, r);
+                if(pos_dot_vel < 0.0)
+                {
+                    true_anom[ii] = 2.0 * M_PI - true_anom[ii];
+                }
+            }
+        }
+    }
+
+    // Compute the mean anomaly & the eccentric, hyperbolic, or parabolic anomaly
+    return nu_to_anomalies();
+}
+
+/**
+ * Compute the inertial positions and velocities of all objects from their
+ * orbital elements, as OrbitalElements::to_cartesian does for one object.
+ * @return Zero on success, -1 if the elements of any object are invalid
+ * \param[in] mu Gravitational parameter of the planet\n Units: M3/s2
+ * \param[out] pos Inertial positions, one per object\n Units: M
+ * \param[out] vel Inertial velocities, one per object\n Units: M/s
+ */
+int OrbitalElementsBatch::to_cartesian(double mu, double pos[][3], double vel[][3])
+{
+    unsigned int num = size();
+
+    // Check for meaningful value of central mass
+    if(mu <= 0.0)
+    {
+        MessageHandler::fail(__FILE__,
+                             __LINE__,
+                             OrbitalElementsMessages::domain_error,
+                             "Grav mass constant (mu) is zero or negative (%f).\n"
+                             "This is likely a user-induced initialization error.\n",
+                             mu);
+        return (-1);
+    }
+
+    // Check for "meaningful" values of the semi-parameter and of the sine
+    // and cosine of the true anomaly
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        if(semiparam[ii] <= 0.0)
+        {
+            MessageHandler::fail(__FILE__,
+                                 __LINE__,
+                                 OrbitalElementsMessages::domain_error,
+                                 "Semi-parameter %g of object %u is zero or negative.",
+                                 semiparam[ii],
+                                 ii);
+            return (-1);
+        }
+
+        double rss_sincos_v = sqrt(sin_v[ii] * sin_v[ii] + cos_v[ii] * cos_v[ii]);
+        if(fabs(rss_sincos_v - 1.0) > circular_tol)
+        {
+            MessageHandler::fail(__FILE__,
+                                 __LINE__,
+                                 OrbitalElementsMessages::domain_error,
+                                 "Sine (%g) and cosine (%g) of the true anomaly of object %u are inconsistent.",
+                                 sin_v[ii],
+                                 cos_v[ii],
+                                 ii);
+            return (-1);
+        }
+    }
+
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        double p = semiparam[ii];
+        double e = e_mag[ii];
+        double incl = inclination[ii];
+        bool equatorial = (incl < circular_tol) || ((M_PI - circular_tol) < incl);
+        bool circular = e < circular_tol;
+
+        // Sines and cosines of the longitude of ascending node, argument of
+        // periapsis and inclination, with the undefined angles zero.
+        double sO = equatorial ? 0.0 : sin(long_asc_node[ii]);
+        double cO = equatorial ? 1.0 : cos(long_asc_node[ii]);
+        double sw = circular ? 0.0 : sin(arg_periapsis[ii]);
+        double cw = circular ? 1.0 : cos(arg_periapsis[ii]);
+        double si = equatorial ? 0.0 : sin(incl);
+        double ci = equatorial ? ((incl < circular_tol) ? 1.0 : -1.0) : cos(incl);
+
+        // Position and velocity in perifocal frame (PQW)
+        double r_pqw[3];
+        double v_pqw[3];
+        r_pqw[0] = (p * cos_v[ii]) / (1.0 + e * cos_v[ii]);
+        r_pqw[1] = (p * sin_v[ii]) / (1.0 + e * cos_v[ii]);
+        r_pqw[2] = 0.0;
+
+        v_pqw[0] = -sqrt(mu / p) * sin_v[ii];
+        v_pqw[1] = sqrt(mu / p) * (e + cos_v[ii]);
+        v_pqw[2] = 0.0;
+
+        // Transformation matrix from PQW to inertial
+        double T_PQW_Inrtl[3][3];
+        T_PQW_Inrtl[0][0] = cO * cw - sO * sw * ci;
+        T_PQW_Inrtl[0][1] = -cO * sw - sO * cw * ci;
+        T_PQW_Inrtl[0][2] = sO * si;
+        T_PQW_Inrtl[1][0] = sO * cw + cO * sw * ci;
+        T_PQW_Inrtl[1][1] = -sO * sw + cO * cw * ci;
+        T_PQW_Inrtl[1][2] = -cO * si;
+        T_PQW_Inrtl[2][0] = sw * si;
+        T_PQW_Inrtl[2][1] = cw * si;
+        T_PQW_Inrtl[2][2] = ci;
+
+        Vector3::transform(T_PQW_Inrtl, r_pqw, pos[ii]);
+        Vector3::transform(T_PQW_Inrtl, v_pqw, vel[ii]);
+    }
+
+    return (0);
+}
+
+/**
+ * Compute the mean anomalies and the eccentric, hyperbolic, or parabolic
+ * anomalies of all objects from their true anomalies and eccentricities, as
+ * OrbitalElements::nu_to_anomalies does for one object.
+ * @return Zero
+ */
+int OrbitalElementsBatch::nu_to_anomalies()
+{
+    unsigned int num = size();
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        sin_v[ii] = sin(true_anom[ii]);
+        cos_v[ii] = cos(true_anom[ii]);
+    }
+
+    sort_by_type();
+
+    for(unsigned int ii : type_index[Circular])
+    {
+        orbital_anom[ii] = true_anom[ii];
+        mean_anom[ii] = true_anom[ii];
+    }
+
+    for(unsigned int ii : type_index[Elliptical])
+    {
+        double e = e_mag[ii];
+        double sin_E = sqrt(1.0 - e * e) * sin_v[ii] / (1.0 + e * cos_v[ii]);
+        double cos_E = (e + cos_v[ii]) / (1.0 + e * cos_v[ii]);
+        double E = atan2(sin_E, cos_E);
+        if(E < 0.0)
+        {
+            E += 2.0 * M_PI;
+        }
+        orbital_anom[ii] = E;
+        mean_anom[ii] = E - e * sin(E);
+    }
+
+    for(unsigned int ii : type_index[Hyperbolic])
+    {
+        double e = e_mag[ii];
+        double H = asinh(sqrt(e * e - 1.0) * sin_v[ii] / (1.0 + e * cos_v[ii]));
+        orbital_anom[ii] = H;
+        mean_anom[ii] = e * sinh(H) - H;
+    }
+
+    for(unsigned int ii : type_index[Parabolic])
+    {
+        double B = tan(true_anom[ii] / 2.0);
+        orbital_anom[ii] = B;
+        mean_anom[ii] = B + B * B * B / 3.0;
+    }
+
+    return (0);
+}
+
+/**
+ * Compute the true anomalies of all objects from their mean anomalies and
+ * eccentricities, as OrbitalElements::mean_anom_to_nu does for one object.
+ * The objects of each orbit type are gathered, and Kepler's equation is
+ * solved for all of them at once.
+ * @return Zero on success, -1 if Kepler's equation failed to converge
+ */
+int OrbitalElementsBatch::mean_anom_to_nu()
+{
+    sort_by_type();
+
+    for(unsigned int ii : type_index[Circular])
+    {
+        orbital_anom[ii] = mean_anom[ii];
+        sin_v[ii] = sin(mean_anom[ii]);
+        cos_v[ii] = cos(mean_anom[ii]);
+        true_anom[ii] = mean_anom[ii];
+    }
+
+    // Solve Kepler's equation for the objects of each non-circular type.
+    for(unsigned int type = Elliptical; type <= Parabolic; ++type)
+    {
+        const std::vector<unsigned int> & indices = type_index[type];
+        auto num_of_type = static_cast<unsigned int>(indices.size());
+        work_mean_anom.resize(num_of_type);
+        work_e_mag.resize(num_of_type);
+        work_orbital_anom.resize(num_of_type);
+        for(unsigned int jj = 0; jj < num_of_type; ++jj)
+        {
+            work_mean_anom[jj] = mean_anom[indices[jj]];
+            work_e_mag[jj] = e_mag[indices[jj]];
+        }
+
+        unsigned int num_unconverged = 0;
+        if(type == Elliptical)
+        {
+            num_unconverged = KepEqtnE(num_of_type,
+                                       work_mean_anom.data(),
+                                       work_e_mag.data(),
+                                       work_orbital_anom.data());
+        }
+        else if(type == Hyperbolic)
+        {
+            num_unconverged = KepEqtnH(num_of_type,
+                                       work_mean_anom.data(),
+                                       work_e_mag.data(),
+                                       work_orbital_anom.data());
+        }
+        else
+        {
+            KepEqtnB(num_of_type, work_mean_anom.data(), work_orbital_anom.data());
+        }
+
+        if(num_unconverged != 0)
+        {
+            MessageHandler::fail(__FILE__,
+                                 __LINE__,
+                                 OrbitalElementsMessages::convergence_error,
+                                 "Attempted solution for %s Kepler's equation "
+                                 "failed to converge for %u objects.",
+                                 (type == Elliptical) ? "eccentric" : "hyperbolic",
+                                 num_unconverged);
+            return (-1);
+        }
+
+        // Compute the true anomaly
+        for(unsigned int jj = 0; jj < num_of_type; ++jj)
+        {
+            unsigned int ii = indices[jj];
+            double e = work_e_mag[jj];
+            double anom = work_orbital_anom[jj];
+            orbital_anom[ii] = anom;
+            if(type == Elliptical)
+            {
+                double sin_E = sin(anom);
+                double cos_E = cos(anom);
+                sin_v[ii] = sqrt(1.0 - e * e) * sin_E / (1.0 - e * cos_E);
+                cos_v[ii] = (cos_E - e) / (1.0 - e * cos_E);
+            }
+            else if(type == Hyperbolic)
+            {
+                double sinh_H = sinh(anom);
+                double cosh_H = cosh(anom);
+                sin_v[ii] = -sqrt(e * e - 1.0) * sinh_H / (1.0 - e * cosh_H);
+                cos_v[ii] = (cosh_H - e) / (1.0 - e * cosh_H);
+            }
+            else
+            {
+                sin_v[ii] = 2 * anom / (1.0 + anom * anom);
+                cos_v[ii] = (1.0 - anom * anom) / (1.0 + anom * anom);
+            }
+            true_anom[ii] = atan2(sin_v[ii], cos_v[ii]);
+            if(true_anom[ii] < 0.0)
+            {
+                true_anom[ii] += 2.0 * M_PI;
+            }
+        }
+    }
+
+    return (0);
+}
+
+/**
+ * Solve Kepler's equation for the eccentric anomalies of many elliptical
+ * orbits. Each mean anomaly is reduced to [-pi, pi]; the starting value is
+ * the lesser of Danby's M + 0.85e and the root of the cubic approximation
+ * of the equation about E = 0, which is refined by a fixed number of
+ * iterations of Halley's method. The loops have no data-dependent exits.
+ * @return Number of objects whose final correction is not small enough to
+ *         ensure convergence
+ * \param[in] num Number of objects
+ * \param[in] M Mean anomalies\n Units: r
+ * \param[in] e Eccentricities, less than one
+ * \param[out] E Eccentric anomalies\n Units: r
+ */
+unsigned int OrbitalElementsBatch::KepEqtnE(unsigned int num, const double * M, const double * e, double * E)
+{
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        double M_red = M[ii] - 2.0 * M_PI * round(M[ii] / (2.0 * M_PI));
+        double abs_M = fabs(M_red);
+        double c3 = e[ii] / 6.0;
+        double cubic = cubic_root((1.0 - e[ii]) / c3, abs_M / c3);
+        E[ii] = copysign(fmin(cubic, abs_M + 0.85 * e[ii]), M_red);
+    }
+
+    unsigned int num_unconverged = 0;
+    for(unsigned int iter = 1; iter <= num_kepler_iterations; ++iter)
+    {
+        for(unsigned int ii = 0; ii < num; ++ii)
+        {
+            double M_red = M[ii] - 2.0 * M_PI * round(M[ii] / (2.0 * M_PI));
+            double e_sin = e[ii] * sin(E[ii]);
+            double e_cos = e[ii] * cos(E[ii]);
+            double f = E[ii] - e_sin - M_red;
+            double fp = 1.0 - e_cos;
+            double step = -f / (fp - 0.5 * f * e_sin / fp);
+            E[ii] += step;
+            num_unconverged += (iter == num_kepler_iterations) && !(fabs(step) < kepler_tol);
+        }
+    }
+
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        E[ii] += 2.0 * M_PI * round(M[ii] / (2.0 * M_PI));
+    }
+
+    return num_unconverged;
+}
+
+/**
+ * Solve Kepler's equation for the hyperbolic anomalies of many hyperbolic
+ * orbits. The starting value is the lesser of log(2|M|/e + 1.8) and the
+ * root of the cubic approximation of the equation about H = 0, which is
+ * refined by a fixed number of iterations of Halley's method. The loops
+ * have no data-dependent exits.
+ * @return Number of objects whose final correction is not small enough to
+ *         ensure convergence
+ * \param[in] num Number of objects
+ * \param[in] M Mean anomalies\n Units: r
+ * \param[in] e Eccentricities, greater than one
+ * \param[out] H Hyperbolic anomalies\n Units: r
+ */
+unsigned int OrbitalElementsBatch::KepEqtnH(unsigned int num, const double * M, const double * e, double * H)
+{
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        double abs_M = fabs(M[ii]);
+        double c3 = e[ii] / 6.0;
+        double cubic = cubic_root((e[ii] - 1.0) / c3, abs_M / c3);
+        H[ii] = copysign(fmin(cubic, log(2.0 * abs_M / e[ii] + 1.8)), M[ii]);
+    }
+
+    unsigned int num_unconverged = 0;
+    for(unsigned int iter = 1; iter <= num_kepler_iterations; ++iter)
+    {
+        for(unsigned int ii = 0; ii < num; ++ii)
+        {
+            double e_sinh = e[ii] * sinh(H[ii]);
+            double e_cosh = e[ii] * cosh(H[ii]);
+            double f = e_sinh - H[ii] - M[ii];
+            double fp = e_cosh - 1.0;
+            double step = -f / (fp - 0.5 * f * e_sinh / fp);
+            H[ii] += step;
+            num_unconverged += (iter == num_kepler_iterations) && !(fabs(step) < kepler_tol);
+        }
+    }
+
+    return num_unconverged;
+}
+
+/**
+ * Solve Barker's equation for the parabolic anomalies of many parabolic
+ * orbits, in the closed form B = t - 1/t with t the cube root of
+ * 3M/2 + sqrt(1 + 9M^2/4). As in OrbitalElements::KepEqtnB, a negative mean
+ * anomaly is first increased by 2 pi.
+ * \param[in] num Number of objects
+ * \param[in] M Mean anomalies\n Units: r
+ * \param[out] B Parabolic anomalies\n Units: r
+ */
+void OrbitalElementsBatch::KepEqtnB(unsigned int num, const double * M, double * B)
+{
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        double M_in = (M[ii] < 0.0) ? M[ii] + 2.0 * M_PI : M[ii];
+        double w = 1.5 * M_in;
+        double t = cbrt(w + sqrt(1.0 + w * w));
+        B[ii] = t - 1.0 / t;
+    }
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -0,0 +1,189 @@
+// Convert a catalog of objects on orbits of all types from orbital elements
+// with mean anomalies to Cartesian states and back, one object at a time
+// with OrbitalElements and all at once with OrbitalElementsBatch, check that
+// the two agree, and report the throughput of each.
+// System includes
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// JEOD includes
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/orbital_elements/include/orbital_elements.hh"
+#include "utils/orbital_elements/include/orbital_elements_batch.hh"
+
+using namespace std;
+using namespace jeod;
+
+static unsigned long seed = 12345;
+
+static double uniform()
+{
+    seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+    return static_cast<double>(seed) / 2147483648.0;
+}
+
+/**
+ * Elements of an object: one in twenty circular, one in ten parabolic, three
+ * in twenty hyperbolic and the rest elliptical, with one in ten of the
+ * non-parabolic orbits equatorial.
+ */
+static void random_elements(unsigned int index, OrbitalElements & elements)
+{
+    unsigned int kind = index % 20;
+    double mean_anom_range = 2.0 * M_PI;
+    if(kind == 0)
+    {
+        elements.e_mag = 0.0;
+    }
+    else if(kind <= 2)
+    {
+        elements.e_mag = 1.0 + 0.02 * (uniform() - 0.5);
+        mean_anom_range = 5.0;
+    }
+    else if(kind <= 5)
+    {
+        elements.e_mag = 1.01 + 5.0 * uniform() * uniform();
+        mean_anom_range = 20.0;
+    }
+    else
+    {
+        elements.e_mag = 0.99 * uniform();
+    }
+    elements.semiparam = 6.6e6 + 3.6e7 * uniform();
+    elements.inclination = ((index % 10 == 9) && (kind > 2)) ? 0.0 : M_PI * uniform();
+    elements.long_asc_node = 2.0 * M_PI * uniform();
+    elements.arg_periapsis = 2.0 * M_PI * uniform();
+    elements.mean_anom = mean_anom_range * (2.0 * uniform() - 1.0);
+}
+
+static double angle_diff(double a, double b)
+{
+    return fabs(remainder(a - b, 2.0 * M_PI));
+}
+
+static double rel_diff(const double a[3], const double b[3])
+{
+    double diff[3] = {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+    return sqrt(diff[0] * diff[0] + diff[1] * diff[1] + diff[2] * diff[2]) /
+           sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]);
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_objects;
+    double tolerance;
+
+    cmdline_parser.add_int("NumObjects", 30000, &num_objects);
+    cmdline_parser.add_double("Tolerance", 1.0e-12, &tolerance);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_objects <= 0)
+    {
+        cerr << "NumObjects must be positive." << endl;
+        return 1;
+    }
+
+    const double mu = 3.986004418e14;
+    auto num = static_cast<unsigned int>(num_objects);
+    vector<OrbitalElements> scalar(num);
+    OrbitalElementsBatch batch;
+    batch.resize(num);
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        random_elements(ii, scalar[ii]);
+        batch.set_elements(ii, scalar[ii]);
+    }
+
+    // Initialization: mean anomaly to true anomaly to Cartesian state.
+    vector<double[3]> scalar_pos(num), scalar_vel(num), batch_pos(num), batch_vel(num);
+    auto start = chrono::steady_clock::now();
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        scalar[ii].mean_anom_to_nu();
+    }
+    auto stop = chrono::steady_clock::now();
+    double scalar_kepler_s = chrono::duration<double>(stop - start).count();
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        scalar[ii].to_cartesian(mu, scalar_pos[ii], scalar_vel[ii]);
+    }
+    double scalar_init_s = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    int batch_rc = batch.mean_anom_to_nu();
+    stop = chrono::steady_clock::now();
+    double batch_kepler_s = chrono::duration<double>(stop - start).count();
+    batch_rc |= batch.to_cartesian(mu, batch_pos.data(), batch_vel.data());
+    double batch_init_s = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    double max_anom_diff = 0.0;
+    double max_state_diff = 0.0;
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        double anom_scale = fmax(1.0, fabs(scalar[ii].orbital_anom));
+        max_anom_diff = fmax(max_anom_diff, fabs(scalar[ii].orbital_anom - batch.orbital_anom[ii]) / anom_scale);
+        max_anom_diff = fmax(max_anom_diff, angle_diff(scalar[ii].true_anom, batch.true_anom[ii]));
+        max_state_diff = fmax(max_state_diff, rel_diff(scalar_pos[ii], batch_pos[ii]));
+        max_state_diff = fmax(max_state_diff, rel_diff(scalar_vel[ii], batch_vel[ii]));
+    }
+
+    // Reporting: Cartesian state to elements.
+    start = chrono::steady_clock::now();
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        scalar[ii].from_cartesian(mu, scalar_pos[ii], scalar_vel[ii]);
+    }
+    double scalar_report_s = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    batch_rc |= batch.from_cartesian(mu, scalar_pos.data(), scalar_vel.data());
+    double batch_report_s = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    double max_element_diff = 0.0;
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        OrbitalElements elements;
+        batch.get_elements(ii, elements);
+        double diffs[] = {fabs(scalar[ii].semiparam - elements.semiparam) / scalar[ii].semiparam,
+                          fabs(scalar[ii].e_mag - elements.e_mag),
+                          angle_diff(scalar[ii].inclination, elements.inclination),
+                          angle_diff(scalar[ii].long_asc_node, elements.long_asc_node),
+                          angle_diff(scalar[ii].arg_periapsis, elements.arg_periapsis),
+                          angle_diff(scalar[ii].true_anom, elements.true_anom),
+                          fabs(scalar[ii].mean_anom - elements.mean_anom) / fmax(1.0, fabs(scalar[ii].mean_anom))};
+        for(double diff : diffs)
+        {
+            max_element_diff = fmax(max_element_diff, diff);
+        }
+    }
+
+    cout << "Objects: " << num << endl;
+    cout << fixed << setprecision(0);
+    cout << setw(28) << "" << setw(16) << "one at a time" << setw(16) << "batched" << endl;
+    cout << setw(28) << "Kepler's equation, obj/s" << setw(16) << num / scalar_kepler_s << setw(16)
+         << num / batch_kepler_s << endl;
+    cout << setw(28) << "Elements to state, obj/s" << setw(16) << num / scalar_init_s << setw(16)
+         << num / batch_init_s << endl;
+    cout << setw(28) << "State to elements, obj/s" << setw(16) << num / scalar_report_s << setw(16)
+         << num / batch_report_s << endl;
+    cout.unsetf(ios::floatfield);
+    cout << scientific << setprecision(2);
+    cout << "Max anomaly difference:        " << max_anom_diff << endl;
+    cout << "Max relative state difference: " << max_state_diff << endl;
+    cout << "Max element difference:        " << max_element_diff << endl;
+    cout.unsetf(ios::floatfield);
+
+    if((batch_rc != 0) || (max_anom_diff > tolerance) || (max_state_diff > tolerance) ||
+       (max_element_diff > tolerance))
+    {
+        cout << "Failed tolerance " << tolerance << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,187 @@
+/*
+ * orbital_elements_batch_ut.cc
+ */
+
+#include "utils/orbital_elements/include/orbital_elements.hh"
+#include "utils/orbital_elements/include/orbital_elements_batch.hh"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+using namespace jeod;
+
+namespace
+{
+/**
+ * Elements of an elliptical, a circular, a hyperbolic and a parabolic orbit.
+ */
+void set_test_elements(unsigned int index, OrbitalElements & elements)
+{
+    const double e_mags[4] = {0.7, 0.0, 2.5, 1.0};
+    const double mean_anoms[4] = {8.0, 1.0, -3.0, 0.5};
+    elements.e_mag = e_mags[index % 4];
+    elements.mean_anom = mean_anoms[index % 4];
+    elements.semiparam = 7.0e6;
+    elements.inclination = 0.5;
+    elements.long_asc_node = 1.0;
+    elements.arg_periapsis = 2.0;
+}
+} // namespace
+
+TEST(OrbitalElementsBatch, create)
+{
+    OrbitalElementsBatch staticInst;
+    OrbitalElementsBatch * dynInst = new OrbitalElementsBatch;
+    delete dynInst;
+}
+
+TEST(OrbitalElementsBatch, resize)
+{
+    OrbitalElementsBatch staticInst;
+    EXPECT_EQ(staticInst.size(), 0u);
+    staticInst.resize(3);
+    EXPECT_EQ(staticInst.size(), 3u);
+    EXPECT_EQ(staticInst.true_anom.size(), 3u);
+    EXPECT_EQ(staticInst.sin_v[2], 0.0);
+    EXPECT_EQ(staticInst.cos_v[2], 1.0);
+}
+
+TEST(OrbitalElementsBatch, set_elements)
+{
+    OrbitalElements elements;
+    OrbitalElementsBatch staticInst;
+    staticInst.resize(2);
+    set_test_elements(2, elements);
+    staticInst.set_elements(1, elements);
+    EXPECT_EQ(staticInst.e_mag[1], 2.5);
+    EXPECT_EQ(staticInst.mean_anom[1], -3.0);
+    EXPECT_EQ(staticInst.e_mag[0], 0.0);
+}
+
+TEST(OrbitalElementsBatch, get_elements)
+{
+    OrbitalElements elements;
+    OrbitalElementsBatch staticInst;
+    staticInst.resize(1);
+    staticInst.inclination[0] = 0.25;
+    staticInst.get_elements(0, elements);
+    EXPECT_EQ(elements.inclination, 0.25);
+    EXPECT_EQ(elements.cos_v, 1.0);
+}
+
+TEST(OrbitalElementsBatch, from_cartesian)
+{
+    const double mu = 3.986004418e14;
+    OrbitalElements scalar[4];
+    double pos[4][3];
+    double vel[4][3];
+    for(unsigned int ii = 0; ii < 4; ++ii)
+    {
+        set_test_elements(ii, scalar[ii]);
+        scalar[ii].mean_anom_to_nu();
+        scalar[ii].to_cartesian(mu, pos[ii], vel[ii]);
+    }
+
+    OrbitalElementsBatch staticInst;
+    staticInst.resize(4);
+    EXPECT_EQ(staticInst.from_cartesian(mu, pos, vel), 0);
+    for(unsigned int ii = 0; ii < 4; ++ii)
+    {
+        scalar[ii].from_cartesian(mu, pos[ii], vel[ii]);
+        EXPECT_NEAR(staticInst.e_mag[ii], scalar[ii].e_mag, 1.0e-12);
+        EXPECT_NEAR(staticInst.arg_periapsis[ii], scalar[ii].arg_periapsis, 1.0e-12);
+        EXPECT_NEAR(staticInst.true_anom[ii], scalar[ii].true_anom, 1.0e-12);
+        EXPECT_NEAR(staticInst.mean_anom[ii], scalar[ii].mean_anom, 1.0e-12);
+    }
+}
+
+TEST(OrbitalElementsBatch, to_cartesian)
+{
+    const double mu = 3.986004418e14;
+    OrbitalElementsBatch staticInst;
+    double scalar_pos[4][3];
+    double scalar_vel[4][3];
+    double pos[4][3];
+    double vel[4][3];
+    staticInst.resize(4);
+    for(unsigned int ii = 0; ii < 4; ++ii)
+    {
+        OrbitalElements elements;
+        set_test_elements(ii, elements);
+        elements.mean_anom_to_nu();
+        elements.to_cartesian(mu, scalar_pos[ii], scalar_vel[ii]);
+        staticInst.set_elements(ii, elements);
+    }
+    EXPECT_EQ(staticInst.to_cartesian(mu, pos, vel), 0);
+    for(unsigned int ii = 0; ii < 4; ++ii)
+    {
+        for(unsigned int jj = 0; jj < 3; ++jj)
+        {
+            EXPECT_DOUBLE_EQ(pos[ii][jj], scalar_pos[ii][jj]);
+            EXPECT_DOUBLE_EQ(vel[ii][jj], scalar_vel[ii][jj]);
+        }
+    }
+}
+
+TEST(OrbitalElementsBatch, nu_to_anomalies) {}
+
+TEST(OrbitalElementsBatch, mean_anom_to_nu)
+{
+    OrbitalElementsBatch staticInst;
+    staticInst.resize(8);
+    for(unsigned int ii = 0; ii < 8; ++ii)
+    {
+        OrbitalElements elements;
+        set_test_elements(ii, elements);
+        staticInst.set_elements(ii, elements);
+    }
+    EXPECT_EQ(staticInst.mean_anom_to_nu(), 0);
+    for(unsigned int ii = 0; ii < 8; ++ii)
+    {
+        OrbitalElements elements;
+        set_test_elements(ii, elements);
+        elements.mean_anom_to_nu();
+        EXPECT_NEAR(staticInst.orbital_anom[ii], elements.orbital_anom, 1.0e-12);
+        EXPECT_NEAR(staticInst.true_anom[ii], elements.true_anom, 1.0e-12);
+    }
+}
+
+TEST(OrbitalElementsBatch, KepEqtnE)
+{
+    const double M[4] = {0.0, 1.0e-6, 3.0, -20.0};
+    const double e[4] = {0.5, 0.98, 0.98, 0.1};
+    double E[4];
+    EXPECT_EQ(OrbitalElementsBatch::KepEqtnE(4, M, e, E), 0u);
+    for(unsigned int ii = 0; ii < 4; ++ii)
+    {
+        EXPECT_NEAR(E[ii] - e[ii] * std::sin(E[ii]), M[ii], 1.0e-14);
+    }
+}
+
+TEST(OrbitalElementsBatch, KepEqtnH)
+{
+    const double M[4] = {0.0, 1.0e-6, -3.0, 1.0e4};
+    const double e[4] = {1.02, 1.02, 2.0, 50.0};
+    double H[4];
+    EXPECT_EQ(OrbitalElementsBatch::KepEqtnH(4, M, e, H), 0u);
+    for(unsigned int ii = 0; ii < 4; ++ii)
+    {
+        EXPECT_NEAR((e[ii] * std::sinh(H[ii]) - H[ii] - M[ii]) / (e[ii] * std::cosh(H[ii]) - 1.0), 0.0, 1.0e-14);
+    }
+}
+
+TEST(OrbitalElementsBatch, KepEqtnB)
+{
+    const double M[3] = {0.0, 2.0, -1.0};
+    double B[3];
+    OrbitalElementsBatch::KepEqtnB(3, M, B);
+    for(unsigned int ii = 0; ii < 3; ++ii)
+    {
+        double M_in = (M[ii] < 0.0) ? M[ii] + 2.0 * M_PI : M[ii];
+        EXPECT_NEAR(B[ii] + B[ii] * B[ii] * B[ii] / 3.0, M_in, 1.0e-13);
+    }
+}
+
+TEST(OrbitalElementsBatch, sort_by_type) {}
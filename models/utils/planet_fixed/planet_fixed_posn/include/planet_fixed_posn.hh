@@ -56,7 +56,10 @@ Purpose:
 References:
    (((Vallado, David. A) (Fundamentals of Astrodynamics and Applications,
       2nd Ed.) (Microcosm Press: El Segundo, CA) (2004) (Page 139-140)
-      (ISBN:1-881883-12-4)))
+      (ISBN:1-881883-12-4))
+    ((Vermeille, H.)
+     (An analytical method to transform geocentric into geodetic coordinates)
+     (J. Geod., 85 (2011), pp. 105-117)))
 
 Assumptions and Limitations:
    ((Given Cartesian coordinates are assumed to be in planet-centered, planet-
@@ -136,6 +139,13 @@ public:
      */
     Planet * planet{}; //!< trick_units(--)
 
+    /**
+     * Compute elliptical coordinates with Vermeille's closed-form solution
+     * rather than by Borkowski's iteration. Points deep inside the planet,
+     * where the closed form does not apply, are still iterated.
+     */
+    bool closed_form_ellip{}; //!< trick_units(--)
+
     // Member functions
 public:
     PlanetFixedPosition() = default;
@@ -153,6 +163,15 @@ public:
     // Update from elliptical position input
     virtual void update_from_ellip(const AltLatLongState & ellip);
 
+    // Compute the elliptical coordinates of many Cartesian positions
+    void cart_to_ellip_batch(unsigned int num_points,
+                             const double * x,
+                             const double * y,
+                             const double * z,
+                             double * altitude,
+                             double * latitude,
+                             double * longitude);
+
 protected:
     // Calculate the spherical representation for the current cartesian coords
     void cart_to_spher();
@@ -168,6 +187,10 @@ protected:
 
     // Calculate elliptic latitude and altitude
     int get_elliptic_parameters(double r, double z, double & f, double & h, int maxIters = Max_iteration_limit);
+
+    // Calculate elliptic latitude and altitude in closed form
+    static bool get_elliptic_parameters_closed_form(
+        double a, double e_sq, double r, double z, double & lat, double & alt);
 };
 
 } // namespace jeod
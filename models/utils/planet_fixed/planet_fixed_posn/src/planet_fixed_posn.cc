@@ -172,7 +172,15 @@ void PlanetFixedPosition::cart_to_ellip()
     }
 
     // Solve for elliptic parameters
-    get_elliptic_parameters(x_ellipse, z_ellipse, ellip_coords.latitude, ellip_coords.altitude);
+    if(!closed_form_ellip || !get_elliptic_parameters_closed_form(planet->r_eq,
+                                                                  planet->e_ellip_sq,
+                                                                  x_ellipse,
+                                                                  z_ellipse,
+                                                                  ellip_coords.latitude,
+                                                                  ellip_coords.altitude))
+    {
+        get_elliptic_parameters(x_ellipse, z_ellipse, ellip_coords.latitude, ellip_coords.altitude);
+    }
 
     // Check for being directly over the pole
     if(std::fpclassify(x_ellipse) != FP_ZERO)
@@ -182,6 +190,41 @@ void PlanetFixedPosition::cart_to_ellip()
     } // end if
 }
 
+/**
+ * Compute the elliptical coordinates of many Cartesian positions, given and
+ * returned as separate arrays of each component. The positions must not be
+ * near the planet's center. This object's coordinates are left unchanged.
+ * The closed-form solution is used regardless of closed_form_ellip.
+ * \param[in] num_points Number of positions
+ * \param[in] x X components of the positions, PCPF\n Units: M
+ * \param[in] y Y components of the positions, PCPF\n Units: M
+ * \param[in] z Z components of the positions, PCPF\n Units: M
+ * \param[out] altitude Elliptical altitudes\n Units: M
+ * \param[out] latitude Elliptical latitudes\n Units: r
+ * \param[out] longitude Elliptical longitudes, zero over a pole\n Units: r
+ */
+void PlanetFixedPosition::cart_to_ellip_batch(unsigned int num_points,
+                                              const double * x,
+                                              const double * y,
+                                              const double * z,
+                                              double * altitude,
+                                              double * latitude,
+                                              double * longitude)
+{
+    double a = planet->r_eq;
+    double e_sq = planet->e_ellip_sq;
+
+    for(unsigned int ii = 0; ii < num_points; ++ii)
+    {
+        double r = sqrt((x[ii] * x[ii]) + (y[ii] * y[ii]));
+        if(!get_elliptic_parameters_closed_form(a, e_sq, r, z[ii], latitude[ii], altitude[ii]))
+        {
+            get_elliptic_parameters(r, z[ii], latitude[ii], altitude[ii]);
+        }
+        longitude[ii] = atan2(y[ii], x[ii]);
+    }
+}
+
 /**
  * Convert from spherical to cartesian position
  */
@@ -276,6 +319,51 @@ int PlanetFixedPosition::get_elliptic_parameters(              /* Return: --
     return numIters;
 } // end get_elliptic_parameters
 
+/*******************************************************************************
+Function: PlanetFixedPosition::get_elliptic_parameters_closed_form
+Purpose: Calculate latitude and altitude of a Cartesian point relative to
+an oblate ellipsoid without iteration. The solution applies outside the
+evolute of the ellipse, which lies within e^2 * a of the center; points
+closer to the center than that are left to get_elliptic_parameters.
+References:
+(((Vermeille, H.)
+(An analytical method to transform geocentric into geodetic coordinates)
+(J. Geod., 85 (2011), pp. 105-117)))
+*******************************************************************************/
+bool PlanetFixedPosition::get_elliptic_parameters_closed_form(          /* Return: --
+                                  False if the point is too near the center */
+                                                             double a,     // In:  M Equatorial radius
+                                                             double e_sq,  // In:  -- Eccentricity squared
+                                                             double r,     // In:  M Equatorial position
+                                                             double z,     // In:  M Polar position
+                                                             double & lat, // Out: r Latitude
+                                                             double & alt) // Out: M Altitude
+{
+    double e_4 = e_sq * e_sq;
+    double p = (r * r) / (a * a);
+    double q = (1.0 - e_sq) * (z * z) / (a * a);
+    double rr = (p + q - e_4) / 6.0;
+
+    // Too near the center; the cubic below has no suitable root.
+    if(rr <= 0.0)
+    {
+        return false;
+    }
+
+    double s = e_4 * p * q / (4.0 * rr * rr * rr);
+    double t = cbrt(1.0 + s + sqrt(s * (2.0 + s)));
+    double u = rr * (1.0 + t + 1.0 / t);
+    double v = sqrt((u * u) + (e_4 * q));
+    double w = e_sq * (u + v - q) / (2.0 * v);
+    double k = sqrt(u + v + (w * w)) - w;
+    double d = k * r / (k + e_sq);
+    double dz = sqrt((d * d) + (z * z));
+
+    lat = 2.0 * atan2(z, d + dz);
+    alt = (k + e_sq - 1.0) / k * dz;
+    return true;
+} // end get_elliptic_parameters_closed_form
+
 } // namespace jeod
 
 /**
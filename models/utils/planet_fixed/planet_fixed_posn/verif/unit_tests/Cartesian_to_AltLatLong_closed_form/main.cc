@@ -0,0 +1,238 @@
+// Compare the iterative and closed-form Cartesian to elliptical conversions,
+// one position at a time and batched, against an extended precision
+// reference, for altitudes from -100 km to beyond GEO, and time them.
+// System includes
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+// JEOD includes
+#include "environment/gravity/include/spherical_harmonics_gravity_source.hh"
+#include "environment/planet/include/planet.hh"
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/planet_fixed/planet_fixed_posn/include/planet_fixed_posn.hh"
+
+using namespace std;
+using namespace jeod;
+
+static constexpr unsigned int NUM_BANDS = 4;
+static const double band_limits[NUM_BANDS + 1] = {-100.0e3, 0.0, 2000.0e3, 20000.0e3, 40000.0e3};
+
+static unsigned long seed = 12345;
+
+static double uniform()
+{
+    seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+    return static_cast<double>(seed) / 2147483648.0;
+}
+
+/**
+ * Reference elliptical latitude and altitude, by fixed-point iteration in
+ * extended precision.
+ */
+static void reference_ellip(const Planet & planet, double r, double z, long double & lat, long double & alt)
+{
+    long double a = planet.r_eq;
+    long double e_sq = planet.e_ellip_sq;
+    long double rl = r;
+    long double zl = z;
+    long double sin_lat = 0.0L;
+    long double n_rad = a;
+    lat = atan2l(zl, rl);
+    for(int iter = 0; iter < 40; ++iter)
+    {
+        sin_lat = sinl(lat);
+        n_rad = a / sqrtl(1.0L - e_sq * sin_lat * sin_lat);
+        lat = atan2l(zl + e_sq * n_rad * sin_lat, rl);
+    }
+    sin_lat = sinl(lat);
+    alt = rl * cosl(lat) + zl * sin_lat - a * sqrtl(1.0L - e_sq * sin_lat * sin_lat);
+}
+
+static unsigned int band_of(double alt)
+{
+    unsigned int band = 0;
+    while((band < NUM_BANDS - 1) && (alt >= band_limits[band + 1]))
+    {
+        ++band;
+    }
+    return band;
+}
+
+/**
+ * Errors of a converted position, in meters: the altitude error and the
+ * latitude error along the meridian.
+ */
+static void ellip_error(
+    const Planet & planet, double lat, double alt, long double ref_lat, long double ref_alt, double err[2])
+{
+    err[0] = fabs(static_cast<double>(alt - ref_alt));
+    err[1] = fabs(static_cast<double>(lat - ref_lat)) * (planet.r_eq + static_cast<double>(ref_alt));
+}
+
+/**
+ * Accumulate the errors of a conversion, by altitude band, and relative to
+ * the resolution of the position, the double precision epsilon times the
+ * distance from the center.
+ */
+static void accumulate_errors(const Planet & planet,
+                              const vector<double> & radius,
+                              const vector<double> & lat,
+                              const vector<double> & alt,
+                              const vector<long double> & ref_lat,
+                              const vector<long double> & ref_alt,
+                              double max_err[2][NUM_BANDS],
+                              double & max_ulps)
+{
+    for(unsigned int ii = 0; ii < radius.size(); ++ii)
+    {
+        unsigned int band = band_of(static_cast<double>(ref_alt[ii]));
+        double err[2];
+        ellip_error(planet, lat[ii], alt[ii], ref_lat[ii], ref_alt[ii], err);
+        for(unsigned int jj = 0; jj < 2; ++jj)
+        {
+            max_err[jj][band] = err[jj] > max_err[jj][band] ? err[jj] : max_err[jj][band];
+            double ulps = err[jj] / (numeric_limits<double>::epsilon() * radius[ii]);
+            max_ulps = ulps > max_ulps ? ulps : max_ulps;
+        }
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    SphericalHarmonicsGravitySource gravBody;
+    Planet planet;
+    PlanetFixedPosition pfp;
+    int numCases;
+    double tolerance;
+
+    cmdline_parser.add_int("NumCases", 100000, &numCases);
+    cmdline_parser.add_double("Tolerance", 4.0, &tolerance);
+    cmdline_parser.parse(argc, argv);
+
+    if(numCases <= 0)
+    {
+        cerr << "NumCases must be positive." << endl;
+        return 1;
+    }
+
+    planet.name = "Earth";
+    planet.r_eq = 6378137.0;
+    planet.flat_inv = 298.257223563;
+    gravBody.name = planet.name;
+    planet.grav_source = &gravBody;
+    planet.initialize();
+    pfp.initialize(&planet);
+
+    // Positions with altitudes uniform between -100 km and 40000 km, with
+    // the poles and the equator included.
+    auto num = static_cast<unsigned int>(numCases);
+    vector<double> x(num), y(num), z(num);
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        AltLatLongState ellip;
+        ellip.altitude = band_limits[0] + (band_limits[NUM_BANDS] - band_limits[0]) * uniform();
+        ellip.latitude = asin(2.0 * uniform() - 1.0);
+        ellip.longitude = M_PI * (2.0 * uniform() - 1.0);
+        if(ii % 100 == 0)
+        {
+            ellip.latitude = (ii % 300 == 0) ? 0.0 : ((ii % 300 == 100) ? M_PI_2 : -M_PI_2);
+        }
+        pfp.update_from_ellip(ellip);
+        x[ii] = pfp.cart_coords[0];
+        y[ii] = pfp.cart_coords[1];
+        z[ii] = pfp.cart_coords[2];
+    }
+
+    vector<double> radius(num);
+    vector<long double> ref_lat(num), ref_alt(num);
+    for(unsigned int ii = 0; ii < num; ++ii)
+    {
+        radius[ii] = sqrt(x[ii] * x[ii] + y[ii] * y[ii] + z[ii] * z[ii]);
+        reference_ellip(planet, sqrt(x[ii] * x[ii] + y[ii] * y[ii]), z[ii], ref_lat[ii], ref_alt[ii]);
+    }
+
+    // Convert one position at a time with each method, then all at once.
+    double max_err[3][2][NUM_BANDS] = {};
+    double max_ulps[3] = {};
+    double conv_ns[3];
+    vector<double> lat(num), alt(num), lon(num);
+    for(unsigned int method = 0; method < 3; ++method)
+    {
+        pfp.closed_form_ellip = (method == 1);
+        auto start = chrono::steady_clock::now();
+        if(method < 2)
+        {
+            for(unsigned int ii = 0; ii < num; ++ii)
+            {
+                double cart[3] = {x[ii], y[ii], z[ii]};
+                pfp.update_from_cart(cart);
+                lat[ii] = pfp.ellip_coords.latitude;
+                alt[ii] = pfp.ellip_coords.altitude;
+            }
+        }
+        else
+        {
+            pfp.cart_to_ellip_batch(num, x.data(), y.data(), z.data(), alt.data(), lat.data(), lon.data());
+        }
+        auto stop = chrono::steady_clock::now();
+        conv_ns[method] = chrono::duration<double, nano>(stop - start).count() / num;
+
+        accumulate_errors(planet, radius, lat, alt, ref_lat, ref_alt, max_err[method], max_ulps[method]);
+    }
+
+    const char * method_names[3] = {"iterative", "closed form", "batch"};
+    const char * error_names[2] = {"altitude", "latitude"};
+    cout << "Cases: " << num << endl;
+    cout << setw(12) << "method" << setw(10) << "error" << setw(10) << "ns/point";
+    for(unsigned int band = 0; band < NUM_BANDS; ++band)
+    {
+        cout << setw(8) << static_cast<int>(band_limits[band] / 1000.0) << "-" << setw(6) << left
+             << static_cast<int>(band_limits[band + 1] / 1000.0) << right;
+    }
+    cout << " km, max error m" << endl;
+
+    int rv = 0;
+    for(unsigned int method = 0; method < 3; ++method)
+    {
+        for(unsigned int jj = 0; jj < 2; ++jj)
+        {
+            cout << setw(12) << (jj == 0 ? method_names[method] : "") << setw(10) << error_names[jj];
+            if(jj == 0)
+            {
+                cout << setw(10) << fixed << setprecision(1) << conv_ns[method];
+            }
+            else
+            {
+                cout << setw(10) << "";
+            }
+            cout << scientific << setprecision(2);
+            for(unsigned int band = 0; band < NUM_BANDS; ++band)
+            {
+                cout << setw(15) << max_err[method][jj][band];
+            }
+            cout << endl;
+            cout.unsetf(ios::floatfield);
+        }
+    }
+
+    for(unsigned int method = 0; method < 3; ++method)
+    {
+        cout << setw(12) << method_names[method] << " max error " << fixed << setprecision(2) << max_ulps[method]
+             << " eps*|r|" << endl;
+        cout.unsetf(ios::floatfield);
+        if((method > 0) && (max_ulps[method] > tolerance))
+        {
+            cout << "Failed tolerance of " << tolerance << " eps*|r| for " << method_names[method] << endl;
+            rv = 1;
+        }
+    }
+
+    return rv;
+}
@@ -24,6 +24,8 @@ TEST(PlanetFixedPosition, update_from_spher) {}
 
 TEST(PlanetFixedPosition, update_from_ellip) {}
 
+TEST(PlanetFixedPosition, cart_to_ellip_batch) {}
+
 TEST(PlanetFixedPosition, cart_to_spher) {}
 
 TEST(PlanetFixedPosition, cart_to_ellip) {}
@@ -33,3 +35,5 @@ TEST(PlanetFixedPosition, spher_to_cart) {}
 TEST(PlanetFixedPosition, ellip_to_cart) {}
 
 TEST(PlanetFixedPosition, get_elliptic_parameters) {}
+
+TEST(PlanetFixedPosition, get_elliptic_parameters_closed_form) {}
@@ -101,11 +101,36 @@ class RefFrame : public Subscription
 
     friend class RefFrameLinks;
 
+public:
+    /**
+     * A request for the state of one frame with respect to another,
+     * as processed by compute_relative_states.
+     */
+    struct RelativeStateRequest
+    {
+        /**
+         * The frame whose state is to be computed.
+         */
+        const RefFrame * frame; //!< trick_units(--)
+
+        /**
+         * The frame with respect to which the state is to be expressed.
+         */
+        const RefFrame * wrt_frame; //!< trick_units(--)
+
+        /**
+         * The computed relative state.
+         */
+        RefFrameState * rel_state; //!< trick_units(--)
+    };
+
     // Member data
 public:
     /**
      * The translational and rotational state of the reference frame
-     * with respect to its parent.
+     * with respect to its parent. Code that writes the state should call
+     * set_timestamp or note_state_change afterwards so that cached relative
+     * states are not reused.
      */
     RefFrameState state; //!< trick_units(--)
 
@@ -203,6 +228,10 @@ public:
                                         bool reverse_sense,
                                         RefFrameState & rel_state) const;
 
+    // compute_relative_states: Compute many relative states, sharing the
+    // parts common to requests for the same frame
+    static void compute_relative_states(const RelativeStateRequest * requests, unsigned int num_requests);
+
     // compute_state_wrt_pred: Compute the relative state between frames
     virtual void compute_state_wrt_pred(const RefFrame & wrt_frame, RefFrameState & rel_state) const;
 
@@ -221,9 +250,32 @@ public:
     // find_last_common_node: Find the point of departure between nodes
     const RefFrame * find_last_common_node(const RefFrame & frame) const;
 
+    // set_relative_state_cache: Enable or disable the relative state cache
+    static void set_relative_state_cache(bool enable);
+
+    // relative_state_cache_enabled: Is the relative state cache enabled?
+    static bool relative_state_cache_enabled();
+
+    // get_relative_state_cache_hits: Number of cached relative states used
+    static unsigned long long get_relative_state_cache_hits();
+
+    // get_relative_state_cache_misses: Number of relative states computed
+    // while the cache was enabled
+    static unsigned long long get_relative_state_cache_misses();
+
+    // reset_relative_state_cache_stats: Zero the hit and miss counters
+    static void reset_relative_state_cache_stats();
+
+    // note_state_change: Invalidate all cached relative states
+    static void note_state_change();
+
 protected:
     // find_last_common_index: Find the point of departure between nodes
     int find_last_common_index(const RefFrame & frame) const;
+
+    // compute_relative_state_uncached: Compute the relative state between
+    // frames by walking the tree
+    void compute_relative_state_uncached(const RefFrame & wrt_frame, RefFrameState & rel_state) const;
 };
 
 } // namespace jeod
@@ -123,11 +123,14 @@ inline const RefFrame * RefFrame::get_root() const
 
 /**
  * Set the update time of this frame.
+ * Models that update a frame's state set its timestamp afterwards, which
+ * also invalidates the cached relative states.
  * \param[in] time Time\n Units: s
  */
 inline void RefFrame::set_timestamp(double time)
 {
     update_time = time;
+    note_state_change();
 }
 
 /**
@@ -145,6 +148,7 @@ inline double RefFrame::timestamp() const
 inline void RefFrame::make_root()
 {
     links.make_root();
+    note_state_change();
 }
 
 /**
@@ -154,6 +158,7 @@ inline void RefFrame::make_root()
 inline void RefFrame::add_child(RefFrame & frame)
 {
     frame.links.attach(links);
+    note_state_change();
 }
 
 /**
@@ -162,6 +167,7 @@ inline void RefFrame::add_child(RefFrame & frame)
 inline void RefFrame::remove_from_parent()
 {
     links.detach();
+    note_state_change();
 }
 
 /**
@@ -100,6 +100,7 @@ void RefFrame::transplant_node(RefFrame & new_parent)
 
     // Reset the state.
     state = new_state;
+    note_state_change();
 }
 
 /**
@@ -109,6 +110,7 @@ void RefFrame::transplant_node(RefFrame & new_parent)
 void RefFrame::reset_parent(RefFrame & new_parent)
 {
     links.reattach(new_parent.links);
+    note_state_change();
 }
 
 } // namespace jeod
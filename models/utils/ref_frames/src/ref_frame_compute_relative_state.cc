@@ -24,7 +24,12 @@
 *******************************************************************************/
 
 // System includes
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
 
 // JEOD includes
 #include "utils/math/include/numerical.hh"
@@ -41,6 +46,260 @@
 namespace jeod
 {
 
+namespace
+{
+
+/**
+ * Is the relative state cache enabled?
+ */
+std::atomic<bool> cache_enabled(false);
+
+/**
+ * Tree-wide generation number. Cached relative states are valid only for
+ * the generation in which they were computed.
+ */
+std::atomic<unsigned long long> cache_generation(1);
+
+/**
+ * Per-thread memo of relative states, keyed on the (frame, wrt_frame) pair.
+ * Each thread that computes relative states owns one of these, so lookups
+ * and stores need no locking. The table is direct mapped; a collision
+ * simply replaces the older entry.
+ */
+class RelativeStateCache
+{
+public:
+    /**
+     * Number of entries in the table; a power of two.
+     */
+    static const unsigned int num_entries = 512;
+
+    /**
+     * A memoized relative state.
+     */
+    struct Entry
+    {
+        const RefFrame * frame{};        //!< Frame whose state was computed
+        const RefFrame * wrt_frame{};    //!< Frame with respect to which
+        unsigned long long generation{}; //!< Generation of the state
+        RefFrameState rel_state;         //!< The relative state
+    };
+
+    Entry entries[num_entries];                   //!< The table
+    std::atomic<unsigned long long> hits{0};      //!< Entries reused
+    std::atomic<unsigned long long> misses{0};    //!< Entries computed
+
+    RelativeStateCache()
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        registry().push_back(this);
+    }
+
+    ~RelativeStateCache()
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        retired_hits() += hits.load(std::memory_order_relaxed);
+        retired_misses() += misses.load(std::memory_order_relaxed);
+        std::vector<RelativeStateCache *> & caches = registry();
+        caches.erase(std::remove(caches.begin(), caches.end(), this), caches.end());
+    }
+
+    RelativeStateCache(const RelativeStateCache &) = delete;
+    RelativeStateCache & operator=(const RelativeStateCache &) = delete;
+
+    /**
+     * Return the table entry for a frame pair.
+     */
+    Entry & slot(const RefFrame * frame, const RefFrame * wrt_frame)
+    {
+        auto key = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(frame)) * 0x9E3779B97F4A7C15ULL ^
+                   static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(wrt_frame)) * 0xC2B2AE3D27D4EB4FULL;
+        return entries[(key >> 32) & (num_entries - 1)];
+    }
+
+    /**
+     * Increment a counter. Only the owning thread increments its counters,
+     * so an atomic read-modify-write is not needed.
+     */
+    static void count(std::atomic<unsigned long long> & counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Return the calling thread's cache.
+     */
+    static RelativeStateCache & local()
+    {
+        static thread_local RelativeStateCache cache;
+        return cache;
+    }
+
+    /**
+     * Sum a counter over all live and retired caches.
+     */
+    static unsigned long long total(std::atomic<unsigned long long> RelativeStateCache::*counter,
+                                    unsigned long long & retired)
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        unsigned long long sum = retired;
+        for(const RelativeStateCache * cache : registry())
+        {
+            sum += (cache->*counter).load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    /**
+     * Zero the counters of all live and retired caches.
+     */
+    static void reset_counters()
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        retired_hits() = 0;
+        retired_misses() = 0;
+        for(RelativeStateCache * cache : registry())
+        {
+            cache->hits.store(0, std::memory_order_relaxed);
+            cache->misses.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    static std::mutex & registry_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::vector<RelativeStateCache *> & registry()
+    {
+        static std::vector<RelativeStateCache *> caches;
+        return caches;
+    }
+
+    static unsigned long long & retired_hits()
+    {
+        static unsigned long long count = 0;
+        return count;
+    }
+
+    static unsigned long long & retired_misses()
+    {
+        static unsigned long long count = 0;
+        return count;
+    }
+};
+
+} // namespace
+
+/**
+ * Enable or disable the relative state cache. When enabled,
+ * compute_relative_state reuses a relative state computed earlier for the
+ * same pair of frames provided no frame state has changed since, as
+ * signaled by set_timestamp, note_state_change, or a change to the tree.
+ * \par Assumptions and Limitations
+ *  - Every write to a RefFrame state is followed by a call to set_timestamp
+ *    or note_state_change before the next relative state request.
+ *    The JEOD models that update frames do this.
+ * \param[in] enable True to enable the cache
+ */
+void RefFrame::set_relative_state_cache(bool enable)
+{
+    cache_generation.fetch_add(1, std::memory_order_relaxed);
+    cache_enabled.store(enable, std::memory_order_relaxed);
+}
+
+/**
+ * Return whether the relative state cache is enabled.
+ * @return True if the cache is enabled
+ */
+bool RefFrame::relative_state_cache_enabled()
+{
+    return cache_enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * Return the number of relative state requests satisfied from the cache
+ * since the counters were last reset, summed over all threads.
+ * @return Number of cache hits
+ */
+unsigned long long RefFrame::get_relative_state_cache_hits()
+{
+    return RelativeStateCache::total(&RelativeStateCache::hits, RelativeStateCache::retired_hits());
+}
+
+/**
+ * Return the number of relative states computed with the cache enabled
+ * since the counters were last reset, summed over all threads.
+ * @return Number of cache misses
+ */
+unsigned long long RefFrame::get_relative_state_cache_misses()
+{
+    return RelativeStateCache::total(&RelativeStateCache::misses, RelativeStateCache::retired_misses());
+}
+
+/**
+ * Zero the relative state cache hit and miss counters.
+ */
+void RefFrame::reset_relative_state_cache_stats()
+{
+    RelativeStateCache::reset_counters();
+}
+
+/**
+ * Invalidate all cached relative states by advancing the tree-wide
+ * generation number. This is a no-op when the cache is disabled.
+ */
+void RefFrame::note_state_change()
+{
+    if(cache_enabled.load(std::memory_order_relaxed))
+    {
+        cache_generation.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Compute the complete state of the invoking reference frame (*this)
+ * with respect to the supplied wrt_frame reference frame, reusing the
+ * state computed earlier for the same frames if the relative state cache
+ * is enabled and no frame state has changed since.
+ * See compute_relative_state_uncached for the contents of the state.
+ *
+ * \par Assumptions and Limitations
+ *  - The two frames are in the same tree.
+ * \param[in] wrt_frame The frame with respect to which the state is to be expressed
+ * \param[out] rel_state The relative state
+ */
+void RefFrame::compute_relative_state(const RefFrame & wrt_frame, RefFrameState & rel_state) const
+{
+    if(!cache_enabled.load(std::memory_order_relaxed))
+    {
+        compute_relative_state_uncached(wrt_frame, rel_state);
+        return;
+    }
+
+    // Read the generation before computing so that a state change made
+    // concurrently with the computation leaves the entry stale.
+    unsigned long long generation = cache_generation.load(std::memory_order_relaxed);
+    RelativeStateCache & cache = RelativeStateCache::local();
+    RelativeStateCache::Entry & entry = cache.slot(this, &wrt_frame);
+
+    if((entry.frame == this) && (entry.wrt_frame == &wrt_frame) && (entry.generation == generation))
+    {
+        rel_state.copy(entry.rel_state);
+        RelativeStateCache::count(cache.hits);
+        return;
+    }
+
+    compute_relative_state_uncached(wrt_frame, rel_state);
+    RelativeStateCache::count(cache.misses);
+
+    entry.frame = this;
+    entry.wrt_frame = &wrt_frame;
+    entry.generation = generation;
+    entry.rel_state.copy(rel_state);
+}
+
 /**
  * Compute the complete state of the invoking reference frame (*this)
  * with respect to the supplied wrt_frame reference frame.
@@ -57,7 +316,7 @@ namespace jeod
  * \param[in] wrt_frame The frame with respect to which the state is to be expressed
  * \param[out] rel_state The relative state
  */
-void RefFrame::compute_relative_state(const RefFrame & wrt_frame, RefFrameState & rel_state) const
+void RefFrame::compute_relative_state_uncached(const RefFrame & wrt_frame, RefFrameState & rel_state) const
 {
     int common_node_index;              /* Index of last node in common between
                                            this frame and the wrt_frame */
@@ -133,6 +392,84 @@ void RefFrame::compute_relative_state(const RefFrame & wrt_frame, RefFrameState
     }
 }
 
+/**
+ * Compute the relative states described by a list of requests. Each result
+ * is identical to that of compute_relative_state_uncached for the same pair
+ * of frames, but the state of a request's frame with respect to the last
+ * frame it has in common with the wrt_frame is computed once for a run of
+ * consecutive requests for the same frame and common frame. Ordering the
+ * requests so that those for the same frame are adjacent maximizes the
+ * sharing.
+ *
+ * \par Assumptions and Limitations
+ *  - The frames of each request are in the same tree.
+ *  - The relative state cache is neither used nor filled.
+ *  - Overrides of compute_relative_state are bypassed.
+ * \param[in] requests     The requests
+ * \param[in] num_requests Number of requests
+ */
+void RefFrame::compute_relative_states(const RelativeStateRequest * requests, unsigned int num_requests)
+{
+    RefFrameState common_state;                    // State of a frame wrt a common frame
+    const RefFrame * common_state_frame = nullptr; // Frame whose state is in common_state
+    int common_state_index = -1;                   // Index of the common frame of common_state
+
+    for(unsigned int ii = 0; ii < num_requests; ++ii)
+    {
+        const RefFrame & frame = *requests[ii].frame;
+        const RefFrame & wrt_frame = *requests[ii].wrt_frame;
+        RefFrameState & rel_state = *requests[ii].rel_state;
+
+        // Find the index of the node below which the path to the two frames diverge.
+        int common_node_index = frame.find_last_common_index(wrt_frame);
+
+        // A negative number indicates a *serious* problem.
+        if(common_node_index < 0)
+        {
+            MessageHandler::fail(__FILE__,
+                                 __LINE__,
+                                 RefFrameMessages::invalid_node,
+                                 "Frames '%s' and '%s' are not in the same tree",
+                                 frame.name.c_str(),
+                                 wrt_frame.name.c_str());
+
+            // Not reached
+            return;
+        }
+
+        const RefFrame * common_node_frame = frame.links.nth_from_root(common_node_index);
+
+        // The same four cases as compute_relative_state_uncached.
+        if(&wrt_frame == &frame)
+        {
+            rel_state.initialize();
+        }
+        else if(common_node_frame == &frame)
+        {
+            wrt_frame.compute_pred_rel_state(common_node_index, rel_state);
+        }
+        else
+        {
+            // Compute the frame's state wrt the common frame unless the
+            // previous request left it in common_state.
+            if((common_state_frame != &frame) || (common_state_index != common_node_index))
+            {
+                frame.compute_state_wrt_pred(common_node_index, common_state);
+                common_state_frame = &frame;
+                common_state_index = common_node_index;
+            }
+            rel_state.copy(common_state);
+
+            // Move the relative state down to the wrt_frame, if it is not
+            // the common frame.
+            for(auto * link : TreeLinksDescentRange<const RefFrameLinks>(wrt_frame.links, common_node_index + 1))
+            {
+                rel_state.decr_left(link->container().state);
+            }
+        }
+    }
+}
+
 /**
  * Compute the complete state of the invoking reference frame (*this)
  * with respect to the supplied wrt_frame reference frame.
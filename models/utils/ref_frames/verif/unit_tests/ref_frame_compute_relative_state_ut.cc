@@ -16,3 +16,13 @@ TEST(RefFrame, compute_state_wrt_pred) {}
 TEST(RefFrame, compute_pred_rel_state) {}
 
 TEST(RefFrame, compute_position_from) {}
+
+TEST(RefFrame, compute_relative_state_uncached) {}
+
+TEST(RefFrame, compute_relative_states) {}
+
+TEST(RefFrame, set_relative_state_cache) {}
+
+TEST(RefFrame, get_relative_state_cache_hits) {}
+
+TEST(RefFrame, note_state_change) {}
@@ -0,0 +1,253 @@
+// Benchmark the relative state cache on a reference frame tree laid out as in
+// SIM_dyncomp: planet inertial and planet-fixed frames below the solar system
+// and Earth-Moon barycenters, and vehicles with composite body, structure,
+// core body, and vehicle point frames below the Earth inertial frame. Each step updates every frame and
+// then issues the relative state requests made by the gravity, derived state,
+// relative kinematics, and lighting models. The cached and uncached results
+// must agree exactly.
+// System includes
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/ref_frames/include/ref_frame.hh"
+#include "utils/ref_frames/include/ref_frame_state.hh"
+
+using namespace std;
+using namespace jeod;
+
+/**
+ * A planet, with its inertial and planet-fixed frames.
+ */
+struct Planet
+{
+    RefFrame inertial;
+    RefFrame pfix;
+};
+
+/**
+ * A vehicle, with the frames maintained by a DynBody.
+ */
+struct Vehicle
+{
+    RefFrame composite_body;
+    RefFrame structure;
+    RefFrame core_body;
+    RefFrame sensor_point;
+};
+
+/**
+ * Set a frame's state to a smooth function of time and stamp the frame.
+ */
+static void update_frame(RefFrame & frame, double time, double seed)
+{
+    RefFrameState & state = frame.state;
+    for(unsigned int ii = 0; ii < 3; ++ii)
+    {
+        state.trans.position[ii] = 1.0e6 * seed * sin(seed * (ii + 1) + 1.0e-3 * time);
+        state.trans.velocity[ii] = 1.0e3 * seed * cos(seed * (ii + 1) + 1.0e-3 * time);
+        state.rot.ang_vel_this[ii] = 1.0e-4 * seed * (ii + 1);
+    }
+    double half_angle = 0.5 * (seed + 1.0e-4 * time);
+    double axis[3] = {1.0 / sqrt(3.0), 1.0 / sqrt(3.0), 1.0 / sqrt(3.0)};
+    state.rot.Q_parent_this.scalar = cos(half_angle);
+    for(unsigned int ii = 0; ii < 3; ++ii)
+    {
+        state.rot.Q_parent_this.vector[ii] = -sin(half_angle) * axis[ii];
+    }
+    state.rot.compute_transformation();
+    state.rot.compute_ang_vel_products();
+    frame.set_timestamp(time);
+}
+
+/**
+ * Compare two states bit for bit.
+ */
+static bool same_state(const RefFrameState & a, const RefFrameState & b)
+{
+    return (memcmp(a.trans.position, b.trans.position, sizeof(a.trans.position)) == 0) &&
+           (memcmp(a.trans.velocity, b.trans.velocity, sizeof(a.trans.velocity)) == 0) &&
+           (memcmp(a.rot.T_parent_this, b.rot.T_parent_this, sizeof(a.rot.T_parent_this)) == 0) &&
+           (memcmp(a.rot.ang_vel_this, b.rot.ang_vel_this, sizeof(a.rot.ang_vel_this)) == 0) &&
+           (a.rot.Q_parent_this.scalar == b.rot.Q_parent_this.scalar) &&
+           (memcmp(a.rot.Q_parent_this.vector, b.rot.Q_parent_this.vector, sizeof(a.rot.Q_parent_this.vector)) == 0);
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_vehicles;
+    int num_steps;
+    int num_stages;
+    int num_repeats;
+
+    cmdline_parser.add_int("NumVehicles", 4, &num_vehicles);
+    cmdline_parser.add_int("NumSteps", 20000, &num_steps);
+    cmdline_parser.add_int("NumStages", 4, &num_stages);
+    cmdline_parser.add_int("NumRepeats", 1, &num_repeats);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_vehicles <= 0 || num_steps <= 0 || num_stages <= 0 || num_repeats <= 0)
+    {
+        cerr << "NumVehicles, NumSteps, NumStages, and NumRepeats must be positive." << endl;
+        return 1;
+    }
+
+    // Build the tree.
+    RefFrame ssb;
+    RefFrame em_bary;
+    Planet sun;
+    Planet earth;
+    Planet moon;
+    vector<Vehicle> vehicles(static_cast<unsigned int>(num_vehicles));
+
+    ssb.set_name("SSB.inertial");
+    ssb.make_root();
+    em_bary.set_name("EMBary.inertial");
+    ssb.add_child(em_bary);
+    Planet * planets[3] = {&sun, &earth, &moon};
+    const char * planet_names[3] = {"Sun", "Earth", "Moon"};
+    for(unsigned int ip = 0; ip < 3; ++ip)
+    {
+        planets[ip]->inertial.set_name(planet_names[ip], "inertial");
+        planets[ip]->pfix.set_name(planet_names[ip], "pfix");
+        ((ip == 0) ? ssb : em_bary).add_child(planets[ip]->inertial);
+        planets[ip]->inertial.add_child(planets[ip]->pfix);
+    }
+    for(unsigned int iv = 0; iv < vehicles.size(); ++iv)
+    {
+        string veh_name = "veh" + to_string(iv);
+        vehicles[iv].composite_body.set_name(veh_name, "composite_body");
+        vehicles[iv].structure.set_name(veh_name, "structure");
+        vehicles[iv].core_body.set_name(veh_name, "core_body");
+        vehicles[iv].sensor_point.set_name(veh_name, "sensor_point");
+        earth.inertial.add_child(vehicles[iv].composite_body);
+        vehicles[iv].composite_body.add_child(vehicles[iv].structure);
+        vehicles[iv].composite_body.add_child(vehicles[iv].core_body);
+        vehicles[iv].structure.add_child(vehicles[iv].sensor_point);
+    }
+
+    // The requests made at each integration stage.
+    vector<pair<const RefFrame *, const RefFrame *>> requests;
+    for(const Vehicle & veh : vehicles)
+    {
+        // Gravity: the integration frame is Earth inertial; each body's
+        // state relative to the integration frame is requested once per
+        // planet, and the planet-fixed attitude once per body.
+        for(const Planet * planet : planets)
+        {
+            requests.emplace_back(&veh.composite_body, &planet->inertial);
+            requests.emplace_back(&veh.composite_body, &earth.inertial);
+            requests.emplace_back(&planet->pfix, &planet->inertial);
+        }
+        // Derived states: orbital elements, LVLH, planetary, and Euler angles.
+        requests.emplace_back(&veh.composite_body, &earth.inertial);
+        requests.emplace_back(&veh.composite_body, &earth.inertial);
+        requests.emplace_back(&veh.composite_body, &earth.pfix);
+        requests.emplace_back(&veh.structure, &earth.pfix);
+        // Lighting and radiation pressure.
+        requests.emplace_back(&sun.inertial, &veh.structure);
+        requests.emplace_back(&sun.inertial, &veh.structure);
+        requests.emplace_back(&earth.inertial, &veh.structure);
+        requests.emplace_back(&moon.inertial, &veh.structure);
+        requests.emplace_back(&sun.inertial, &veh.sensor_point);
+        // Relative kinematics between vehicles.
+        for(const Vehicle & other : vehicles)
+        {
+            if(&other != &veh)
+            {
+                requests.emplace_back(&veh.structure, &other.structure);
+            }
+        }
+    }
+
+    vector<RefFrameState> results[2];
+    double elapsed_ms[2] = {0.0, 0.0};
+    unsigned long long hits = 0;
+    unsigned long long misses = 0;
+    RefFrameState rel_state;
+
+    for(unsigned int pass = 0; pass < 2; ++pass)
+    {
+        bool use_cache = (pass == 1);
+        RefFrame::set_relative_state_cache(use_cache);
+        RefFrame::reset_relative_state_cache_stats();
+        results[pass].reserve(requests.size());
+
+        for(int step = 0; step < num_steps; ++step)
+        {
+            for(int stage = 0; stage < num_stages; ++stage)
+            {
+                double time = step + stage / static_cast<double>(num_stages);
+
+                // Planet updates happen once per step; vehicle updates once
+                // per integration stage.
+                if(stage == 0)
+                {
+                    update_frame(em_bary, time, 0.05);
+                    for(unsigned int ip = 0; ip < 3; ++ip)
+                    {
+                        update_frame(planets[ip]->inertial, time, 0.1 * (ip + 1));
+                        update_frame(planets[ip]->pfix, time, 0.2 * (ip + 1));
+                    }
+                }
+                for(unsigned int iv = 0; iv < vehicles.size(); ++iv)
+                {
+                    update_frame(vehicles[iv].composite_body, time, 0.3 + 0.01 * iv);
+                    update_frame(vehicles[iv].structure, time, 0.4 + 0.01 * iv);
+                    update_frame(vehicles[iv].core_body, time, 0.5 + 0.01 * iv);
+                    update_frame(vehicles[iv].sensor_point, time, 0.6 + 0.01 * iv);
+                }
+
+                // Each set of requests is issued num_repeats times per stage,
+                // as by several models that need the same relative states.
+                auto start = chrono::steady_clock::now();
+                for(int repeat = 0; repeat < num_repeats; ++repeat)
+                {
+                    for(const auto & request : requests)
+                    {
+                        request.first->compute_relative_state(*request.second, rel_state);
+                        if((repeat == 0) && (step == num_steps - 1) && (stage == num_stages - 1))
+                        {
+                            results[pass].push_back(rel_state);
+                        }
+                    }
+                }
+                auto stop = chrono::steady_clock::now();
+                elapsed_ms[pass] += chrono::duration<double, milli>(stop - start).count();
+            }
+        }
+
+        if(use_cache)
+        {
+            hits = RefFrame::get_relative_state_cache_hits();
+            misses = RefFrame::get_relative_state_cache_misses();
+        }
+    }
+    RefFrame::set_relative_state_cache(false);
+
+    unsigned int num_diff = 0;
+    for(unsigned int ii = 0; ii < requests.size(); ++ii)
+    {
+        num_diff += same_state(results[0][ii], results[1][ii]) ? 0 : 1;
+    }
+
+    double num_requests = static_cast<double>(requests.size()) * num_repeats * num_steps * num_stages;
+    cout << vehicles.size() << " vehicles, " << requests.size() * num_repeats << " requests per stage, " << num_steps
+         << " steps of " << num_stages << " stages" << endl;
+    cout << fixed << setprecision(1);
+    cout << "  uncached: " << setw(8) << 1.0e6 * elapsed_ms[0] / num_requests << " ns/request" << endl;
+    cout << "  cached:   " << setw(8) << 1.0e6 * elapsed_ms[1] / num_requests << " ns/request, " << hits
+         << " hits, " << misses << " misses (" << 100.0 * hits / (hits + misses) << "% hit rate)" << endl;
+    cout << "  " << num_diff << " differences" << endl;
+
+    return (num_diff == 0) ? 0 : 1;
+}
@@ -0,0 +1,308 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2025 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/include/binary_checkpoint.hh
+ * Define classes BinaryCheckpointWriter and BinaryCheckpointReader, which
+ * write and read the binary form of a checkpoint file section.
+ */
+
+/*
+ PURPOSE: ()
+*/
+
+#ifndef JEOD_BINARY_CHECKPOINT_HH
+#define JEOD_BINARY_CHECKPOINT_HH
+
+// System includes
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+//! Namespace jeod
+namespace jeod
+{
+
+class JeodCheckpointable;
+
+/**
+ A BinaryCheckpointWriter writes the binary form of a checkpoint file section
+ to the stream, typically a SectionedOutputStream, supplied at construction.
+
+ The section starts with a text line that identifies the format. What follows
+ is a sequence of length-prefixed blocks, each optionally compressed with the
+ LZ4 block format, that carry a byte stream of records. Numbers are written in
+ the byte order of the machine, which the reader checks. Every newline byte in
+ the section is followed by a 0x01 byte so that no line in the section can be
+ mistaken for a section marker.
+
+ This class is not extensible.
+ */
+class BinaryCheckpointWriter
+{
+public:
+    /**
+     * Default size of the uncompressed content of a block.
+     */
+    static const std::size_t default_block_size = 1024 * 1024;
+
+    // Constructor.
+    BinaryCheckpointWriter(std::ostream & stream, bool compress, std::size_t block_size = default_block_size);
+
+    // Destructor.
+    ~BinaryCheckpointWriter();
+
+    BinaryCheckpointWriter(const BinaryCheckpointWriter &) = delete;
+    BinaryCheckpointWriter & operator=(const BinaryCheckpointWriter &) = delete;
+
+    // Write raw bytes.
+    void write(const void * data, std::size_t nbytes);
+
+    /**
+     * Write an unsigned byte.
+     */
+    void write_u8(uint8_t value)
+    {
+        write(&value, sizeof(value));
+    }
+
+    /**
+     * Write an unsigned 32 bit integer.
+     */
+    void write_u32(uint32_t value)
+    {
+        write(&value, sizeof(value));
+    }
+
+    /**
+     * Write an unsigned 64 bit integer.
+     */
+    void write_u64(uint64_t value)
+    {
+        write(&value, sizeof(value));
+    }
+
+    // Write a length-prefixed string.
+    void write_string(const std::string & value);
+
+    // Write the contents of a checkpointable object as a record.
+    void write_checkpointable(const std::string & identifier, JeodCheckpointable & checkpointable);
+
+    // Write the last block and the end of the section.
+    void finish();
+
+    /**
+     * Have all writes to the stream succeeded?
+     */
+    bool good() const
+    {
+        return stream.good();
+    }
+
+private:
+    // Compress, escape, and write the pending block.
+    void flush_block();
+
+    // Write bytes to the stream, escaping newlines.
+    void write_escaped(const char * data, std::size_t nbytes);
+
+    // Member data
+
+    /**
+     * The stream that receives the section.
+     */
+    std::ostream & stream;
+
+    /**
+     * Uncompressed content of the block being filled.
+     */
+    std::vector<char> block;
+
+    /**
+     * Work area for the compressed and escaped forms of a block.
+     */
+    std::vector<char> work;
+
+    /**
+     * Uncompressed size at which a block is written.
+     */
+    std::size_t block_size;
+
+    /**
+     * Compress blocks that the LZ4 block format makes smaller?
+     */
+    bool compress;
+
+    /**
+     * Has the end of the section been written?
+     */
+    bool finished{};
+};
+
+/**
+ A BinaryCheckpointReader reads a checkpoint file section written by a
+ BinaryCheckpointWriter from the stream, typically a SectionedInputStream,
+ supplied at construction.
+
+ Errors in the section put the reader in a failed state, after which all
+ reads fail. Diagnosing the failure is the responsibility of the caller.
+
+ This class is not extensible.
+ */
+class BinaryCheckpointReader
+{
+public:
+    // Determine whether the section read by the stream is in binary form.
+    static bool is_binary_section(std::istream & stream, std::string & first_line);
+
+    // Constructor.
+    explicit BinaryCheckpointReader(std::istream & stream);
+
+    ~BinaryCheckpointReader() = default;
+    BinaryCheckpointReader(const BinaryCheckpointReader &) = delete;
+    BinaryCheckpointReader & operator=(const BinaryCheckpointReader &) = delete;
+
+    // Read raw bytes.
+    bool read(void * data, std::size_t nbytes);
+
+    // Skip raw bytes.
+    bool skip(std::size_t nbytes);
+
+    /**
+     * Read an unsigned byte.
+     */
+    bool read_u8(uint8_t & value)
+    {
+        return read(&value, sizeof(value));
+    }
+
+    /**
+     * Read an unsigned 32 bit integer.
+     */
+    bool read_u32(uint32_t & value)
+    {
+        return read(&value, sizeof(value));
+    }
+
+    /**
+     * Read an unsigned 64 bit integer.
+     */
+    bool read_u64(uint64_t & value)
+    {
+        return read(&value, sizeof(value));
+    }
+
+    // Read a length-prefixed string.
+    bool read_string(std::string & value);
+
+    // Restore a checkpointable object from the record that follows its identifier.
+    int restore_checkpointable(JeodCheckpointable * checkpointable);
+
+    // Have all of the records been read?
+    bool at_end();
+
+    /**
+     * Have all reads from the section succeeded?
+     */
+    bool good() const
+    {
+        return !failed;
+    }
+
+private:
+    // Read the next block.
+    bool load_block();
+
+    // Read bytes from the stream, removing the escapes written with newlines.
+    bool read_escaped(char * data, std::size_t nbytes);
+
+    // Member data
+
+    /**
+     * The stream that reads the section.
+     */
+    std::istream & stream;
+
+    /**
+     * Uncompressed content of the current block.
+     */
+    std::vector<char> block;
+
+    /**
+     * Compressed content of the current block.
+     */
+    std::vector<char> work;
+
+    /**
+     * Position of the next unread byte in the current block.
+     */
+    std::size_t block_pos{};
+
+    /**
+     * Was the last byte read from the stream a newline?
+     */
+    bool after_newline{};
+
+    /**
+     * Has the end of the section been reached?
+     */
+    bool end_seen{};
+
+    /**
+     * Has a read failed?
+     */
+    bool failed{};
+};
+
+} // namespace jeod
+
+#endif
+
+/**
+ * @}
+ * @}
+ * @}
+ */
@@ -130,6 +130,9 @@ private:
     // Get a character (future: set of characters) from the file buffer.
     std::streambuf::int_type underflow() override;
 
+    // Get a sequence of characters from the file buffer.
+    std::streamsize xsgetn(char * s, std::streamsize count) override;
+
     // Member data
 
     /**
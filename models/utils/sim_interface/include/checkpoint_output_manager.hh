@@ -132,6 +132,9 @@ private:
     // Write a character to the file when the output buffer overflows.
     std::streambuf::int_type overflow(std::streambuf::int_type c) override;
 
+    // Write a sequence of characters to the file.
+    std::streamsize xsputn(const char * s, std::streamsize count) override;
+
     // Member data
 
     /**
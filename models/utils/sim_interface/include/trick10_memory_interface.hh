@@ -160,6 +160,18 @@ public:
     // Restore the allocated data per the checkpoint file.
     void restore_allocations(JeodMemoryManager & memory_manager) override;
 
+    /**
+     * Select the form of the JEOD_containers and JEOD_allocations sections
+     * written by subsequent checkpoints. Restarts read either form.
+     * \param[in] binary Write the binary form rather than text?
+     * \param[in] compress Compress the blocks of the binary form?
+     */
+    void set_binary_checkpoint(bool binary, bool compress)
+    {
+        binary_checkpoint = binary;
+        compress_checkpoint = compress;
+    }
+
 protected:
     // Member functions
 
@@ -174,6 +186,16 @@ protected:
      * Trick checkpoint agent.
      */
     Trick::ClassicCheckPointAgent * trick_checkpoint_agent; //!< trick_io(**)
+
+    /**
+     * Write the JEOD checkpoint sections in binary form?
+     */
+    bool binary_checkpoint{}; //!< trick_units(--)
+
+    /**
+     * Compress the blocks of binary checkpoint sections?
+     */
+    bool compress_checkpoint{}; //!< trick_units(--)
 };
 
 } // namespace jeod
@@ -113,6 +113,16 @@ public:
         return checkpoint_file_name;
     }
 
+    /**
+     * Select the binary form of the JEOD checkpoint sections, which
+     * holds primitive container contents as raw bytes in optionally
+     * compressed blocks, or the default text form.
+     */
+    void set_binary_checkpoint(bool binary, bool compress = false)
+    {
+        trick_memory_interface.set_binary_checkpoint(binary, compress);
+    }
+
     // The next set of functions are public because they are called by the
     // JEODSysSimObject sim object (see).
     // DO NOT call from Python.
@@ -0,0 +1,739 @@
+/**
+ * @addtogroup Models
+ * @{
+ * @addtogroup Utils
+ * @{
+ * @addtogroup SimInterface
+ * @{
+ *
+ * @file models/utils/sim_interface/src/binary_checkpoint.cc
+ * Define BinaryCheckpointWriter and BinaryCheckpointReader member functions.
+ */
+
+/*
+ PURPOSE:
+   ()
+*/
+
+// System includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// JEOD includes
+#include "utils/container/include/checkpointable.hh"
+
+// Model includes
+#include "../include/binary_checkpoint.hh"
+
+//! Namespace jeod
+namespace jeod
+{
+
+namespace
+{
+// The line that starts a binary section.
+const char section_magic[] = "JEOD binary checkpoint v1";
+
+// Written after the magic line in the byte order of the writer.
+const uint32_t byte_order_mark = 0x4a454f44;
+
+// Block and record markers.
+const char block_marker = 'B';
+const char end_marker = 'E';
+const uint8_t compressed_flag = 1;
+const uint8_t action_record = 'A';
+const uint8_t raw_record = 'R';
+
+// Size of the header that follows a block marker.
+const std::size_t block_header_size = 9;
+
+// Upper bound on the uncompressed size of a block, a sanity check on input.
+const uint32_t max_block_size = 1U << 30;
+
+// Constants of the LZ4 block format.
+const std::size_t lz4_min_match = 4;
+const std::size_t lz4_last_literals = 5;
+const std::size_t lz4_match_limit = 12;
+const std::size_t lz4_max_offset = 65535;
+const unsigned int lz4_hash_bits = 12;
+
+uint32_t read_u32_at(const char * ptr)
+{
+    uint32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+// Append an LZ4 length continuation, the length less the 15 held by the token.
+char * put_length(char * op, std::size_t length)
+{
+    for(; length >= 255; length -= 255)
+    {
+        *op++ = static_cast<char>(255);
+    }
+    *op++ = static_cast<char>(length);
+    return op;
+}
+
+/**
+ * Compress in the LZ4 block format.
+ * @return Compressed size, zero if that would not be smaller than the input.
+ * \param[in] src Uncompressed data
+ * \param[in] nbytes Size of the uncompressed data
+ * \param[out] dst Compressed data, at least nbytes long
+ */
+std::size_t lz4_compress(const char * src, std::size_t nbytes, char * dst)
+{
+    uint32_t table[1U << lz4_hash_bits] = {};
+    char * op = dst;
+    char * const op_limit = dst + nbytes;
+    std::size_t anchor = 0;
+    std::size_t ip = 0;
+
+    // Emit a sequence, with a match unless match_len is zero.
+    auto emit = [&](std::size_t literal_len, std::size_t offset, std::size_t match_len) -> bool
+    {
+        if(static_cast<std::size_t>(op_limit - op) < literal_len + literal_len / 255 + match_len / 255 + 8)
+        {
+            return false;
+        }
+        char * token = op++;
+        *token = static_cast<char>(std::min<std::size_t>(literal_len, 15) << 4);
+        if(literal_len >= 15)
+        {
+            op = put_length(op, literal_len - 15);
+        }
+        std::memcpy(op, src + anchor, literal_len);
+        op += literal_len;
+        if(match_len != 0)
+        {
+            *op++ = static_cast<char>(offset & 0xff);
+            *op++ = static_cast<char>(offset >> 8);
+            std::size_t extra = match_len - lz4_min_match;
+            *token = static_cast<char>(*token | std::min<std::size_t>(extra, 15));
+            if(extra >= 15)
+            {
+                op = put_length(op, extra - 15);
+            }
+        }
+        return true;
+    };
+
+    if(nbytes > lz4_match_limit)
+    {
+        const std::size_t match_start_limit = nbytes - lz4_match_limit;
+        const std::size_t match_end_limit = nbytes - lz4_last_literals;
+        while(ip < match_start_limit)
+        {
+            uint32_t sequence = read_u32_at(src + ip);
+            uint32_t hash = (sequence * 2654435761U) >> (32 - lz4_hash_bits);
+            // Table entries hold position + 1 so that zero means empty.
+            std::size_t candidate = table[hash];
+            table[hash] = static_cast<uint32_t>(ip + 1);
+
+            if((candidate != 0) && (ip + 1 - candidate <= lz4_max_offset) &&
+               (read_u32_at(src + candidate - 1) == sequence))
+            {
+                std::size_t ref = candidate - 1;
+                std::size_t match_len = lz4_min_match;
+                while((ip + match_len < match_end_limit) && (src[ref + match_len] == src[ip + match_len]))
+                {
+                    ++match_len;
+                }
+                if(!emit(ip - anchor, ip - ref, match_len))
+                {
+                    return 0;
+                }
+                ip += match_len;
+                anchor = ip;
+            }
+            else
+            {
+                // Step faster through data that does not compress.
+                ip += 1 + ((ip - anchor) >> 6);
+            }
+        }
+    }
+
+    if(!emit(nbytes - anchor, 0, 0))
+    {
+        return 0;
+    }
+    return static_cast<std::size_t>(op - dst);
+}
+
+/**
+ * Decompress data in the LZ4 block format.
+ * @return True if the input decompresses to exactly out_size bytes.
+ * \param[in] src Compressed data
+ * \param[in] nbytes Size of the compressed data
+ * \param[out] dst Uncompressed data
+ * \param[in] out_size Size of the uncompressed data
+ */
+bool lz4_decompress(const char * src, std::size_t nbytes, char * dst, std::size_t out_size)
+{
+    std::size_t ip = 0;
+    std::size_t op = 0;
+
+    // Add a length continuation to length.
+    auto get_length = [&](std::size_t & length) -> bool
+    {
+        unsigned char byte;
+        do
+        {
+            if(ip >= nbytes)
+            {
+                return false;
+            }
+            byte = static_cast<unsigned char>(src[ip++]);
+            length += byte;
+        } while(byte == 255);
+        return true;
+    };
+
+    while(ip < nbytes)
+    {
+        auto token = static_cast<unsigned char>(src[ip++]);
+
+        std::size_t literal_len = token >> 4;
+        if((literal_len == 15) && !get_length(literal_len))
+        {
+            return false;
+        }
+        if((literal_len > nbytes - ip) || (literal_len > out_size - op))
+        {
+            return false;
+        }
+        std::memcpy(dst + op, src + ip, literal_len);
+        ip += literal_len;
+        op += literal_len;
+
+        // The last sequence has literals only.
+        if(ip == nbytes)
+        {
+            break;
+        }
+
+        if(nbytes - ip < 2)
+        {
+            return false;
+        }
+        std::size_t offset = static_cast<unsigned char>(src[ip]) | (static_cast<unsigned char>(src[ip + 1]) << 8);
+        ip += 2;
+        std::size_t match_len = token & 15;
+        if((match_len == 15) && !get_length(match_len))
+        {
+            return false;
+        }
+        match_len += lz4_min_match;
+        if((offset == 0) || (offset > op) || (match_len > out_size - op))
+        {
+            return false;
+        }
+
+        // Matches may overlap the bytes they produce.
+        if(offset >= match_len)
+        {
+            std::memcpy(dst + op, dst + op - offset, match_len);
+            op += match_len;
+        }
+        else
+        {
+            for(std::size_t ii = 0; ii < match_len; ++ii, ++op)
+            {
+                dst[op] = dst[op - offset];
+            }
+        }
+    }
+
+    return op == out_size;
+}
+} // namespace
+
+/**
+ * Construct a BinaryCheckpointWriter and write the start of the section.
+ * \param[in,out] stream_in Stream that receives the section
+ * \param[in] compress_in Compress blocks?
+ * \param[in] block_size_in Uncompressed size of a block
+ */
+BinaryCheckpointWriter::BinaryCheckpointWriter(std::ostream & stream_in, bool compress_in, std::size_t block_size_in)
+    : stream(stream_in),
+      block_size(std::max<std::size_t>(block_size_in, 1)),
+      compress(compress_in)
+{
+    block.reserve(block_size);
+    std::string header(section_magic);
+    header += '\n';
+    write_escaped(header.data(), header.size());
+    write_escaped(reinterpret_cast<const char *>(&byte_order_mark), sizeof(byte_order_mark));
+}
+
+/**
+ * Destruct a BinaryCheckpointWriter, finishing the section if need be.
+ */
+BinaryCheckpointWriter::~BinaryCheckpointWriter()
+{
+    finish();
+}
+
+/**
+ * Write raw bytes, which are blocked and written when a block fills.
+ * \param[in] data Bytes to be written
+ * \param[in] nbytes Number of bytes
+ */
+void BinaryCheckpointWriter::write(const void * data, std::size_t nbytes)
+{
+    const char * bytes = static_cast<const char *>(data);
+    while(nbytes > 0)
+    {
+        std::size_t count = std::min(nbytes, block_size - block.size());
+        block.insert(block.end(), bytes, bytes + count);
+        bytes += count;
+        nbytes -= count;
+        if(block.size() == block_size)
+        {
+            flush_block();
+        }
+    }
+}
+
+/**
+ * Write a string as its length followed by its characters.
+ * \param[in] value String to be written
+ */
+void BinaryCheckpointWriter::write_string(const std::string & value)
+{
+    write_u32(static_cast<uint32_t>(value.size()));
+    write(value.data(), value.size());
+}
+
+/**
+ * Write the contents of a checkpointable object as a record that starts with
+ * the identifier of the object.
+ *
+ * Objects with a binary form are written as a raw record: the init action,
+ * the contents as written by the object, and the final action. All others
+ * are written as an action record that holds the same actions, as name and
+ * value strings, as the text form of the section.
+ * \param[in] identifier Identifier of the object
+ * \param[in,out] checkpointable The object
+ */
+void BinaryCheckpointWriter::write_checkpointable(const std::string & identifier, JeodCheckpointable & checkpointable)
+{
+    write_string(identifier);
+
+    std::size_t elem_size = checkpointable.get_binary_element_size();
+    const std::string & init_action = checkpointable.get_init_name();
+    if(elem_size != 0)
+    {
+        write_u8(raw_record);
+        write_string(init_action);
+        write_string(init_action.empty() ? std::string() : checkpointable.get_init_value());
+        write_u32(static_cast<uint32_t>(elem_size));
+        write_u64(checkpointable.get_binary_element_count());
+        checkpointable.write_binary_contents(*this);
+        const std::string & final_action = checkpointable.get_final_name();
+        write_string(final_action);
+        write_string(final_action.empty() ? std::string() : checkpointable.get_final_value());
+        return;
+    }
+
+    write_u8(action_record);
+    if(!init_action.empty())
+    {
+        write_u8(1);
+        write_string(init_action);
+        write_string(checkpointable.get_init_value());
+    }
+    for(checkpointable.start_checkpoint(); !checkpointable.is_checkpoint_finished();
+        checkpointable.advance_checkpoint())
+    {
+        write_u8(1);
+        write_string(checkpointable.get_item_name());
+        write_string(checkpointable.get_item_value());
+    }
+    const std::string & final_action = checkpointable.get_final_name();
+    if(!final_action.empty())
+    {
+        write_u8(1);
+        write_string(final_action);
+        write_string(checkpointable.get_final_value());
+    }
+    write_u8(0);
+}
+
+/**
+ * Write the pending block, if any, and the end of the section.
+ * Nothing can be written after the section is finished.
+ */
+void BinaryCheckpointWriter::finish()
+{
+    if(finished)
+    {
+        return;
+    }
+    if(!block.empty())
+    {
+        flush_block();
+    }
+    write_escaped(&end_marker, 1);
+    finished = true;
+}
+
+/**
+ * Write the pending block, compressed if that makes it smaller.
+ */
+void BinaryCheckpointWriter::flush_block()
+{
+    auto raw_size = static_cast<uint32_t>(block.size());
+    uint8_t flags = 0;
+    const char * payload = block.data();
+    std::size_t stored_size = block.size();
+
+    if(compress)
+    {
+        work.resize(block.size());
+        std::size_t packed_size = lz4_compress(block.data(), block.size(), work.data());
+        if(packed_size != 0)
+        {
+            flags = compressed_flag;
+            payload = work.data();
+            stored_size = packed_size;
+        }
+    }
+
+    char header[1 + block_header_size];
+    auto stored_size_32 = static_cast<uint32_t>(stored_size);
+    header[0] = block_marker;
+    header[1] = static_cast<char>(flags);
+    std::memcpy(header + 2, &raw_size, sizeof(raw_size));
+    std::memcpy(header + 6, &stored_size_32, sizeof(stored_size_32));
+    write_escaped(header, sizeof(header));
+    write_escaped(payload, stored_size);
+    block.clear();
+}
+
+/**
+ * Write bytes to the stream, following each newline with a 0x01 byte.
+ * \param[in] data Bytes to be written
+ * \param[in] nbytes Number of bytes
+ */
+void BinaryCheckpointWriter::write_escaped(const char * data, std::size_t nbytes)
+{
+    const char * end = data + nbytes;
+    while(data < end)
+    {
+        const auto * newline = static_cast<const char *>(std::memchr(data, '\n', end - data));
+        if(newline == nullptr)
+        {
+            stream.write(data, end - data);
+            break;
+        }
+        stream.write(data, newline - data);
+        stream.write("\n\x01", 2);
+        data = newline + 1;
+    }
+}
+
+/**
+ * Determine whether the section read by the stream is in binary form.
+ * Leading blank lines are skipped. On return, the stream is positioned
+ * after the first non-blank line.
+ * @return True if the section is in binary form.
+ * \param[in,out] stream Stream that reads the section
+ * \param[out] first_line First non-blank line of a text section
+ */
+bool BinaryCheckpointReader::is_binary_section(std::istream & stream, std::string & first_line)
+{
+    first_line.clear();
+    while(first_line.empty() && std::getline(stream, first_line))
+    {
+    }
+    return first_line == section_magic;
+}
+
+/**
+ * Construct a BinaryCheckpointReader from a stream positioned after the
+ * first line of a binary section.
+ * \param[in,out] stream_in Stream that reads the section
+ */
+BinaryCheckpointReader::BinaryCheckpointReader(std::istream & stream_in)
+    : stream(stream_in),
+      after_newline(true)
+{
+    uint32_t mark = 0;
+    failed = !read_escaped(reinterpret_cast<char *>(&mark), sizeof(mark)) || (mark != byte_order_mark);
+}
+
+/**
+ * Read raw bytes.
+ * @return True if all of the bytes were read.
+ * \param[out] data Bytes read
+ * \param[in] nbytes Number of bytes
+ */
+bool BinaryCheckpointReader::read(void * data, std::size_t nbytes)
+{
+    char * bytes = static_cast<char *>(data);
+    while(nbytes > 0)
+    {
+        if((block_pos == block.size()) && !load_block())
+        {
+            failed = true;
+            return false;
+        }
+        std::size_t count = std::min(nbytes, block.size() - block_pos);
+        std::memcpy(bytes, block.data() + block_pos, count);
+        block_pos += count;
+        bytes += count;
+        nbytes -= count;
+    }
+    return !failed;
+}
+
+/**
+ * Skip raw bytes.
+ * @return True if all of the bytes were skipped.
+ * \param[in] nbytes Number of bytes
+ */
+bool BinaryCheckpointReader::skip(std::size_t nbytes)
+{
+    while(nbytes > 0)
+    {
+        if((block_pos == block.size()) && !load_block())
+        {
+            failed = true;
+            return false;
+        }
+        std::size_t count = std::min(nbytes, block.size() - block_pos);
+        block_pos += count;
+        nbytes -= count;
+    }
+    return !failed;
+}
+
+/**
+ * Read a string written as its length followed by its characters.
+ * @return True if the string was read.
+ * \param[out] value String read
+ */
+bool BinaryCheckpointReader::read_string(std::string & value)
+{
+    uint32_t length;
+    if(!read_u32(length))
+    {
+        return false;
+    }
+    value.resize(length);
+    return (length == 0) || read(&value[0], length);
+}
+
+/**
+ * Restore a checkpointable object from the record that follows its identifier.
+ * The record is read and discarded if the object is null.
+ * @return Zero if the object was restored, non-zero otherwise.
+ * \param[in,out] checkpointable The object, or null
+ */
+int BinaryCheckpointReader::restore_checkpointable(JeodCheckpointable * checkpointable)
+{
+    int status = 0;
+    uint8_t record_type = 0;
+    std::string action;
+    std::string value;
+
+    // Perform an action that was read, noting failures.
+    auto perform = [&]()
+    {
+        if((checkpointable != nullptr) && !action.empty() &&
+           (checkpointable->perform_restore_action(action, value) != 0))
+        {
+            status = 1;
+        }
+    };
+
+    if(!read_u8(record_type))
+    {
+        return 1;
+    }
+
+    if(record_type == action_record)
+    {
+        uint8_t more;
+        while(read_u8(more) && (more != 0))
+        {
+            if(!read_string(action) || !read_string(value))
+            {
+                break;
+            }
+            perform();
+        }
+    }
+    else if(record_type == raw_record)
+    {
+        uint32_t elem_size;
+        uint64_t count;
+        if(read_string(action) && read_string(value))
+        {
+            perform();
+        }
+        if(read_u32(elem_size) && read_u64(count))
+        {
+            // The contents are restored only if the object agrees on their layout.
+            if((checkpointable != nullptr) && (checkpointable->get_binary_element_size() == elem_size))
+            {
+                if(checkpointable->perform_binary_restore(*this, count) != 0)
+                {
+                    status = 1;
+                }
+            }
+            else
+            {
+                status = 1;
+                skip(elem_size * count);
+            }
+        }
+        if(read_string(action) && read_string(value))
+        {
+            perform();
+        }
+    }
+    else
+    {
+        failed = true;
+    }
+
+    return ((status != 0) || failed || (checkpointable == nullptr)) ? 1 : 0;
+}
+
+/**
+ * Determine whether all of the records in the section have been read.
+ * @return True at the end of the section or after a failure.
+ */
+bool BinaryCheckpointReader::at_end()
+{
+    while(!failed && !end_seen && (block_pos == block.size()))
+    {
+        if(!load_block())
+        {
+            failed = !end_seen;
+        }
+    }
+    return failed || (end_seen && (block_pos == block.size()));
+}
+
+/**
+ * Read the next block.
+ * @return True if a block was read, false at the end of the section or on
+ *         a malformed block.
+ */
+bool BinaryCheckpointReader::load_block()
+{
+    char marker;
+    char header[block_header_size];
+    uint32_t raw_size;
+    uint32_t stored_size;
+
+    if(end_seen || failed || !read_escaped(&marker, 1))
+    {
+        return false;
+    }
+    if(marker == end_marker)
+    {
+        end_seen = true;
+        return false;
+    }
+    if((marker != block_marker) || !read_escaped(header, sizeof(header)))
+    {
+        failed = true;
+        return false;
+    }
+
+    auto flags = static_cast<uint8_t>(header[0]);
+    std::memcpy(&raw_size, header + 1, sizeof(raw_size));
+    std::memcpy(&stored_size, header + 5, sizeof(stored_size));
+    if((raw_size > max_block_size) || (stored_size > raw_size) ||
+       ((flags & compressed_flag) == 0 && stored_size != raw_size))
+    {
+        failed = true;
+        return false;
+    }
+
+    block.resize(raw_size);
+    block_pos = 0;
+    if((flags & compressed_flag) == 0)
+    {
+        failed = !read_escaped(block.data(), raw_size);
+    }
+    else
+    {
+        work.resize(stored_size);
+        failed = !read_escaped(work.data(), stored_size) ||
+                 !lz4_decompress(work.data(), stored_size, block.data(), raw_size);
+    }
+    if(failed)
+    {
+        block.clear();
+    }
+    return !failed;
+}
+
+/**
+ * Read bytes from the stream, dropping the 0x01 byte that follows each newline.
+ * @return True if all of the bytes were read and the escapes were intact.
+ * \param[out] data Bytes read
+ * \param[in] nbytes Number of bytes
+ */
+bool BinaryCheckpointReader::read_escaped(char * data, std::size_t nbytes)
+{
+    std::size_t produced = 0;
+    while(produced < nbytes)
+    {
+        // Read what remains in place. Escapes make the result shorter.
+        char * dst = data + produced;
+        stream.read(dst, static_cast<std::streamsize>(nbytes - produced));
+        auto nread = static_cast<std::size_t>(stream.gcount());
+        if(nread == 0)
+        {
+            return false;
+        }
+
+        const char * src = dst;
+        const char * end = dst + nread;
+        char * out = dst;
+        while(src < end)
+        {
+            if(after_newline)
+            {
+                if(*src != '\x01')
+                {
+                    return false;
+                }
+                ++src;
+                after_newline = false;
+                continue;
+            }
+            const auto * newline = static_cast<const char *>(std::memchr(src, '\n', end - src));
+            const char * segment_end = (newline != nullptr) ? newline + 1 : end;
+            std::size_t length = segment_end - src;
+            if(out != src)
+            {
+                std::memmove(out, src, length);
+            }
+            out += length;
+            src = segment_end;
+            after_newline = (newline != nullptr);
+        }
+        produced += out - dst;
+    }
+    return true;
+}
+
+} // namespace jeod
+
+/**
+ * @}
+ * @}
+ * @}
+ */
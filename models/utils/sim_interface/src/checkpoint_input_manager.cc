@@ -16,6 +16,7 @@
 */
 
 // System includes
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <iostream>
@@ -109,6 +110,51 @@ std::streambuf::int_type SectionedInputBuffer::underflow()
     return result;
 }
 
+/**
+ * Get a sequence of characters, read straight from the file buffer rather
+ * than one at a time through underflow.
+ * @return Number of characters read, short of count at the end of the section.
+ * \param[out] s Characters read
+ * \param[in] count Number of characters requested
+ */
+std::streamsize SectionedInputBuffer::xsgetn(char * s, std::streamsize count)
+{
+    std::streamsize nread = 0;
+
+    // Hand over the character that underflow left in the get area, if any.
+    if((count > 0) && (this->gptr() < this->egptr()))
+    {
+        *s = *this->gptr();
+        this->gbump(1);
+        nread = 1;
+    }
+
+    // Protect against reads from an inoperable object.
+    if(!*this || (nread == count) || (curr_pos >= end_pos))
+    {
+        return nread;
+    }
+
+    // End of section *is* end of file.
+    std::streamsize nwanted = std::min<std::streamsize>(count - nread, end_pos - curr_pos);
+    try
+    {
+        std::streamsize ngot = file_buf->sgetn(s + nread, nwanted);
+        curr_pos += ngot;
+        nread += ngot;
+        if((ngot < nwanted) || (curr_pos >= end_pos))
+        {
+            at_eof = true;
+        }
+    }
+    catch(...)
+    {
+        at_eof = true;
+    }
+
+    return nread;
+}
+
 /**
  * Construct a SectionedInputStream object.
  * @note
@@ -104,6 +104,31 @@ std::streambuf::int_type SectionedOutputBuffer::overflow(std::streambuf::int_typ
     return result;
 }
 
+/**
+ * Write a sequence of characters, which go straight to the file buffer
+ * rather than one at a time through overflow.
+ * @return Number of characters written
+ * \param[in] s Characters to be written
+ * \param[in] count Number of characters
+ */
+std::streamsize SectionedOutputBuffer::xsputn(const char * s, std::streamsize count)
+{
+    // Protect against writes to an inoperable object.
+    if(!*this)
+    {
+        return 0;
+    }
+
+    try
+    {
+        return file_buf->sputn(s, count);
+    }
+    catch(...)
+    {
+        return 0;
+    }
+}
+
 /**
  * Construct a SectionedOutputStream object.
  * @note
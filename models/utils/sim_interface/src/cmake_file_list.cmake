@@ -1,6 +1,7 @@
 set(SUBDIR ${CMAKE_CURRENT_LIST_DIR})
 
 set(SRCS
+binary_checkpoint.cc
 trick_sim_interface.cc
 trick_memory_interface_alloc.cc
 trick10_memory_interface.cc
@@ -18,6 +18,7 @@ Purpose:
 Library Dependency:
   ((trick_memory_interface_chkpnt.cc)
    (trick10_memory_interface.cc)
+   (binary_checkpoint.cc)
    (utils/container/src/primitive_serializer.cc))
 
 
@@ -50,6 +51,7 @@ extern Trick::MemoryManager * trick_MM;
 #include "utils/message/include/message_handler.hh"
 
 // Model includes
+#include "../include/binary_checkpoint.hh"
 #include "../include/sim_interface_messages.hh"
 #include "../include/simulation_interface.hh"
 #include "../include/trick10_memory_interface.hh"
@@ -247,41 +249,54 @@ void JeodTrick10MemoryInterface::checkpoint_containers()
         return;
     }
 
-    // Checkpoint each of the containers.
-    for(auto & iter : container_list)
+    // Checkpoint each of the containers, as records of a binary section or
+    // as lines of the form identifier.action(value); in a text section.
+    if(binary_checkpoint)
     {
-        ContainerListEntry & entry = iter;
-
-        const std::string & identifier = get_container_id(entry);
-        JeodCheckpointable & checkpointable = iter.container;
-
-        // Add identifier.init_action() to the checkpoint section,
-        // but only if the init_action is not the empty string.
-        const std::string & init_action = checkpointable.get_init_name();
-        if(!init_action.empty())
+        BinaryCheckpointWriter binary_writer(writer, compress_checkpoint);
+        for(auto & entry : container_list)
         {
-            const std::string & value = checkpointable.get_init_value();
-            writer << identifier << "." << init_action << "(" << value << ");\n";
+            binary_writer.write_checkpointable(get_container_id(entry), entry.container);
         }
-
-        // Walk over the checkpointable, writing entries of the form
-        //    identifier.action(value)
-        // to the checkpoint section until the checkpointable says it is done.
-        for(checkpointable.start_checkpoint(); !checkpointable.is_checkpoint_finished();
-            checkpointable.advance_checkpoint())
+        binary_writer.finish();
+    }
+    else
+    {
+        for(auto & iter : container_list)
         {
-            const std::string & action = checkpointable.get_item_name();
-            const std::string & value = checkpointable.get_item_value();
-            writer << identifier << "." << action << "(" << value << ");\n";
-        }
+            ContainerListEntry & entry = iter;
 
-        // Add identifier.final_action() to the checkpoint section,
-        // but only if the final_action is not the empty string.
-        const std::string & final_action = checkpointable.get_final_name();
-        if(!final_action.empty())
-        {
-            const std::string & value = checkpointable.get_final_value();
-            writer << identifier << "." << final_action << "(" << value << ");\n";
+            const std::string & identifier = get_container_id(entry);
+            JeodCheckpointable & checkpointable = iter.container;
+
+            // Add identifier.init_action() to the checkpoint section,
+            // but only if the init_action is not the empty string.
+            const std::string & init_action = checkpointable.get_init_name();
+            if(!init_action.empty())
+            {
+                const std::string & value = checkpointable.get_init_value();
+                writer << identifier << "." << init_action << "(" << value << ");\n";
+            }
+
+            // Walk over the checkpointable, writing entries of the form
+            //    identifier.action(value)
+            // to the checkpoint section until the checkpointable says it is done.
+            for(checkpointable.start_checkpoint(); !checkpointable.is_checkpoint_finished();
+                checkpointable.advance_checkpoint())
+            {
+                const std::string & action = checkpointable.get_item_name();
+                const std::string & value = checkpointable.get_item_value();
+                writer << identifier << "." << action << "(" << value << ");\n";
+            }
+
+            // Add identifier.final_action() to the checkpoint section,
+            // but only if the final_action is not the empty string.
+            const std::string & final_action = checkpointable.get_final_name();
+            if(!final_action.empty())
+            {
+                const std::string & value = checkpointable.get_final_value();
+                writer << identifier << "." << final_action << "(" << value << ");\n";
+            }
         }
     }
 
@@ -340,12 +355,57 @@ void JeodTrick10MemoryInterface::restore_containers()
         return;
     }
 
+    // A binary section is a sequence of records, each of which starts with
+    // the identifier of the container that the record restores.
+    if(BinaryCheckpointReader::is_binary_section(reader, line))
+    {
+        BinaryCheckpointReader binary_reader(reader);
+        while(!binary_reader.at_end() && binary_reader.read_string(ident))
+        {
+            auto iter = container_map.find(ident);
+            JeodCheckpointable * checkpointable = (iter != container_map.end()) ? iter->second : nullptr;
+            int status = binary_reader.restore_checkpointable(checkpointable);
+
+            if(!binary_reader.good())
+            {
+                break;
+            }
+            else if(checkpointable == nullptr)
+            {
+                MessageHandler::error(__FILE__,
+                                      __LINE__,
+                                      SimInterfaceMessages::interface_error,
+                                      "Unable to find container '%s' in binary checkpoint section\n"
+                                      "Skipping processing of its record.",
+                                      ident.c_str());
+            }
+            else if(status != 0)
+            {
+                MessageHandler::error(__FILE__,
+                                      __LINE__,
+                                      SimInterfaceMessages::interface_error,
+                                      "Processing failed for binary checkpoint record of '%s'",
+                                      ident.c_str());
+            }
+        }
+
+        if(!binary_reader.good())
+        {
+            MessageHandler::error(__FILE__,
+                                  __LINE__,
+                                  SimInterfaceMessages::interface_error,
+                                  "Badly formatted binary checkpoint section JEOD_containers\n"
+                                  "Skipping processing of the rest of the section.");
+        }
+        line.clear();
+    }
+
     // Read lines from the container checkpoint section.
     // Non-blank lines are of the form identifier.action (value).
     // Split each non-blank line into identifier, action, and value strings
     // and then direct the container corresponding to the identifier to perform
-    // the indicated action.
-    while(std::getline(reader, line))
+    // the indicated action. The first line was read above.
+    for(bool have_line = !line.empty(); have_line; have_line = static_cast<bool>(std::getline(reader, line)))
     {
         // Skip blank lines.
         if(line.length() != 0)
@@ -443,7 +503,27 @@ void JeodTrick10MemoryInterface::checkpoint_allocations()
         checkpointable.pre_checkpoint();
     }
 
-    // Record data allocations.
+    // Record data allocations in a binary section as records of the mangled
+    // type name, the identifier, the size, and whether it is an array.
+    if(binary_checkpoint)
+    {
+        BinaryCheckpointWriter binary_writer(writer, compress_checkpoint);
+        for(auto & iter : allocation_map)
+        {
+            const AllocationMapEntry & entry = iter.second;
+            if(JeodMemoryManager::get_type_descriptor(entry.typeid_info) != nullptr)
+            {
+                binary_writer.write_string(entry.typeid_info.name());
+                binary_writer.write_u32(iter.first);
+                binary_writer.write_u32(entry.nelements);
+                binary_writer.write_u8(entry.is_array ? 1 : 0);
+            }
+        }
+        binary_writer.finish();
+        return;
+    }
+
+    // Record data allocations in a text section.
     for(auto & iter : allocation_map)
     {
         uint32_t unique_id = iter.first;
@@ -513,9 +593,34 @@ void JeodTrick10MemoryInterface::restore_allocations(JeodMemoryManager & memory_
     // Clear all allocated memory.
     memory_manager.restart_clear_memory();
 
+    // A binary section comprises records of the mangled type name,
+    // the identifier, the size, and whether the allocation is an array.
+    if(BinaryCheckpointReader::is_binary_section(reader, line))
+    {
+        BinaryCheckpointReader binary_reader(reader);
+        uint8_t array_flag;
+        while(!binary_reader.at_end() && binary_reader.read_string(mangled_type_name) &&
+              binary_reader.read_u32(unique_id) && binary_reader.read_u32(nelements) &&
+              binary_reader.read_u8(array_flag))
+        {
+            memory_manager.restart_reallocate(mangled_type_name, unique_id, nelements, array_flag != 0);
+        }
+
+        if(!binary_reader.good())
+        {
+            MessageHandler::error(__FILE__,
+                                  __LINE__,
+                                  SimInterfaceMessages::interface_error,
+                                  "Badly formatted binary checkpoint section JEOD_allocations\n"
+                                  "Skipping processing of the rest of the section.");
+        }
+        return;
+    }
+
     // Read the JEOD_allocations section of the input checkpoint file.
     // This section comprises lines of the form <type> <name>[size].
-    while(std::getline(reader, line))
+    // The first line was read above.
+    for(bool have_line = !line.empty(); have_line; have_line = static_cast<bool>(std::getline(reader, line)))
     {
         // Skip blank lines.
         if(line.length() != 0)
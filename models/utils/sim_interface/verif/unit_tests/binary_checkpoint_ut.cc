@@ -0,0 +1,166 @@
+/*
+ * binary_checkpoint_ut.cc
+ */
+
+#include "utils/container/include/primitive_list.hh"
+#include "utils/container/include/primitive_vector.hh"
+#include "utils/sim_interface/include/binary_checkpoint.hh"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+using namespace jeod;
+
+TEST(BinaryCheckpointWriter, create)
+{
+    std::ostringstream stream;
+    BinaryCheckpointWriter staticInst(stream, false);
+    BinaryCheckpointWriter * dynInst = new BinaryCheckpointWriter(stream, true);
+    delete dynInst;
+}
+
+TEST(BinaryCheckpointWriter, write)
+{
+    // Small blocks put values across block boundaries, and newline bytes
+    // must not start lines in the section.
+    for(bool compress : {false, true})
+    {
+        std::stringstream stream;
+        {
+            BinaryCheckpointWriter writer(stream, compress, 7);
+            for(uint32_t ii = 0; ii < 1000; ++ii)
+            {
+                writer.write_u32(ii % 20 == 0 ? 0x0a0a0a0a : ii);
+                writer.write_string(std::string(ii % 13, '\n'));
+            }
+        }
+        std::string line;
+        std::getline(stream, line);
+        while(std::getline(stream, line))
+        {
+            ASSERT_FALSE(line.empty());
+            EXPECT_EQ('\x01', line[0]);
+        }
+
+        stream.clear();
+        stream.seekg(0);
+        ASSERT_TRUE(BinaryCheckpointReader::is_binary_section(stream, line));
+        BinaryCheckpointReader reader(stream);
+        for(uint32_t ii = 0; ii < 1000; ++ii)
+        {
+            uint32_t value;
+            std::string text;
+            ASSERT_TRUE(reader.read_u32(value));
+            ASSERT_TRUE(reader.read_string(text));
+            EXPECT_EQ(ii % 20 == 0 ? 0x0a0a0a0a : ii, value);
+            EXPECT_EQ(std::string(ii % 13, '\n'), text);
+        }
+        EXPECT_TRUE(reader.at_end());
+        EXPECT_TRUE(reader.good());
+    }
+}
+
+TEST(BinaryCheckpointWriter, write_checkpointable)
+{
+    JeodPrimitiveVector<double>::type vec;
+    JeodPrimitiveList<int>::type list;
+    JeodPrimitiveVector<std::string>::type strings;
+    for(int ii = 0; ii < 10000; ++ii)
+    {
+        vec.push_back(ii * 0.1);
+        list.push_back(-ii);
+    }
+    strings.push_back("a(b);\n");
+
+    for(bool compress : {false, true})
+    {
+        std::stringstream stream;
+        {
+            BinaryCheckpointWriter writer(stream, compress);
+            writer.write_checkpointable("vec", vec);
+            writer.write_checkpointable("list", list);
+            writer.write_checkpointable("strings", strings);
+        }
+
+        JeodPrimitiveVector<double>::type vec_out;
+        JeodPrimitiveList<int>::type list_out;
+        JeodPrimitiveVector<std::string>::type strings_out;
+        vec_out.push_back(1.0);
+
+        std::string ident;
+        ASSERT_TRUE(BinaryCheckpointReader::is_binary_section(stream, ident));
+        BinaryCheckpointReader reader(stream);
+        ASSERT_TRUE(reader.read_string(ident));
+        EXPECT_EQ("vec", ident);
+        EXPECT_EQ(0, reader.restore_checkpointable(&vec_out));
+        ASSERT_TRUE(reader.read_string(ident));
+        EXPECT_EQ("list", ident);
+        EXPECT_EQ(0, reader.restore_checkpointable(&list_out));
+        ASSERT_TRUE(reader.read_string(ident));
+        EXPECT_EQ("strings", ident);
+        EXPECT_EQ(0, reader.restore_checkpointable(&strings_out));
+        EXPECT_TRUE(reader.at_end());
+
+        EXPECT_TRUE(vec_out == vec);
+        EXPECT_TRUE(list_out == list);
+        EXPECT_TRUE(strings_out == strings);
+    }
+}
+
+TEST(BinaryCheckpointWriter, finish) {}
+
+TEST(BinaryCheckpointReader, is_binary_section)
+{
+    std::istringstream text("\n\nfoo.bar.insert(1);\n");
+    std::string line;
+    EXPECT_FALSE(BinaryCheckpointReader::is_binary_section(text, line));
+    EXPECT_EQ("foo.bar.insert(1);", line);
+}
+
+TEST(BinaryCheckpointReader, restore_checkpointable)
+{
+    JeodPrimitiveVector<double>::type vec;
+    vec.push_back(1.0);
+    std::stringstream stream;
+    {
+        BinaryCheckpointWriter writer(stream, false);
+        writer.write_checkpointable("vec", vec);
+    }
+
+    // A record that has no container is skipped.
+    std::string ident;
+    BinaryCheckpointReader::is_binary_section(stream, ident);
+    BinaryCheckpointReader reader(stream);
+    ASSERT_TRUE(reader.read_string(ident));
+    EXPECT_NE(0, reader.restore_checkpointable(nullptr));
+    EXPECT_TRUE(reader.good());
+    EXPECT_TRUE(reader.at_end());
+}
+
+TEST(BinaryCheckpointReader, read)
+{
+    std::stringstream stream;
+    {
+        BinaryCheckpointWriter writer(stream, true);
+        writer.write_u64(42);
+    }
+
+    // A truncated section fails.
+    std::string contents = stream.str();
+    std::istringstream truncated(contents.substr(0, contents.size() - 3));
+    std::string line;
+    ASSERT_TRUE(BinaryCheckpointReader::is_binary_section(truncated, line));
+    BinaryCheckpointReader reader(truncated);
+    uint64_t value;
+    EXPECT_FALSE(reader.read_u64(value));
+    EXPECT_FALSE(reader.good());
+    EXPECT_TRUE(reader.at_end());
+}
+
+TEST(BinaryCheckpointReader, skip) {}
+
+TEST(BinaryCheckpointReader, at_end) {}
@@ -0,0 +1,220 @@
+// Checkpoint and restore a set of large primitive vectors in the text form of
+// the JEOD_containers section and in the binary form, with and without block
+// compression. Report the time to write and to read each form and the size
+// of the file, and check that each form restores the contents bit for bit.
+// The text form is written and read as JeodTrick10MemoryInterface does.
+
+// System includes
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// JEOD includes
+#include "test_harness/include/cmdline_parser.hh"
+#include "test_harness/include/test_sim_interface.hh"
+#include "utils/container/include/primitive_vector.hh"
+#include "utils/sim_interface/include/binary_checkpoint.hh"
+#include "utils/sim_interface/include/checkpoint_input_manager.hh"
+#include "utils/sim_interface/include/checkpoint_output_manager.hh"
+
+using namespace std;
+using namespace jeod;
+
+using DoubleVector = JeodPrimitiveVector<double>::type;
+
+static const string section_start = "// ++++++++++ Start of section ";
+static const string section_end = "// ---------- End of section ";
+static const char * file_name = "checkpoint_format.ckpnt";
+
+enum Format
+{
+    Text,
+    Binary,
+    Compressed
+};
+
+static void checkpoint(Format format, vector<unique_ptr<DoubleVector>> & containers)
+{
+    CheckPointOutputManager manager(file_name, section_start, section_end);
+    SectionedOutputStream writer(manager.create_section_writer("JEOD_containers"));
+    writer.activate();
+
+    if(format == Text)
+    {
+        for(unsigned int ii = 0; ii < containers.size(); ++ii)
+        {
+            DoubleVector & checkpointable = *containers[ii];
+            string identifier = "sim.vec_" + to_string(ii);
+            writer << identifier << "." << checkpointable.get_init_name() << "(" << checkpointable.get_init_value()
+                   << ");\n";
+            for(checkpointable.start_checkpoint(); !checkpointable.is_checkpoint_finished();
+                checkpointable.advance_checkpoint())
+            {
+                writer << identifier << "." << checkpointable.get_item_name() << "("
+                       << checkpointable.get_item_value() << ");\n";
+            }
+            writer << identifier << "." << checkpointable.get_final_name() << "("
+                   << checkpointable.get_final_value() << ");\n";
+        }
+    }
+    else
+    {
+        BinaryCheckpointWriter binary_writer(writer, format == Compressed);
+        for(unsigned int ii = 0; ii < containers.size(); ++ii)
+        {
+            binary_writer.write_checkpointable("sim.vec_" + to_string(ii), *containers[ii]);
+        }
+        binary_writer.finish();
+    }
+
+    writer.deactivate();
+}
+
+static int restore(vector<unique_ptr<DoubleVector>> & containers)
+{
+    map<string, JeodCheckpointable *> container_map;
+    for(unsigned int ii = 0; ii < containers.size(); ++ii)
+    {
+        container_map["sim.vec_" + to_string(ii)] = containers[ii].get();
+    }
+
+    CheckPointInputManager manager(file_name, section_start, section_end);
+    SectionedInputStream reader(manager.create_section_reader("JEOD_containers"));
+    reader.activate();
+
+    int failures = 0;
+    string line;
+    if(BinaryCheckpointReader::is_binary_section(reader, line))
+    {
+        BinaryCheckpointReader binary_reader(reader);
+        string ident;
+        while(!binary_reader.at_end() && binary_reader.read_string(ident))
+        {
+            auto iter = container_map.find(ident);
+            JeodCheckpointable * checkpointable = (iter != container_map.end()) ? iter->second : nullptr;
+            failures += binary_reader.restore_checkpointable(checkpointable);
+        }
+        failures += binary_reader.good() ? 0 : 1;
+        return failures;
+    }
+
+    for(bool have_line = !line.empty(); have_line; have_line = static_cast<bool>(getline(reader, line)))
+    {
+        if(line.empty())
+        {
+            continue;
+        }
+        size_t open_paren = line.find_first_of('(');
+        size_t close_paren = line.find_last_of(')');
+        size_t last_dot = line.find_last_of('.', open_paren);
+        auto iter = container_map.find(line.substr(0, last_dot));
+        if((open_paren == string::npos) || (close_paren == string::npos) || (iter == container_map.end()))
+        {
+            ++failures;
+            continue;
+        }
+        failures += iter->second->perform_restore_action(line.substr(last_dot + 1, open_paren - last_dot - 1),
+                                                         line.substr(open_paren + 1, close_paren - open_paren - 1));
+    }
+    return failures;
+}
+
+int main(int argc, char * argv[])
+{
+    TestSimInterface test_sim_interface;
+    CmdlineParser cmdline_parser;
+    int num_containers;
+    int num_elements;
+    int num_reps;
+
+    cmdline_parser.add_int("NumContainers", 20, &num_containers);
+    cmdline_parser.add_int("NumElements", 250000, &num_elements);
+    cmdline_parser.add_int("NumReps", 3, &num_reps);
+    cmdline_parser.parse(argc, argv);
+
+    if(num_containers <= 0 || num_elements <= 0 || num_reps <= 0)
+    {
+        cerr << "NumContainers, NumElements, and NumReps must be positive." << endl;
+        return 1;
+    }
+
+    // Logged trajectories, smooth but with full-precision mantissas, and
+    // logged settings, which change now and then.
+    vector<unique_ptr<DoubleVector>> containers;
+    vector<unique_ptr<DoubleVector>> restored;
+    for(int ii = 0; ii < num_containers; ++ii)
+    {
+        containers.emplace_back(new DoubleVector);
+        restored.emplace_back(new DoubleVector);
+        for(int jj = 0; jj < num_elements; ++jj)
+        {
+            if(ii % 2 == 0)
+            {
+                containers.back()->push_back(6.7e6 * sin(1.0e-3 * jj + ii) + 1.0e-3 * jj);
+            }
+            else
+            {
+                containers.back()->push_back(0.1 * ii * (jj / 1000));
+            }
+        }
+    }
+
+    cout << "Containers: " << num_containers << ", elements per container: " << num_elements
+         << ", repetitions: " << num_reps << endl;
+    cout << setw(12) << "format" << setw(16) << "checkpoint ms" << setw(14) << "restore ms" << setw(14) << "size MB"
+         << setw(12) << "identical" << endl;
+
+    int rv = 0;
+    const char * format_names[] = {"text", "binary", "compressed"};
+    for(Format format : {Text, Binary, Compressed})
+    {
+        double write_ms = 0.0;
+        double read_ms = 0.0;
+        int failures = 0;
+        for(int rep = 0; rep < num_reps; ++rep)
+        {
+            auto start = chrono::steady_clock::now();
+            checkpoint(format, containers);
+            auto middle = chrono::steady_clock::now();
+            for(auto & container : restored)
+            {
+                container->push_back(-1.0);
+            }
+            failures += restore(restored);
+            auto stop = chrono::steady_clock::now();
+            write_ms += chrono::duration<double, milli>(middle - start).count() / num_reps;
+            read_ms += chrono::duration<double, milli>(stop - middle).count() / num_reps;
+        }
+
+        bool identical = (failures == 0);
+        for(int ii = 0; identical && ii < num_containers; ++ii)
+        {
+            const vector<double> & original = *containers[ii];
+            const vector<double> & copy = *restored[ii];
+            identical = (copy.size() == original.size()) &&
+                        (memcmp(copy.data(), original.data(), original.size() * sizeof(double)) == 0);
+        }
+
+        ifstream file(file_name, ios::binary | ios::ate);
+        double size_mb = static_cast<double>(file.tellg()) / (1024.0 * 1024.0);
+
+        cout << setw(12) << format_names[format] << fixed << setprecision(1) << setw(16) << write_ms << setw(14)
+             << read_ms << setw(14) << size_mb << setw(12) << (identical ? "yes" : "NO") << endl;
+
+        if(!identical)
+        {
+            rv = 1;
+        }
+    }
+
+    remove(file_name);
+    return rv;
+}
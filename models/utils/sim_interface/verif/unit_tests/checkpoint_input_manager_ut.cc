@@ -15,6 +15,8 @@ TEST(SectionedInputBuffer, activate) {}
 
 TEST(SectionedInputBuffer, underflow) {}
 
+TEST(SectionedInputBuffer, xsgetn) {}
+
 TEST(SectionedInputStream, create)
 {
     SectionedInputStream staticInst;
@@ -13,6 +13,8 @@ TEST(SectionedOutputBuffer, activate) {}
 
 TEST(SectionedOutputBuffer, overflow) {}
 
+TEST(SectionedOutputBuffer, xsputn) {}
+
 TEST(SectionedOutputStream, create)
 {
     SectionedOutputStream staticInst;
@@ -73,6 +73,7 @@ public:
 
 private:
     std::string header;
+    std::vector<double> table;
     double ** values{};
     unsigned int numRows{};
     unsigned int numCols{};
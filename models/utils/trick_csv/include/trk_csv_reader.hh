@@ -0,0 +1,166 @@
+//=============================================================================
+// Notices:
+//
+// Copyright © 2025 United States Government as represented by the Administrator
+// of the National Aeronautics and Space Administration.  All Rights Reserved.
+//
+//
+// Disclaimers:
+//
+// No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY OF
+// ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING, BUT NOT LIMITED
+// TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO SPECIFICATIONS, ANY
+// IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR
+// FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+// FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO THE
+// SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER, CONSTITUTE AN
+// ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT OF ANY RESULTS,
+// RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY OTHER APPLICATIONS
+// RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER, GOVERNMENT AGENCY
+// DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING THIRD-PARTY SOFTWARE,
+// IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT "AS IS."
+//
+// Waiver and Indemnity:  RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN ANY
+// LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+// INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+// USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+// UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+// PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+// ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+// AGREEMENT.
+//
+//=============================================================================
+//
+//
+#ifndef TRK_CSV_READER_HH
+#define TRK_CSV_READER_HH
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Reads a Trick CSV log file one row at a time.
+ *
+ * The file is memory mapped one chunk at a time, so the memory used does not
+ * grow with the size of the file. Only the selected columns of a row are
+ * converted to numbers, and only when the row is reached. Rows whose number
+ * of fields differs from the header's are skipped.
+ */
+class TrkCsvReader
+{
+public:
+    // Size of the chunk of the file that is mapped at once
+    static const std::size_t defaultChunkSize = 64 * 1024 * 1024;
+
+    // constructor
+    explicit TrkCsvReader(const std::string & fileName, std::size_t chunkSize = defaultChunkSize);
+
+    // Destructor
+    virtual ~TrkCsvReader();
+
+    // Unimplemented copy constructor and assignment operator
+    TrkCsvReader(const TrkCsvReader &) = delete;
+    TrkCsvReader & operator=(const TrkCsvReader &) = delete;
+
+    // Public methods
+    bool isOpen() const
+    {
+        return fd >= 0;
+    }
+
+    std::string getHeader() const
+    {
+        return header;
+    }
+
+    unsigned int getNumCols() const
+    {
+        return columnNames.size();
+    }
+
+    const std::vector<std::string> & getColumnNames() const
+    {
+        return columnNames;
+    }
+
+    unsigned int getNumSelected() const
+    {
+        return selected.size();
+    }
+
+    // Values of the selected columns of the current row
+    const double * getRow() const
+    {
+        return rowValues.data();
+    }
+
+    // Number of rows read since the last rewind
+    unsigned long getRowNumber() const
+    {
+        return rowNumber;
+    }
+
+    int findColumn(const std::string & name) const;
+    bool selectColumns(const std::vector<std::string> & names);
+    void selectColumns(const std::vector<unsigned int> & indices);
+    void selectAllColumns();
+
+    void rewind();
+    bool nextRow();
+
+    unsigned long readColumns(std::vector<std::vector<double>> & columns);
+    unsigned long readRows(std::vector<double> & values);
+
+private:
+    bool mapChunk(std::size_t offset, std::size_t minSize);
+    void unmapChunk();
+    bool findLine(const char *& begin, const char *& end);
+    bool parseRow(const char * begin, const char * end);
+
+    // File descriptor of the open file, or -1
+    int fd{-1};
+
+    // Size of the file, in bytes
+    std::size_t fileSize{};
+
+    // Size of the chunk of the file mapped at once, a multiple of the page size
+    std::size_t chunkSize{};
+
+    // Mapped part of the file
+    const char * chunk{};
+
+    // Offset in the file of the mapped part
+    std::size_t chunkOffset{};
+
+    // Size of the mapped part
+    std::size_t chunkLength{};
+
+    // Offset in the file of the first data row
+    std::size_t dataOffset{};
+
+    // Offset in the file of the next row
+    std::size_t position{};
+
+    // First line of the file
+    std::string header;
+
+    // Name of each column in the file, the header field less its units
+    std::vector<std::string> columnNames;
+
+    // File columns of the selected columns, in selection order
+    std::vector<unsigned int> selected;
+
+    // For each file column, its place among the selected columns or -1
+    std::vector<int> slotOfColumn;
+
+    // Values of the selected columns of the current row
+    std::vector<double> rowValues;
+
+    // Number of rows read since the last rewind
+    unsigned long rowNumber{};
+};
+
+#endif
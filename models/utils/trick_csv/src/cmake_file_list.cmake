@@ -2,6 +2,7 @@ set(SUBDIR ${CMAKE_CURRENT_LIST_DIR})
 
 set(SRCS
 read_trk_csv.cc
+trk_csv_reader.cc
 )
 
 foreach(SRC ${SRCS})
@@ -0,0 +1,331 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../include/trk_csv_reader.hh"
+
+using namespace std;
+
+namespace
+{
+// Convert a field of a row, copied so that strtod stops at its end.
+double parseValue(const char * begin, const char * end)
+{
+    char buffer[64];
+    auto length = static_cast<size_t>(end - begin);
+    if(length >= sizeof(buffer))
+    {
+        return strtod(string(begin, end).c_str(), nullptr);
+    }
+    memcpy(buffer, begin, length);
+    buffer[length] = '\0';
+    return strtod(buffer, nullptr);
+}
+
+// The name of a column is its header field less the units in braces.
+string columnName(const char * begin, const char * end)
+{
+    const char * brace = static_cast<const char *>(memchr(begin, '{', end - begin));
+    if(brace != nullptr)
+    {
+        end = brace;
+    }
+    while((begin < end) && (*begin == ' '))
+    {
+        ++begin;
+    }
+    while((end > begin) && (end[-1] == ' '))
+    {
+        --end;
+    }
+    return string(begin, end);
+}
+} // namespace
+
+TrkCsvReader::TrkCsvReader(const string & fileName, size_t chunkSizeIn)
+{
+    fd = open(fileName.c_str(), O_RDONLY); // flawfinder: ignore
+    if(fd < 0)
+    {
+        return;
+    }
+
+    struct stat fileStat;
+    if(fstat(fd, &fileStat) != 0)
+    {
+        close(fd);
+        fd = -1;
+        return;
+    }
+    fileSize = static_cast<size_t>(fileStat.st_size);
+
+    auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    chunkSize = ((chunkSizeIn + pageSize - 1) / pageSize) * pageSize;
+    if(chunkSize == 0)
+    {
+        chunkSize = pageSize;
+    }
+
+    const char * begin;
+    const char * end;
+    if(findLine(begin, end))
+    {
+        header.assign(begin, end);
+        const char * field = begin;
+        while(true)
+        {
+            const char * comma = static_cast<const char *>(memchr(field, ',', end - field));
+            columnNames.push_back(columnName(field, (comma != nullptr) ? comma : end));
+            if(comma == nullptr)
+            {
+                break;
+            }
+            field = comma + 1;
+        }
+    }
+    dataOffset = position;
+    selectAllColumns();
+}
+
+TrkCsvReader::~TrkCsvReader()
+{
+    unmapChunk();
+    if(fd >= 0)
+    {
+        close(fd);
+    }
+}
+
+/**
+ * Find a column by name, the header field less its units.
+ * @return The column's index in the file, or -1 if there is no such column
+ */
+int TrkCsvReader::findColumn(const string & name) const
+{
+    for(unsigned int ii = 0; ii < columnNames.size(); ++ii)
+    {
+        if(columnNames[ii] == name)
+        {
+            return static_cast<int>(ii);
+        }
+    }
+    return -1;
+}
+
+/**
+ * Select the columns to be read by name. The selection is unchanged if any
+ * of the names is not found.
+ * @return True if every column was found
+ */
+bool TrkCsvReader::selectColumns(const vector<string> & names)
+{
+    vector<unsigned int> indices;
+    for(const auto & name : names)
+    {
+        int index = findColumn(name);
+        if(index < 0)
+        {
+            return false;
+        }
+        indices.push_back(index);
+    }
+    selectColumns(indices);
+    return true;
+}
+
+/**
+ * Select the columns to be read by their indices in the file. Indices past
+ * the last column are ignored.
+ */
+void TrkCsvReader::selectColumns(const vector<unsigned int> & indices)
+{
+    selected.clear();
+    slotOfColumn.assign(columnNames.size(), -1);
+    for(unsigned int index : indices)
+    {
+        if(index < columnNames.size())
+        {
+            slotOfColumn[index] = selected.size();
+            selected.push_back(index);
+        }
+    }
+    rowValues.assign(selected.size(), 0.0);
+}
+
+void TrkCsvReader::selectAllColumns()
+{
+    vector<unsigned int> indices(columnNames.size());
+    for(unsigned int ii = 0; ii < indices.size(); ++ii)
+    {
+        indices[ii] = ii;
+    }
+    selectColumns(indices);
+}
+
+/**
+ * Return to the first data row.
+ */
+void TrkCsvReader::rewind()
+{
+    position = dataOffset;
+    rowNumber = 0;
+}
+
+/**
+ * Advance to the next row with the same number of fields as the header.
+ * @return False at the end of the file
+ */
+bool TrkCsvReader::nextRow()
+{
+    const char * begin;
+    const char * end;
+    while(findLine(begin, end))
+    {
+        if((begin < end) && parseRow(begin, end))
+        {
+            ++rowNumber;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Read the selected columns of every row, one contiguous array per column.
+ * @return The number of rows
+ */
+unsigned long TrkCsvReader::readColumns(vector<vector<double>> & columns)
+{
+    columns.assign(selected.size(), vector<double>());
+    rewind();
+    while(nextRow())
+    {
+        for(unsigned int ii = 0; ii < selected.size(); ++ii)
+        {
+            columns[ii].push_back(rowValues[ii]);
+        }
+    }
+    return rowNumber;
+}
+
+/**
+ * Read the selected columns of every row, row after row.
+ * @return The number of rows
+ */
+unsigned long TrkCsvReader::readRows(vector<double> & values)
+{
+    values.clear();
+    rewind();
+    while(nextRow())
+    {
+        values.insert(values.end(), rowValues.begin(), rowValues.end());
+    }
+    return rowNumber;
+}
+
+/**
+ * Map the chunk of the file that starts at the page containing offset, of
+ * at least minSize bytes past offset unless the file ends first.
+ */
+bool TrkCsvReader::mapChunk(size_t offset, size_t minSize)
+{
+    unmapChunk();
+    auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t start = (offset / pageSize) * pageSize;
+    size_t length = max(chunkSize, minSize + (offset - start));
+    length = min(length, fileSize - start);
+
+    void * addr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, start);
+    if(addr == MAP_FAILED)
+    {
+        return false;
+    }
+    madvise(addr, length, MADV_SEQUENTIAL);
+    chunk = static_cast<const char *>(addr);
+    chunkOffset = start;
+    chunkLength = length;
+    return true;
+}
+
+void TrkCsvReader::unmapChunk()
+{
+    if(chunk != nullptr)
+    {
+        munmap(const_cast<char *>(chunk), chunkLength);
+        chunk = nullptr;
+        chunkLength = 0;
+    }
+}
+
+/**
+ * Find the line that starts at position, less its line ending, and move
+ * position to the start of the following line. A line that runs past the
+ * mapped chunk is mapped again from its start, in a larger chunk if need be.
+ * @return False at the end of the file
+ */
+bool TrkCsvReader::findLine(const char *& begin, const char *& end)
+{
+    if((fd < 0) || (position >= fileSize))
+    {
+        return false;
+    }
+    if((chunk == nullptr) || (position < chunkOffset) || (position >= chunkOffset + chunkLength))
+    {
+        if(!mapChunk(position, 0))
+        {
+            return false;
+        }
+    }
+
+    begin = chunk + (position - chunkOffset);
+    const char * limit = chunk + chunkLength;
+    const char * newline = static_cast<const char *>(memchr(begin, '\n', limit - begin));
+    while((newline == nullptr) && (chunkOffset + chunkLength < fileSize))
+    {
+        if(!mapChunk(position, 2 * static_cast<size_t>(limit - begin)))
+        {
+            return false;
+        }
+        begin = chunk + (position - chunkOffset);
+        limit = chunk + chunkLength;
+        newline = static_cast<const char *>(memchr(begin, '\n', limit - begin));
+    }
+
+    end = (newline != nullptr) ? newline : limit;
+    position = chunkOffset + (end - chunk) + 1;
+    if((end > begin) && (end[-1] == '\r'))
+    {
+        --end;
+    }
+    return true;
+}
+
+/**
+ * Convert the selected fields of a row.
+ * @return True if the row has as many fields as the header
+ */
+bool TrkCsvReader::parseRow(const char * begin, const char * end)
+{
+    unsigned int numCols = columnNames.size();
+    unsigned int col = 0;
+    const char * field = begin;
+    while(true)
+    {
+        const char * comma = static_cast<const char *>(memchr(field, ',', end - field));
+        if((col < numCols) && (slotOfColumn[col] >= 0))
+        {
+            rowValues[slotOfColumn[col]] = parseValue(field, (comma != nullptr) ? comma : end);
+        }
+        ++col;
+        if(comma == nullptr)
+        {
+            break;
+        }
+        field = comma + 1;
+    }
+    return col == numCols;
+}
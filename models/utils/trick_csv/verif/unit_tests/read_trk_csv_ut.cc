@@ -7,4 +7,25 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
-TEST(ReadTrkCsv, create) {}
+#include <cstdio>
+#include <fstream>
+
+TEST(ReadTrkCsv, create)
+{
+    const char * fileName = "read_trk_csv_ut.csv";
+    {
+        std::ofstream ofs(fileName);
+        ofs << "sys.exec.out.time {s},dyn.veh.x {m}\n";
+        for(unsigned int ii = 0; ii < 10; ++ii)
+        {
+            ofs << ii * 0.5 << "," << 2.0 * ii << "\n";
+        }
+    }
+    ReadTrkCsv table(fileName);
+    std::remove(fileName);
+
+    EXPECT_EQ(10, table.getNumRows());
+    EXPECT_EQ(2, table.getNumCols());
+    EXPECT_DOUBLE_EQ(18.0, table.getValues()[9][1]);
+    EXPECT_DOUBLE_EQ(4.5, table.getValues()[9][0]);
+}
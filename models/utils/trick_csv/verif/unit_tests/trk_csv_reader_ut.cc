@@ -0,0 +1,91 @@
+/*
+ * trk_csv_reader_ut.cc
+ */
+
+#include "utils/trick_csv/include/trk_csv_reader.hh"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Write a log of numRows rows: time, then x = 2 * row and a long label column.
+std::string writeLog(unsigned int numRows)
+{
+    std::string fileName = "trk_csv_reader_ut.csv";
+    std::ofstream ofs(fileName);
+    ofs << "sys.exec.out.time {s},dyn.veh.x {m},dyn.veh.label {--}\n";
+    for(unsigned int ii = 0; ii < numRows; ++ii)
+    {
+        ofs << ii * 0.5 << "," << 2.0 * ii << "," << std::string(100, '7') << "\n";
+        if(ii == 3)
+        {
+            ofs << "1,2\n";
+        }
+    }
+    return fileName;
+}
+} // namespace
+
+TEST(TrkCsvReader, create)
+{
+    std::string fileName = writeLog(5);
+    TrkCsvReader reader(fileName);
+    ASSERT_TRUE(reader.isOpen());
+    EXPECT_EQ(3u, reader.getNumCols());
+    EXPECT_EQ(1, reader.findColumn("dyn.veh.x"));
+    EXPECT_EQ(-1, reader.findColumn("dyn.veh.y"));
+    std::remove(fileName.c_str());
+
+    TrkCsvReader missing("no_such_file.csv");
+    EXPECT_FALSE(missing.isOpen());
+    EXPECT_FALSE(missing.nextRow());
+}
+
+TEST(TrkCsvReader, nextRow)
+{
+    std::string fileName = writeLog(1000);
+    // A chunk of one page makes the rows run across chunk boundaries.
+    TrkCsvReader reader(fileName, 1);
+    ASSERT_TRUE(reader.selectColumns(std::vector<std::string>{"dyn.veh.x", "sys.exec.out.time"}));
+    EXPECT_FALSE(reader.selectColumns(std::vector<std::string>{"dyn.veh.y"}));
+    EXPECT_EQ(2u, reader.getNumSelected());
+
+    unsigned int numRows = 0;
+    while(reader.nextRow())
+    {
+        EXPECT_DOUBLE_EQ(2.0 * numRows, reader.getRow()[0]);
+        EXPECT_DOUBLE_EQ(0.5 * numRows, reader.getRow()[1]);
+        ++numRows;
+    }
+    EXPECT_EQ(1000u, numRows);
+    EXPECT_EQ(1000u, reader.getRowNumber());
+
+    reader.rewind();
+    ASSERT_TRUE(reader.nextRow());
+    EXPECT_DOUBLE_EQ(0.0, reader.getRow()[0]);
+    std::remove(fileName.c_str());
+}
+
+TEST(TrkCsvReader, readColumns)
+{
+    std::string fileName = writeLog(100);
+    TrkCsvReader reader(fileName);
+    std::vector<std::vector<double>> columns;
+    EXPECT_EQ(100u, reader.readColumns(columns));
+    ASSERT_EQ(3u, columns.size());
+    EXPECT_DOUBLE_EQ(198.0, columns[1][99]);
+    EXPECT_DOUBLE_EQ(49.5, columns[0][99]);
+
+    std::vector<double> values;
+    reader.selectColumns(std::vector<unsigned int>{1});
+    EXPECT_EQ(100u, reader.readRows(values));
+    ASSERT_EQ(100u, values.size());
+    EXPECT_DOUBLE_EQ(20.0, values[10]);
+    std::remove(fileName.c_str());
+}